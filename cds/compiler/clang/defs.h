@@ -118,6 +118,9 @@
 #define cds_likely( expr )   __builtin_expect( !!( expr ), 1 )
 #define cds_unlikely( expr ) __builtin_expect( !!( expr ), 0 )
 
+// prefetch for reading, keep in all cache levels
+#define cds_prefetch( addr ) __builtin_prefetch( (addr), 0, 3 )
+
 // Exceptions
 #if defined( __EXCEPTIONS ) && __EXCEPTIONS == 1
 #   define CDS_EXCEPTION_ENABLED
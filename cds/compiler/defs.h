@@ -65,6 +65,10 @@
 #   define cds_unlikely( expr ) expr
 #endif
 
+#ifndef cds_prefetch
+#   define cds_prefetch( addr ) ((void)(addr))
+#endif
+
 //if constexpr support (C++17)
 #ifndef constexpr_if
 #   define constexpr_if if
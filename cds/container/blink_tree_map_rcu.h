@@ -0,0 +1,1630 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2017
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef CDSLIB_CONTAINER_BLINK_TREE_MAP_RCU_H
+#define CDSLIB_CONTAINER_BLINK_TREE_MAP_RCU_H
+
+#include <functional> // ref
+#include <cds/container/details/blink_tree_base.h>
+#include <cds/urcu/details/check_deadlock.h>
+#include <cds/urcu/exempt_ptr.h>
+#include <cds/details/allocator.h>
+
+namespace cds { namespace container {
+
+    /// B-link tree map (RCU specialization)
+    /** @ingroup cds_nonintrusive_map
+        @ingroup cds_nonintrusive_tree
+        @anchor cds_container_BLinkTreeMap_rcu
+
+        Source:
+            - [1981] P.Lehman, S.B.Yao "Efficient Locking for Concurrent Operations on B-Trees"
+            - [2016] V.Leis, F.Scheibner, A.Kemper, T.Neumann "The ART of Practical Synchronization"
+
+        %BLinkTreeMap is a B+tree where every node has a link to its right sibling and a high key,
+        the upper bound of the keys in the node. All items of type <tt>std::pair<Key const, T></tt>
+        are referenced from the leaves, inner nodes contain separator keys only.
+        Unlike \ref cds_container_EllenBinTreeMap_rcu "EllenBinTreeMap" and \ref cds_container_BronsonAVLTreeMap_rcu "BronsonAVLTreeMap"
+        that store one key per node, a node of %BLinkTreeMap keeps the sorted array of keys in one block
+        which size is a multiple of the cache line, see \p blink_tree::node_size option.
+        So, a lookup loads a few cache lines per tree level and the tree height is <tt>O(log N)</tt>
+        with the base equal to the node capacity.
+
+        The keys of a node are never changed in place. A writer builds a new copy of the key block
+        and publishes it by an atomic pointer store, the old block is retired by RCU. Thus:
+        - \p find(), \p contains(), \p get() and \p for_each_in_range() are lock-free.
+          A reader descends from the root under RCU lock only, if the key is not less than
+          the high key of a node (the node has been split concurrently) the reader moves to the right sibling;
+        - a writer descends optimistically in the same way, then it locks the leaf only and moves right
+          with lock coupling if the leaf has been split. When the leaf overflows, it is split into two nodes
+          and the separator is inserted into the parent level after the leaf is unlocked. Thus,
+          a writer holds at most two node locks on the same level at any time.
+
+        The nodes are not merged as in original Lehman-Yao algorithm. When a removal empties a leaf,
+        the leaf is unlinked if its left sibling has the same parent: under the locks of the parent,
+        the left sibling and the leaf, the left sibling takes over the key range of the leaf and
+        the separator is removed from the parent. The leaf unlinked is retired by RCU, a writer that
+        has reached it re-descends from the root. Otherwise (the leaf is the first child of its parent)
+        the empty leaf is kept in the tree and is reused by following insertions.
+        The inner nodes are freed in the destructor only.
+
+        The tree can act as a <i>priority queue</i> by \p extract_min() and \p extract_max() member functions.
+        The map keeps the lower and the upper bound of its keys, so these functions do not scan again
+        the leaves emptied by previous calls.
+
+        <b>Template arguments</b> :
+        - \p RCU - one of \ref cds_urcu_gc "RCU type"
+        - \p Key - key type. The key is copied into the key blocks, so it should be copy-constructible
+            and preferably small
+        - \p T - value type to be stored in the map
+        - \p Traits - map traits, default is \p blink_tree::traits.
+            It is possible to declare option-based tree with \p blink_tree::make_traits metafunction
+            instead of \p Traits template argument.
+
+        @note Before including <tt><cds/container/blink_tree_map_rcu.h></tt> you should include appropriate RCU header file,
+        see \ref cds_urcu_gc "RCU type" for list of existing RCU class and corresponding header files.
+    */
+    template <
+        class RCU,
+        typename Key,
+        typename T,
+#ifdef CDS_DOXYGEN_INVOKED
+        class Traits = blink_tree::traits
+#else
+        class Traits
+#endif
+    >
+    class BLinkTreeMap< cds::urcu::gc<RCU>, Key, T, Traits >
+    {
+    public:
+        typedef cds::urcu::gc<RCU>  gc;   ///< RCU Garbage collector
+        typedef Key     key_type;    ///< type of a key stored in the map
+        typedef T       mapped_type; ///< type of value stored in the map
+        typedef std::pair< key_type const, mapped_type > value_type;   ///< Key-value pair stored in the map
+        typedef Traits  traits;      ///< Traits template parameter
+
+#   ifdef CDS_DOXYGEN_INVOKED
+        typedef implementation_defined key_comparator;    ///< key compare functor based on \p Traits::compare and \p Traits::less
+#   else
+        typedef typename opt::details::make_comparator< key_type, traits >::type key_comparator;
+#endif
+        typedef typename traits::item_counter           item_counter;       ///< Item counting policy
+        typedef typename traits::memory_model           memory_model;       ///< Memory ordering, see \p cds::opt::memory_model option
+        typedef typename traits::node_allocator         node_allocator_type; ///< allocator for tree nodes
+        typedef typename traits::block_allocator        block_allocator_type; ///< aligned allocator for key blocks
+        typedef typename traits::allocator              allocator_type;     ///< allocator for map items
+        typedef typename traits::lock_type              lock_type;          ///< node lock type
+        typedef typename traits::stat                   stat;               ///< internal statistics
+        typedef typename traits::rcu_check_deadlock     rcu_check_deadlock; ///< Deadlock checking policy
+
+        /// Group of \p extract_xxx functions does not require external locking
+        static constexpr const bool c_bExtractLockExternal = false;
+
+    protected:
+        //@cond
+        typedef typename std::aligned_storage< sizeof( key_type ), std::alignment_of< key_type >::value >::type key_storage;
+
+        static constexpr size_t const c_nNodeSize = ( static_cast<size_t>( traits::node_size ) + cds::c_nCacheLineSize - 1 ) / cds::c_nCacheLineSize * cds::c_nCacheLineSize;
+        static constexpr size_t const c_nBlockHeaderSize = sizeof( void * ) + 2 * sizeof( unsigned ) + sizeof( key_storage );
+        static constexpr size_t const c_nEntrySize = sizeof( key_storage ) + sizeof( void * );
+        static constexpr size_t const c_nMaxHeight = 64;
+        //@endcond
+
+    public:
+        /// Max number of keys in a leaf node and max number of children of an inner node
+        static constexpr size_t const c_nCapacity = c_nNodeSize > c_nBlockHeaderSize + 4 * c_nEntrySize
+            ? ( c_nNodeSize - c_nBlockHeaderSize ) / c_nEntrySize
+            : 4;
+
+    protected:
+        //@cond
+        struct node;
+
+        // Immutable key block of a node
+        struct alignas( cds::c_nCacheLineSize ) block
+        {
+            node *      m_pRight;   // right sibling, nullptr for the rightmost node of the level
+            unsigned    m_nCount;   // item count for a leaf, child count for an inner node
+            unsigned    m_nKeys;    // key count: m_nCount for a leaf, m_nCount - 1 for an inner node
+            key_storage m_High;     // high key, valid if m_pRight != nullptr
+            key_storage m_Keys[c_nCapacity];
+            void *      m_Ptr[c_nCapacity]; // value_type * for a leaf, node * for an inner node
+
+            key_type const& key( size_t i ) const
+            {
+                assert( i < m_nKeys );
+                return *reinterpret_cast<key_type const *>( &m_Keys[i] );
+            }
+
+            key_type const& high() const
+            {
+                assert( m_pRight != nullptr );
+                return *reinterpret_cast<key_type const *>( &m_High );
+            }
+
+            value_type * value( size_t i ) const
+            {
+                return static_cast<value_type *>( m_Ptr[i] );
+            }
+
+            node * child( size_t i ) const
+            {
+                return static_cast<node *>( m_Ptr[i] );
+            }
+        };
+
+        struct node
+        {
+            atomics::atomic< block * > m_pBlock; // current key block
+            lock_type       m_Lock;     // held by a writer replacing the block
+            unsigned const  m_nLevel;   // 0 for a leaf
+            bool const      m_bLow;     // false for the leftmost node of the level
+            bool            m_bUnlinked; // the leaf has been unlinked, guarded by m_Lock
+            key_storage     m_Low;      // low key, the separator between the node and its left sibling
+
+            node( unsigned nLevel, block * pBlock )
+                : m_pBlock( pBlock )
+                , m_nLevel( nLevel )
+                , m_bLow( false )
+                , m_bUnlinked( false )
+            {}
+
+            node( unsigned nLevel, block * pBlock, key_type const& low )
+                : m_pBlock( pBlock )
+                , m_nLevel( nLevel )
+                , m_bLow( true )
+                , m_bUnlinked( false )
+            {
+                new( &m_Low ) key_type( low );
+            }
+
+            ~node()
+            {
+                if ( m_bLow )
+                    low().~key_type();
+            }
+
+            key_type const& low() const
+            {
+                assert( m_bLow );
+                return *reinterpret_cast<key_type const *>( &m_Low );
+            }
+        };
+
+        typedef cds::details::Allocator< node, node_allocator_type >  cxx_node_allocator;
+        typedef cds::details::Allocator< value_type, allocator_type > cxx_value_allocator;
+        typedef typename block_allocator_type::template rebind< block >::other cxx_block_allocator;
+        typedef cds::urcu::details::check_deadlock_policy< gc, rcu_check_deadlock > check_deadlock_policy;
+
+        struct value_disposer
+        {
+            void operator()( value_type * p ) const
+            {
+                cxx_value_allocator().Delete( p );
+            }
+        };
+        //@endcond
+
+    public:
+        typedef typename gc::scoped_lock    rcu_lock;  ///< RCU scoped lock
+
+        /// Pointer to extracted item
+#   ifdef CDS_DOXYGEN_INVOKED
+        typedef cds::urcu::exempt_ptr< gc, value_type, value_type, implementation_defined, void > exempt_ptr;
+#   else
+        typedef cds::urcu::exempt_ptr< gc, value_type, value_type, value_disposer, void > exempt_ptr;
+#   endif
+
+    protected:
+        //@cond
+        class rcu_disposer
+        {
+            block *      m_arrBlock[c_nMaxHeight + 1];
+            value_type * m_arrValue[c_nCapacity];
+            unsigned     m_nBlockCount;
+            unsigned     m_nValueCount;
+            node *       m_pNode;   // the leaf unlinked
+
+        public:
+            rcu_disposer()
+                : m_nBlockCount( 0 )
+                , m_nValueCount( 0 )
+                , m_pNode( nullptr )
+            {}
+
+            ~rcu_disposer()
+            {
+                clean();
+            }
+
+            void dispose( block * p )
+            {
+                assert( m_nBlockCount < sizeof( m_arrBlock ) / sizeof( m_arrBlock[0] ));
+                m_arrBlock[m_nBlockCount++] = p;
+            }
+
+            void dispose_value( value_type * p )
+            {
+                assert( m_nValueCount < c_nCapacity );
+                m_arrValue[m_nValueCount++] = p;
+            }
+
+            // The node is freed with its last block
+            void dispose_node( node * p )
+            {
+                assert( m_pNode == nullptr );
+                m_pNode = p;
+            }
+
+        private:
+            struct block_disposer
+            {
+                void operator()( block * p ) const
+                {
+                    free_block( p );
+                }
+            };
+
+            struct node_disposer
+            {
+                void operator()( node * p ) const
+                {
+                    free_block( p->m_pBlock.load( atomics::memory_order_relaxed ));
+                    cxx_node_allocator().Delete( p );
+                }
+            };
+
+            void clean()
+            {
+                assert( !gc::is_locked());
+
+                if ( m_nBlockCount + m_nValueCount ) {
+                    unsigned nBlock = 0;
+                    unsigned nValue = 0;
+                    auto f = [this, &nBlock, &nValue]() -> cds::urcu::retired_ptr {
+                        if ( nBlock < m_nBlockCount )
+                            return cds::urcu::make_retired_ptr<block_disposer>( m_arrBlock[nBlock++] );
+                        if ( nValue < m_nValueCount )
+                            return cds::urcu::make_retired_ptr<value_disposer>( m_arrValue[nValue++] );
+                        return cds::urcu::make_retired_ptr<block_disposer>( static_cast<block *>( nullptr ));
+                    };
+                    gc::batch_retire( std::ref( f ));
+                }
+
+                if ( m_pNode )
+                    gc::template retire_ptr<node_disposer>( m_pNode );
+            }
+        };
+        //@endcond
+
+    protected:
+        //@cond
+        atomics::atomic< node * >   m_pRoot;
+        atomics::atomic< node * >   m_pMinBound;    // the map has no keys less than m_pMinBound->low()
+        atomics::atomic< node * >   m_pMaxBound;    // the map has no keys greater than or equal to m_pMaxBound->low()
+        item_counter                m_ItemCounter;
+        mutable lock_type           m_RootLock;
+        mutable stat                m_stat;
+        //@endcond
+
+    public:
+        /// Creates empty map
+        BLinkTreeMap()
+            : m_pRoot( cxx_node_allocator().New( 0u, alloc_block( nullptr, nullptr )))
+            , m_pMinBound( nullptr )
+            , m_pMaxBound( nullptr )
+        {}
+
+        /// Destroys the map
+        /**
+            The function frees all nodes and items of the map, it is not thread-safe.
+        */
+        ~BLinkTreeMap()
+        {
+            node * pLevel = m_pRoot.load( memory_model::memory_order_relaxed );
+            while ( pLevel ) {
+                node * pDown = pLevel->m_nLevel ? pLevel->m_pBlock.load( memory_model::memory_order_relaxed )->child( 0 ) : nullptr;
+                for ( node * pNode = pLevel; pNode; ) {
+                    block * pBlock = pNode->m_pBlock.load( memory_model::memory_order_relaxed );
+                    node * pNext = pBlock->m_pRight;
+                    if ( pNode->m_nLevel == 0 ) {
+                        for ( unsigned i = 0; i < pBlock->m_nCount; ++i )
+                            cxx_value_allocator().Delete( pBlock->value( i ));
+                    }
+                    free_block( pBlock );
+                    cxx_node_allocator().Delete( pNode );
+                    pNode = pNext;
+                }
+                pLevel = pDown;
+            }
+        }
+
+        /// Inserts new node with key and default value
+        /**
+            The function creates an item with \p key and default value, and then inserts the item into the map.
+
+            Preconditions:
+            - The \p key_type should be constructible from a value of type \p K.
+            - The \p mapped_type should be default-constructible.
+
+            RCU \p synchronize() can be called. RCU should not be locked.
+
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename K>
+        bool insert( K const& key )
+        {
+            return insert_with( key, []( value_type& ) {} );
+        }
+
+        /// Inserts new node
+        /**
+            The function creates an item with copy of \p val value
+            and then inserts the item into the map.
+
+            Preconditions:
+            - The \p key_type should be constructible from \p key of type \p K.
+            - The \p mapped_type should be constructible from \p val of type \p V.
+
+            RCU \p synchronize() method can be called. RCU should not be locked.
+
+            Returns \p true if \p val is inserted into the map, \p false otherwise.
+        */
+        template <typename K, typename V>
+        bool insert( K const& key, V const& val )
+        {
+            std::pair<bool, bool> res = do_update( key, key_comparator(),
+                [&key, &val]( value_type * pFound ) -> value_type * {
+                    return pFound ? nullptr : cxx_value_allocator().MoveNew( key_type( key ), mapped_type( val ));
+                });
+            if ( res.second )
+                m_stat.onInsertSuccess();
+            else
+                m_stat.onInsertFailed();
+            return res.second;
+        }
+
+        /// Inserts new node and initialize it by a functor
+        /**
+            This function inserts new item with key \p key and if inserting is successful then it calls
+            \p func functor with signature
+            \code
+                struct functor {
+                    void operator()( value_type& item );
+                };
+            \endcode
+
+            The argument \p item of user-defined functor \p func is the reference
+            to the map's item inserted:
+                - <tt>item.first</tt> is a const reference to item's key that cannot be changed.
+                - <tt>item.second</tt> is a reference to item's value that may be changed.
+
+            The functor is called under the leaf lock before the item becomes visible for other threads.
+
+            RCU \p synchronize() method can be called. RCU should not be locked.
+        */
+        template <typename K, typename Func>
+        bool insert_with( K const& key, Func func )
+        {
+            std::pair<bool, bool> res = do_update( key, key_comparator(),
+                [&key, &func]( value_type * pFound ) -> value_type * {
+                    if ( pFound )
+                        return nullptr;
+                    value_type * pVal = cxx_value_allocator().MoveNew( key_type( key ), mapped_type());
+                    func( *pVal );
+                    return pVal;
+                });
+            if ( res.second )
+                m_stat.onInsertSuccess();
+            else
+                m_stat.onInsertFailed();
+            return res.second;
+        }
+
+        /// For key \p key inserts data of type \p value_type created in-place from \p args
+        /**
+            Returns \p true if inserting successful, \p false otherwise.
+
+            RCU \p synchronize() method can be called. RCU should not be locked.
+        */
+        template <typename K, typename... Args>
+        bool emplace( K&& key, Args&&... args )
+        {
+            value_type * pNew = cxx_value_allocator().MoveNew( key_type( std::forward<K>( key )), mapped_type( std::forward<Args>( args )... ));
+            std::pair<bool, bool> res = do_update( pNew->first, key_comparator(),
+                [pNew]( value_type * pFound ) -> value_type * {
+                    return pFound ? nullptr : pNew;
+                });
+            if ( res.second )
+                m_stat.onInsertSuccess();
+            else {
+                cxx_value_allocator().Delete( pNew );
+                m_stat.onInsertFailed();
+            }
+            return res.second;
+        }
+
+        /// Updates the value for \p key
+        /**
+            The operation performs inserting or changing data.
+
+            If \p key is not found in the map, then the new item is inserted iff \p bAllowInsert is \p true.
+            Otherwise, the functor \p func is called with item found.
+            The functor \p func signature is:
+            \code
+                struct my_functor {
+                    void operator()( bool bNew, value_type& item );
+                };
+            \endcode
+
+            with arguments:
+            - \p bNew - \p true if the item has been inserted, \p false otherwise
+            - \p item - item of the map
+
+            The functor is called under the leaf lock, it may change \p item.second.
+
+            RCU \p synchronize() method can be called. RCU should not be locked.
+
+            Returns std::pair<bool, bool> where \p first is \p true if operation is successful,
+            i.e. the node has been inserted or updated,
+            \p second is \p true if new item has been added or \p false if the item with \p key
+            already exists.
+        */
+        template <typename K, typename Func>
+        std::pair<bool, bool> update( K const& key, Func func, bool bAllowInsert = true )
+        {
+            std::pair<bool, bool> res = do_update( key, key_comparator(),
+                [&key, &func, bAllowInsert]( value_type * pFound ) -> value_type * {
+                    if ( pFound ) {
+                        func( false, *pFound );
+                        return nullptr;
+                    }
+                    if ( !bAllowInsert )
+                        return nullptr;
+                    value_type * pVal = cxx_value_allocator().MoveNew( key_type( key ), mapped_type());
+                    func( true, *pVal );
+                    return pVal;
+                });
+            if ( res.second )
+                m_stat.onUpdateNew();
+            else if ( res.first )
+                m_stat.onUpdateExisting();
+            else
+                m_stat.onUpdateFailed();
+            return res;
+        }
+
+        /// Delete \p key from the map
+        /**\anchor cds_nonintrusive_BLinkTreeMap_rcu_erase_val
+
+            RCU \p synchronize() method can be called. RCU should not be locked.
+
+            Return \p true if \p key is found and deleted, \p false otherwise
+        */
+        template <typename K>
+        bool erase( K const& key )
+        {
+            return erase( key, []( value_type& ) {} );
+        }
+
+        /// Deletes the item from the map using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_nonintrusive_BLinkTreeMap_rcu_erase_val "erase(K const&)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less>
+        bool erase_with( K const& key, Less pred )
+        {
+            return erase_with( key, pred, []( value_type& ) {} );
+        }
+
+        /// Delete \p key from the map
+        /** \anchor cds_nonintrusive_BLinkTreeMap_rcu_erase_func
+
+            The function searches an item with key \p key, calls \p f functor
+            and deletes the item. If \p key is not found, the functor is not called.
+
+            The functor \p Func interface:
+            \code
+            struct extractor {
+                void operator()(value_type& item) { ... }
+            };
+            \endcode
+
+            RCU \p synchronize method can be called. RCU should not be locked.
+
+            Return \p true if key is found and deleted, \p false otherwise
+        */
+        template <typename K, typename Func>
+        bool erase( K const& key, Func f )
+        {
+            if ( do_remove( key, key_comparator(), f, true )) {
+                m_stat.onEraseSuccess();
+                return true;
+            }
+            m_stat.onEraseFailed();
+            return false;
+        }
+
+        /// Deletes the item from the map using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_nonintrusive_BLinkTreeMap_rcu_erase_func "erase(K const&, Func)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less, typename Func>
+        bool erase_with( K const& key, Less pred, Func f )
+        {
+            CDS_UNUSED( pred );
+            if ( do_remove( key, cds::opt::details::make_comparator_from_less<Less>(), f, true )) {
+                m_stat.onEraseSuccess();
+                return true;
+            }
+            m_stat.onEraseFailed();
+            return false;
+        }
+
+        /// Extracts an item with minimal key from the map
+        /**
+            Returns \ref cds::urcu::exempt_ptr "exempt_ptr" pointer to the leftmost item.
+            If the map is empty, returns empty \p exempt_ptr.
+
+            @note Due the concurrent nature of the map, the function extracts <i>nearly</i> minimum key.
+            It means that the function locks the leftmost non-empty leaf and unlinks its first item.
+            Meanwhile, a concurrent thread may insert an item with key less than the key extracted.
+
+            RCU \p synchronize method can be called. RCU should NOT be locked.
+            The function does not free the item.
+            The deallocator will be implicitly invoked when the returned object is destroyed or when
+            its \p release() member function is called.
+        */
+        exempt_ptr extract_min()
+        {
+            return exempt_ptr( do_extract_min());
+        }
+
+        /// Extracts an item with maximal key from the map
+        /**
+            Returns \ref cds::urcu::exempt_ptr "exempt_ptr" pointer to the rightmost item.
+            If the map is empty, returns empty \p exempt_ptr.
+
+            @note Due the concurrent nature of the map, the function extracts <i>nearly</i> maximal key.
+            It means that the function locks the rightmost non-empty leaf and unlinks its last item.
+            Meanwhile, a concurrent thread may insert an item with key greater than the key extracted.
+
+            RCU \p synchronize method can be called. RCU should NOT be locked.
+            The function does not free the item.
+            The deallocator will be implicitly invoked when the returned object is destroyed or when
+            its \p release() member function is called.
+        */
+        exempt_ptr extract_max()
+        {
+            return exempt_ptr( do_extract_max());
+        }
+
+        /// Extracts an item from the map
+        /** \anchor cds_nonintrusive_BLinkTreeMap_rcu_extract
+            The function searches an item with key equal to \p key in the tree,
+            unlinks it, and returns \ref cds::urcu::exempt_ptr "exempt_ptr" pointer to an item found.
+            If \p key is not found the function returns an empty \p exempt_ptr.
+
+            RCU \p synchronize method can be called. RCU should NOT be locked.
+            The function does not destroy the item found.
+            The dealloctor will be implicitly invoked when the returned object is destroyed or when
+            its \p release() member function is called.
+        */
+        template <typename Q>
+        exempt_ptr extract( Q const& key )
+        {
+            value_type * pVal = do_remove( key, key_comparator(), []( value_type& ) {}, false );
+            if ( pVal )
+                m_stat.onExtractSuccess();
+            else
+                m_stat.onExtractFailed();
+            return exempt_ptr( pVal );
+        }
+
+        /// Extracts an item from the map using \p pred for searching
+        /**
+            The function is an analog of \p extract(Q const&)
+            but \p pred is used for key compare.
+            \p Less has the interface like \p std::less.
+            \p pred must imply the same element order as the comparator used for building the map.
+        */
+        template <typename Q, typename Less>
+        exempt_ptr extract_with( Q const& key, Less pred )
+        {
+            CDS_UNUSED( pred );
+            value_type * pVal = do_remove( key, cds::opt::details::make_comparator_from_less<Less>(), []( value_type& ) {}, false );
+            if ( pVal )
+                m_stat.onExtractSuccess();
+            else
+                m_stat.onExtractFailed();
+            return exempt_ptr( pVal );
+        }
+
+        /// Find the key \p key
+        /** \anchor cds_nonintrusive_BLinkTreeMap_rcu_find_cfunc
+
+            The function searches the item with key equal to \p key and calls the functor \p f for item found.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            where \p item is the item found.
+
+            The functor may change \p item.second. Note that the node is not locked,
+            the functor can be called concurrently with \p update() for the same item.
+
+            The function applies RCU lock internally.
+
+            The function returns \p true if \p key is found, \p false otherwise.
+        */
+        template <typename K, typename Func>
+        bool find( K const& key, Func f )
+        {
+            rcu_lock l;
+            value_type * pVal = do_find( key, key_comparator());
+            if ( pVal )
+                f( *pVal );
+            return pVal != nullptr;
+        }
+
+        /// Finds the key \p val using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_nonintrusive_BLinkTreeMap_rcu_find_cfunc "find(K const&, Func)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less, typename Func>
+        bool find_with( K const& key, Less pred, Func f )
+        {
+            CDS_UNUSED( pred );
+            rcu_lock l;
+            value_type * pVal = do_find( key, cds::opt::details::make_comparator_from_less<Less>());
+            if ( pVal )
+                f( *pVal );
+            return pVal != nullptr;
+        }
+
+        /// Calls \p f for each item with key in range <tt>[lo, hi)</tt> in ascending key order
+        /** @anchor cds_nonintrusive_BLinkTreeMap_rcu_for_each_in_range
+            The function visits all items whose key is not less than \p lo and less than \p hi.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+
+            The function walks the leaf level by the right links, the key block of each leaf is visited
+            as one snapshot. The traversal is not atomic: the items inserted or removed concurrently
+            may be visited or not. The functor can change \p item.second and must not call
+            other member functions of the map.
+
+            The function applies RCU lock internally for whole traversal.
+
+            The function returns the number of items visited.
+        */
+        template <typename K, typename Func>
+        size_t for_each_in_range( K const& lo, K const& hi, Func f )
+        {
+            return do_for_each_in_range( lo, hi, key_comparator(), f );
+        }
+
+        /// Calls \p f for each item with key in range <tt>[lo, hi)</tt> using \p pred for key comparing
+        /**
+            The function is an analog of \ref cds_nonintrusive_BLinkTreeMap_rcu_for_each_in_range "for_each_in_range(K const&, K const&, Func)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less, typename Func>
+        size_t for_each_in_range_with( K const& lo, K const& hi, Less pred, Func f )
+        {
+            CDS_UNUSED( pred );
+            return do_for_each_in_range( lo, hi, cds::opt::details::make_comparator_from_less<Less>(), f );
+        }
+
+        /// Checks whether the map contains \p key
+        /**
+            The function searches the item with key equal to \p key
+            and returns \p true if it is found, and \p false otherwise.
+
+            The function applies RCU lock internally.
+        */
+        template <typename K>
+        bool contains( K const& key )
+        {
+            rcu_lock l;
+            return do_find( key, key_comparator()) != nullptr;
+        }
+
+        /// Checks whether the map contains \p key using \p pred predicate for searching
+        /**
+            The function is similar to <tt>contains( key )</tt> but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less>
+        bool contains( K const& key, Less pred )
+        {
+            CDS_UNUSED( pred );
+            rcu_lock l;
+            return do_find( key, cds::opt::details::make_comparator_from_less<Less>()) != nullptr;
+        }
+
+        /// Finds \p key and return the item found
+        /** \anchor cds_nonintrusive_BLinkTreeMap_rcu_get
+            The function searches the item with key equal to \p key and returns the pointer to item found.
+            If \p key is not found it returns \p nullptr.
+
+            RCU should be locked before call the function.
+            Returned pointer is valid while RCU is locked.
+        */
+        template <typename Q>
+        value_type * get( Q const& key ) const
+        {
+            assert( gc::is_locked());
+            return do_find( key, key_comparator());
+        }
+
+        /// Finds \p key with \p pred predicate and return the item found
+        /**
+            The function is an analog of \ref cds_nonintrusive_BLinkTreeMap_rcu_get "get(Q const&)"
+            but \p pred is used for comparing the keys.
+
+            \p Less functor has the semantics like \p std::less but should take arguments of type \p key_type
+            and \p Q in any order.
+            \p pred must imply the same element order as the comparator used for building the map.
+        */
+        template <typename Q, typename Less>
+        value_type * get_with( Q const& key, Less pred ) const
+        {
+            CDS_UNUSED( pred );
+            assert( gc::is_locked());
+            return do_find( key, cds::opt::details::make_comparator_from_less<Less>());
+        }
+
+        /// Clears the map
+        /**
+            The function removes all items leaf by leaf, it is not atomic.
+            The leaves emptied are unlinked as by \p erase(), the inner nodes are kept.
+
+            RCU \p synchronize method can be called. RCU should not be locked.
+        */
+        void clear()
+        {
+            check_deadlock_policy::check();
+
+            key_comparator cmp;
+            key_storage nextKey;    // the low key of the next leaf
+            bool bNext = false;
+
+            while ( true ) {
+                rcu_disposer removed_list;
+                {
+                    rcu_lock l;
+
+                    node * pLeaf;
+                    if ( bNext ) {
+                        key_type const& key = *reinterpret_cast<key_type const *>( &nextKey );
+                        pLeaf = lock_node( descend( key, cmp, 0, nullptr ), key, cmp );
+                        reinterpret_cast<key_type *>( &nextKey )->~key_type();
+                        bNext = false;
+                    }
+                    else {
+                        pLeaf = leftmost_leaf();
+                        pLeaf->m_Lock.lock();
+                    }
+
+                    block * pBlock = pLeaf->m_pBlock.load( memory_model::memory_order_relaxed );
+                    if ( pBlock->m_pRight ) {
+                        // The leaf can be freed after RCU is unlocked, keep its high key
+                        new( &nextKey ) key_type( pBlock->high());
+                        bNext = true;
+                    }
+
+                    bool const bEmptied = pBlock->m_nCount != 0;
+                    if ( bEmptied ) {
+                        for ( unsigned i = 0; i < pBlock->m_nCount; ++i ) {
+                            removed_list.dispose_value( pBlock->value( i ));
+                            --m_ItemCounter;
+                        }
+                        replace_block( pLeaf, pBlock, nullptr, 0, nullptr, 0, removed_list );
+                    }
+                    pLeaf->m_Lock.unlock();
+
+                    if ( bEmptied && pLeaf->m_bLow )
+                        unlink_leaf( pLeaf, removed_list );
+                }
+
+                if ( !bNext )
+                    break;
+            }
+        }
+
+        /// Checks if the map is empty
+        /**
+            If the item counter is enabled, the function checks whether the counter is zero, that is O(1).
+            Otherwise, the function scans the leaf level from the lower bound of the keys
+            maintained by \p extract_min() until the first non-empty leaf; the scan is linear
+            in the number of empty leaves left in the tree.
+        */
+        bool empty() const
+        {
+            if ( !std::is_same< item_counter, atomicity::empty_item_counter >::value )
+                return size() == 0;
+
+            key_comparator cmp;
+            rcu_lock l;
+
+            node * pBound = m_pMinBound.load( memory_model::memory_order_acquire );
+            node * pLeaf = pBound ? descend( pBound->low(), cmp, 0, nullptr ) : leftmost_leaf();
+            while ( pLeaf ) {
+                block const * pBlock = pLeaf->m_pBlock.load( memory_model::memory_order_acquire );
+                if ( pBlock->m_nCount )
+                    return false;
+                pLeaf = pBlock->m_pRight;
+            }
+            return true;
+        }
+
+        /// Returns item count in the map
+        /**
+            The value returned depends on item counter type provided by \p Traits template parameter.
+            If it is \p atomicity::empty_item_counter this function always returns 0.
+
+            The function is not suitable for checking the tree emptiness, use \p empty()
+            member function for this purpose.
+        */
+        size_t size() const
+        {
+            return m_ItemCounter;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return m_stat;
+        }
+
+        /// Returns the height of the tree, 1 for the tree consisting of one leaf
+        size_t height() const
+        {
+            return m_pRoot.load( memory_model::memory_order_acquire )->m_nLevel + 1;
+        }
+
+        /// Checks internal consistency (not atomic, not thread-safe)
+        /**
+            The debugging function checks that the keys of every node are sorted and lie in the range
+            of the node, the high key of each node is equal to the low key of its right sibling,
+            and the item counter (if it is enabled) is equal to the number of items in the leaves.
+        */
+        bool check_consistency() const
+        {
+            key_comparator cmp;
+            size_t nItemCount = 0;
+
+            node * pLevel = m_pRoot.load( memory_model::memory_order_relaxed );
+            while ( pLevel ) {
+                if ( pLevel->m_bLow )
+                    return false;
+                node * pDown = pLevel->m_nLevel ? pLevel->m_pBlock.load( memory_model::memory_order_relaxed )->child( 0 ) : nullptr;
+
+                for ( node const * pNode = pLevel; pNode; ) {
+                    block const * pBlock = pNode->m_pBlock.load( memory_model::memory_order_relaxed );
+                    for ( unsigned i = 0; i < pBlock->m_nKeys; ++i ) {
+                        if ( i > 0 && cmp( pBlock->key( i - 1 ), pBlock->key( i )) >= 0 )
+                            return false;
+                        if ( pNode->m_bLow && cmp( pBlock->key( i ), pNode->low()) < 0 )
+                            return false;
+                        if ( pBlock->m_pRight && cmp( pBlock->key( i ), pBlock->high()) >= 0 )
+                            return false;
+                    }
+                    if ( pBlock->m_pRight ) {
+                        node const * pRight = pBlock->m_pRight;
+                        if ( pRight->m_nLevel != pNode->m_nLevel || !pRight->m_bLow || cmp( pBlock->high(), pRight->low()) != 0 )
+                            return false;
+                    }
+
+                    if ( pNode->m_nLevel ) {
+                        if ( pBlock->m_nCount == 0 || pBlock->m_nKeys + 1 != pBlock->m_nCount )
+                            return false;
+                        for ( unsigned i = 0; i < pBlock->m_nCount; ++i ) {
+                            if ( pBlock->child( i )->m_nLevel + 1 != pNode->m_nLevel )
+                                return false;
+                        }
+                    }
+                    else {
+                        if ( pBlock->m_nKeys != pBlock->m_nCount )
+                            return false;
+                        nItemCount += pBlock->m_nCount;
+                    }
+
+                    pNode = pBlock->m_pRight;
+                }
+                pLevel = pDown;
+            }
+
+            return std::is_same< item_counter, atomicity::empty_item_counter >::value || nItemCount == size();
+        }
+
+    protected:
+        //@cond
+        static block * alloc_block( node * pRight, key_type const * pHigh )
+        {
+            block * pBlock = new( cxx_block_allocator().allocate( cds::c_nCacheLineSize, 1 )) block;
+            pBlock->m_pRight = pRight;
+            pBlock->m_nCount = 0;
+            pBlock->m_nKeys = 0;
+            if ( pRight ) {
+                assert( pHigh != nullptr );
+                new( &pBlock->m_High ) key_type( *pHigh );
+            }
+            return pBlock;
+        }
+
+        static block * make_block( key_type const * const * arrKeys, unsigned nKeys, void * const * arrPtr, unsigned nCount, node * pRight, key_type const * pHigh )
+        {
+            assert( nCount <= c_nCapacity );
+            block * pBlock = alloc_block( pRight, pHigh );
+            for ( unsigned i = 0; i < nKeys; ++i )
+                new( &pBlock->m_Keys[i] ) key_type( *arrKeys[i] );
+            pBlock->m_nKeys = nKeys;
+            for ( unsigned i = 0; i < nCount; ++i )
+                pBlock->m_Ptr[i] = arrPtr[i];
+            pBlock->m_nCount = nCount;
+            return pBlock;
+        }
+
+        static void free_block( block * pBlock )
+        {
+            for ( unsigned i = 0; i < pBlock->m_nKeys; ++i )
+                pBlock->key( i ).~key_type();
+            if ( pBlock->m_pRight )
+                pBlock->high().~key_type();
+            pBlock->~block();
+            cxx_block_allocator().deallocate( pBlock, 1 );
+        }
+
+        // Index of the first key that is not less than key
+        template <typename Q, typename Compare>
+        static unsigned lower_bound( block const * pBlock, Q const& key, Compare cmp )
+        {
+            unsigned nLo = 0;
+            unsigned nHi = pBlock->m_nKeys;
+            while ( nLo < nHi ) {
+                unsigned nMid = ( nLo + nHi ) / 2;
+                if ( cmp( pBlock->key( nMid ), key ) < 0 )
+                    nLo = nMid + 1;
+                else
+                    nHi = nMid;
+            }
+            return nLo;
+        }
+
+        // Index of the first key that is greater than key, that is the index of the child containing key
+        template <typename Q, typename Compare>
+        static unsigned upper_bound( block const * pBlock, Q const& key, Compare cmp )
+        {
+            unsigned nLo = 0;
+            unsigned nHi = pBlock->m_nKeys;
+            while ( nLo < nHi ) {
+                unsigned nMid = ( nLo + nHi ) / 2;
+                if ( cmp( key, pBlock->key( nMid )) < 0 )
+                    nHi = nMid;
+                else
+                    nLo = nMid + 1;
+            }
+            return nLo;
+        }
+
+        // key is out of the node range, the node has been split
+        template <typename Q, typename Compare>
+        static bool is_beyond( block const * pBlock, Q const& key, Compare cmp )
+        {
+            return pBlock->m_pRight && cmp( key, pBlock->high()) >= 0;
+        }
+
+        // Lock-free descent to the node of level nLevel containing key, RCU should be locked.
+        // If pPath is not null, the inner nodes passed are stored to pPath[level]
+        template <typename Q, typename Compare>
+        node * descend( Q const& key, Compare cmp, unsigned nLevel, node ** pPath ) const
+        {
+            assert( gc::is_locked());
+
+            node * pNode = m_pRoot.load( memory_model::memory_order_acquire );
+            assert( pNode->m_nLevel >= nLevel );
+            while ( true ) {
+                block const * pBlock = pNode->m_pBlock.load( memory_model::memory_order_acquire );
+                if ( is_beyond( pBlock, key, cmp )) {
+                    m_stat.onMoveRight();
+                    pNode = pBlock->m_pRight;
+                    continue;
+                }
+                if ( pNode->m_nLevel == nLevel )
+                    return pNode;
+                if ( pPath )
+                    pPath[pNode->m_nLevel] = pNode;
+                pNode = pBlock->child( upper_bound( pBlock, key, cmp ));
+            }
+        }
+
+        // Locks the node containing key moving right with lock coupling, RCU should be locked.
+        // If the node has been unlinked, the descent is restarted from the root
+        template <typename Q, typename Compare>
+        node * lock_node( node * pNode, Q const& key, Compare cmp ) const
+        {
+            while ( true ) {
+                pNode->m_Lock.lock();
+                if ( !pNode->m_bUnlinked )
+                    break;
+                pNode->m_Lock.unlock();
+                m_stat.onUnlinkedRestart();
+                pNode = descend( key, cmp, pNode->m_nLevel, nullptr );
+            }
+
+            // The right sibling of a locked live node cannot be unlinked
+            while ( true ) {
+                block const * pBlock = pNode->m_pBlock.load( memory_model::memory_order_relaxed );
+                if ( !is_beyond( pBlock, key, cmp ))
+                    return pNode;
+
+                node * pRight = pBlock->m_pRight;
+                pRight->m_Lock.lock();
+                pNode->m_Lock.unlock();
+                pNode = pRight;
+                m_stat.onLockedMoveRight();
+            }
+        }
+
+        node * leftmost_leaf() const
+        {
+            assert( gc::is_locked());
+
+            node * pNode = m_pRoot.load( memory_model::memory_order_acquire );
+            while ( pNode->m_nLevel )
+                pNode = pNode->m_pBlock.load( memory_model::memory_order_acquire )->child( 0 );
+            return pNode;
+        }
+
+        // Replaces the block of locked pNode by the new one built from arrKeys and arrPtr.
+        // If the items do not fit into one block, the node is split and the new right sibling is returned.
+        node * replace_block( node * pNode, block * pOld, key_type const * const * arrKeys, unsigned nKeys, void * const * arrPtr, unsigned nCount, rcu_disposer& removed_list )
+        {
+            key_type const * pHigh = pOld->m_pRight ? &pOld->high() : nullptr;
+            node * pSplit = nullptr;
+
+            if ( nCount <= c_nCapacity )
+                pNode->m_pBlock.store( make_block( arrKeys, nKeys, arrPtr, nCount, pOld->m_pRight, pHigh ), memory_model::memory_order_release );
+            else {
+                // For a leaf the separator is the first key of the right part,
+                // for an inner node the separator moves to the parent
+                unsigned const nKeyShift = pNode->m_nLevel ? 1 : 0;
+                unsigned const nLeft = nCount / 2;
+                unsigned const nSep = nLeft - nKeyShift;
+
+                block * pRightBlock = make_block( arrKeys + nLeft, nKeys - nLeft, arrPtr + nLeft, nCount - nLeft, pOld->m_pRight, pHigh );
+                pSplit = cxx_node_allocator().New( pNode->m_nLevel, pRightBlock, *arrKeys[nSep] );
+
+                // The right node is reachable from the left sibling only after the new left block is published
+                pNode->m_pBlock.store( make_block( arrKeys, nSep, arrPtr, nLeft, pSplit, arrKeys[nSep] ), memory_model::memory_order_release );
+
+                if ( pNode->m_nLevel )
+                    m_stat.onInnerSplit();
+                else
+                    m_stat.onLeafSplit();
+            }
+
+            removed_list.dispose( pOld );
+            m_stat.onBlockRetired();
+            return pSplit;
+        }
+
+        // Inserts pVal at position nPos of locked leaf
+        node * leaf_insert( node * pLeaf, block * pBlock, unsigned nPos, value_type * pVal, rcu_disposer& removed_list )
+        {
+            key_type const * arrKeys[c_nCapacity + 1];
+            void * arrPtr[c_nCapacity + 1];
+
+            unsigned const nCount = pBlock->m_nCount;
+            for ( unsigned i = 0, j = 0; i <= nCount; ++i ) {
+                if ( i == nPos ) {
+                    arrKeys[i] = &pVal->first;
+                    arrPtr[i] = pVal;
+                }
+                else {
+                    arrKeys[i] = &pBlock->key( j );
+                    arrPtr[i] = pBlock->m_Ptr[j];
+                    ++j;
+                }
+            }
+            return replace_block( pLeaf, pBlock, arrKeys, nCount + 1, arrPtr, nCount + 1, removed_list );
+        }
+
+        // Removes the item at position nPos of locked leaf
+        void leaf_remove( node * pLeaf, block * pBlock, unsigned nPos, rcu_disposer& removed_list )
+        {
+            key_type const * arrKeys[c_nCapacity];
+            void * arrPtr[c_nCapacity];
+
+            unsigned const nCount = pBlock->m_nCount;
+            for ( unsigned i = 0, j = 0; i < nCount; ++i ) {
+                if ( i != nPos ) {
+                    arrKeys[j] = &pBlock->key( i );
+                    arrPtr[j] = pBlock->m_Ptr[i];
+                    ++j;
+                }
+            }
+            replace_block( pLeaf, pBlock, arrKeys, nCount - 1, arrPtr, nCount - 1, removed_list );
+        }
+
+        // Unlinks empty pLeaf, its left sibling takes over the key range of the leaf. RCU should be locked.
+        // The leaf is unlinked only if it is not the first child of its parent.
+        // Lock order: the parent, the left sibling, the leaf
+        void unlink_leaf( node * pLeaf, rcu_disposer& removed_list )
+        {
+            assert( gc::is_locked());
+            assert( pLeaf->m_nLevel == 0 && pLeaf->m_bLow );
+
+            if ( m_pRoot.load( memory_model::memory_order_acquire )->m_nLevel == 0 ) {
+                // The separator of the leaf has not been inserted yet
+                return;
+            }
+
+            key_comparator cmp;
+            key_type const& low = pLeaf->low();
+            node * pParent = lock_node( descend( low, cmp, 1, nullptr ), low, cmp );
+            block * pParentBlock = pParent->m_pBlock.load( memory_model::memory_order_relaxed );
+
+            // The separator of the leaf is the key nPos - 1 of the parent
+            unsigned const nPos = upper_bound( pParentBlock, low, cmp );
+            if ( nPos > 0 && pParentBlock->child( nPos ) == pLeaf ) {
+                node * pLeft = pParentBlock->child( nPos - 1 );
+                pLeft->m_Lock.lock();
+                pLeaf->m_Lock.lock();
+
+                block * pLeftBlock = pLeft->m_pBlock.load( memory_model::memory_order_relaxed );
+                block * pBlock = pLeaf->m_pBlock.load( memory_model::memory_order_relaxed );
+
+                // If the left sibling has been split, the separator of its new right node is not in the parent yet
+                if ( pLeftBlock->m_pRight == pLeaf && pBlock->m_nCount == 0 ) {
+                    assert( !pLeaf->m_bUnlinked );
+
+                    key_type const * arrKeys[c_nCapacity];
+                    void * arrPtr[c_nCapacity];
+
+                    // Remove the separator and the leaf from the parent
+                    for ( unsigned i = 0, j = 0; i < pParentBlock->m_nKeys; ++i ) {
+                        if ( i != nPos - 1 )
+                            arrKeys[j++] = &pParentBlock->key( i );
+                    }
+                    for ( unsigned i = 0, j = 0; i < pParentBlock->m_nCount; ++i ) {
+                        if ( i != nPos )
+                            arrPtr[j++] = pParentBlock->m_Ptr[i];
+                    }
+                    replace_block( pParent, pParentBlock, arrKeys, pParentBlock->m_nKeys - 1, arrPtr, pParentBlock->m_nCount - 1, removed_list );
+
+                    // The left sibling gets the right link and the high key of the leaf
+                    for ( unsigned i = 0; i < pLeftBlock->m_nCount; ++i ) {
+                        arrKeys[i] = &pLeftBlock->key( i );
+                        arrPtr[i] = pLeftBlock->m_Ptr[i];
+                    }
+                    pLeft->m_pBlock.store( make_block( arrKeys, pLeftBlock->m_nKeys, arrPtr, pLeftBlock->m_nCount, pBlock->m_pRight, pBlock->m_pRight ? &pBlock->high() : nullptr ),
+                        memory_model::memory_order_release );
+                    removed_list.dispose( pLeftBlock );
+                    m_stat.onBlockRetired();
+
+                    // The bounds of extract_min()/extract_max() must not refer to the leaf
+                    node * pBound = pLeaf;
+                    m_pMinBound.compare_exchange_strong( pBound, pLeft->m_bLow ? pLeft : nullptr, memory_model::memory_order_acq_rel, atomics::memory_order_relaxed );
+                    pBound = pLeaf;
+                    m_pMaxBound.compare_exchange_strong( pBound, pBlock->m_pRight, memory_model::memory_order_acq_rel, atomics::memory_order_relaxed );
+
+                    // A reader can still pass through the leaf, its last block is kept until the leaf is freed
+                    pLeaf->m_bUnlinked = true;
+                    removed_list.dispose_node( pLeaf );
+                    m_stat.onLeafUnlink();
+                }
+
+                pLeaf->m_Lock.unlock();
+                pLeft->m_Lock.unlock();
+            }
+            pParent->m_Lock.unlock();
+        }
+
+        // Inserts the separators of split nodes into upper levels, RCU should be locked.
+        // pPath[1..nTop] are the inner nodes passed by the descent.
+        void insert_separator( node * pSplit, node * const * pPath, unsigned nTop, rcu_disposer& removed_list )
+        {
+            key_comparator cmp;
+
+            while ( pSplit ) {
+                unsigned const nLevel = pSplit->m_nLevel + 1;
+                assert( nLevel < c_nMaxHeight );
+                key_type const& sep = pSplit->low();
+
+                node * pParent;
+                if ( nLevel <= nTop )
+                    pParent = pPath[nLevel];
+                else {
+                    // The split node was on the top level when the descent started
+                    m_RootLock.lock();
+                    node * pRoot = m_pRoot.load( memory_model::memory_order_relaxed );
+                    if ( pRoot->m_nLevel < nLevel ) {
+                        // The root is the leftmost node of the level,
+                        // the nodes between it and pSplit are reachable by the right links
+                        key_type const * arrKeys[1] = { &sep };
+                        void * arrPtr[2] = { pRoot, pSplit };
+                        m_pRoot.store( cxx_node_allocator().New( nLevel, make_block( arrKeys, 1, arrPtr, 2, nullptr, nullptr )),
+                            memory_model::memory_order_release );
+                        m_RootLock.unlock();
+                        m_stat.onRootGrow();
+                        return;
+                    }
+                    m_RootLock.unlock();
+
+                    // The tree has grown concurrently
+                    pParent = descend( sep, cmp, nLevel, nullptr );
+                    m_stat.onParentSearch();
+                }
+
+                pParent = lock_node( pParent, sep, cmp );
+                block * pBlock = pParent->m_pBlock.load( memory_model::memory_order_relaxed );
+
+                key_type const * arrKeys[c_nCapacity + 1];
+                void * arrPtr[c_nCapacity + 1];
+
+                // sep is inserted at key position nPos, pSplit is the right neighbour of the child nPos
+                unsigned const nPos = upper_bound( pBlock, sep, cmp );
+                for ( unsigned i = 0, j = 0; i <= pBlock->m_nKeys; ++i ) {
+                    if ( i == nPos )
+                        arrKeys[i] = &sep;
+                    else
+                        arrKeys[i] = &pBlock->key( j++ );
+                }
+                for ( unsigned i = 0, j = 0; i <= pBlock->m_nCount; ++i ) {
+                    if ( i == nPos + 1 )
+                        arrPtr[i] = pSplit;
+                    else
+                        arrPtr[i] = pBlock->m_Ptr[j++];
+                }
+
+                pSplit = replace_block( pParent, pBlock, arrKeys, pBlock->m_nKeys + 1, arrPtr, pBlock->m_nCount + 1, removed_list );
+                pParent->m_Lock.unlock();
+            }
+        }
+
+        template <typename Q, typename Compare>
+        value_type * do_find( Q const& key, Compare cmp ) const
+        {
+            block const * pBlock = descend( key, cmp, 0, nullptr )->m_pBlock.load( memory_model::memory_order_acquire );
+
+            // The leaf can be split after descent
+            while ( is_beyond( pBlock, key, cmp )) {
+                m_stat.onMoveRight();
+                pBlock = pBlock->m_pRight->m_pBlock.load( memory_model::memory_order_acquire );
+            }
+
+            unsigned const nPos = lower_bound( pBlock, key, cmp );
+            if ( nPos < pBlock->m_nKeys && cmp( key, pBlock->key( nPos )) == 0 ) {
+                m_stat.onFindSuccess();
+                return pBlock->value( nPos );
+            }
+            m_stat.onFindFailed();
+            return nullptr;
+        }
+
+        // Func: value_type * f( value_type * pFound ), it is called under the leaf lock.
+        // If pFound is nullptr, f returns new item to insert or nullptr
+        template <typename Q, typename Compare, typename Func>
+        std::pair<bool, bool> do_update( Q const& key, Compare cmp, Func f )
+        {
+            check_deadlock_policy::check();
+
+            std::pair<bool, bool> result( false, false );
+            rcu_disposer removed_list;
+            {
+                rcu_lock l;
+
+                node * arrPath[c_nMaxHeight];
+                unsigned const nTop = static_cast<unsigned>( height()) - 1;
+                node * pLeaf = lock_node( descend( key, cmp, 0, arrPath ), key, cmp );
+                block * pBlock = pLeaf->m_pBlock.load( memory_model::memory_order_relaxed );
+
+                unsigned const nPos = lower_bound( pBlock, key, cmp );
+                if ( nPos < pBlock->m_nKeys && cmp( key, pBlock->key( nPos )) == 0 ) {
+                    f( pBlock->value( nPos ));
+                    pLeaf->m_Lock.unlock();
+                    result.first = true;
+                }
+                else {
+                    value_type * pVal = f( nullptr );
+                    if ( pVal ) {
+                        // The bounds are moved before the key is published,
+                        // so extract_min()/extract_max() cannot miss the key found by a reader
+                        update_bounds( pLeaf, pBlock->m_pRight, pVal->first );
+                        node * pSplit = leaf_insert( pLeaf, pBlock, nPos, pVal, removed_list );
+                        pLeaf->m_Lock.unlock();
+                        ++m_ItemCounter;
+                        result.first = result.second = true;
+
+                        if ( pSplit )
+                            insert_separator( pSplit, arrPath, nTop, removed_list );
+                    }
+                    else
+                        pLeaf->m_Lock.unlock();
+                }
+            }
+            return result;
+        }
+
+        // Func: void f( value_type& item ), it is called under the leaf lock before removing.
+        // Returns the item removed; if bDispose is true, the item is retired by RCU
+        template <typename Q, typename Compare, typename Func>
+        value_type * do_remove( Q const& key, Compare cmp, Func f, bool bDispose )
+        {
+            check_deadlock_policy::check();
+
+            value_type * pVal = nullptr;
+            rcu_disposer removed_list;
+            {
+                rcu_lock l;
+
+                node * pLeaf = lock_node( descend( key, cmp, 0, nullptr ), key, cmp );
+                block * pBlock = pLeaf->m_pBlock.load( memory_model::memory_order_relaxed );
+
+                unsigned const nPos = lower_bound( pBlock, key, cmp );
+                bool bEmptied = false;
+                if ( nPos < pBlock->m_nKeys && cmp( key, pBlock->key( nPos )) == 0 ) {
+                    pVal = pBlock->value( nPos );
+                    f( *pVal );
+                    bEmptied = pBlock->m_nCount == 1;
+                    leaf_remove( pLeaf, pBlock, nPos, removed_list );
+                    --m_ItemCounter;
+                    if ( bDispose )
+                        removed_list.dispose_value( pVal );
+                }
+                pLeaf->m_Lock.unlock();
+
+                if ( bEmptied && pLeaf->m_bLow )
+                    unlink_leaf( pLeaf, removed_list );
+            }
+            return pVal;
+        }
+
+        value_type * do_extract_min()
+        {
+            check_deadlock_policy::check();
+
+            key_comparator cmp;
+            value_type * pVal = nullptr;
+            rcu_disposer removed_list;
+            {
+                rcu_lock l;
+
+                // The map has no keys less than the low key of pBound, nullptr is -infinity
+                node * pBound = m_pMinBound.load( memory_model::memory_order_acquire );
+                bool bEmptied = false;
+                while ( true ) {
+                    node * pLeaf;
+                    if ( pBound )
+                        pLeaf = lock_node( descend( pBound->low(), cmp, 0, nullptr ), pBound->low(), cmp );
+                    else {
+                        pLeaf = leftmost_leaf();
+                        pLeaf->m_Lock.lock();
+                    }
+
+                    bool bRestart = false;
+                    while ( true ) {
+                        block * pBlock = pLeaf->m_pBlock.load( memory_model::memory_order_relaxed );
+                        if ( pBlock->m_nCount ) {
+                            pVal = pBlock->value( 0 );
+                            bEmptied = pBlock->m_nCount == 1;
+                            leaf_remove( pLeaf, pBlock, 0, removed_list );
+                            --m_ItemCounter;
+                            break;
+                        }
+
+                        node * pRight = pBlock->m_pRight;
+                        if ( !pRight )
+                            break;
+
+                        // The locked leaf is empty, so the map has no keys less than its high key
+                        if ( !m_pMinBound.compare_exchange_strong( pBound, pRight, memory_model::memory_order_acq_rel, atomics::memory_order_acquire )) {
+                            // The bound has been changed by a concurrent thread
+                            bRestart = true;
+                            break;
+                        }
+                        pBound = pRight;
+
+                        pRight->m_Lock.lock();
+                        pLeaf->m_Lock.unlock();
+                        pLeaf = pRight;
+                        m_stat.onLockedMoveRight();
+                    }
+                    pLeaf->m_Lock.unlock();
+
+                    if ( !bRestart ) {
+                        if ( bEmptied && pLeaf->m_bLow )
+                            unlink_leaf( pLeaf, removed_list );
+                        break;
+                    }
+                }
+            }
+
+            if ( pVal )
+                m_stat.onExtractSuccess();
+            else
+                m_stat.onExtractFailed();
+            return pVal;
+        }
+
+        value_type * do_extract_max()
+        {
+            check_deadlock_policy::check();
+
+            key_comparator cmp;
+            value_type * pVal = nullptr;
+            rcu_disposer removed_list;
+            {
+                rcu_lock l;
+
+                // The map has no keys greater than or equal to the low key of pBound, nullptr is +infinity.
+                // We are looking for the greatest key less than the bound; if the leaf found is empty,
+                // the bound is moved to the low key of the leaf
+                node * pBound = m_pMaxBound.load( memory_model::memory_order_acquire );
+                auto is_below_bound = [&cmp, &pBound]( block const * pBlock ) -> bool {
+                    return pBlock->m_pRight && ( !pBound || cmp( pBlock->high(), pBound->low()) < 0 );
+                };
+
+                while ( true ) {
+                    node * pNode = m_pRoot.load( memory_model::memory_order_acquire );
+                    while ( true ) {
+                        block const * pBlock = pNode->m_pBlock.load( memory_model::memory_order_acquire );
+                        if ( is_below_bound( pBlock )) {
+                            m_stat.onMoveRight();
+                            pNode = pBlock->m_pRight;
+                        }
+                        else if ( pNode->m_nLevel )
+                            pNode = pBlock->child( pBound ? lower_bound( pBlock, pBound->low(), cmp ) : pBlock->m_nCount - 1 );
+                        else
+                            break;
+                    }
+
+                    pNode->m_Lock.lock();
+                    if ( pNode->m_bUnlinked ) {
+                        pNode->m_Lock.unlock();
+                        m_stat.onUnlinkedRestart();
+                        continue;
+                    }
+
+                    block * pBlock = pNode->m_pBlock.load( memory_model::memory_order_relaxed );
+                    while ( is_below_bound( pBlock )) {
+                        node * pRight = pBlock->m_pRight;
+                        pRight->m_Lock.lock();
+                        pNode->m_Lock.unlock();
+                        pNode = pRight;
+                        pBlock = pNode->m_pBlock.load( memory_model::memory_order_relaxed );
+                        m_stat.onLockedMoveRight();
+                    }
+
+                    unsigned const nPos = pBound ? lower_bound( pBlock, pBound->low(), cmp ) : pBlock->m_nCount;
+                    if ( nPos > 0 ) {
+                        pVal = pBlock->value( nPos - 1 );
+                        bool const bEmptied = pBlock->m_nCount == 1;
+                        leaf_remove( pNode, pBlock, nPos - 1, removed_list );
+                        --m_ItemCounter;
+                        pNode->m_Lock.unlock();
+
+                        if ( bEmptied && pNode->m_bLow )
+                            unlink_leaf( pNode, removed_list );
+                        break;
+                    }
+
+                    if ( !pNode->m_bLow ) {
+                        // The leftmost leaf is reached, the map is empty
+                        pNode->m_Lock.unlock();
+                        break;
+                    }
+
+                    // The locked leaf has no keys less than the bound
+                    if ( m_pMaxBound.compare_exchange_strong( pBound, pNode, memory_model::memory_order_acq_rel, atomics::memory_order_acquire ))
+                        pBound = pNode;
+                    // otherwise pBound is changed by a concurrent thread
+                    pNode->m_Lock.unlock();
+                }
+            }
+
+            if ( pVal )
+                m_stat.onExtractSuccess();
+            else
+                m_stat.onExtractFailed();
+            return pVal;
+        }
+
+        // Restores the bounds of extract_min()/extract_max() before key is inserted into locked pLeaf.
+        // pRight is the right sibling of pLeaf
+        void update_bounds( node * pLeaf, node * pRight, key_type const& key )
+        {
+            key_comparator cmp;
+
+            node * pBound = m_pMinBound.load( memory_model::memory_order_acquire );
+            while ( pBound && cmp( key, pBound->low()) < 0 ) {
+                if ( m_pMinBound.compare_exchange_weak( pBound, pLeaf->m_bLow ? pLeaf : nullptr, memory_model::memory_order_acq_rel, atomics::memory_order_acquire ))
+                    break;
+            }
+
+            pBound = m_pMaxBound.load( memory_model::memory_order_acquire );
+            while ( pBound && cmp( key, pBound->low()) >= 0 ) {
+                if ( m_pMaxBound.compare_exchange_weak( pBound, pRight, memory_model::memory_order_acq_rel, atomics::memory_order_acquire ))
+                    break;
+            }
+        }
+
+        template <typename Q, typename Compare, typename Func>
+        size_t do_for_each_in_range( Q const& lo, Q const& hi, Compare cmp, Func f )
+        {
+            size_t nCount = 0;
+
+            rcu_lock l;
+            block const * pBlock = descend( lo, cmp, 0, nullptr )->m_pBlock.load( memory_model::memory_order_acquire );
+            while ( is_beyond( pBlock, lo, cmp ))
+                pBlock = pBlock->m_pRight->m_pBlock.load( memory_model::memory_order_acquire );
+
+            unsigned nPos = lower_bound( pBlock, lo, cmp );
+            while ( true ) {
+                for ( ; nPos < pBlock->m_nCount; ++nPos ) {
+                    if ( cmp( hi, pBlock->key( nPos )) <= 0 )
+                        return nCount;
+                    f( *pBlock->value( nPos ));
+                    ++nCount;
+                }
+
+                if ( !pBlock->m_pRight )
+                    break;
+                pBlock = pBlock->m_pRight->m_pBlock.load( memory_model::memory_order_acquire );
+                nPos = 0;
+            }
+            return nCount;
+        }
+        //@endcond
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_BLINK_TREE_MAP_RCU_H
@@ -141,11 +141,15 @@ namespace cds { namespace container {
         typedef typename traits::stat                   stat;               ///< internal statistics
         typedef typename traits::rcu_check_deadlock     rcu_check_deadlock; ///< Deadlock checking policy
         typedef typename traits::back_off               back_off;           ///< Back-off strategy
+        typedef typename traits::optimistic_back_off    optimistic_back_off; ///< Back-off strategy of @ref bronson_avltree::optimistic_read "optimistic readers"
         typedef typename traits::sync_monitor           sync_monitor;       ///< @ref cds_sync_monitor "Synchronization monitor" type for node-level locking
 
         /// Enabled or disabled @ref bronson_avltree::relaxed_insert "relaxed insertion"
         static bool const c_bRelaxedInsert = traits::relaxed_insert;
 
+        /// Enabled or disabled @ref bronson_avltree::optimistic_read "optimistic readers"
+        static constexpr bool const c_bOptimisticRead = base_class::c_bOptimisticRead;
+
         /// Group of \p extract_xxx functions does not require external locking
         static constexpr const bool c_bExtractLockExternal = base_class::c_bExtractLockExternal;
 
@@ -161,6 +165,18 @@ namespace cds { namespace container {
         typedef typename maker::cxx_allocator         cxx_allocator;
 
         typedef typename base_class::update_flags update_flags;
+
+        // Passes the item placed in neither map by split()/join() to the user functor, then destroys the item
+        template <typename Func>
+        struct value_reporter {
+            Func& f;
+
+            void operator()( key_type const& key, mapped_type * pVal ) const
+            {
+                f( key, *pVal );
+                gc::template retire_ptr< typename base_class::disposer >( pVal );
+            }
+        };
         //@endcond
 
     public:
@@ -630,6 +646,97 @@ namespace cds { namespace container {
             return base_class::contains( key, pred );
         }
 
+        /// Deletes all items with key in range <tt>[lo, hi)</tt> (thread safe, not atomic)
+        /**
+            The function sweeps the range once and unlinks the emptied nodes by the usual rebalancing pass.
+            It is not faster than \p erase() called for each key of the range, it removes the range in one call.
+            The function is not atomic: the keys inserted into the range concurrently may survive the call.
+
+            RCU \p synchronize() can be called. RCU should not be locked.
+
+            Returns the number of items deleted.
+        */
+        template <typename K>
+        size_t erase_range( K const& lo, K const& hi )
+        {
+            return base_class::erase_range( lo, hi );
+        }
+
+        /// Deletes all items with key in range <tt>[lo, hi)</tt> using \p pred predicate for key comparing
+        /**
+            The function is an analog of \p erase_range(K const&, K const&)
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less>
+        size_t erase_range_with( K const& lo, K const& hi, Less pred )
+        {
+            return base_class::erase_range_with( lo, hi, pred );
+        }
+
+        /// Moves all items with key not less than \p key to \p dest (thread safe, not atomic)
+        /**
+            The values are moved as is, no copy is made.
+            If \p dest already contains a key, the item stays in this map.
+            If the key has been inserted concurrently into this map too, the item can be placed in neither map:
+            such item is reported to the functor \p f with the interface
+            \code
+            struct functor {
+                void operator()( key_type const& key, mapped_type& val );
+            };
+            \endcode
+            The functor may move \p val out, the item is destroyed after the functor returns.
+            \p dest must be a different map.
+
+            RCU \p synchronize() can be called. RCU should not be locked.
+
+            Returns the number of items moved to \p dest.
+        */
+        template <typename K, typename Func>
+        size_t split( K const& key, BronsonAVLTreeMap& dest, Func f )
+        {
+            return base_class::split( key, static_cast<base_class&>( dest ), value_reporter<Func>{ f } );
+        }
+
+        /// Moves all items with key not less than \p key to \p dest (thread safe, not atomic)
+        /**
+            The function is an analog of \p split(K const&, BronsonAVLTreeMap&, Func)
+            but the item that can be placed in neither map is destroyed.
+        */
+        template <typename K>
+        size_t split( K const& key, BronsonAVLTreeMap& dest )
+        {
+            return base_class::split( key, static_cast<base_class&>( dest ));
+        }
+
+        /// Moves all items from \p src to this map (thread safe, not atomic)
+        /**
+            If this map already contains a key, the item stays in \p src.
+            If the key has been inserted concurrently into \p src too, the item is reported to the functor \p f,
+            see \p split(K const&, BronsonAVLTreeMap&, Func).
+            \p src must be a different map.
+
+            RCU \p synchronize() can be called. RCU should not be locked.
+
+            Returns the number of items moved from \p src.
+        */
+        template <typename Func>
+        size_t join( BronsonAVLTreeMap& src, Func f )
+        {
+            return base_class::join( static_cast<base_class&>( src ), value_reporter<Func>{ f } );
+        }
+
+        /// Moves all items from \p src to this map (thread safe, not atomic)
+        /**
+            The function is an analog of \p join(BronsonAVLTreeMap&, Func)
+            but the item that can be placed in neither map is destroyed.
+        */
+        size_t join( BronsonAVLTreeMap& src )
+        {
+            return base_class::join( static_cast<base_class&>( src ));
+        }
+
         /// Clears the map
         void clear()
         {
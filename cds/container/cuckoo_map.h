@@ -276,6 +276,7 @@ namespace cds { namespace container {
         typedef typename base_class::mutex_policy mutex_policy; ///< Concurrent access policy, see \p cuckoo::traits::mutex_policy
         typedef typename base_class::stat         stat;         ///< internal statistics type
 
+
         static bool const c_isSorted = base_class::c_isSorted; ///< whether the probe set should be ordered
         static size_t const c_nArity = base_class::c_nArity;   ///< the arity of cuckoo hashing: the number of hash functors provided; minimum 2.
 
@@ -341,6 +342,14 @@ namespace cds { namespace container {
 
         typedef std::unique_ptr< node_type, node_disposer >     scoped_node_ptr;
 
+        // Frees the node unlinked from the set
+        void dispose_node( node_type * pNode )
+        {
+            // cuckoo::optimistic: the lookups in progress may still read the node
+            base_class::synchronize();
+            free_node( pNode );
+        }
+
         //@endcond
 
     public:
@@ -562,7 +571,7 @@ namespace cds { namespace container {
         {
             node_type * pNode = base_class::erase(key);
             if ( pNode ) {
-                free_node( pNode );
+                dispose_node( pNode );
                 return true;
             }
             return false;
@@ -582,7 +591,7 @@ namespace cds { namespace container {
             CDS_UNUSED( pred );
             node_type * pNode = base_class::erase_with(key, cds::details::predicate_wrapper<node_type, Predicate, key_accessor>());
             if ( pNode ) {
-                free_node( pNode );
+                dispose_node( pNode );
                 return true;
             }
             return false;
@@ -611,7 +620,7 @@ namespace cds { namespace container {
             node_type * pNode = base_class::erase( key );
             if ( pNode ) {
                 f( pNode->m_val );
-                free_node( pNode );
+                dispose_node( pNode );
                 return true;
             }
             return false;
@@ -632,7 +641,7 @@ namespace cds { namespace container {
             node_type * pNode = base_class::erase_with( key, cds::details::predicate_wrapper<node_type, Predicate, key_accessor>());
             if ( pNode ) {
                 f( pNode->m_val );
-                free_node( pNode );
+                dispose_node( pNode );
                 return true;
             }
             return false;
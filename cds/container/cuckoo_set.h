@@ -354,6 +354,7 @@ namespace cds { namespace container {
         typedef typename base_class::stat         stat;         ///< internal statistics type
 
 
+
         static bool const c_isSorted = base_class::c_isSorted; ///< whether the probe set should be ordered
         static size_t const c_nArity = base_class::c_nArity;   ///< the arity of cuckoo hashing: the number of hash functors provided; minimum 2.
 
@@ -414,6 +415,14 @@ namespace cds { namespace container {
 
         typedef std::unique_ptr< node_type, node_disposer >     scoped_node_ptr;
 
+        // Frees the node unlinked from the set
+        void dispose_node( node_type * pNode )
+        {
+            // cuckoo::optimistic: the lookups in progress may still read the node
+            base_class::synchronize();
+            free_node( pNode );
+        }
+
         //@endcond
 
     public:
@@ -620,7 +629,7 @@ namespace cds { namespace container {
         {
             node_type * pNode = base_class::erase( key );
             if ( pNode ) {
-                free_node( pNode );
+                dispose_node( pNode );
                 return true;
             }
             return false;
@@ -640,7 +649,7 @@ namespace cds { namespace container {
             CDS_UNUSED( pred );
             node_type * pNode = base_class::erase_with( key, typename maker::template predicate_wrapper<Predicate, bool>());
             if ( pNode ) {
-                free_node( pNode );
+                dispose_node( pNode );
                 return true;
             }
             return false;
@@ -667,7 +676,7 @@ namespace cds { namespace container {
             node_type * pNode = base_class::erase( key );
             if ( pNode ) {
                 f( pNode->m_val );
-                free_node( pNode );
+                dispose_node( pNode );
                 return true;
             }
             return false;
@@ -688,7 +697,7 @@ namespace cds { namespace container {
             node_type * pNode = base_class::erase_with( key, typename maker::template predicate_wrapper<Predicate, bool>());
             if ( pNode ) {
                 f( pNode->m_val );
-                free_node( pNode );
+                dispose_node( pNode );
                 return true;
             }
             return false;
@@ -0,0 +1,263 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2017
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef CDSLIB_CONTAINER_DETAILS_BLINK_TREE_BASE_H
+#define CDSLIB_CONTAINER_DETAILS_BLINK_TREE_BASE_H
+
+#include <cds/container/details/base.h>
+#include <cds/opt/compare.h>
+#include <cds/urcu/options.h>
+#include <cds/sync/spinlock.h>
+#include <cds/details/aligned_allocator.h>
+
+namespace cds { namespace container {
+
+    /// \p BLinkTreeMap related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace blink_tree {
+
+        /// \p BLinkTreeMap internal statistics
+        template <typename EventCounter = cds::atomicity::event_counter>
+        struct stat {
+            typedef EventCounter event_counter ; ///< Event counter type
+
+            event_counter   m_nInsertSuccess;   ///< Number of success \p insert() operations
+            event_counter   m_nInsertFailed;    ///< Number of failed \p insert() operations
+            event_counter   m_nUpdateNew;       ///< Number of new item inserted for \p update()
+            event_counter   m_nUpdateExisting;  ///< Number of existing item updates
+            event_counter   m_nUpdateFailed;    ///< Number of failed \p update() call
+            event_counter   m_nEraseSuccess;    ///< Number of successful \p erase() operations
+            event_counter   m_nEraseFailed;     ///< Number of failed \p erase() operations
+            event_counter   m_nExtractSuccess;  ///< Number of successful \p extract(), \p extract_min() and \p extract_max() operations
+            event_counter   m_nExtractFailed;   ///< Number of failed \p extract(), \p extract_min() and \p extract_max() operations
+            event_counter   m_nFindSuccess;     ///< Number of successful \p find(), \p contains() and \p get() operations
+            event_counter   m_nFindFailed;      ///< Number of failed \p find(), \p contains() and \p get() operations
+
+            event_counter   m_nMoveRight;       ///< Number of moves to the right sibling during lock-free descent
+            event_counter   m_nLockedMoveRight; ///< Number of moves to the right sibling with lock coupling
+            event_counter   m_nLeafSplit;       ///< Number of leaf node splits
+            event_counter   m_nInnerSplit;      ///< Number of inner node splits
+            event_counter   m_nRootGrow;        ///< Number of new roots (the tree height increments)
+            event_counter   m_nParentSearch;    ///< Number of parent searches from the root when the tree has grown during an update
+            event_counter   m_nBlockRetired;    ///< Number of node blocks retired by RCU
+            event_counter   m_nLeafUnlink;      ///< Number of empty leaves unlinked
+            event_counter   m_nUnlinkedRestart; ///< Number of descents restarted since a writer has reached an unlinked leaf
+
+            //@cond
+            void onInsertSuccess()      { ++m_nInsertSuccess;   }
+            void onInsertFailed()       { ++m_nInsertFailed;    }
+            void onUpdateNew()          { ++m_nUpdateNew;       }
+            void onUpdateExisting()     { ++m_nUpdateExisting;  }
+            void onUpdateFailed()       { ++m_nUpdateFailed;    }
+            void onEraseSuccess()       { ++m_nEraseSuccess;    }
+            void onEraseFailed()        { ++m_nEraseFailed;     }
+            void onExtractSuccess()     { ++m_nExtractSuccess;  }
+            void onExtractFailed()      { ++m_nExtractFailed;   }
+            void onFindSuccess()        { ++m_nFindSuccess;     }
+            void onFindFailed()         { ++m_nFindFailed;      }
+
+            void onMoveRight()          { ++m_nMoveRight;       }
+            void onLockedMoveRight()    { ++m_nLockedMoveRight; }
+            void onLeafSplit()          { ++m_nLeafSplit;       }
+            void onInnerSplit()         { ++m_nInnerSplit;      }
+            void onRootGrow()           { ++m_nRootGrow;        }
+            void onParentSearch()       { ++m_nParentSearch;    }
+            void onBlockRetired()       { ++m_nBlockRetired;    }
+            void onLeafUnlink()         { ++m_nLeafUnlink;      }
+            void onUnlinkedRestart()    { ++m_nUnlinkedRestart; }
+            //@endcond
+        };
+
+        /// \p BLinkTreeMap empty internal statistics
+        struct empty_stat {
+            //@cond
+            void onInsertSuccess()      const {}
+            void onInsertFailed()       const {}
+            void onUpdateNew()          const {}
+            void onUpdateExisting()     const {}
+            void onUpdateFailed()       const {}
+            void onEraseSuccess()       const {}
+            void onEraseFailed()        const {}
+            void onExtractSuccess()     const {}
+            void onExtractFailed()      const {}
+            void onFindSuccess()        const {}
+            void onFindFailed()         const {}
+
+            void onMoveRight()          const {}
+            void onLockedMoveRight()    const {}
+            void onLeafSplit()          const {}
+            void onInnerSplit()         const {}
+            void onRootGrow()           const {}
+            void onParentSearch()       const {}
+            void onBlockRetired()       const {}
+            void onLeafUnlink()         const {}
+            void onUnlinkedRestart()    const {}
+            //@endcond
+        };
+
+        /// Node size option
+        /**
+            Specifies the size in bytes of the key block of a tree node. The size is rounded up
+            to a multiple of \p cds::c_nCacheLineSize, and the block holds as many keys as fit
+            into that size but no less than 4. Default is 256 (4 cache lines).
+        */
+        template <size_t Size>
+        struct node_size {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                enum { node_size = Size };
+            };
+            //@endcond
+        };
+
+        /// Key block allocator option setter
+        /**
+            The allocator should be an aligned allocator like \ref CDS_DEFAULT_ALIGNED_ALLOCATOR,
+            see \p cds::details::AlignedAllocator.
+        */
+        template <typename Type>
+        struct block_allocator {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                typedef Type block_allocator;
+            };
+            //@endcond
+        };
+
+        /// \p BLinkTreeMap traits
+        struct traits
+        {
+            /// Key comparison functor
+            /**
+                No default functor is provided. If the option is not specified, the \p less is used.
+
+                See \p cds::opt::compare option description for functor interface.
+
+                You should provide \p compare or \p less functor.
+            */
+            typedef opt::none                       compare;
+
+            /// Specifies binary predicate used for key compare.
+            /**
+                See \p cds::opt::less option description for predicate interface.
+
+                You should provide \p compare or \p less functor.
+            */
+            typedef opt::none                       less;
+
+            /// Size of the key block of a node in bytes, see \p blink_tree::node_size option
+            static size_t const node_size = 256;
+
+            /// Allocator for the tree nodes
+            typedef CDS_DEFAULT_ALLOCATOR           node_allocator;
+
+            /// Aligned allocator for the key blocks of the nodes, default is \ref CDS_DEFAULT_ALIGNED_ALLOCATOR
+            /**
+                The blocks are allocated on the cache line boundary.
+            */
+            typedef CDS_DEFAULT_ALIGNED_ALLOCATOR   block_allocator;
+
+            /// Allocator for the items of the map
+            typedef CDS_DEFAULT_ALLOCATOR           allocator;
+
+            /// Lock type for the node-level locking, default is \p cds::sync::spin
+            typedef cds::sync::spin                 lock_type;
+
+            /// Item counter
+            /**
+                The type for item counter, by default it is disabled (\p atomicity::empty_item_counter).
+                To enable it use \p atomicity::item_counter or \p atomicity::cache_friendly_item_counter.
+            */
+            typedef atomicity::empty_item_counter   item_counter;
+
+            /// C++ memory ordering model
+            /**
+                List of available memory ordering see \p opt::memory_model
+            */
+            typedef opt::v::relaxed_ordering        memory_model;
+
+            /// Internal statistics
+            /**
+                By default, internal statistics is disabled (\p blink_tree::empty_stat).
+                To enable it use \p blink_tree::stat.
+            */
+            typedef empty_stat                      stat;
+
+            /// RCU deadlock checking policy
+            /**
+                List of available options see \p opt::rcu_check_deadlock
+            */
+            typedef cds::opt::v::rcu_throw_deadlock rcu_check_deadlock;
+        };
+
+        /// Metafunction converting option list to \p blink_tree::traits
+        /**
+            \p Options are:
+            - \p opt::compare - key compare functor. No default functor is provided.
+                If the option is not specified, \p %opt::less is used.
+            - \p opt::less - specifies binary predicate used for key compare. At least \p %opt::compare or \p %opt::less should be defined.
+            - \p blink_tree::node_size - the size of the key block of a node in bytes, default is 256
+            - \p opt::node_allocator - the allocator for tree nodes. Default is \ref CDS_DEFAULT_ALLOCATOR.
+            - \p blink_tree::block_allocator - the aligned allocator for the key blocks of nodes. Default is \ref CDS_DEFAULT_ALIGNED_ALLOCATOR.
+            - \p opt::allocator - the allocator for the items of the map. Default is \ref CDS_DEFAULT_ALLOCATOR.
+            - \p opt::lock_type - the lock for the node-level locking, default is \p cds::sync::spin
+            - \p opt::item_counter - the type of item counting feature, by default it is disabled (\p atomicity::empty_item_counter)
+                To enable it use \p atomicity::item_counter or \p atomicity::cache_friendly_item_counter
+            - \p opt::memory_model - C++ memory ordering model. Can be \p opt::v::relaxed_ordering (relaxed memory model, the default)
+                or \p opt::v::sequential_consistent (sequentially consisnent memory model).
+            - \p opt::stat - internal statistics, by default it is disabled (\p blink_tree::empty_stat)
+                To enable statistics use \p blink_tree::stat
+            - \p opt::rcu_check_deadlock - a deadlock checking policy for RCU-based tree, default is \p opt::v::rcu_throw_deadlock
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< traits, Options... >::type
+                ,Options...
+            >::type   type;
+#   endif
+        };
+    } // namespace blink_tree
+
+    //@cond
+    // Forward declaration
+    template < class GC, typename Key, typename T, class Traits = blink_tree::traits >
+    class BLinkTreeMap;
+    //@endcond
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_DETAILS_BLINK_TREE_BASE_H
@@ -210,10 +210,16 @@ namespace cds { namespace container {
         struct stat {
             typedef Counter   event_counter; ///< Event counter type
 
+            /// Size of \p m_nFindLevelRetry array; the retries on deeper levels are accounted in the last item
+            static constexpr size_t const c_nLevelStatCount = 16;
+
             event_counter   m_nFindSuccess; ///< Count of success \p find() call
             event_counter   m_nFindFailed;  ///< Count of failed \p find() call
             event_counter   m_nFindRetry;   ///< Count of retries during \p find()
             event_counter   m_nFindWaitShrinking;   ///< Count of waiting until shrinking completed duting \p find() call
+            event_counter   m_nFindLevelRetry[c_nLevelStatCount]; ///< Count of retries during \p find() per tree level, level 0 is the root
+            event_counter   m_nFindOptimisticBackoff;  ///< Count of back-offs on shrinking node instead of waiting (only if @ref bronson_avltree::optimistic_read "optimistic read" is enabled)
+            event_counter   m_nFindOptimisticFallback; ///< Count of waiting until shrinking completed after the optimistic retry limit is exceeded
 
             event_counter   m_nInsertSuccess;       ///< Count of inserting data node
             event_counter   m_nInsertFailed;        ///< Count of insert failures
@@ -257,11 +263,23 @@ namespace cds { namespace container {
             event_counter   m_nInsertRebalanceReq;  ///< Count of rebalance required after inserting
             event_counter   m_nRemoveRebalanceReq;  ///< Count of rebalance required after removing
 
+            event_counter   m_nEraseRange;          ///< Count of \p erase_range() call
+            event_counter   m_nEraseRangeItem;      ///< Count of items removed by \p erase_range()
+            event_counter   m_nRangeMovedItem;      ///< Count of items moved by \p split() and \p join()
+            event_counter   m_nRangeSweepRetry;     ///< Count of range sweep resumptions caused by concurrent rotations
+
             //@cond
             void onFindSuccess()        { ++m_nFindSuccess      ; }
             void onFindFailed()         { ++m_nFindFailed       ; }
             void onFindRetry()          { ++m_nFindRetry        ; }
+            void onFindRetry( size_t nLevel )
+            {
+                onFindRetry();
+                ++m_nFindLevelRetry[ nLevel < c_nLevelStatCount ? nLevel : c_nLevelStatCount - 1 ];
+            }
             void onFindWaitShrinking()  { ++m_nFindWaitShrinking; }
+            void onFindOptimisticBackoff()  { ++m_nFindOptimisticBackoff; }
+            void onFindOptimisticFallback() { ++m_nFindOptimisticFallback; }
 
             void onInsertSuccess()          { ++m_nInsertSuccess; }
             void onInsertFailed()           { ++m_nInsertFailed; }
@@ -314,6 +332,14 @@ namespace cds { namespace container {
 
             void onInsertRebalanceRequired() { ++m_nInsertRebalanceReq; }
             void onRemoveRebalanceRequired() { ++m_nRemoveRebalanceReq; }
+
+            void onEraseRange( size_t nCount )
+            {
+                ++m_nEraseRange;
+                m_nEraseRangeItem += nCount;
+            }
+            void onRangeMoved( size_t nCount ) { m_nRangeMovedItem += nCount; }
+            void onRangeSweepRetry()        { ++m_nRangeSweepRetry; }
             //@endcond
         };
 
@@ -323,7 +349,10 @@ namespace cds { namespace container {
             void onFindSuccess()        const {}
             void onFindFailed()         const {}
             void onFindRetry()          const {}
+            void onFindRetry( size_t /*nLevel*/ ) const {}
             void onFindWaitShrinking()  const {}
+            void onFindOptimisticBackoff()  const {}
+            void onFindOptimisticFallback() const {}
 
             void onInsertSuccess()          const {}
             void onInsertFailed()           const {}
@@ -364,6 +393,10 @@ namespace cds { namespace container {
 
             void onInsertRebalanceRequired() const {}
             void onRemoveRebalanceRequired() const {}
+
+            void onEraseRange( size_t /*nCount*/ ) const {}
+            void onRangeMoved( size_t /*nCount*/ ) const {}
+            void onRangeSweepRetry()        const {}
             //@endcond
         };
 
@@ -388,6 +421,37 @@ namespace cds { namespace container {
             //@endcond
         };
 
+        /// Option to enable optimistic readers in \ref cds_container_BronsonAVLTreeMap_rcu "Bronson et al AVL-tree"
+        /**
+            By default (\p RetryLimit is 0), \p find() locks the found node by \p sync_monitor
+            before calling the user functor, and a reader waits until a shrinking (rotated) node
+            on its path is stabilized.
+
+            When \p RetryLimit is not 0, the read path relies only on node version validation:
+            - the found node is not locked, the value is read under RCU lock only.
+              Note that the functor passed to \p find() can be called concurrently
+              with \p update() of the same item;
+            - if a node on the path is shrinking, the reader backs off by \p BackOff
+              and re-reads the link from its parent up to \p RetryLimit times per level,
+              then it falls back to waiting until the shrinking is completed.
+
+            Thus, no \p sync_monitor method is called in the read path that is useful
+            for \p cds::sync::pool_monitor under skewed workloads.
+
+            \p BackOff is the back-off strategy of optimistic readers, default is \p cds::backoff::Default.
+            It is not \p Traits::back_off since the default \p cds::backoff::empty turns the retries into a tight spin.
+        */
+        template <unsigned int RetryLimit, typename BackOff = cds::backoff::Default>
+        struct optimistic_read {
+            //@cond
+            template <typename Base> struct pack : public Base
+            {
+                enum { optimistic_read = RetryLimit };
+                typedef BackOff optimistic_back_off;
+            };
+            //@endcond
+        };
+
         /// \p BronsonAVLTreeMap traits
         /**
             Note that there are two main specialization of Bronson et al AVL-tree:
@@ -442,6 +506,19 @@ namespace cds { namespace container {
             */
             static bool const relaxed_insert = false;
 
+            /// Enable optimistic readers
+            /**
+                About optimistic readers see \p bronson_avltree::optimistic_read option.
+                By default, this option is disabled (0).
+            */
+            static unsigned int const optimistic_read = 0;
+
+            /// Back-off strategy of optimistic readers
+            /**
+                See \p bronson_avltree::optimistic_read option.
+            */
+            typedef cds::backoff::Default           optimistic_back_off;
+
             /// Item counter
             /**
                 The type for item counter, by default it is disabled (\p atomicity::empty_item_counter).
@@ -497,6 +574,8 @@ namespace cds { namespace container {
                 default is \p cds::sync::injecting_monitor<cds::sync::spin>
             - \p bronson_avltree::relaxed_insert - enable (\p true) or disable (\p false, the default)
                 @ref bronson_avltree::relaxed_insert "relaxed insertion"
+            - \p bronson_avltree::optimistic_read - enable @ref bronson_avltree::optimistic_read "optimistic readers"
+                with given retry limit per tree level and back-off strategy, default is 0 (disabled)
             - \p opt::item_counter - the type of item counting feature, by default it is disabled (\p atomicity::empty_item_counter)
                 To enable it use \p atomicity::item_counter or \p atomicity::cache_friendly_item_counter
             - \p opt::memory_model - C++ memory ordering model. Can be \p opt::v::relaxed_ordering (relaxed memory model, the default)
@@ -55,6 +55,14 @@ namespace cds { namespace container {
         using intrusive::cuckoo::refinable;
 #endif
 
+#ifdef CDS_DOXYGEN_INVOKED
+        /// Optimistic concurrent access policy. This is typedef for intrusive::cuckoo::optimistic template
+        class optimistic
+        {};
+#else
+        using intrusive::cuckoo::optimistic;
+#endif
+
 #ifdef CDS_DOXYGEN_INVOKED
         /// Striping internal statistics. This is typedef for intrusive::cuckoo::striping_stat
         class striping_stat
@@ -87,6 +95,22 @@ namespace cds { namespace container {
         using intrusive::cuckoo::empty_refinable_stat;
 #endif
 
+#ifdef CDS_DOXYGEN_INVOKED
+        /// Optimistic internal statistics. This is typedef for intrusive::cuckoo::optimistic_stat
+        class optimistic_stat
+        {};
+#else
+        using intrusive::cuckoo::optimistic_stat;
+#endif
+
+#ifdef CDS_DOXYGEN_INVOKED
+        /// Empty optimistic internal statistics. This is typedef for intrusive::cuckoo::empty_optimistic_stat
+        class empty_optimistic_stat
+        {};
+#else
+        using intrusive::cuckoo::empty_optimistic_stat;
+#endif
+
 #ifdef CDS_DOXYGEN_INVOKED
         /// Cuckoo statistics. This is typedef for intrusive::cuckoo::stat
         class stat
@@ -140,6 +164,18 @@ namespace cds { namespace container {
         using intrusive::cuckoo::list;
         using intrusive::cuckoo::vector;
 
+#ifdef CDS_DOXYGEN_INVOKED
+        /// Option specifying the depth of breadth-first cuckoo path search
+        /**
+            @copydetails cds::intrusive::cuckoo::bfs_depth
+        */
+        template <unsigned int Depth>
+        struct bfs_depth
+        {};
+#else
+        using intrusive::cuckoo::bfs_depth;
+#endif
+
         /// Type traits for CuckooSet and CuckooMap classes
         struct traits
         {
@@ -167,6 +203,8 @@ namespace cds { namespace container {
                 Available opt::mutex_policy types:
                 - cuckoo::striping - simple, but the lock array is not resizable
                 - cuckoo::refinable - resizable lock array, but more complex access to set data.
+                - cuckoo::optimistic - lock striping with versioned locks; the lookups do not lock the buckets.
+                    The erasing waits for the lookups in progress before freeing the node, see \p cuckoo::optimistic.
 
                 Default is cuckoo::striping.
             */
@@ -220,6 +258,9 @@ namespace cds { namespace container {
 
             /// Internal statistics
             typedef empty_stat                  stat;
+
+            /// Depth of breadth-first cuckoo path search, see \p cuckoo::bfs_depth. Default is 0 - no path search
+            static unsigned int const bfs_depth = 0;
         };
 
         /// Metafunction converting option list to CuckooSet/CuckooMap traits
@@ -230,7 +271,7 @@ namespace cds { namespace container {
                 The hash functors are passed as <tt> std::tuple< H1, H2, ... Hn > </tt>. The number of hash functors specifies
                 the number \p k - the count of hash tables in cuckoo hashing.
             - \p opt::mutex_policy - concurrent access policy.
-                Available policies: \p cuckoo::striping, \p cuckoo::refinable.
+                Available policies: \p cuckoo::striping, \p cuckoo::refinable, \p cuckoo::optimistic.
                 Default is \p %cuckoo::striping.
             - \p opt::equal_to - key equality functor like \p std::equal_to.
                 If this functor is defined then the probe-set will be unordered.
@@ -255,6 +296,8 @@ namespace cds { namespace container {
                 Default is \p cuckoo::list.
             - \p opt::stat - internal statistics. Possibly types: \p cuckoo::stat, \p cuckoo::empty_stat.
                 Default is \p %cuckoo::empty_stat
+            - \p cuckoo::bfs_depth - the depth of breadth-first cuckoo path search used instead of resizing
+                when the buckets of a new item are full. Default is 0 - no path search.
         */
         template <typename... Options>
         struct make_traits {
@@ -54,11 +54,16 @@ namespace cds { namespace container {
 
         /// Typedef for \p cds::intrusive::ellen_bintree::update_desc_allocator
         typedef cds::intrusive::ellen_bintree::update_desc_allocator update_desc_allocator;
+
+        /// Typedef for \p cds::intrusive::ellen_bintree::cached_allocator
+        template <typename T = int, size_t Capacity = 256, typename Alloc = CDS_DEFAULT_ALLOCATOR>
+        using cached_allocator = cds::intrusive::ellen_bintree::cached_allocator< T, Capacity, Alloc >;
 #else
         using cds::intrusive::ellen_bintree::update_desc;
         using cds::intrusive::ellen_bintree::internal_node;
         using cds::intrusive::ellen_bintree::key_extractor;
         using cds::intrusive::ellen_bintree::update_desc_allocator;
+        using cds::intrusive::ellen_bintree::cached_allocator;
         using cds::intrusive::ellen_bintree::node_types;
 #endif
         /// EllenBinTree internal statistics
@@ -191,6 +196,8 @@ namespace cds { namespace container {
             /// Allocator for internal nodes
             /**
                 The allocator type is used for \p ellen_bintree::internal_node.
+                \p ellen_bintree::cached_allocator keeps per-thread free-lists of internal nodes
+                and update descriptors, it can be used for both \p node_allocator and \p update_desc_allocator.
             */
             typedef CDS_DEFAULT_ALLOCATOR           node_allocator;
 
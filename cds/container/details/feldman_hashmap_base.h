@@ -54,6 +54,9 @@ namespace cds { namespace container {
         /// \p FeldmanHashMap level statistics
         typedef cds::intrusive::feldman_hashset::level_statistics level_statistics;
 
+        /// \p FeldmanHashMap geometry, see \p cds::intrusive::feldman_hashset::geometry
+        typedef cds::intrusive::feldman_hashset::geometry geometry;
+
         /// Key size option
         /**
             @copydetails cds::container::feldman_hashmap::traits::hash_size
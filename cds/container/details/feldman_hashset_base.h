@@ -74,6 +74,9 @@ namespace cds { namespace container {
         /// \p FeldmanHashSet level statistics
         typedef cds::intrusive::feldman_hashset::level_statistics level_statistics;
 
+        /// \p FeldmanHashSet geometry, see \p cds::intrusive::feldman_hashset::geometry
+        typedef cds::intrusive::feldman_hashset::geometry geometry;
+
         /// \p FeldmanHashSet traits
         struct traits
         {
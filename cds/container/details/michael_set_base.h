@@ -46,6 +46,9 @@ namespace cds { namespace container {
         template <typename... Options>
         using make_traits = cds::intrusive::michael_set::make_traits< Options... >;
 
+        /// Cache-line bucket layout option, see \p cds::intrusive::michael_set::traits::cache_line_bucket
+        using cds::intrusive::michael_set::cache_line_bucket;
+
         //@cond
         namespace details {
             using cds::intrusive::michael_set::details::init_hash_bitmask;
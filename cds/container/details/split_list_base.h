@@ -57,6 +57,10 @@ namespace cds { namespace container {
         template <typename Type>
         using bit_reversal = cds::intrusive::split_list::bit_reversal<Type>;
 
+        /// Count of skip pointers in auxiliary node = typedef for \p intrusive::split_list::skip_pointers
+        template <size_t Count>
+        using skip_pointers = cds::intrusive::split_list::skip_pointers<Count>;
+
         using cds::intrusive::split_list::static_bucket_table;
         using cds::intrusive::split_list::expandable_bucket_table;
 
@@ -0,0 +1,262 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2017
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef CDSLIB_CONTAINER_DETAILS_SWISS_HASH_MAP_BASE_H
+#define CDSLIB_CONTAINER_DETAILS_SWISS_HASH_MAP_BASE_H
+
+#include <cds/container/details/base.h>
+#include <cds/opt/hash.h>
+#include <cds/algo/atomic.h>
+#include <cds/algo/backoff_strategy.h>
+
+#if CDS_PROCESSOR_ARCH == CDS_PROCESSOR_AMD64
+#   include <emmintrin.h>
+#endif
+
+namespace cds { namespace container {
+
+    /// \p SwissHashMap related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace swiss_hash_map {
+
+        /// \p SwissHashMap internal statistics
+        template <typename EventCounter = cds::atomicity::event_counter>
+        struct stat {
+            typedef EventCounter event_counter ; ///< Event counter type
+
+            event_counter   m_nInsertSuccess;   ///< Number of success \p insert() operations
+            event_counter   m_nInsertFailed;    ///< Number of failed \p insert() operations
+            event_counter   m_nUpdateNew;       ///< Number of new item inserted for \p update()
+            event_counter   m_nUpdateExisting;  ///< Number of existing item updates
+            event_counter   m_nUpdateFailed;    ///< Number of failed \p update() call
+            event_counter   m_nEraseSuccess;    ///< Number of successful \p erase() operations
+            event_counter   m_nEraseFailed;     ///< Number of failed \p erase() operations
+            event_counter   m_nFindSuccess;     ///< Number of successful \p find() and \p contains() operations
+            event_counter   m_nFindFailed;      ///< Number of failed \p find() and \p contains() operations
+
+            event_counter   m_nValueCasFailed;  ///< Number of failed CAS on the value of a slot
+            event_counter   m_nGroupProbe;      ///< Number of control groups probed after the first one
+            event_counter   m_nTableFull;       ///< Number of events when no empty slot has been found in the table
+            event_counter   m_nNextTable;       ///< Number of operations continued in the next table during resizing
+            event_counter   m_nResize;          ///< Number of resizings started
+            event_counter   m_nChunkMigrated;   ///< Number of migrated chunks of the old table
+
+            //@cond
+            void onInsertSuccess()      { ++m_nInsertSuccess;   }
+            void onInsertFailed()       { ++m_nInsertFailed;    }
+            void onUpdateNew()          { ++m_nUpdateNew;       }
+            void onUpdateExisting()     { ++m_nUpdateExisting;  }
+            void onUpdateFailed()       { ++m_nUpdateFailed;    }
+            void onEraseSuccess()       { ++m_nEraseSuccess;    }
+            void onEraseFailed()        { ++m_nEraseFailed;     }
+            void onFindSuccess()        { ++m_nFindSuccess;     }
+            void onFindFailed()         { ++m_nFindFailed;      }
+
+            void onValueCasFailed()     { ++m_nValueCasFailed;  }
+            void onGroupProbe()         { ++m_nGroupProbe;      }
+            void onTableFull()          { ++m_nTableFull;       }
+            void onNextTable()          { ++m_nNextTable;       }
+            void onResize()             { ++m_nResize;          }
+            void onChunkMigrated()      { ++m_nChunkMigrated;   }
+            //@endcond
+        };
+
+        /// \p SwissHashMap empty internal statistics
+        struct empty_stat {
+            //@cond
+            void onInsertSuccess()      const {}
+            void onInsertFailed()       const {}
+            void onUpdateNew()          const {}
+            void onUpdateExisting()     const {}
+            void onUpdateFailed()       const {}
+            void onEraseSuccess()       const {}
+            void onEraseFailed()        const {}
+            void onFindSuccess()        const {}
+            void onFindFailed()         const {}
+
+            void onValueCasFailed()     const {}
+            void onGroupProbe()         const {}
+            void onTableFull()          const {}
+            void onNextTable()          const {}
+            void onResize()             const {}
+            void onChunkMigrated()      const {}
+            //@endcond
+        };
+
+        /// \p SwissHashMap traits
+        struct traits
+        {
+            /// Hash functor, default is \p opt::none that means \p std::hash<Key>
+            /**
+                The map mixes the hash value by itself, so a weak hash like identity \p std::hash
+                for integers is acceptable. The low bits of the mixed hash select the group,
+                the highest 7 bits are stored in the control byte of the slot.
+            */
+            typedef opt::none hash;
+
+            /// Item counter
+            /**
+                The item counter is used to choose the size of the new table when the map is resized,
+                so it cannot be \p atomicity::empty_item_counter.
+                Default is \p atomicity::item_counter.
+            */
+            typedef cds::atomicity::item_counter item_counter;
+
+            /// Internal statistics
+            /**
+                By default, internal statistics is disabled (\p swiss_hash_map::empty_stat).
+                Use \p swiss_hash_map::stat to enable it.
+            */
+            typedef empty_stat stat;
+
+            /// Back-off strategy
+            typedef cds::backoff::Default back_off;
+
+            /// Allocator for the tables, default is \ref CDS_DEFAULT_ALLOCATOR
+            typedef CDS_DEFAULT_ALLOCATOR allocator;
+        };
+
+        /// Metafunction converting option list to \p swiss_hash_map::traits
+        /**
+            Supported \p Options are:
+            - \p opt::hash - a hash functor, default is \p std::hash<Key>
+            - \p opt::item_counter - an item counter, default is \p atomicity::item_counter.
+                \p atomicity::empty_item_counter is not allowed.
+            - \p opt::stat - internal statistics. By default, it is disabled (\p swiss_hash_map::empty_stat).
+                To enable it use \p swiss_hash_map::stat
+            - \p opt::back_off - back-off strategy, default is \p cds::backoff::Default
+            - \p opt::allocator - an allocator for the tables, default is \ref CDS_DEFAULT_ALLOCATOR
+        */
+        template <typename... Options>
+        struct make_traits
+        {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< traits, Options... >::type
+                ,Options...
+            >::type   type;
+#   endif
+        };
+
+        //@cond
+        namespace details {
+
+            static constexpr size_t const c_nGroupSize = 16;    // slot count in a group
+            static constexpr uint8_t const c_nCtrlEmpty = 0x80; // the slot is free
+            static constexpr uint8_t const c_nCtrlSealed = 0xFE;// the slot is closed by the resizing
+            // any other control byte is 0x00 - 0x7F, the 7 high bits of the hash of the key
+
+            // Snapshot of the 16 control bytes of a group.
+            // Byte i is the bits 8*(i%8) .. 8*(i%8)+7 of the word i/8
+            struct ctrl_group {
+                uint64_t lo;
+                uint64_t hi;
+
+#   if CDS_PROCESSOR_ARCH == CDS_PROCESSOR_AMD64
+                // Bit i of the result is set if control byte i is equal to b
+                unsigned match( uint8_t b ) const
+                {
+                    __m128i const ctrl = _mm_set_epi64x( static_cast<long long>( hi ), static_cast<long long>( lo ));
+                    return static_cast<unsigned>( _mm_movemask_epi8( _mm_cmpeq_epi8( ctrl, _mm_set1_epi8( static_cast<char>( b )))));
+                }
+
+                // Bit i of the result is set if control byte i is empty or sealed
+                unsigned match_special() const
+                {
+                    __m128i const ctrl = _mm_set_epi64x( static_cast<long long>( hi ), static_cast<long long>( lo ));
+                    return static_cast<unsigned>( _mm_movemask_epi8( ctrl ));
+                }
+#   else
+                unsigned match( uint8_t b ) const
+                {
+                    uint64_t const pattern = 0x0101010101010101ULL * b;
+                    return zero_bytes( lo ^ pattern ) | ( zero_bytes( hi ^ pattern ) << 8 );
+                }
+
+                unsigned match_special() const
+                {
+                    return high_bits( lo ) | ( high_bits( hi ) << 8 );
+                }
+
+            private:
+                // Bit i of the result is the high bit of byte i of w
+                static unsigned high_bits( uint64_t w )
+                {
+                    return static_cast<unsigned>(((( w & 0x8080808080808080ULL ) >> 7 ) * 0x0102040810204080ULL ) >> 56 );
+                }
+
+                // Bit i of the result is set if byte i of w is zero
+                static unsigned zero_bytes( uint64_t w )
+                {
+                    uint64_t const lo7 = 0x7F7F7F7F7F7F7F7FULL;
+                    return high_bits( ~((( w & lo7 ) + lo7 ) | w | lo7 ));
+                }
+#   endif
+            };
+
+            static inline uint8_t ctrl_byte( uint64_t w, size_t nSlot )
+            {
+                return static_cast<uint8_t>( w >> (( nSlot % 8 ) * 8 ));
+            }
+
+            static inline uint64_t set_ctrl_byte( uint64_t w, size_t nSlot, uint8_t b )
+            {
+                unsigned const nShift = static_cast<unsigned>(( nSlot % 8 ) * 8 );
+                return ( w & ~( uint64_t( 0xFF ) << nShift )) | ( uint64_t( b ) << nShift );
+            }
+
+            // Finalization mix of 64bit hash (fmix64 of MurmurHash3).
+            // Every input bit affects both the low bits (group index) and the high bits (tag)
+            static inline uint64_t mix_hash( uint64_t h )
+            {
+                h ^= h >> 33;
+                h *= 0xff51afd7ed558ccdULL;
+                h ^= h >> 33;
+                h *= 0xc4ceb9fe1a85ec53ULL;
+                h ^= h >> 33;
+                return h;
+            }
+        } // namespace details
+        //@endcond
+
+    } // namespace swiss_hash_map
+
+    //@cond
+    // Forward declaration
+    template < class GC, typename Key, typename T, class Traits = swiss_hash_map::traits >
+    class SwissHashMap;
+    //@endcond
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_DETAILS_SWISS_HASH_MAP_BASE_H
@@ -480,6 +480,46 @@ namespace cds { namespace container {
                 [&f](leaf_node& item, K const& ) { f( item.m_Value );});
         }
 
+        /// Calls \p f for each item with key in range <tt>[lo, hi)</tt> in ascending key order
+        /** @anchor cds_nonintrusive_EllenBinTreeMap_rcu_for_each_in_range
+            The function visits all items whose key is not less than \p lo and less than \p hi.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            where \p item is <tt>std::pair<key_type const, mapped_type></tt>.
+
+            The items are streamed without copying the range. The traversal is not atomic but linearizable per key,
+            see \ref cds_intrusive_EllenBinTree_rcu_for_each_in_range "intrusive for_each_in_range" for details.
+            The functor can change non-key fields of \p item and must not call other member functions of the map.
+
+            The function applies RCU lock internally for whole traversal.
+
+            The function returns the number of items visited.
+        */
+        template <typename K, typename Func>
+        size_t for_each_in_range( K const& lo, K const& hi, Func f )
+        {
+            return base_class::for_each_in_range( lo, hi, [&f]( leaf_node& node ) { f( node.m_Value ); } );
+        }
+
+        /// Calls \p f for each item with key in range <tt>[lo, hi)</tt> using \p pred for key comparing
+        /**
+            The function is an analog of \ref cds_nonintrusive_EllenBinTreeMap_rcu_for_each_in_range "for_each_in_range(K const&, K const&, Func)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less, typename Func>
+        size_t for_each_in_range_with( K const& lo, K const& hi, Less pred, Func f )
+        {
+            CDS_UNUSED( pred );
+            return base_class::for_each_in_range_with( lo, hi, cds::details::predicate_wrapper< leaf_node, Less, typename maker::key_accessor >(),
+                [&f]( leaf_node& node ) { f( node.m_Value ); } );
+        }
+
         /// Checks whether the map contains \p key
         /**
             The function searches the item with key equal to \p key
@@ -32,6 +32,9 @@
 #define CDSLIB_CONTAINER_IMPL_BRONSON_AVLTREE_MAP_RCU_H
 
 #include <type_traits> // is_base_of
+#include <vector>
+#include <memory> // unique_ptr
+#include <functional> // ref
 #include <cds/container/details/bronson_avltree_base.h>
 #include <cds/urcu/details/check_deadlock.h>
 #include <cds/urcu/exempt_ptr.h>
@@ -90,12 +93,19 @@ namespace cds { namespace container {
         typedef typename traits::stat                   stat;               ///< internal statistics
         typedef typename traits::rcu_check_deadlock     rcu_check_deadlock; ///< Deadlock checking policy
         typedef typename traits::back_off               back_off;           ///< Back-off strategy
+        typedef typename traits::optimistic_back_off    optimistic_back_off; ///< Back-off strategy of @ref bronson_avltree::optimistic_read "optimistic readers"
         typedef typename traits::disposer               disposer;           ///< Value disposer
         typedef typename traits::sync_monitor           sync_monitor;       ///< @ref cds_sync_monitor "Synchronization monitor" type for node-level locking
 
         /// Enabled or disabled @ref bronson_avltree::relaxed_insert "relaxed insertion"
         static constexpr bool const c_bRelaxedInsert = traits::relaxed_insert;
 
+        /// Retry limit per tree level for @ref bronson_avltree::optimistic_read "optimistic readers", 0 if disabled
+        static constexpr unsigned int const c_nOptimisticReadRetryLimit = traits::optimistic_read;
+
+        /// Enabled or disabled @ref bronson_avltree::optimistic_read "optimistic readers"
+        static constexpr bool const c_bOptimisticRead = c_nOptimisticReadRetryLimit != 0;
+
         /// Group of \p extract_xxx functions does not require external locking
         static constexpr const bool c_bExtractLockExternal = false;
 
@@ -233,14 +243,19 @@ namespace cds { namespace container {
             {
                 assert( !gc::is_locked());
 
-                // TODO: use RCU::batch_retire
-
                 // Dispose nodes
-                for ( node_type * p = m_pRetiredList; p; ) {
-                    node_type * pNext = static_cast<node_type *>( p->m_pNextRemoved );
-                    // Value already disposed
-                    gc::template retire_ptr<internal_disposer>( p );
-                    p = pNext;
+                if ( m_pRetiredList ) {
+                    node_type * pList = m_pRetiredList;
+                    auto f = [&pList]() -> cds::urcu::retired_ptr {
+                        node_type * p = pList;
+                        if ( p ) {
+                            // Value already disposed
+                            pList = static_cast<node_type *>( p->m_pNextRemoved );
+                            return cds::urcu::make_retired_ptr<internal_disposer>( p );
+                        }
+                        return cds::urcu::make_retired_ptr<internal_disposer>( static_cast<node_type *>( nullptr ));
+                    };
+                    gc::batch_retire( std::ref( f ));
                 }
 
                 // Dispose value
@@ -596,7 +611,8 @@ namespace cds { namespace container {
             };
             \endcode
             where \p item is the item found.
-            The functor is called under node-level lock.
+            The functor is called under node-level lock. If @ref bronson_avltree::optimistic_read "optimistic read"
+            is enabled, the functor is called without the lock, the item is protected by RCU only.
 
             The function applies RCU lock internally.
 
@@ -608,7 +624,8 @@ namespace cds { namespace container {
             return do_find( key, key_comparator(),
                 [&f]( node_type * pNode ) -> bool {
                     assert( pNode != nullptr );
-                    mapped_type pVal = pNode->m_pValue.load( memory_model::memory_order_relaxed );
+                    // acquire: the node may be unlocked in optimistic read mode
+                    mapped_type pVal = pNode->m_pValue.load( memory_model::memory_order_acquire );
                     if ( pVal ) {
                         f( pNode->m_key, *pVal );
                         return true;
@@ -632,7 +649,8 @@ namespace cds { namespace container {
             return do_find( key, cds::opt::details::make_comparator_from_less<Less>(),
                 [&f]( node_type * pNode ) -> bool {
                     assert( pNode != nullptr );
-                    mapped_type pVal = pNode->m_pValue.load( memory_model::memory_order_relaxed );
+                    // acquire: the node may be unlocked in optimistic read mode
+                    mapped_type pVal = pNode->m_pValue.load( memory_model::memory_order_acquire );
                     if ( pVal ) {
                         f( pNode->m_key, *pVal );
                         return true;
@@ -668,6 +686,129 @@ namespace cds { namespace container {
             return do_find( key, cds::opt::details::make_comparator_from_less<Less>(), []( node_type * ) -> bool { return true; } );
         }
 
+        /// Deletes all items with key in range <tt>[lo, hi)</tt> (thread safe, not atomic)
+        /**
+            The function sweeps the subtrees overlapping the range <tt>[lo, hi)</tt> once,
+            converting each valued node with the key in the range to a routing node under its own node monitor.
+            Then the nodes that can be spliced out are unlinked by the usual height-fixing and rebalancing pass.
+            The values removed are passed to RCU in one batch,
+            the \ref disposer is called for each value after the grace period.
+
+            The function is not faster than \p erase() called for each key of the range:
+            the cost is dominated by locking each node and by RCU reclamation of the nodes and values,
+            not by the descent from the root. The function is a convenience that removes the range in one call.
+
+            The sweep is performed by batches of 128 nodes; RCU is unlocked between the batches,
+            so a long sweep does not delay the grace periods. The next batch, as well as a sweep
+            interrupted by a concurrent rotation, resumes from the last key swept.
+
+            The function is not atomic: each key is removed linearizably,
+            but the keys inserted into the range concurrently may survive the call.
+
+            RCU \p synchronize() can be called. RCU should not be locked.
+
+            Returns the number of items deleted.
+        */
+        template <typename K>
+        size_t erase_range( K const& lo, K const& hi )
+        {
+            return do_erase_range( lo, hi, key_comparator());
+        }
+
+        /// Deletes all items with key in range <tt>[lo, hi)</tt> using \p pred predicate for key comparing
+        /**
+            The function is an analog of \p erase_range(K const&, K const&)
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less>
+        size_t erase_range_with( K const& lo, K const& hi, Less pred )
+        {
+            CDS_UNUSED( pred );
+            return do_erase_range( lo, hi, cds::opt::details::make_comparator_from_less<Less>());
+        }
+
+        /// Moves all items with key not less than \p key to \p dest (thread safe, not atomic)
+        /**
+            The items with key <tt>>= key</tt> are detached from the map by one range sweep
+            (see \p erase_range()) and then inserted into \p dest. The values are moved as is, no copy is made.
+            If \p dest already contains a key, the item is returned back to this map.
+            If the key has been inserted concurrently into this map too, the item can be placed in neither map:
+            such item is reported to the functor \p f with the interface
+            \code
+            struct functor {
+                void operator()( key_type const& key, mapped_type pVal );
+            };
+            \endcode
+            The functor takes the ownership of \p pVal.
+
+            \p dest must be a different map.
+
+            RCU \p synchronize() can be called. RCU should not be locked.
+
+            Returns the number of items moved to \p dest.
+        */
+        template <typename K, typename Func>
+        size_t split( K const& key, BronsonAVLTreeMap& dest, Func f )
+        {
+            assert( &dest != this );
+
+            std::vector< std::pair< key_type, mapped_type >> items;
+            do_range_sweep( &key, static_cast<K const*>( nullptr ), key_comparator(),
+                [&items]( key_type const& k, mapped_type pVal ) { items.emplace_back( k, pVal ); }
+            );
+            return move_items( items, dest, f );
+        }
+
+        /// Moves all items with key not less than \p key to \p dest (thread safe, not atomic)
+        /**
+            The function is an analog of \p split(K const&, BronsonAVLTreeMap&, Func)
+            but the item that can be placed in neither map is disposed: the \ref disposer is called for its value.
+            Use \p split() with a functor if such items should not be lost.
+        */
+        template <typename K>
+        size_t split( K const& key, BronsonAVLTreeMap& dest )
+        {
+            return split( key, dest, value_disposer());
+        }
+
+        /// Moves all items from \p src to this map (thread safe, not atomic)
+        /**
+            The function is the counterpart of \p split(): all items of \p src are detached by one range sweep
+            and inserted into this map. If this map already contains a key, the item is returned back to \p src.
+            If the key has been inserted concurrently into \p src too, the item is reported to the functor \p f
+            that takes the ownership of the value, see \p split(K const&, BronsonAVLTreeMap&, Func).
+
+            \p src must be a different map.
+
+            RCU \p synchronize() can be called. RCU should not be locked.
+
+            Returns the number of items moved from \p src.
+        */
+        template <typename Func>
+        size_t join( BronsonAVLTreeMap& src, Func f )
+        {
+            assert( &src != this );
+
+            std::vector< std::pair< key_type, mapped_type >> items;
+            src.do_range_sweep( static_cast<key_type const*>( nullptr ), static_cast<key_type const*>( nullptr ), key_comparator(),
+                [&items]( key_type const& k, mapped_type pVal ) { items.emplace_back( k, pVal ); }
+            );
+            return src.move_items( items, *this, f );
+        }
+
+        /// Moves all items from \p src to this map (thread safe, not atomic)
+        /**
+            The function is an analog of \p join(BronsonAVLTreeMap&, Func)
+            but the item that can be placed in neither map is disposed: the \ref disposer is called for its value.
+            Use \p join() with a functor if such items should not be lost.
+        */
+        size_t join( BronsonAVLTreeMap& src )
+        {
+            return join( src, value_disposer());
+        }
+
         /// Clears the tree (thread safe, not atomic)
         /**
             The function unlink all items from the tree.
@@ -938,6 +1079,202 @@ namespace cds { namespace container {
             m_stat.onExtract( pExtracted != nullptr );
             return pExtracted;
         }
+
+        template <typename K, typename Compare>
+        size_t do_erase_range( K const& lo, K const& hi, Compare cmp )
+        {
+            std::vector< mapped_type > values;
+            do_range_sweep( &lo, &hi, cmp, [&values]( key_type const&, mapped_type pVal ) { values.push_back( pVal ); } );
+
+            if ( !values.empty()) {
+                auto it = values.cbegin();
+                auto itEnd = values.cend();
+                auto f = [&it, itEnd]() -> cds::urcu::retired_ptr {
+                    if ( it != itEnd )
+                        return cds::urcu::make_retired_ptr<disposer>( *it++ );
+                    return cds::urcu::make_retired_ptr<disposer>( static_cast<mapped_type>( nullptr ));
+                };
+                gc::batch_retire( std::ref( f ));
+            }
+
+            m_stat.onEraseRange( values.size());
+            return values.size();
+        }
+
+        enum class sweep_result
+        {
+            done,       // the range has been swept
+            retry,      // a concurrent rotation is detected, resume from the last swept key
+            pause       // the batch is exhausted, release RCU and resume from the last swept key
+        };
+
+        static constexpr size_t const c_nRangeSweepBatch = 128;
+
+        template <typename K, typename Compare, typename Func>
+        struct range_sweep
+        {
+            K const*                    pLo;        // nullptr - unbounded
+            K const*                    pHi;        // nullptr - unbounded
+            Compare&                    cmp;
+            Func&                       func;
+            key_type const*             pResume;    // exclusive lower bound to resume from, overrides pLo
+            node_type *                 pLast;      // the last node swept in the current batch
+            size_t                      nBudget;    // nodes in range left to sweep in the current batch
+            std::vector< node_type * >  candidates; // routing nodes produced by the current batch
+
+            range_sweep( K const* lo, K const* hi, Compare& c, Func& f )
+                : pLo( lo )
+                , pHi( hi )
+                , cmp( c )
+                , func( f )
+                , pResume( nullptr )
+                , pLast( nullptr )
+                , nBudget( 0 )
+            {}
+        };
+
+        template <typename K, typename Compare, typename Func>
+        void do_range_sweep( K const* pLo, K const* pHi, Compare cmp, Func func )
+        {
+            // pLo == nullptr or pHi == nullptr means the range is unbounded from that side
+            // func( key, value ) is called for each value detached; the node is locked at the time
+            //
+            // The sweep visits at most c_nRangeSweepBatch nodes in range under one RCU lock.
+            // When the batch is exhausted or a concurrent rotation is detected the sweep is resumed
+            // by the descent from the root to the first key greater than the last key swept,
+            // so the part of the range already swept is not visited again.
+            check_deadlock_policy::check();
+
+            range_sweep< K, Compare, Func > sweep( pLo, pHi, cmp, func );
+            std::unique_ptr< key_type > pResumeKey;
+
+            sweep_result result;
+            do {
+                rcu_disposer removed_list;
+                {
+                    rcu_lock l;
+
+                    sweep.pLast = nullptr;
+                    sweep.nBudget = c_nRangeSweepBatch;
+                    node_type * pChild = child( m_pRoot, right_child, memory_model::memory_order_acquire );
+                    result = pChild ? try_range_sweep( pChild, sweep ) : sweep_result::done;
+
+                    if ( result != sweep_result::done ) {
+                        if ( result == sweep_result::retry )
+                            m_stat.onRangeSweepRetry();
+                        if ( sweep.pLast ) {
+                            // The node can be freed after RCU is unlocked, copy its key
+                            pResumeKey.reset( new key_type( sweep.pLast->m_key ));
+                            sweep.pResume = pResumeKey.get();
+                        }
+                    }
+
+                    // Unlink the routing nodes produced by the batch bottom-up
+                    for ( node_type * pNode : sweep.candidates )
+                        fix_height_and_rebalance( pNode, removed_list );
+                    sweep.candidates.clear();
+                }
+            } while ( result != sweep_result::done );
+        }
+
+        template <typename K, typename Compare, typename Func>
+        sweep_result try_range_sweep( node_type * pNode, range_sweep< K, Compare, Func >& sweep )
+        {
+            assert( gc::is_locked());
+
+            if ( sweep.nBudget == 0 )
+                return sweep_result::pause;
+
+            version_type nVersion = pNode->version( memory_model::memory_order_acquire );
+            if ( nVersion & node_type::shrinking ) {
+                pNode->template wait_until_shrink_completed<back_off>( memory_model::memory_order_acquire );
+                return sweep_result::retry;
+            }
+            if ( pNode->is_unlinked( memory_model::memory_order_acquire ))
+                return sweep_result::retry;
+
+            // nCmpLo < 0 - the left subtree can contain the keys of the range
+            // bLoInRange - pNode->m_key is not less than the lower bound
+            int nCmpLo;
+            bool bLoInRange;
+            if ( sweep.pResume ) {
+                nCmpLo = key_comparator()( *sweep.pResume, pNode->m_key );
+                bLoInRange = nCmpLo < 0;
+            }
+            else {
+                nCmpLo = sweep.pLo ? sweep.cmp( *sweep.pLo, pNode->m_key ) : -1;
+                bLoInRange = nCmpLo <= 0;
+            }
+            int nCmpHi = sweep.pHi ? sweep.cmp( *sweep.pHi, pNode->m_key ) : 1;
+
+            if ( nCmpLo < 0 ) {
+                node_type * pLeft = child( pNode, left_child, memory_model::memory_order_acquire );
+                if ( pLeft ) {
+                    sweep_result result = try_range_sweep( pLeft, sweep );
+                    if ( result != sweep_result::done )
+                        return result;
+                }
+            }
+
+            if ( bLoInRange && nCmpHi > 0 ) {
+                node_scoped_lock l( m_Monitor, *pNode );
+                if ( !pNode->is_unlinked( memory_model::memory_order_relaxed )) {
+                    mapped_type pVal = pNode->value( memory_model::memory_order_relaxed );
+                    if ( pVal ) {
+                        pNode->m_pValue.store( nullptr, memory_model::memory_order_release );
+                        --m_ItemCounter;
+                        sweep.func( pNode->m_key, pVal );
+                        m_stat.onMakeRoutingNode();
+
+                        if ( child( pNode, left_child, memory_model::memory_order_relaxed ) == nullptr
+                          || child( pNode, right_child, memory_model::memory_order_relaxed ) == nullptr )
+                        {
+                            sweep.candidates.push_back( pNode );
+                        }
+                    }
+                }
+                sweep.pLast = pNode;
+                --sweep.nBudget;
+            }
+
+            if ( nCmpHi > 0 ) {
+                node_type * pRight = child( pNode, right_child, memory_model::memory_order_acquire );
+                if ( pRight ) {
+                    sweep_result result = try_range_sweep( pRight, sweep );
+                    if ( result != sweep_result::done )
+                        return result;
+                }
+            }
+
+            // If pNode has been rotated the subtrees may be changed
+            return pNode->version( memory_model::memory_order_acquire ) == nVersion ? sweep_result::done : sweep_result::retry;
+        }
+
+        // The default functor of split() and join() for the items placed in neither map
+        struct value_disposer {
+            void operator()( key_type const&, mapped_type pVal ) const
+            {
+                gc::template retire_ptr<disposer>( pVal );
+            }
+        };
+
+        template <typename Func>
+        size_t move_items( std::vector< std::pair< key_type, mapped_type >> const& items, BronsonAVLTreeMap& dest, Func& f )
+        {
+            // items are detached from this map; RCU must not be locked
+            size_t nMoved = 0;
+            for ( auto const& item : items ) {
+                if ( dest.insert( item.first, item.second ))
+                    ++nMoved;
+                else if ( !insert( item.first, item.second )) {
+                    // The key has been inserted into both maps concurrently
+                    m_stat.onDisposeValue();
+                    f( item.first, item.second );
+                }
+            }
+            m_stat.onRangeMoved( nMoved );
+            return nMoved;
+        }
         //@endcond
 
     private:
@@ -978,17 +1315,21 @@ namespace cds { namespace container {
             stack[0].nVersion = nVersion;
             stack[0].nDir = nDir;
 
+            optimistic_back_off bkoff;
             while ( pos >= 0 ) {
                 pNode = stack[pos].pNode;
                 nVersion = stack[pos].nVersion;
                 nDir = stack[pos].nDir;
 
+                unsigned int nBackoffCount = 0;
+                bkoff.reset();
+
                 while ( true ) {
                     node_type * pChild = child( pNode, nDir, memory_model::memory_order_acquire );
                     if ( !pChild ) {
                         if ( pNode->version(memory_model::memory_order_acquire) != nVersion ) {
+                            m_stat.onFindRetry( pos );
                             --pos;
-                            m_stat.onFindRetry();
                             break; // retry
                         }
                         m_stat.onFindFailed();
@@ -999,18 +1340,27 @@ namespace cds { namespace container {
                     if ( nCmp == 0 ) {
                         if ( pChild->is_valued( memory_model::memory_order_acquire )) {
                             // key found
-                            node_scoped_lock l( m_Monitor, *pChild );
-                            if ( child(pNode, nDir, memory_model::memory_order_acquire) == pChild ) {
-                                if ( pChild->is_valued( memory_model::memory_order_relaxed )) {
-                                    if ( f( pChild )) {
-                                        m_stat.onFindSuccess();
-                                        return find_result::found;
-                                    }
+                            constexpr_if ( c_bOptimisticRead ) {
+                                // The value is protected by RCU lock, f() checks whether the node is still valued
+                                if ( f( pChild )) {
+                                    m_stat.onFindSuccess();
+                                    return find_result::found;
                                 }
                             }
                             else {
-                                m_stat.onFindRetry();
-                                continue;
+                                node_scoped_lock l( m_Monitor, *pChild );
+                                if ( child(pNode, nDir, memory_model::memory_order_acquire) == pChild ) {
+                                    if ( pChild->is_valued( memory_model::memory_order_relaxed )) {
+                                        if ( f( pChild )) {
+                                            m_stat.onFindSuccess();
+                                            return find_result::found;
+                                        }
+                                    }
+                                }
+                                else {
+                                    m_stat.onFindRetry( pos );
+                                    continue;
+                                }
                             }
                         }
                         m_stat.onFindFailed();
@@ -1019,20 +1369,30 @@ namespace cds { namespace container {
                     else {
                         version_type nChildVersion = pChild->version( memory_model::memory_order_acquire );
                         if ( nChildVersion & node_type::shrinking ) {
-                            m_stat.onFindWaitShrinking();
-                            pChild->template wait_until_shrink_completed<back_off>( memory_model::memory_order_acquire );
+                            if ( c_bOptimisticRead && nBackoffCount < c_nOptimisticReadRetryLimit ) {
+                                // Do not wait for the rotation, re-read the link from pNode after back-off
+                                ++nBackoffCount;
+                                m_stat.onFindOptimisticBackoff();
+                                bkoff();
+                            }
+                            else {
+                                constexpr_if ( c_bOptimisticRead )
+                                    m_stat.onFindOptimisticFallback();
+                                m_stat.onFindWaitShrinking();
+                                pChild->template wait_until_shrink_completed<back_off>( memory_model::memory_order_acquire );
+                            }
 
                             if ( pNode->version(memory_model::memory_order_acquire) != nVersion ) {
+                                m_stat.onFindRetry( pos );
                                 --pos;
-                                m_stat.onFindRetry();
                                 break; // retry
                             }
                         }
                         else if ( nChildVersion != node_type::unlinked && child( pNode, nDir, memory_model::memory_order_acquire ) == pChild )
                         {
                             if ( pNode->version(memory_model::memory_order_acquire) != nVersion ) {
+                                m_stat.onFindRetry( pos );
                                 --pos;
-                                m_stat.onFindRetry();
                                 break; // retry
                             }
 
@@ -1045,12 +1405,12 @@ namespace cds { namespace container {
                         }
 
                         if ( pNode->version(memory_model::memory_order_acquire) != nVersion ) {
+                            m_stat.onFindRetry( pos );
                             --pos;
-                            m_stat.onFindRetry();
                             break; // retry
                         }
                     }
-                    m_stat.onFindRetry();
+                    m_stat.onFindRetry( pos );
                 }
             }
             return find_result::retry;
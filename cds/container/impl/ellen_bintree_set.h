@@ -499,6 +499,43 @@ namespace cds { namespace container {
         }
         //@endcond
 
+        /// Calls \p f for each item with key in range <tt>[lo, hi)</tt> in ascending key order
+        /** @anchor cds_nonintrusive_EllenBinTreeSet_for_each_in_range
+            The function visits all items whose key is not less than \p lo and less than \p hi.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+
+            The items are streamed without copying the range. The traversal is not atomic but linearizable per key,
+            see \ref cds_intrusive_EllenBinTree_for_each_in_range "intrusive for_each_in_range" for details.
+            The functor can change non-key fields of \p item and must not call other member functions of the set.
+
+            The function returns the number of items visited.
+        */
+        template <typename Q, typename Func>
+        size_t for_each_in_range( Q const& lo, Q const& hi, Func f )
+        {
+            return base_class::for_each_in_range( lo, hi, [&f]( leaf_node& node ) { f( node.m_Value ); } );
+        }
+
+        /// Calls \p f for each item with key in range <tt>[lo, hi)</tt> using \p pred for key comparing
+        /**
+            The function is an analog of \ref cds_nonintrusive_EllenBinTreeSet_for_each_in_range "for_each_in_range(Q const&, Q const&, Func)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less, typename Func>
+        size_t for_each_in_range_with( Q const& lo, Q const& hi, Less pred, Func f )
+        {
+            CDS_UNUSED( pred );
+            return base_class::for_each_in_range_with( lo, hi, cds::details::predicate_wrapper< leaf_node, Less, typename maker::value_accessor >(),
+                [&f]( leaf_node& node ) { f( node.m_Value ); } );
+        }
+
         /// Checks whether the set contains \p key
         /**
             The function searches the item with key equal to \p key
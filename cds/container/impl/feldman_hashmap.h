@@ -155,6 +155,9 @@ namespace cds { namespace container {
         /// Count of hazard pointers required
         static constexpr size_t const c_nHazardPtrCount = base_class::c_nHazardPtrCount;
 
+        /// Max count of keys searched simultaneously by \p find_batch()
+        static constexpr size_t const c_nBatchSize = base_class::c_nBatchSize;
+
         /// The size of \p hash_type in bytes, see \p feldman_hashmap::traits::hash_size for explanation
         static constexpr size_t const c_hash_size = base_class::c_hash_size;
 
@@ -369,6 +372,11 @@ namespace cds { namespace container {
             : base_class( head_bits, array_bits )
         {}
 
+        /// Creates empty map with the geometry \p g, see \p feldman_hashmap::geometry::for_size()
+        explicit FeldmanHashMap( feldman_hashmap::geometry const& g )
+            : base_class( g )
+        {}
+
         /// Destructs the map and frees all data
         ~FeldmanHashMap()
         {}
@@ -632,6 +640,53 @@ namespace cds { namespace container {
             return base_class::find( m_Hasher( key_type( key )), [&f]( node_type& node ) { f( node.m_Value );});
         }
 
+        /// Finds a batch of keys
+        /**
+            The function searches \p nCount keys from the array \p pKeys and calls the functor \p f
+            for each item found:
+            \code
+            struct functor {
+                void operator()( size_t nIndex, value_type& item );
+            };
+            \endcode
+            where \p nIndex is the index of the key in \p pKeys.
+            The trie walks of the keys are interleaved and prefetched,
+            see \p intrusive::FeldmanHashSet::find_batch() for details.
+
+            The function returns the count of keys found.
+        */
+        template <typename K, typename Func>
+        size_t find_batch( K const* pKeys, size_t nCount, Func f )
+        {
+            // hash_type may be not default-constructible
+            typedef typename std::aligned_storage< sizeof( hash_type ), alignof( hash_type )>::type hash_storage;
+            hash_storage arrStorage[c_nBatchSize];
+            hash_type* arrHash = reinterpret_cast<hash_type*>( arrStorage );
+
+            size_t nFound = 0;
+            for ( size_t nStart = 0; nStart < nCount; nStart += c_nBatchSize ) {
+                size_t const nChunk = nCount - nStart < c_nBatchSize ? nCount - nStart : c_nBatchSize;
+                for ( size_t i = 0; i < nChunk; ++i )
+                    new( arrHash + i ) hash_type( m_Hasher( key_type( pKeys[nStart + i] )));
+                nFound += base_class::find_batch( arrHash, nChunk, [&f, nStart]( size_t nIndex, node_type& node ) { f( nStart + nIndex, node.m_Value ); } );
+                for ( size_t i = 0; i < nChunk; ++i )
+                    arrHash[i].~hash_type();
+            }
+            return nFound;
+        }
+
+        /// Checks whether the map contains a batch of keys
+        /**
+            The function sets <tt>pResult[i]</tt> to \p true if the map contains <tt>pKeys[i]</tt>, \p false otherwise.
+            Returns the count of keys found. See \p find_batch() for details.
+        */
+        template <typename K>
+        size_t contains_batch( K const* pKeys, size_t nCount, bool* pResult )
+        {
+            std::fill( pResult, pResult + nCount, false );
+            return find_batch( pKeys, nCount, [pResult]( size_t nIndex, value_type& ) { pResult[nIndex] = true; } );
+        }
+
         /// Finds the key \p key and return the item found
         /**
             The function searches the item with a hash equal to <tt>hash( key_type( key ))</tt>
@@ -675,6 +730,18 @@ namespace cds { namespace container {
             base_class::clear();
         }
 
+        /// Collapses sparse array nodes (not thread-safe)
+        /**
+            See \p intrusive::FeldmanHashSet::compact() for details.
+            No other thread may access the map and no iterator may exist during the call.
+
+            Returns the count of array nodes freed.
+        */
+        size_t compact()
+        {
+            return base_class::compact();
+        }
+
         /// Checks if the map is empty
         /**
             Emptiness is checked by item counting: if item count is zero then the map is empty.
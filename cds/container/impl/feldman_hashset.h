@@ -148,6 +148,9 @@ namespace cds { namespace container {
         /// Count of hazard pointers required
         static constexpr size_t const c_nHazardPtrCount = base_class::c_nHazardPtrCount;
 
+        /// Max count of hashes searched simultaneously by \p find_batch()
+        static constexpr size_t const c_nBatchSize = base_class::c_nBatchSize;
+
         /// The size of \p hash_type in bytes, see \p feldman_hashset::traits::hash_size for explanation
         static constexpr size_t const c_hash_size = base_class::c_hash_size;
 
@@ -300,6 +303,11 @@ namespace cds { namespace container {
             : base_class( head_bits, array_bits )
         {}
 
+        /// Creates empty set with the geometry \p g, see \p feldman_hashset::geometry::for_size()
+        explicit FeldmanHashSet( feldman_hashset::geometry const& g )
+            : base_class( g )
+        {}
+
         /// Destructs the set and frees all data
         ~FeldmanHashSet()
         {}
@@ -517,6 +525,37 @@ namespace cds { namespace container {
             return base_class::contains( hash );
         }
 
+        /// Finds a batch of hashes
+        /**
+            The function searches \p nCount hashes from the array \p pHashes and calls the functor \p f
+            for each item found:
+            \code
+            struct functor {
+                void operator()( size_t nIndex, value_type& item );
+            };
+            \endcode
+            where \p nIndex is the index of the hash in \p pHashes.
+            The trie walks of the hashes are interleaved and prefetched,
+            see \p intrusive::FeldmanHashSet::find_batch() for details.
+
+            The function returns the count of hashes found.
+        */
+        template <typename Func>
+        size_t find_batch( hash_type const* pHashes, size_t nCount, Func f )
+        {
+            return base_class::find_batch( pHashes, nCount, f );
+        }
+
+        /// Checks whether the set contains a batch of hashes
+        /**
+            The function sets <tt>pResult[i]</tt> to \p true if the set contains <tt>pHashes[i]</tt>, \p false otherwise.
+            Returns the count of hashes found. See \p find_batch() for details.
+        */
+        size_t contains_batch( hash_type const* pHashes, size_t nCount, bool* pResult )
+        {
+            return base_class::contains_batch( pHashes, nCount, pResult );
+        }
+
         /// Finds an item by it's \p hash and returns the item found
         /**
             The function searches the item by its \p hash
@@ -556,6 +595,18 @@ namespace cds { namespace container {
             base_class::clear();
         }
 
+        /// Collapses sparse array nodes (not thread-safe)
+        /**
+            See \p intrusive::FeldmanHashSet::compact() for details.
+            No other thread may access the set and no iterator may exist during the call.
+
+            Returns the count of array nodes freed.
+        */
+        size_t compact()
+        {
+            return base_class::compact();
+        }
+
         /// Checks if the set is empty
         /**
             Emptiness is checked by item counting: if item count is zero then the set is empty.
@@ -786,6 +786,15 @@ namespace cds { namespace container {
             return base_class::statistics();
         }
 
+        //@cond
+        // Resizable MichaelHashMap support
+        template <typename Func>
+        void scan_frozen( Func f )
+        {
+            scan_frozen_at( head(), f );
+        }
+        //@endcond
+
     protected:
         //@cond
         bool insert_node_at( head_type& refHead, node_type * pNode )
@@ -878,6 +887,13 @@ namespace cds { namespace container {
             return base_class::get_at( refHead, key, cmp );
         }
 
+        // Resizable MichaelHashMap support, see intrusive::MichaelList::scan_frozen_at()
+        template <typename Func>
+        void scan_frozen_at( head_type& refHead, Func f )
+        {
+            base_class::scan_frozen_at( refHead, [&f]( node_type& node ) { f( node.m_Data ); });
+        }
+
         //@endcond
     };
 
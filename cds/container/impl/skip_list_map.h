@@ -313,6 +313,36 @@ namespace cds { namespace container {
             return false;
         }
 
+        /// Inserts a sorted range of key-value pairs
+        /**
+            The function inserts the items of range <tt>[itFirst, itLast)</tt> whose keys are not in the map.
+            \p Iterator dereferencing should produce a pair-like object with \p first and \p second fields;
+            the item is constructed as <tt>value_type( first, second )</tt>.
+
+            If the range is sorted in ascending order of the keys, the insert position of each item
+            is searched from the position of the previous item (a finger search), so loading a sorted range
+            into the empty map takes expected <tt>O(N)</tt> time. The function can be used for merging a sorted batch
+            into populated map, and several threads can load disjoint key ranges concurrently.
+            See \p intrusive::SkipListSet::insert_sorted() for details.
+
+            Returns the count of items inserted.
+        */
+        template <typename Iterator>
+        size_t insert_sorted( Iterator itFirst, Iterator itLast )
+        {
+            typename base_class::position pos;
+            bool bFinger = false;
+            size_t nCount = 0;
+            for ( ; itFirst != itLast; ++itFirst ) {
+                scoped_node_ptr pNode( node_allocator().New( random_level(), (*itFirst).first, (*itFirst).second ));
+                if ( base_class::insert_at_finger( *pNode, pos, bFinger, []( node_type& ) {} )) {
+                    pNode.release();
+                    ++nCount;
+                }
+            }
+            return nCount;
+        }
+
         /// For key \p key inserts data of type \p value_type created in-place from <tt>std::forward<Args>(args)...</tt>
         /**
             Returns \p true if inserting successful, \p false otherwise.
@@ -320,6 +320,36 @@ namespace cds { namespace container {
             return false;
         }
 
+        /// Inserts a sorted range of values
+        /**
+            The function creates a node with copy of each value of range <tt>[itFirst, itLast)</tt>
+            and inserts it into the set if the set does not contain its key.
+            \p Iterator dereferencing should produce a value from which \ref value_type can be constructed.
+
+            If the range is sorted in ascending order of the keys, the insert position of each value
+            is searched from the position of the previous value (a finger search), so loading a sorted range
+            into the empty set takes expected <tt>O(N)</tt> time. The function can be used for merging a sorted batch
+            into populated set, and several threads can load disjoint key ranges concurrently.
+            See \p intrusive::SkipListSet::insert_sorted() for details.
+
+            Returns the count of values inserted.
+        */
+        template <typename Iterator>
+        size_t insert_sorted( Iterator itFirst, Iterator itLast )
+        {
+            typename base_class::position pos;
+            bool bFinger = false;
+            size_t nCount = 0;
+            for ( ; itFirst != itLast; ++itFirst ) {
+                scoped_node_ptr sp( node_allocator().New( random_level(), *itFirst ));
+                if ( base_class::insert_at_finger( *sp, pos, bFinger, []( node_type& ) {} )) {
+                    sp.release();
+                    ++nCount;
+                }
+            }
+            return nCount;
+        }
+
         /// Updates the item
         /**
             The operation performs inserting or changing data with lock-free manner.
@@ -33,8 +33,188 @@
 
 #include <cds/container/details/michael_map_base.h>
 #include <cds/container/details/iterable_list_base.h>
+#include <cds/container/details/michael_list_base.h>
+#include <cds/container/details/make_michael_kvlist.h>
 #include <cds/details/allocator.h>
 
+//@cond
+namespace cds { namespace intrusive { namespace michael_set { namespace details {
+
+    // Cache-line bucket for container::MichaelKVList
+    template <class GC, typename Key, typename Value, class Traits, typename Hash>
+    class alignas( cds::c_nCacheLineSize ) tagged_bucket< cds::container::MichaelKVList< GC, Key, Value, Traits >, Hash >
+        : public cds::container::MichaelKVList< GC, Key, Value, Traits >
+    {
+        typedef cds::container::MichaelKVList< GC, Key, Value, Traits > base_class;
+        typedef cds::container::details::make_michael_kvlist< GC, Key, Value, Traits > maker;
+        typedef typename maker::type intrusive_list;
+
+    public:
+        typedef typename base_class::gc          gc;
+        typedef typename base_class::value_type  value_type;
+        typedef typename base_class::guarded_ptr guarded_ptr;
+
+    protected:
+        typedef typename base_class::node_type                node_type;
+        typedef typename base_class::intrusive_key_comparator intrusive_key_comparator;
+        typedef typename base_class::head_type                head_type;
+        typedef typename intrusive_list::marked_node_ptr      marked_node_ptr;
+        typedef typename intrusive_list::guarded_ptr          node_guarded_ptr;
+        typedef michael_set::details::tag_array< gc, node_type, sizeof( base_class ) > tag_array;
+
+        tag_array m_Tags;
+
+    public:
+        tagged_bucket()
+        {}
+
+        template <typename Stat>
+        explicit tagged_bucket( Stat& st )
+            : base_class( st )
+        {}
+
+        template <typename K>
+        bool erase( K const& key )
+        {
+            return erase_at( key, intrusive_key_comparator(), []( value_type& ) {} );
+        }
+
+        template <typename K, typename Less>
+        bool erase_with( K const& key, Less )
+        {
+            return erase_at( key, typename maker::template less_wrapper<Less>::type(), []( value_type& ) {} );
+        }
+
+        template <typename K, typename Func>
+        bool erase( K const& key, Func f )
+        {
+            return erase_at( key, intrusive_key_comparator(), f );
+        }
+
+        template <typename K, typename Less, typename Func>
+        bool erase_with( K const& key, Less, Func f )
+        {
+            return erase_at( key, typename maker::template less_wrapper<Less>::type(), f );
+        }
+
+        template <typename K>
+        guarded_ptr extract( K const& key )
+        {
+            return extract_at( key, intrusive_key_comparator());
+        }
+
+        template <typename K, typename Less>
+        guarded_ptr extract_with( K const& key, Less )
+        {
+            return extract_at( key, typename maker::template less_wrapper<Less>::type());
+        }
+
+        template <typename Q>
+        bool contains( Q const& key )
+        {
+            return !get_node( key ).empty();
+        }
+
+        template <typename Q, typename Less>
+        bool contains( Q const& key, Less pred )
+        {
+            return base_class::contains( key, pred );
+        }
+
+        template <typename Q, typename Func>
+        bool find( Q const& key, Func f )
+        {
+            node_guarded_ptr gp( get_node( key ));
+            if ( gp ) {
+                f( gp->m_Data );
+                return true;
+            }
+            return false;
+        }
+
+        template <typename Q, typename Less, typename Func>
+        bool find_with( Q const& key, Less pred, Func f )
+        {
+            return base_class::find_with( key, pred, f );
+        }
+
+        template <typename K>
+        guarded_ptr get( K const& key )
+        {
+            return guarded_ptr( get_node( key ));
+        }
+
+        template <typename K, typename Less>
+        guarded_ptr get_with( K const& key, Less pred )
+        {
+            return base_class::get_with( key, pred );
+        }
+
+        void clear()
+        {
+            typename gc::Guard guard;
+            while ( true ) {
+                node_type * pHead = static_cast<node_type *>( guard.protect( head(), []( marked_node_ptr p ) -> node_type* {
+                    return static_cast<node_type *>( p.ptr());
+                }).ptr());
+                if ( pHead == nullptr )
+                    break;
+                if ( intrusive_list::unlink_at( head(), *pHead ))
+                    m_Tags.erase( pHead );
+            }
+        }
+
+    protected:
+        head_type& head()
+        {
+            return base_class::head();
+        }
+
+        static bool is_marked( node_type& node )
+        {
+            return node.m_pNext.load( atomics::memory_order_acquire ).bits() != 0;
+        }
+
+        template <typename K, typename Compare, typename Func>
+        bool erase_at( K const& key, Compare cmp, Func f )
+        {
+            // The functor is called while the node is guarded
+            return intrusive_list::erase_at( head(), key, cmp, [this, &f]( node_type& node ) {
+                m_Tags.erase( &node );
+                f( node.m_Data );
+            });
+        }
+
+        template <typename K, typename Compare>
+        guarded_ptr extract_at( K const& key, Compare cmp )
+        {
+            node_guarded_ptr gp( intrusive_list::extract_at( head(), key, cmp ));
+            if ( gp )
+                m_Tags.erase( &*gp );
+            return guarded_ptr( std::move( gp ));
+        }
+
+        template <typename Q>
+        node_guarded_ptr get_node( Q const& key )
+        {
+            uint8_t const nTag = tag_array::fingerprint( Hash()( key ));
+            {
+                typename gc::Guard guard;
+                if ( m_Tags.find( guard, nTag, [&key]( node_type& node ) { return !is_marked( node ) && intrusive_key_comparator()( node, key ) == 0; } )) {
+                    intrusive_list::m_Stat.onFindSuccess();
+                    return node_guarded_ptr( std::move( guard ));
+                }
+            }
+
+            node_guarded_ptr gp( intrusive_list::get_at( head(), key, intrusive_key_comparator()));
+            if ( gp )
+                m_Tags.publish( &*gp, nTag, &is_marked );
+            return gp;
+        }
+    };
+}}}} // namespace cds::intrusive::michael_set::details
+//@endcond
+
 namespace cds { namespace container {
 
     /// Michael's hash map
@@ -171,21 +351,90 @@ namespace cds { namespace container {
         // GC and OrderedList::gc must be the same
         static_assert( std::is_same<gc, typename ordered_list::gc>::value, "GC and OrderedList::gc must be the same");
 
-        static constexpr const size_t c_nHazardPtrCount = ordered_list::c_nHazardPtrCount; ///< Count of hazard pointer required
+        static constexpr const bool c_bResizable = traits::resizable; ///< Growth mode, see \p michael_map::traits::resizable
+
+        /// Count of hazard pointer required
+        static constexpr const size_t c_nHazardPtrCount = ordered_list::c_nHazardPtrCount + ( c_bResizable ? 4 : 0 );
+
+        static_assert( !c_bResizable || !is_iterable_list< ordered_list >::value, "Growth mode is not supported for IterableKVList" );
+        static_assert( !c_bResizable || !std::is_same< item_counter, cds::atomicity::empty_item_counter >::value,
+            "Growth mode requires real item counter" );
 
         //@cond
         typedef typename ordered_list::template select_stat_wrapper< typename ordered_list::stat > bucket_stat;
 
-        typedef typename ordered_list::template rebind_traits<
-            cds::opt::item_counter< cds::atomicity::empty_item_counter >
-            , cds::opt::stat< typename bucket_stat::wrapped_stat >
+        typedef typename cds::intrusive::michael_set::details::bucket_type_selector<
+            typename ordered_list::template rebind_traits<
+                cds::opt::item_counter< cds::atomicity::empty_item_counter >
+                , cds::opt::stat< typename bucket_stat::wrapped_stat >
+            >::type
+            , hash
+            , traits::cache_line_bucket
         >::type internal_bucket_type;
 
         typedef typename internal_bucket_type::guarded_ptr guarded_ptr;
-        typedef typename allocator::template rebind< internal_bucket_type >::other bucket_table_allocator;
+        typedef cds::intrusive::michael_set::details::bucket_table_allocator< internal_bucket_type, allocator > bucket_table_allocator;
         typedef typename bucket_stat::stat stat;
         //@endcond
 
+    protected:
+        //@cond
+        // Hash table of growth mode
+        struct bucket_table {
+            size_t const                    nHashBitmask;
+            internal_bucket_type *          pBuckets;
+            atomics::atomic<size_t> *       pState;     // migration state of the buckets, see c_nFrozen
+            atomics::atomic<bucket_table *> pNext;      // the table the buckets are moved to
+            atomics::atomic<size_t>         nCursor;    // next bucket to migrate
+            atomics::atomic<size_t>         nMigrated;  // count of migrated buckets
+
+            explicit bucket_table( size_t nMask )
+                : nHashBitmask( nMask )
+                , pBuckets( nullptr )
+                , pState( nullptr )
+                , pNext( nullptr )
+                , nCursor( 0 )
+                , nMigrated( 0 )
+            {}
+        };
+
+        // Bucket state of growth mode: the low bits are the count of updating operations in progress
+        static constexpr const size_t c_nMigrated = size_t( 1 ) << ( sizeof( size_t ) * 8 - 1 ); // the bucket has been moved to the next table
+        static constexpr const size_t c_nFrozen = c_nMigrated >> 1;       // the bucket is being moved, no update is allowed
+        static constexpr const size_t c_nUpdaterMask = c_nFrozen - 1;
+
+        typedef typename ordered_list::back_off back_off;
+        typedef cds::details::Allocator< bucket_table, allocator > table_allocator;
+        typedef cds::details::Allocator< atomics::atomic<size_t>, allocator > state_allocator;
+
+        // Growth mode: the iterator keeps the traversed table guarded
+        class iterator_table_guard {
+            typename gc::Guard m_Guard;
+
+        public:
+            iterator_table_guard()
+            {}
+
+            iterator_table_guard( iterator_table_guard const& src )
+            {
+                m_Guard.copy( src.m_Guard );
+            }
+
+            iterator_table_guard& operator =( iterator_table_guard const& src )
+            {
+                m_Guard.copy( src.m_Guard );
+                return *this;
+            }
+
+            typename gc::Guard& guard()
+            {
+                return m_Guard;
+            }
+        };
+        struct empty_table_guard {};
+        typedef typename std::conditional< c_bResizable, iterator_table_guard, empty_table_guard >::type table_guard;
+        //@endcond
+
     protected:
         //@cond
         const size_t            m_nHashBitmask;
@@ -193,6 +442,11 @@ namespace cds { namespace container {
         hash                    m_HashFunctor; ///< Hash functor
         item_counter            m_ItemCounter; ///< Item counter
         stat                    m_Stat;        ///< Internal statistics
+
+        // growth mode
+        atomics::atomic<bucket_table *> m_pTable;       ///< current hash table
+        atomics::atomic<size_t>         m_nBucketCount; ///< size of current hash table
+        size_t const                    m_nLoadFactor;  ///< max average count of items per bucket
         //@endcond
 
     protected:
@@ -203,11 +457,14 @@ namespace cds { namespace container {
         {
             typedef cds::intrusive::michael_set::details::iterator< internal_bucket_type, IsConst >  base_class;
             friend class MichaelHashMap;
+            template <bool> friend class iterator_type;
 
         protected:
             typedef typename base_class::bucket_ptr     bucket_ptr;
             typedef typename base_class::list_iterator  list_iterator;
 
+            table_guard m_TableGuard; // growth mode: the table of m_pCurBucket
+
         public:
             /// Value pointer type (const for const_iterator)
             typedef typename cds::details::make_const_type<typename MichaelHashMap::mapped_type, IsConst>::pointer   value_ptr;
@@ -224,6 +481,18 @@ namespace cds { namespace container {
                 : base_class( it, pFirst, pLast )
             {}
 
+            // pFirst and pLast belong to the table guarded by g
+            iterator_type( table_guard const& g, list_iterator const& it, bucket_ptr pFirst, bucket_ptr pLast )
+                : base_class( it, pFirst, pLast )
+                , m_TableGuard( g )
+            {}
+
+            // Growth mode: end() is the default-constructed iterator since the table may change between begin() and end()
+            bool at_end() const
+            {
+                return base_class::m_pCurBucket == nullptr || base_class::m_itList == base_class::m_pCurBucket->end();
+            }
+
         public:
             /// Default ctor
             iterator_type()
@@ -233,6 +502,7 @@ namespace cds { namespace container {
             /// Copy ctor
             iterator_type( const iterator_type& src )
                 : base_class( src )
+                , m_TableGuard( src.m_TableGuard )
             {}
 
             /// Dereference operator
@@ -259,6 +529,7 @@ namespace cds { namespace container {
             /// Assignment operator
             iterator_type& operator = (const iterator_type& src)
             {
+                m_TableGuard = src.m_TableGuard;
                 base_class::operator =(src);
                 return *this;
             }
@@ -273,6 +544,8 @@ namespace cds { namespace container {
             template <bool C>
             bool operator ==(iterator_type<C> const& i ) const
             {
+                if ( c_bResizable && ( at_end() || i.at_end()))
+                    return at_end() && i.at_end();
                 return base_class::operator ==( i );
             }
             /// Equality operator
@@ -333,6 +606,13 @@ namespace cds { namespace container {
             \endcode
 
             @note The iterator object returned by \p end(), \p cend() member functions points to \p nullptr and should not be dereferenced.
+
+            @note In growth mode (see \p michael_map::traits::resizable) \p begin() finishes the migration in progress,
+            helping to move the buckets and waiting for the buckets being moved by other threads,
+            and the iterator keeps the traversed hash table guarded, so the table cannot be freed under the iterator.
+            \p end() does not depend on the table. The items moved by a growth that starts during the traversal
+            may be missed. The iterator should not be used to change \p item.second in growth mode,
+            the change may be lost when the bucket is moved to the new table.
         */
         typedef iterator_type< false >    iterator;
 
@@ -345,7 +625,11 @@ namespace cds { namespace container {
         */
         iterator begin()
         {
-            return iterator( bucket_begin()->begin(), bucket_begin(), bucket_end());
+            table_guard guard;
+            internal_bucket_type * pBegin;
+            internal_bucket_type * pEnd;
+            iteration_range( guard, pBegin, pEnd );
+            return iterator( guard, pBegin->begin(), pBegin, pEnd );
         }
 
         /// Returns an iterator that addresses the location succeeding the last element in a map
@@ -356,6 +640,8 @@ namespace cds { namespace container {
         */
         iterator end()
         {
+            if ( c_bResizable )
+                return iterator();
             return iterator( bucket_end()[-1].end(), bucket_end() - 1, bucket_end());
         }
 
@@ -392,21 +678,40 @@ namespace cds { namespace container {
             Note, that many popular STL hash map implementation uses load factor 1.
 
             The ctor defines hash table size as rounding <tt>nMacItemCount / nLoadFactor</tt> up to nearest power of two.
+
+            In growth mode (see \p michael_map::traits::resizable) \p nMaxItemCount is the initial estimation only:
+            the hash table is doubled when the item count exceeds <tt>bucket_count() * nLoadFactor</tt>.
         */
         MichaelHashMap(
             size_t nMaxItemCount,   ///< estimation of max item count in the hash map
             size_t nLoadFactor      ///< load factor: estimation of max number of items in the bucket
             )
             : m_nHashBitmask( michael_map::details::init_hash_bitmask( nMaxItemCount, nLoadFactor ))
-            , m_Buckets( bucket_table_allocator().allocate( bucket_count()))
+            , m_Buckets( c_bResizable ? nullptr : bucket_table_allocator().allocate( m_nHashBitmask + 1 ))
+            , m_pTable( nullptr )
+            , m_nBucketCount( m_nHashBitmask + 1 )
+            , m_nLoadFactor( nLoadFactor ? nLoadFactor : 1 )
         {
-            for ( auto it = m_Buckets, itEnd = m_Buckets + bucket_count(); it != itEnd; ++it )
-                construct_bucket<bucket_stat>( it );
+            if ( c_bResizable )
+                m_pTable.store( alloc_table( m_nHashBitmask ), atomics::memory_order_release );
+            else {
+                for ( auto it = m_Buckets, itEnd = m_Buckets + bucket_count(); it != itEnd; ++it )
+                    construct_bucket<bucket_stat>( it );
+            }
         }
 
         /// Clears hash map and destroys it
         ~MichaelHashMap()
         {
+            if ( c_bResizable ) {
+                bucket_table * pTable = m_pTable.load( atomics::memory_order_relaxed );
+                bucket_table * pNext = pTable->pNext.load( atomics::memory_order_relaxed );
+                free_table( pTable );
+                if ( pNext )
+                    free_table( pNext );
+                return;
+            }
+
             clear();
 
             for ( auto it = m_Buckets, itEnd = m_Buckets + bucket_count(); it != itEnd; ++it )
@@ -428,9 +733,9 @@ namespace cds { namespace container {
         template <typename K>
         bool insert( K&& key )
         {
-            const bool bRet = bucket( key ).insert( std::forward<K>( key ));
+            const bool bRet = update_bucket( key, [&]( internal_bucket_type& b ) { return b.insert( std::forward<K>( key )); });
             if ( bRet )
-                ++m_ItemCounter;
+                item_inserted();
             return bRet;
         }
 
@@ -448,9 +753,11 @@ namespace cds { namespace container {
         template <typename K, typename V>
         bool insert( K&& key, V&& val )
         {
-            const bool bRet = bucket( key ).insert( std::forward<K>( key ), std::forward<V>( val ));
+            const bool bRet = update_bucket( key, [&]( internal_bucket_type& b ) {
+                return b.insert( std::forward<K>( key ), std::forward<V>( val ));
+            });
             if ( bRet )
-                ++m_ItemCounter;
+                item_inserted();
             return bRet;
         }
 
@@ -488,9 +795,9 @@ namespace cds { namespace container {
         template <typename K, typename Func>
         bool insert_with( K&& key, Func func )
         {
-            const bool bRet = bucket( key ).insert_with( std::forward<K>( key ), func );
+            const bool bRet = update_bucket( key, [&]( internal_bucket_type& b ) { return b.insert_with( std::forward<K>( key ), func ); });
             if ( bRet )
-                ++m_ItemCounter;
+                item_inserted();
             return bRet;
         }
 
@@ -540,9 +847,11 @@ namespace cds { namespace container {
         template <typename K, typename Func >
         std::pair<bool, bool> update( K&& key, Func func, bool bAllowInsert = true )
         {
-            std::pair<bool, bool> bRet = bucket( key ).update( std::forward<K>( key ), func, bAllowInsert );
+            std::pair<bool, bool> bRet = update_bucket( key, [&]( internal_bucket_type& b ) {
+                return b.update( std::forward<K>( key ), func, bAllowInsert );
+            });
             if ( bRet.first && bRet.second )
-                ++m_ItemCounter;
+                item_inserted();
             return bRet;
         }
         //@cond
@@ -550,9 +859,9 @@ namespace cds { namespace container {
         CDS_DEPRECATED("ensure() is deprecated, use update()")
         std::pair<bool, bool> ensure( K const& key, Func func )
         {
-            std::pair<bool, bool> bRet = bucket( key ).update( key, func, true );
+            std::pair<bool, bool> bRet = update_bucket( key, [&]( internal_bucket_type& b ) { return b.update( key, func, true ); });
             if ( bRet.first && bRet.second )
-                ++m_ItemCounter;
+                item_inserted();
             return bRet;
         }
         //@endcond
@@ -594,9 +903,11 @@ namespace cds { namespace container {
         template <typename K, typename... Args>
         bool emplace( K&& key, Args&&... args )
         {
-            const bool bRet = bucket( key ).emplace( std::forward<K>(key), std::forward<Args>(args)... );
+            const bool bRet = update_bucket( key, [&]( internal_bucket_type& b ) {
+                return b.emplace( std::forward<K>( key ), std::forward<Args>( args )... );
+            });
             if ( bRet )
-                ++m_ItemCounter;
+                item_inserted();
             return bRet;
         }
 
@@ -608,7 +919,7 @@ namespace cds { namespace container {
         template <typename K>
         bool erase( K const& key )
         {
-            const bool bRet = bucket( key ).erase( key );
+            const bool bRet = update_bucket( key, [&]( internal_bucket_type& b ) { return b.erase( key ); });
             if ( bRet )
                 --m_ItemCounter;
             return bRet;
@@ -624,7 +935,7 @@ namespace cds { namespace container {
         template <typename K, typename Less>
         bool erase_with( K const& key, Less pred )
         {
-            const bool bRet = bucket( key ).erase_with( key, pred );
+            const bool bRet = update_bucket( key, [&]( internal_bucket_type& b ) { return b.erase_with( key, pred ); });
             if ( bRet )
                 --m_ItemCounter;
             return bRet;
@@ -648,7 +959,7 @@ namespace cds { namespace container {
         template <typename K, typename Func>
         bool erase( K const& key, Func f )
         {
-            const bool bRet = bucket( key ).erase( key, f );
+            const bool bRet = update_bucket( key, [&]( internal_bucket_type& b ) { return b.erase( key, f ); });
             if ( bRet )
                 --m_ItemCounter;
             return bRet;
@@ -664,7 +975,7 @@ namespace cds { namespace container {
         template <typename K, typename Less, typename Func>
         bool erase_with( K const& key, Less pred, Func f )
         {
-            const bool bRet = bucket( key ).erase_with( key, pred, f );
+            const bool bRet = update_bucket( key, [&]( internal_bucket_type& b ) { return b.erase_with( key, pred, f ); });
             if ( bRet )
                 --m_ItemCounter;
             return bRet;
@@ -727,7 +1038,7 @@ namespace cds { namespace container {
         template <typename K>
         guarded_ptr extract( K const& key )
         {
-            guarded_ptr gp( bucket( key ).extract( key ));
+            guarded_ptr gp( update_bucket( key, [&]( internal_bucket_type& b ) { return b.extract( key ); }));
             if ( gp )
                 --m_ItemCounter;
             return gp;
@@ -745,7 +1056,7 @@ namespace cds { namespace container {
         template <typename K, typename Less>
         guarded_ptr extract_with( K const& key, Less pred )
         {
-            guarded_ptr gp( bucket( key ).extract_with( key, pred ));
+            guarded_ptr gp( update_bucket( key, [&]( internal_bucket_type& b ) { return b.extract_with( key, pred ); }));
             if ( gp )
                 --m_ItemCounter;
             return gp;
@@ -768,12 +1079,16 @@ namespace cds { namespace container {
             The functor does not serialize simultaneous access to the map's \p item. If such access is
             possible you must provide your own synchronization schema on item level to exclude unsafe item modifications.
 
+            In growth mode (see \p michael_map::traits::resizable) the function is a lock-free lookup like \p contains():
+            it never helps to move the buckets and never waits for the bucket being moved.
+            The functor should not change \p item.second in this mode, the change may be lost when the bucket is copied to the new table.
+
             The function returns \p true if \p key is found, \p false otherwise.
         */
         template <typename K, typename Func>
         bool find( K const& key, Func f )
         {
-            return bucket( key ).find( key, f );
+            return find_bucket( key, [&]( internal_bucket_type& b ) { return b.find( key, f ); });
         }
 
         /// Finds \p key and returns iterator pointed to the item found (only for \p IterableList)
@@ -808,7 +1123,7 @@ namespace cds { namespace container {
         template <typename K, typename Less, typename Func>
         bool find_with( K const& key, Less pred, Func f )
         {
-            return bucket( key ).find_with( key, pred, f );
+            return find_bucket( key, [&]( internal_bucket_type& b ) { return b.find_with( key, pred, f ); });
         }
 
         /// Finds \p key using \p pred predicate and returns iterator pointed to the item found (only for \p IterableList)
@@ -844,7 +1159,7 @@ namespace cds { namespace container {
         template <typename K>
         bool contains( K const& key )
         {
-            return bucket( key ).contains( key );
+            return find_bucket( key, [&]( internal_bucket_type& b ) { return b.contains( key ); });
         }
 
         /// Checks whether the map contains \p key using \p pred predicate for searching
@@ -856,7 +1171,7 @@ namespace cds { namespace container {
         template <typename K, typename Less>
         bool contains( K const& key, Less pred )
         {
-            return bucket( key ).contains( key, pred );
+            return find_bucket( key, [&]( internal_bucket_type& b ) { return b.contains( key, pred ); });
         }
 
         /// Finds \p key and return the item found
@@ -867,6 +1182,10 @@ namespace cds { namespace container {
 
             @note Each \p guarded_ptr object uses one GC's guard which can be limited resource.
 
+            @note In growth mode (see \p michael_map::traits::resizable) the item should not be changed through \p guarded_ptr:
+            the bucket may be copied to the new table at the same time, and the change is lost.
+            Use \p update() or \p find() with a functor to change \p item.second.
+
             Usage:
             \code
             typedef cds::container::MichaeHashMap< your_template_params >  michael_map;
@@ -888,7 +1207,7 @@ namespace cds { namespace container {
         template <typename K>
         guarded_ptr get( K const& key )
         {
-            return bucket( key ).get( key );
+            return find_bucket( key, [&]( internal_bucket_type& b ) { return b.get( key ); });
         }
 
         /// Finds \p key and return the item found
@@ -903,14 +1222,18 @@ namespace cds { namespace container {
         template <typename K, typename Less>
         guarded_ptr get_with( K const& key, Less pred )
         {
-            return bucket( key ).get_with( key, pred );
+            return find_bucket( key, [&]( internal_bucket_type& b ) { return b.get_with( key, pred ); });
         }
 
         /// Clears the map (not atomic)
         void clear()
         {
-            for ( size_t i = 0; i < bucket_count(); ++i )
-                m_Buckets[i].clear();
+            if ( c_bResizable )
+                clear_table();
+            else {
+                for ( size_t i = 0; i < bucket_count(); ++i )
+                    m_Buckets[i].clear();
+            }
             m_ItemCounter.reset();
         }
 
@@ -936,13 +1259,16 @@ namespace cds { namespace container {
 
         /// Returns the size of hash table
         /**
-            Since \p %MichaelHashMap cannot dynamically extend the hash table size,
+            If the growth mode is off (the default), \p %MichaelHashMap cannot dynamically extend the hash table size,
             the value returned is an constant depending on object initialization parameters;
             see \p MichaelHashMap::MichaelHashMap for explanation.
+
+            In growth mode the function returns the size of current hash table.
+            While the buckets are being moved to the doubled table, the size of the old table is returned.
         */
         size_t bucket_count() const
         {
-            return m_nHashBitmask + 1;
+            return c_bResizable ? m_nBucketCount.load( atomics::memory_order_acquire ) : m_nHashBitmask + 1;
         }
 
         /// Returns const reference to internal statistics
@@ -966,26 +1292,289 @@ namespace cds { namespace container {
         {
             return m_Buckets[hash_value( key )];
         }
+
+        /// Calls \p f( bucket ) for updating operation
+        template <typename Q, typename Func>
+        auto update_bucket( Q const& key, Func f ) -> decltype( f( std::declval<internal_bucket_type&>()))
+        {
+            return update_bucket( key, f, std::integral_constant< bool, c_bResizable >());
+        }
+
+        /// Calls \p f( bucket ) for lookup operation
+        template <typename Q, typename Func>
+        auto find_bucket( Q const& key, Func f ) -> decltype( f( std::declval<internal_bucket_type&>()))
+        {
+            return find_bucket( key, f, std::integral_constant< bool, c_bResizable >());
+        }
         //@endcond
 
     private:
         //@cond
+        template <typename Q, typename Func>
+        auto update_bucket( Q const& key, Func& f, std::false_type ) -> decltype( f( std::declval<internal_bucket_type&>()))
+        {
+            return f( bucket( key ));
+        }
+
+        template <typename Q, typename Func>
+        auto find_bucket( Q const& key, Func& f, std::false_type ) -> decltype( f( std::declval<internal_bucket_type&>()))
+        {
+            return f( bucket( key ));
+        }
+
+        // Growth mode: leaves the bucket entered by updating operation
+        struct bucket_updater {
+            atomics::atomic<size_t>& m_State;
+
+            ~bucket_updater()
+            {
+                m_State.fetch_sub( 1, atomics::memory_order_release );
+            }
+        };
+
+        template <typename Q, typename Func>
+        auto update_bucket( Q const& key, Func& f, std::true_type ) -> decltype( f( std::declval<internal_bucket_type&>()))
+        {
+            typename gc::Guard guard;
+            bucket_table * pTable = guard.protect( m_pTable );
+            size_t const nHash = m_HashFunctor( key );
+            back_off bkoff;
+
+            while ( true ) {
+                // Each updating operation helps to move the buckets if the table is growing
+                if ( pTable->pNext.load( atomics::memory_order_acquire ) != nullptr )
+                    help_migrate( pTable );
+
+                size_t const nIdx = nHash & pTable->nHashBitmask;
+                atomics::atomic<size_t>& state = pTable->pState[nIdx];
+                size_t nState = state.load( atomics::memory_order_acquire );
+                if ( nState & c_nMigrated )
+                    pTable = next_table( guard, pTable );
+                else if ( nState & c_nFrozen ) {
+                    // the bucket is being moved by another thread
+                    bkoff();
+                }
+                else if ( state.compare_exchange_weak( nState, nState + 1, atomics::memory_order_acquire, atomics::memory_order_relaxed )) {
+                    bucket_updater updater{ state };
+                    return f( pTable->pBuckets[nIdx] );
+                }
+            }
+        }
+
+        template <typename Q, typename Func>
+        auto find_bucket( Q const& key, Func& f, std::true_type ) -> decltype( f( std::declval<internal_bucket_type&>()))
+        {
+            typename gc::Guard guard;
+            bucket_table * pTable = guard.protect( m_pTable );
+            size_t const nHash = m_HashFunctor( key );
+
+            while ( true ) {
+                size_t const nIdx = nHash & pTable->nHashBitmask;
+                atomics::atomic<size_t>& state = pTable->pState[nIdx];
+                if ( !( state.load( atomics::memory_order_acquire ) & c_nMigrated )) {
+                    auto ret = f( pTable->pBuckets[nIdx] );
+
+                    // The bucket content is actual until the bucket is marked as migrated.
+                    // If the key is not found, the bucket may have been migrated and cleared during the search
+                    if ( is_found( ret ) || !( state.load( atomics::memory_order_acquire ) & c_nMigrated ))
+                        return ret;
+                }
+                pTable = next_table( guard, pTable );
+            }
+        }
+
+        static bool is_found( bool bFound )
+        {
+            return bFound;
+        }
+
+        static bool is_found( guarded_ptr const& gp )
+        {
+            return !gp.empty();
+        }
+
+        // Returns the table the buckets of pTable are moved to; pTable is guarded by guard
+        bucket_table * next_table( typename gc::Guard& guard, bucket_table * pTable )
+        {
+            bucket_table * pNext = pTable->pNext.load( atomics::memory_order_acquire );
+            assert( pNext != nullptr );
+            guard.assign( pNext );
+
+            // The next table cannot be retired while pTable or the next table is the current one
+            bucket_table * pCur = m_pTable.load( atomics::memory_order_acquire );
+            if ( pCur == pTable || pCur == pNext )
+                return pNext;
+            return guard.protect( m_pTable );
+        }
+
+        void help_migrate( bucket_table * pTable )
+        {
+            size_t const nIdx = pTable->nCursor.fetch_add( 1, atomics::memory_order_relaxed );
+            if ( nIdx <= pTable->nHashBitmask )
+                migrate_bucket( pTable, nIdx );
+        }
+
+        void migrate_bucket( bucket_table * pTable, size_t nIdx )
+        {
+            atomics::atomic<size_t>& state = pTable->pState[nIdx];
+            state.fetch_or( c_nFrozen, atomics::memory_order_acq_rel );
+
+            // wait for the updating operations entered the bucket before freezing
+            back_off bkoff;
+            while ( state.load( atomics::memory_order_acquire ) & c_nUpdaterMask )
+                bkoff();
+
+            // The bucket is frozen, so the items are copied to the next table without any interference.
+            // The lookups still search the old bucket until it is marked as migrated
+            bucket_table * pNext = pTable->pNext.load( atomics::memory_order_acquire );
+            internal_bucket_type& b = pTable->pBuckets[nIdx];
+            b.scan_frozen( [this, pNext]( value_type& item ) {
+                pNext->pBuckets[ m_HashFunctor( item.first ) & pNext->nHashBitmask ].insert( item.first, item.second );
+            });
+            state.store( c_nFrozen | c_nMigrated, atomics::memory_order_release );
+            b.clear();
+
+            if ( pTable->nMigrated.fetch_add( 1, atomics::memory_order_acq_rel ) == pTable->nHashBitmask ) {
+                // All buckets have been moved
+                m_pTable.store( pNext, atomics::memory_order_release );
+                m_nBucketCount.store( pNext->nHashBitmask + 1, atomics::memory_order_release );
+                gc::template retire< table_disposer >( pTable );
+            }
+        }
+
+        // The buckets traversed by iterators
+        void iteration_range( empty_table_guard&, internal_bucket_type*& pBegin, internal_bucket_type*& pEnd )
+        {
+            pBegin = bucket_begin();
+            pEnd = bucket_end();
+        }
+
+        // Growth mode: finishes the migration in progress and returns the buckets of the current table guarded by g.
+        // Waits for the buckets being moved by other threads, so no item is skipped because its bucket is frozen
+        void iteration_range( iterator_table_guard& g, internal_bucket_type*& pBegin, internal_bucket_type*& pEnd )
+        {
+            typename gc::Guard& guard = g.guard();
+            bucket_table * pTable = guard.protect( m_pTable );
+            back_off bkoff;
+            while ( pTable->pNext.load( atomics::memory_order_acquire ) != nullptr ) {
+                if ( pTable->nCursor.load( atomics::memory_order_relaxed ) <= pTable->nHashBitmask )
+                    help_migrate( pTable );
+                else
+                    bkoff();
+                pTable = guard.protect( m_pTable );
+            }
+            pBegin = pTable->pBuckets;
+            pEnd = pTable->pBuckets + pTable->nHashBitmask + 1;
+        }
+
+        void item_inserted()
+        {
+            ++m_ItemCounter;
+            if ( c_bResizable && m_ItemCounter.value() > m_nBucketCount.load( atomics::memory_order_relaxed ) * m_nLoadFactor )
+                grow();
+        }
+
+        void grow()
+        {
+            typename gc::Guard guard;
+            bucket_table * pTable = guard.protect( m_pTable );
+            if ( pTable->pNext.load( atomics::memory_order_relaxed ) == nullptr
+                && m_ItemCounter.value() > ( pTable->nHashBitmask + 1 ) * m_nLoadFactor )
+            {
+                bucket_table * pNew = alloc_table( pTable->nHashBitmask * 2 + 1 );
+                bucket_table * pExpected = nullptr;
+                if ( !pTable->pNext.compare_exchange_strong( pExpected, pNew, atomics::memory_order_release, atomics::memory_order_relaxed ))
+                    free_table( pNew );
+            }
+        }
+
+        void clear_table()
+        {
+            typename gc::Guard guard;
+            bucket_table * pTable = guard.protect( m_pTable );
+            while ( true ) {
+                for ( size_t i = 0; i <= pTable->nHashBitmask; ++i ) {
+                    atomics::atomic<size_t>& state = pTable->pState[i];
+                    back_off bkoff;
+                    size_t nState = state.load( atomics::memory_order_acquire );
+                    while ( !( nState & c_nMigrated )) {
+                        if ( !( nState & c_nFrozen ) && state.compare_exchange_weak( nState, nState + 1, atomics::memory_order_acquire, atomics::memory_order_relaxed )) {
+                            bucket_updater updater{ state };
+                            pTable->pBuckets[i].clear();
+                            break;
+                        }
+                        bkoff();
+                        nState = state.load( atomics::memory_order_acquire );
+                    }
+                }
+
+                // The migrated buckets are cleared in the next table
+                if ( pTable->pNext.load( atomics::memory_order_acquire ) == nullptr )
+                    break;
+                pTable = next_table( guard, pTable );
+            }
+        }
+
+        bucket_table * alloc_table( size_t nMask )
+        {
+            bucket_table * pTable = table_allocator().New( nMask );
+            pTable->pBuckets = bucket_table_allocator().allocate( nMask + 1 );
+            for ( auto it = pTable->pBuckets, itEnd = pTable->pBuckets + nMask + 1; it != itEnd; ++it )
+                construct_bucket<bucket_stat>( it );
+            pTable->pState = state_allocator().NewArray( nMask + 1, size_t( 0 ));
+            return pTable;
+        }
+
+        void free_table( bucket_table * pTable )
+        {
+            for ( auto it = pTable->pBuckets, itEnd = pTable->pBuckets + pTable->nHashBitmask + 1; it != itEnd; ++it ) {
+                it->clear();
+                it->~internal_bucket_type();
+            }
+            dispose_table( pTable );
+        }
+
+        // The buckets of the retired table are already empty.
+        // The bucket dtor is not called since it may use GC's guard that is not allowed in the disposer
+        static void dispose_table( bucket_table * pTable )
+        {
+            size_t const nCount = pTable->nHashBitmask + 1;
+            bucket_table_allocator().deallocate( pTable->pBuckets, nCount );
+            state_allocator().Delete( pTable->pState, nCount );
+            table_allocator().Delete( pTable );
+        }
+
+        struct table_disposer {
+            void operator()( bucket_table * pTable )
+            {
+                dispose_table( pTable );
+            }
+        };
+
         internal_bucket_type* bucket_begin() const
         {
+            assert( !c_bResizable );
             return m_Buckets;
         }
 
         internal_bucket_type* bucket_end() const
         {
+            assert( !c_bResizable );
             return m_Buckets + bucket_count();
         }
 
         const_iterator get_const_begin() const
         {
-            return const_iterator( bucket_begin()->cbegin(), bucket_begin(), bucket_end());
+            table_guard guard;
+            internal_bucket_type * pBegin;
+            internal_bucket_type * pEnd;
+            const_cast<MichaelHashMap *>( this )->iteration_range( guard, pBegin, pEnd );
+            return const_iterator( guard, pBegin->cbegin(), pBegin, pEnd );
         }
         const_iterator get_const_end() const
         {
+            if ( c_bResizable )
+                return const_iterator();
             return const_iterator( (bucket_end() - 1)->cend(), bucket_end() - 1, bucket_end());
         }
 
@@ -0,0 +1,781 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2017
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef CDSLIB_CONTAINER_SWISS_HASH_MAP_H
+#define CDSLIB_CONTAINER_SWISS_HASH_MAP_H
+
+#include <cstring>  // memcpy
+#include <cds/container/details/swiss_hash_map_base.h>
+#include <cds/details/allocator.h>
+#include <cds/algo/int_algo.h>
+
+namespace cds { namespace container {
+
+    /// Lock-free open-addressing hash map for word-sized keys and values
+    /** @ingroup cds_nonintrusive_map
+        @anchor cds_nonintrusive_SwissHashMap_hp
+
+        The map is a flat table of slots grouped by 16. Each group has 16 control bytes:
+        a control byte of the occupied slot keeps 7 high bits of the hash of its key,
+        the free slot has the special control byte. The lookup compares the control bytes of
+        a whole group with the hash tag at once (by SSE2 on x86-64, by SWAR technique otherwise)
+        and checks only the keys of the matched slots, so usually only one key is compared.
+        The groups are probed in triangular sequence.
+
+        The key and the value are stored in the slot "as is", in a 64bit atomic word each,
+        so all operations are lock-free CAS on the slot words:
+        - the key is written into the free slot once and never changes up to the table is discarded;
+        - the erasing replaces the value with the tombstone, the slot stays bound to its key
+          and will be reused if the key is inserted again.
+
+        When 7/8 of the slots of the table are bound to the keys, the map allocates the new table
+        (twice bigger if there are enough live items, the same size if the table is polluted by tombstones)
+        and starts cooperative migration: each modifying operation moves a chunk of the groups
+        of the old table to the new one. During the migration each operation starts from the old table
+        and continues in the new one if the slot of the key has been migrated already. When all
+        chunks are moved the new table becomes current, and the old table is retired via \p GC.
+
+        Restrictions:
+        - \p Key and \p T must be trivially copyable types not larger than 64 bits.
+          The keys are compared bitwise, so the key type must not have padding bytes.
+        - the key with all bits set and the key <tt>~0 - 1</tt> (as 64bit word) are reserved.
+          The same is for the value. These bit patterns are achievable only for 8-byte types.
+        - the map has no iterators. The values are copied out: \p find() and \p erase() functors
+          get a copy of the item.
+        - the item counter is mandatory, \p atomicity::empty_item_counter is not allowed.
+
+        Template parameters:
+        - \p GC - safe memory reclamation schema used to retire the old tables: \p gc::HP or \p gc::DHP
+        - \p Key - a key type
+        - \p T - a value type
+        - \p Traits - type traits, the structure based on \p swiss_hash_map::traits or result of \p swiss_hash_map::make_traits metafunction.
+
+        You should include <tt><cds/container/swiss_hash_map.h></tt> and the header of the garbage collector.
+    */
+    template <
+        class GC
+        ,typename Key
+        ,typename T
+#ifdef CDS_DOXYGEN_INVOKED
+        ,class Traits = swiss_hash_map::traits
+#else
+        ,class Traits
+#endif
+    >
+    class SwissHashMap
+    {
+    public:
+        typedef GC      gc;          ///< Garbage collector
+        typedef Key     key_type;    ///< Key type
+        typedef T       mapped_type; ///< Mapped type
+        typedef std::pair< key_type const, mapped_type> value_type;   ///< Key-value pair
+        typedef Traits  traits;      ///< Map traits
+
+#ifdef CDS_DOXYGEN_INVOKED
+        typedef typename traits::hash hasher; ///< Hash functor, see \p swiss_hash_map::traits::hash
+#else
+        typedef typename cds::opt::v::hash_selector< typename traits::hash >::type hasher;
+#endif
+        typedef typename traits::item_counter   item_counter;   ///< Item counter type
+        typedef typename traits::stat           stat;           ///< Internal statistics type
+        typedef typename traits::back_off       back_off;       ///< Back-off strategy
+        typedef typename traits::allocator      allocator;      ///< Table allocator
+
+        /// Count of hazard pointer required
+        static constexpr const size_t c_nHazardPtrCount = 1;
+
+        static_assert( std::is_trivially_copyable< key_type >::value && sizeof( key_type ) <= sizeof( uint64_t ),
+            "SwissHashMap: the key must be trivially copyable and fit in 64bit word" );
+        static_assert( std::is_trivially_copyable< mapped_type >::value && sizeof( mapped_type ) <= sizeof( uint64_t ),
+            "SwissHashMap: the value must be trivially copyable and fit in 64bit word" );
+        static_assert( !std::is_same< item_counter, cds::atomicity::empty_item_counter >::value,
+            "SwissHashMap requires an item counter" );
+
+    protected:
+        //@cond
+        static constexpr uint64_t const c_nEmptyKey = ~uint64_t( 0 );       // the slot is free
+        static constexpr uint64_t const c_nSealedKey = ~uint64_t( 0 ) - 1;  // the free slot is closed by the migration
+        static constexpr uint64_t const c_nAbsent = ~uint64_t( 0 );         // no value: the slot is not used yet or the key is erased
+        static constexpr uint64_t const c_nMoved = ~uint64_t( 0 ) - 1;      // the value has been moved to the next table
+
+        static constexpr size_t const c_nGroupSize = swiss_hash_map::details::c_nGroupSize;
+        static constexpr size_t const c_nChunkSize = 8;   // groups migrated by one operation
+
+        struct slot {
+            atomics::atomic<uint64_t> key;
+            atomics::atomic<uint64_t> value;
+
+            slot()
+                : key( c_nEmptyKey )
+                , value( c_nAbsent )
+            {}
+        };
+
+        struct group {
+            atomics::atomic<uint64_t> ctrl[2];
+            slot slots[c_nGroupSize];
+
+            group()
+            {
+                ctrl[0].store( 0x8080808080808080ULL, atomics::memory_order_relaxed );
+                ctrl[1].store( 0x8080808080808080ULL, atomics::memory_order_relaxed );
+            }
+        };
+        static_assert( swiss_hash_map::details::c_nCtrlEmpty == 0x80, "Invalid initial control bytes" );
+
+        struct table {
+            size_t const                nGroupMask;
+            group * const               pGroups;
+            atomics::atomic<table *>    pNext;      // the table the items are migrated to
+            atomics::atomic<size_t>     nClaimed;   // count of the slots bound to a key
+            atomics::atomic<size_t>     nCursor;    // next chunk to migrate
+            atomics::atomic<size_t>     nMigrated;  // count of migrated chunks
+
+            table( size_t nMask, group * pGroupArr )
+                : nGroupMask( nMask )
+                , pGroups( pGroupArr )
+                , pNext( nullptr )
+                , nClaimed( 0 )
+                , nCursor( 0 )
+                , nMigrated( 0 )
+            {}
+
+            size_t capacity() const
+            {
+                return ( nGroupMask + 1 ) * c_nGroupSize;
+            }
+
+            size_t chunk_count() const
+            {
+                return ( nGroupMask + c_nChunkSize ) / c_nChunkSize;
+            }
+        };
+
+        typedef cds::details::Allocator< table, allocator > table_allocator;
+        typedef cds::details::Allocator< group, allocator > group_allocator;
+
+        enum class probe_result {
+            found,      // the slot of the key is found
+            not_found,  // the key is not in the map
+            next_table  // the key should be searched in the next table
+        };
+        //@endcond
+
+    protected:
+        //@cond
+        atomics::atomic<table *> m_pTable;
+        hasher          m_Hasher;
+        item_counter    m_ItemCounter;
+        stat            m_Stat;
+        //@endcond
+
+    public:
+        /// Creates the map
+        /**
+            \p nCapacity is an estimation of the item count. The map is resized automatically,
+            the initial capacity allows to avoid the resizing while the map is filling.
+        */
+        explicit SwissHashMap( size_t nCapacity = 0 )
+            : m_pTable( nullptr )
+        {
+            // The table is resized when 7/8 of the slots is used
+            m_pTable.store( alloc_table( cds::beans::ceil2( nCapacity * 8 / 7 / c_nGroupSize + 1 ) - 1 ), atomics::memory_order_release );
+        }
+
+        /// Destroys the map
+        ~SwissHashMap()
+        {
+            table * pTable = m_pTable.load( atomics::memory_order_relaxed );
+            while ( pTable ) {
+                table * pNext = pTable->pNext.load( atomics::memory_order_relaxed );
+                free_table( pTable );
+                pTable = pNext;
+            }
+        }
+
+        /// Inserts new item with key \p key and default value
+        /**
+            Returns \p true if \p key is inserted, \p false if \p key is already in the map.
+        */
+        bool insert( key_type const& key )
+        {
+            return insert( key, mapped_type());
+        }
+
+        /// Inserts new item
+        /**
+            Returns \p true if \p key is inserted, \p false if \p key is already in the map.
+        */
+        bool insert( key_type const& key, mapped_type const& val )
+        {
+            return insert_with( key, [&val]( value_type& item ) { item.second = val; } );
+        }
+
+        /// Inserts new item and initializes it by a functor
+        /**
+            The functor \p func is called with the copy of new item before it is inserted:
+            \code
+                struct functor {
+                    void operator()( value_type& item );
+                };
+            \endcode
+            The functor may change \p item.second. The functor is not called if \p key is already in the map,
+            however, it may be called for an unsuccessful insertion if the same key is inserted concurrently.
+            Returns \p true if \p key is inserted, \p false otherwise.
+        */
+        template <typename Func>
+        bool insert_with( key_type const& key, Func func )
+        {
+            bool bInserted = false;
+            with_slot( key, true, true, [&]( slot& s ) -> bool {
+                uint64_t v = s.value.load( atomics::memory_order_acquire );
+                if ( v == c_nAbsent ) {
+                    value_type item( key, mapped_type());
+                    func( item );
+                    uint64_t const nVal = to_value_word( item.second );
+                    do {
+                        if ( s.value.compare_exchange_weak( v, nVal, atomics::memory_order_acq_rel, atomics::memory_order_acquire )) {
+                            bInserted = true;
+                            return true;
+                        }
+                    } while ( v == c_nAbsent );
+                }
+                return v != c_nMoved;
+            });
+
+            if ( bInserted ) {
+                ++m_ItemCounter;
+                m_Stat.onInsertSuccess();
+            }
+            else
+                m_Stat.onInsertFailed();
+            return bInserted;
+        }
+
+        /// Updates the value of \p key
+        /**
+            If \p key is not found in the map and \p bAllowInsert is \p true,
+            the new item is created. The functor \p func is called with the copy of the item:
+            \code
+                struct my_functor {
+                    void operator()( bool bNew, value_type& item );
+                };
+            \endcode
+            with arguments:
+            - \p bNew - \p true if the item has been inserted, \p false otherwise
+            - \p item - copy of the item; the functor may change \p item.second.
+
+            The changed value is stored by CAS, so the functor may be called several times
+            if the item is concurrently modified.
+
+            Returns std::pair<bool, bool> where \p first is \p true if operation is successful,
+            \p second is \p true if new item has been added or \p false if the item with \p key
+            already exists.
+        */
+        template <typename Func>
+        std::pair<bool, bool> update( key_type const& key, Func func, bool bAllowInsert = true )
+        {
+            std::pair<bool, bool> res( false, false );
+            stat& st = m_Stat;
+            with_slot( key, true, bAllowInsert, [&]( slot& s ) -> bool {
+                uint64_t v = s.value.load( atomics::memory_order_acquire );
+                while ( v != c_nMoved ) {
+                    uint64_t nNew;
+                    if ( v == c_nAbsent ) {
+                        if ( !bAllowInsert )
+                            return true;
+                        value_type item( key, mapped_type());
+                        func( true, item );
+                        nNew = to_value_word( item.second );
+                    }
+                    else {
+                        value_type item( key, from_word<mapped_type>( v ));
+                        func( false, item );
+                        nNew = to_value_word( item.second );
+                    }
+
+                    if ( s.value.compare_exchange_weak( v, nNew, atomics::memory_order_acq_rel, atomics::memory_order_acquire )) {
+                        res = std::make_pair( true, v == c_nAbsent );
+                        return true;
+                    }
+                    st.onValueCasFailed();
+                }
+                return false;
+            });
+
+            if ( res.first ) {
+                if ( res.second ) {
+                    ++m_ItemCounter;
+                    m_Stat.onUpdateNew();
+                }
+                else
+                    m_Stat.onUpdateExisting();
+            }
+            else
+                m_Stat.onUpdateFailed();
+            return res;
+        }
+
+        /// Inserts or assigns the value of \p key
+        /**
+            Returns std::pair<bool, bool> where \p first is always \p true,
+            \p second is \p true if new item has been added.
+        */
+        std::pair<bool, bool> upsert( key_type const& key, mapped_type const& val )
+        {
+            return update( key, [&val]( bool, value_type& item ) { item.second = val; }, true );
+        }
+
+        /// Deletes \p key from the map
+        /**
+            Returns \p true if \p key is found and deleted, \p false otherwise.
+        */
+        bool erase( key_type const& key )
+        {
+            return erase( key, []( value_type const& ) {} );
+        }
+
+        /// Deletes \p key from the map
+        /**
+            The functor \p f is called with the copy of the deleted item:
+            \code
+            struct functor {
+                void operator()( value_type& item ) { ... }
+            };
+            \endcode
+
+            Returns \p true if \p key is found and deleted, \p false otherwise.
+        */
+        template <typename Func>
+        bool erase( key_type const& key, Func f )
+        {
+            uint64_t nOld = c_nAbsent;
+            stat& st = m_Stat;
+            with_slot( key, true, false, [&nOld, &st]( slot& s ) -> bool {
+                uint64_t v = s.value.load( atomics::memory_order_acquire );
+                while ( v != c_nAbsent ) {
+                    if ( v == c_nMoved )
+                        return false;
+                    if ( s.value.compare_exchange_weak( v, c_nAbsent, atomics::memory_order_acq_rel, atomics::memory_order_acquire )) {
+                        nOld = v;
+                        return true;
+                    }
+                    st.onValueCasFailed();
+                }
+                return true;
+            });
+
+            if ( nOld != c_nAbsent ) {
+                --m_ItemCounter;
+                m_Stat.onEraseSuccess();
+                value_type item( key, from_word<mapped_type>( nOld ));
+                f( item );
+                return true;
+            }
+            m_Stat.onEraseFailed();
+            return false;
+        }
+
+        /// Finds \p key and calls the functor \p f with the copy of the item found
+        /**
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+
+            The function returns \p true if \p key is found, \p false otherwise.
+        */
+        template <typename Func>
+        bool find( key_type const& key, Func f )
+        {
+            uint64_t nVal = c_nAbsent;
+            with_slot( key, false, false, [&nVal]( slot& s ) -> bool {
+                nVal = s.value.load( atomics::memory_order_acquire );
+                return nVal != c_nMoved;
+            });
+
+            if ( nVal != c_nAbsent ) {
+                m_Stat.onFindSuccess();
+                value_type item( key, from_word<mapped_type>( nVal ));
+                f( item );
+                return true;
+            }
+            m_Stat.onFindFailed();
+            return false;
+        }
+
+        /// Checks whether the map contains \p key
+        bool contains( key_type const& key )
+        {
+            return find( key, []( value_type& ) {} );
+        }
+
+        /// Clears the map (not atomic)
+        /**
+            The function erases all items one by one. The tables are not shrunk.
+        */
+        void clear()
+        {
+            typename gc::Guard guard;
+            table * pTable = guard.protect( m_pTable );
+            while ( true ) {
+                for ( group * pGroup = pTable->pGroups, *pEnd = pTable->pGroups + pTable->nGroupMask + 1; pGroup != pEnd; ++pGroup ) {
+                    for ( slot& s : pGroup->slots ) {
+                        uint64_t v = s.value.load( atomics::memory_order_acquire );
+                        while ( v != c_nAbsent && v != c_nMoved ) {
+                            if ( s.value.compare_exchange_weak( v, c_nAbsent, atomics::memory_order_acq_rel, atomics::memory_order_acquire )) {
+                                --m_ItemCounter;
+                                break;
+                            }
+                        }
+                    }
+                }
+
+                // The moved items are cleared in the next table
+                table * pNext = pTable->pNext.load( atomics::memory_order_acquire );
+                if ( !pNext )
+                    break;
+                pTable = next_table( guard, pTable, pNext );
+            }
+        }
+
+        /// Checks if the map is empty
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        /// Returns item count in the map
+        size_t size() const
+        {
+            return m_ItemCounter.value();
+        }
+
+        /// Returns the slot count of the current table
+        size_t capacity() const
+        {
+            typename gc::Guard guard;
+            return guard.protect( m_pTable )->capacity();
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return m_Stat;
+        }
+
+    protected:
+        //@cond
+        template <typename Q>
+        static uint64_t to_word( Q const& v )
+        {
+            uint64_t w = 0;
+            memcpy( &w, &v, sizeof( Q ));
+            return w;
+        }
+
+        static uint64_t to_value_word( mapped_type const& val )
+        {
+            uint64_t const w = to_word( val );
+            assert( w != c_nAbsent && w != c_nMoved );
+            return w;
+        }
+
+        template <typename Q>
+        static Q from_word( uint64_t w )
+        {
+            typename std::aligned_storage< sizeof( Q ), alignof( Q ) >::type buf;
+            memcpy( &buf, &w, sizeof( Q ));
+            return *reinterpret_cast<Q *>( &buf );
+        }
+
+        uint64_t hash_of( key_type const& key ) const
+        {
+            return swiss_hash_map::details::mix_hash( static_cast<uint64_t>( m_Hasher( key )));
+        }
+
+        // Finds the slot of the key and calls f( slot& ) for it.
+        // f returns false if the value of the slot has been moved to the next table.
+        // bUpdate - the operation changes the map and should help to migrate the table
+        // bClaim - bind a free slot to the key if the key is not found
+        template <typename Func>
+        void with_slot( key_type const& key, bool bUpdate, bool bClaim, Func f )
+        {
+            uint64_t const nKey = to_word( key );
+            assert( nKey != c_nEmptyKey && nKey != c_nSealedKey );
+            uint64_t const nHash = hash_of( key );
+
+            typename gc::Guard guard;
+            table * pTable = bUpdate ? current_table( guard ) : guard.protect( m_pTable );
+            while ( true ) {
+                slot * pSlot = nullptr;
+                probe_result const res = probe( pTable, nKey, nHash, bClaim, pSlot );
+                if ( res == probe_result::not_found )
+                    return;
+                if ( res == probe_result::found && f( *pSlot ))
+                    return;
+
+                table * pNext = pTable->pNext.load( atomics::memory_order_acquire );
+                if ( !pNext ) {
+                    // pTable is full
+                    if ( !bClaim )
+                        return;
+                    pNext = start_resize( pTable );
+                }
+                m_Stat.onNextTable();
+                pTable = next_table( guard, pTable, pNext );
+            }
+        }
+
+        probe_result probe( table * pTable, uint64_t nKey, uint64_t nHash, bool bClaim, slot *& pSlot )
+        {
+            using swiss_hash_map::details::ctrl_group;
+            uint8_t const nTag = static_cast<uint8_t>( nHash >> 57 );
+            size_t const nMask = pTable->nGroupMask;
+            size_t nGroup = static_cast<size_t>( nHash ) & nMask;
+
+            for ( size_t nProbe = 1; nProbe <= nMask + 1; ++nProbe ) {
+                group& g = pTable->pGroups[nGroup];
+                ctrl_group const ctrl = { g.ctrl[0].load( atomics::memory_order_acquire ), g.ctrl[1].load( atomics::memory_order_acquire ) };
+                unsigned const nMatch = ctrl.match( nTag );
+
+                // The candidates are the slots with matched tag and the free ones in slot order.
+                // A free slot may have the key already if its control byte is not published yet
+                for ( unsigned nCandidates = nMatch | ctrl.match_special(); nCandidates; nCandidates &= nCandidates - 1 ) {
+                    unsigned const i = static_cast<unsigned>( cds::bitop::LSBnz( nCandidates ));
+                    slot& s = g.slots[i];
+                    uint64_t k = s.key.load( atomics::memory_order_acquire );
+                    if ( k == c_nSealedKey )
+                        return probe_result::next_table;
+                    if ( k == c_nEmptyKey ) {
+                        // The first free slot of the probe sequence: the key is not in the table
+                        if ( !bClaim )
+                            return probe_result::not_found;
+                        if ( s.key.compare_exchange_strong( k, nKey, atomics::memory_order_acq_rel, atomics::memory_order_acquire )) {
+                            if ( pTable->nClaimed.fetch_add( 1, atomics::memory_order_relaxed ) + 1 > pTable->capacity() / 8 * 7 )
+                                start_resize( pTable );
+                        }
+                        else if ( k == c_nSealedKey )
+                            return probe_result::next_table;
+                        else if ( k != nKey )
+                            continue;
+                    }
+                    else if ( k != nKey )
+                        continue;
+
+                    // The slot of the key. The control byte is published before the value is changed
+                    if ( !( nMatch & ( 1u << i )) && !publish_tag( g, i, nTag ))
+                        return probe_result::next_table;
+                    pSlot = &s;
+                    return probe_result::found;
+                }
+
+                m_Stat.onGroupProbe();
+                nGroup = ( nGroup + nProbe ) & nMask;
+            }
+
+            m_Stat.onTableFull();
+            return probe_result::next_table;
+        }
+
+        // Sets the control byte of the slot bound to the key
+        // Returns false if the slot is sealed by the migration
+        static bool publish_tag( group& g, size_t nSlot, uint8_t nTag )
+        {
+            using namespace swiss_hash_map::details;
+            atomics::atomic<uint64_t>& ctrl = g.ctrl[nSlot / 8];
+            uint64_t w = ctrl.load( atomics::memory_order_acquire );
+            while ( true ) {
+                uint8_t const b = ctrl_byte( w, nSlot );
+                if ( b == nTag )
+                    return true;
+                if ( b == c_nCtrlSealed )
+                    return false;
+                assert( b == c_nCtrlEmpty );
+                if ( ctrl.compare_exchange_weak( w, set_ctrl_byte( w, nSlot, nTag ), atomics::memory_order_acq_rel, atomics::memory_order_acquire ))
+                    return true;
+            }
+        }
+
+        // Protects the current table and helps to migrate it
+        table * current_table( typename gc::Guard& guard )
+        {
+            table * pTable = guard.protect( m_pTable );
+            table * pNext = pTable->pNext.load( atomics::memory_order_acquire );
+            if ( pNext ) {
+                size_t const nChunk = pTable->nCursor.fetch_add( 1, atomics::memory_order_relaxed );
+                if ( nChunk < pTable->chunk_count()) {
+                    migrate_chunk( pTable, pNext, nChunk );
+                    pTable = guard.protect( m_pTable );
+                }
+            }
+            return pTable;
+        }
+
+        // Returns pNext that is the next table of pTable; pTable is guarded by guard
+        table * next_table( typename gc::Guard& guard, table * pTable, table * pNext )
+        {
+            guard.assign( pNext );
+
+            // The next table cannot be retired while pTable or the next table is the current one
+            table * pCur = m_pTable.load( atomics::memory_order_acquire );
+            if ( pCur == pTable || pCur == pNext )
+                return pNext;
+            return guard.protect( m_pTable );
+        }
+
+        table * start_resize( table * pTable )
+        {
+            table * pNext = pTable->pNext.load( atomics::memory_order_acquire );
+            if ( pNext )
+                return pNext;
+
+            // If the table is polluted by tombstones it is rehashed to the table of the same size
+            size_t nGroups = pTable->nGroupMask + 1;
+            size_t const nLive = m_ItemCounter.value();
+            if ( nLive >= pTable->capacity() / 2 ) {
+                nGroups *= 2;
+                while ( nLive * 2 > nGroups * c_nGroupSize )
+                    nGroups *= 2;
+            }
+
+            table * pNew = alloc_table( nGroups - 1 );
+            if ( pTable->pNext.compare_exchange_strong( pNext, pNew, atomics::memory_order_acq_rel, atomics::memory_order_acquire )) {
+                m_Stat.onResize();
+                return pNew;
+            }
+            free_table( pNew );
+            return pNext;
+        }
+
+        void migrate_chunk( table * pTable, table * pNext, size_t nChunk )
+        {
+            group * pGroup = pTable->pGroups + nChunk * c_nChunkSize;
+            group * pEnd = pTable->pGroups + std::min( ( nChunk + 1 ) * c_nChunkSize, pTable->nGroupMask + 1 );
+            for ( ; pGroup != pEnd; ++pGroup ) {
+                for ( size_t i = 0; i < c_nGroupSize; ++i )
+                    migrate_slot( *pGroup, i, pNext );
+            }
+            m_Stat.onChunkMigrated();
+
+            if ( pTable->nMigrated.fetch_add( 1, atomics::memory_order_acq_rel ) + 1 == pTable->chunk_count()) {
+                // All chunks have been moved. pTable is the current table since only the current table is migrated
+                m_pTable.store( pNext, atomics::memory_order_release );
+                gc::template retire< table_disposer >( pTable );
+            }
+        }
+
+        void migrate_slot( group& g, size_t nSlot, table * pNext )
+        {
+            using namespace swiss_hash_map::details;
+            slot& s = g.slots[nSlot];
+
+            // Close the free slot
+            uint64_t nKey = s.key.load( atomics::memory_order_acquire );
+            if ( nKey == c_nEmptyKey && s.key.compare_exchange_strong( nKey, c_nSealedKey, atomics::memory_order_acq_rel, atomics::memory_order_acquire ))
+                return;
+
+            // The slot is bound to a key. If the control byte is not published the slot is never used
+            atomics::atomic<uint64_t>& ctrl = g.ctrl[nSlot / 8];
+            uint64_t w = ctrl.load( atomics::memory_order_acquire );
+            while ( ctrl_byte( w, nSlot ) == c_nCtrlEmpty ) {
+                if ( ctrl.compare_exchange_weak( w, set_ctrl_byte( w, nSlot, c_nCtrlSealed ), atomics::memory_order_acq_rel, atomics::memory_order_acquire ))
+                    return;
+            }
+
+            // Copy the value to the next table and mark the slot as moved.
+            // Nobody changes the key in the next table until the value in the old table is marked as moved,
+            // so the value copied is overwritten if the old value is changed before marking
+            uint64_t const nHash = hash_of( from_word<key_type>( nKey ));
+            uint64_t v = s.value.load( atomics::memory_order_acquire );
+            bool bCopied = false;
+            while ( true ) {
+                assert( v != c_nMoved );
+                if ( v != c_nAbsent || bCopied ) {
+                    copy_value( pNext, nKey, nHash, v );
+                    bCopied = true;
+                }
+                if ( s.value.compare_exchange_weak( v, c_nMoved, atomics::memory_order_acq_rel, atomics::memory_order_acquire ))
+                    break;
+            }
+        }
+
+        // Stores the value of the key into pTable or to its successor.
+        // The tables cannot be retired while the migration of their predecessor is not finished
+        void copy_value( table * pTable, uint64_t nKey, uint64_t nHash, uint64_t nVal )
+        {
+            while ( true ) {
+                slot * pSlot = nullptr;
+                probe_result const res = probe( pTable, nKey, nHash, nVal != c_nAbsent, pSlot );
+                if ( res == probe_result::not_found )
+                    return;
+                if ( res == probe_result::found ) {
+                    uint64_t v = pSlot->value.load( atomics::memory_order_acquire );
+                    while ( v != c_nMoved ) {
+                        if ( pSlot->value.compare_exchange_weak( v, nVal, atomics::memory_order_acq_rel, atomics::memory_order_acquire ))
+                            return;
+                    }
+                }
+
+                table * pNext = pTable->pNext.load( atomics::memory_order_acquire );
+                if ( !pNext ) {
+                    if ( nVal == c_nAbsent )
+                        return;
+                    pNext = start_resize( pTable );
+                }
+                pTable = pNext;
+            }
+        }
+
+        static table * alloc_table( size_t nGroupMask )
+        {
+            return table_allocator().New( nGroupMask, group_allocator().NewArray( nGroupMask + 1 ));
+        }
+
+        static void free_table( table * pTable )
+        {
+            group_allocator().Delete( pTable->pGroups, pTable->nGroupMask + 1 );
+            table_allocator().Delete( pTable );
+        }
+
+        struct table_disposer {
+            void operator()( table * pTable )
+            {
+                free_table( pTable );
+            }
+        };
+        //@endcond
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_SWISS_HASH_MAP_H
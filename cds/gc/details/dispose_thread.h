@@ -0,0 +1,327 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2017
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef CDSLIB_GC_DETAILS_DISPOSE_THREAD_H
+#define CDSLIB_GC_DETAILS_DISPOSE_THREAD_H
+
+#include <algorithm>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <chrono>
+#include <condition_variable>
+#include <cds/gc/details/retired_ptr.h>
+#include <cds/algo/atomic.h>
+#include <cds/threading/model.h>
+
+//@cond
+namespace cds { namespace gc { namespace details {
+
+    /// Background reclamation thread for Hazard Pointer SMR (\p gc::HP, \p gc::DHP)
+    /**
+        The mutator thread whose retired array is full passes the retired pointers to the reclamation thread
+        by \p offload() instead of calling \p scan() itself. The retired pointers are copied to a batch
+        that is pushed to lock-free MPSC list. The reclamation thread takes all batches at once,
+        builds sorted list of hazard pointers and frees all retired pointers that are not guarded.
+        Guarded pointers are kept in the thread-private pending list and are checked on the next pass.
+
+        If the count of queued and pending retired pointers exceeds \p max_backlog()
+        \p offload() returns \p false (back-pressure), and the mutator should call \p scan() itself.
+
+        The reclamation thread is attached to \p cds::threading::Manager for its whole lifetime,
+        so the disposers called by it may use any GC, for example, retire other pointers.
+
+        Template arguments:
+        - \p Derived - derived class (CRTP) that must provide <tt>void collect_hazards( hp_vector& plist )</tt>
+            to copy all non-null hazard pointers into \p plist
+        - \p Allocator - allocator for internal data, the value type is <tt>void*</tt>
+    */
+    template <class Derived, class Allocator>
+    class dispose_thread
+    {
+    public:
+        typedef std::vector<void*, Allocator> hp_vector;
+
+    private:
+        struct batch
+        {
+            batch*  next_;
+            size_t  size_;
+
+            retired_ptr* first()
+            {
+                return reinterpret_cast<retired_ptr*>( this + 1 );
+            }
+
+            retired_ptr* last()
+            {
+                return first() + size_;
+            }
+        };
+
+        typedef typename std::allocator_traits<Allocator>::template rebind_alloc<retired_ptr> retired_allocator;
+        typedef std::vector<retired_ptr, retired_allocator> retired_vector;
+
+        // Period of pending list rescan when no new batch arrives
+        static constexpr std::chrono::milliseconds rescan_period()
+        {
+            return std::chrono::milliseconds( 10 );
+        }
+
+    public:
+        explicit dispose_thread( size_t nMaxBacklog )
+            : queue_( nullptr )
+            , backlog_( 0 )
+            , max_backlog_( nMaxBacklog )
+            , quit_( false )
+            , offload_count_( 0 )
+            , offload_retired_count_( 0 )
+            , reject_count_( 0 )
+            , free_count_( 0 )
+        {
+            thread_ = std::thread( &dispose_thread::execute, this );
+        }
+
+        ~dispose_thread()
+        {
+            assert( !thread_.joinable());
+        }
+
+        /// Stops the thread and frees all retired pointers unconditionally
+        /**
+            Should be called only when no thread uses SMR anymore. The second call only frees
+            the retired pointers passed after the first one.
+        */
+        void stop()
+        {
+            if ( thread_.joinable()) {
+                {
+                    std::unique_lock<std::mutex> lock( mutex_ );
+                    quit_ = true;
+                }
+                cv_.notify_one();
+                thread_.join();
+            }
+
+            for ( batch* b = queue_.exchange( nullptr, atomics::memory_order_acquire ); b; ) {
+                batch* next = b->next_;
+                for ( retired_ptr* p = b->first(), *last = b->last(); p != last; ++p )
+                    p->free();
+                free_count_.fetch_add( b->size_, atomics::memory_order_relaxed );
+                free_batch( b );
+                b = next;
+            }
+
+            for ( auto& p : pending_ )
+                p.free();
+            free_count_.fetch_add( pending_.size(), atomics::memory_order_relaxed );
+            pending_.clear();
+        }
+
+        /// Passes retired pointers <tt>[first, last)</tt> to the reclamation thread
+        /**
+            Returns \p false if the backlog of the reclamation thread is too large,
+            in this case the retired pointers are not passed and the caller should scan them itself.
+        */
+        bool offload( retired_ptr const* first, retired_ptr const* last )
+        {
+            return offload( static_cast<size_t>( last - first ), [first, last]( retired_ptr* dest ) { std::copy( first, last, dest ); });
+        }
+
+        /// Passes \p nSize retired pointers to the reclamation thread
+        /**
+            The functor \p copy has the signature <tt>void copy( retired_ptr* dest )</tt>
+            and should copy exactly \p nSize retired pointers to \p dest.
+            The function returns \p false if the backlog of the reclamation thread is too large,
+            in this case \p copy is not called.
+        */
+        template <typename Func>
+        bool offload( size_t nSize, Func copy )
+        {
+            if ( backlog_.load( atomics::memory_order_relaxed ) + nSize > max_backlog_ ) {
+                reject_count_.fetch_add( 1, atomics::memory_order_relaxed );
+                return false;
+            }
+
+            batch* b = alloc_batch( nSize );
+            copy( b->first());
+            backlog_.fetch_add( nSize, atomics::memory_order_relaxed );
+
+            batch* head = queue_.load( atomics::memory_order_relaxed );
+            do {
+                b->next_ = head;
+            } while ( !queue_.compare_exchange_weak( head, b, atomics::memory_order_release, atomics::memory_order_relaxed ));
+
+            offload_count_.fetch_add( 1, atomics::memory_order_relaxed );
+            offload_retired_count_.fetch_add( nSize, atomics::memory_order_relaxed );
+
+            if ( head == nullptr ) {
+                // The reclamation thread may sleep
+                { std::unique_lock<std::mutex> lock( mutex_ ); }
+                cv_.notify_one();
+            }
+            return true;
+        }
+
+        size_t max_backlog() const
+        {
+            return max_backlog_;
+        }
+
+        size_t backlog() const
+        {
+            return backlog_.load( atomics::memory_order_relaxed );
+        }
+
+        size_t offload_count() const
+        {
+            return offload_count_.load( atomics::memory_order_relaxed );
+        }
+
+        size_t offload_retired_count() const
+        {
+            return offload_retired_count_.load( atomics::memory_order_relaxed );
+        }
+
+        size_t reject_count() const
+        {
+            return reject_count_.load( atomics::memory_order_relaxed );
+        }
+
+        size_t free_count() const
+        {
+            return free_count_.load( atomics::memory_order_relaxed );
+        }
+
+    private:
+        void execute()
+        {
+            cds::threading::Manager::attachThread();
+            run();
+            cds::threading::Manager::detachThread();
+        }
+
+        void run()
+        {
+            hp_vector plist;
+
+            for (;;) {
+                {
+                    std::unique_lock<std::mutex> lock( mutex_ );
+                    while ( !quit_ && queue_.load( atomics::memory_order_relaxed ) == nullptr ) {
+                        if ( pending_.empty())
+                            cv_.wait( lock );
+                        else if ( cv_.wait_for( lock, rescan_period()) == std::cv_status::timeout )
+                            break;
+                    }
+                    if ( quit_ )
+                        return;
+                }
+
+                batch* list = queue_.exchange( nullptr, atomics::memory_order_acquire );
+                for ( batch* b = list; b; b = b->next_ )
+                    pending_.insert( pending_.end(), b->first(), b->last());
+
+                reclaim( plist );
+
+                while ( list ) {
+                    batch* next = list->next_;
+                    free_batch( list );
+                    list = next;
+                }
+            }
+        }
+
+        void reclaim( hp_vector& plist )
+        {
+            if ( pending_.empty())
+                return;
+
+            // Stage 1: collect hazard pointers
+            plist.clear();
+            atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+            static_cast<Derived*>( this )->collect_hazards( plist );
+            std::sort( plist.begin(), plist.end());
+
+            // Stage 2: free unguarded retired pointers, keep guarded ones pending
+            auto insert_pos = pending_.begin();
+            for ( auto it = pending_.begin(); it != pending_.end(); ++it ) {
+                if ( std::binary_search( plist.begin(), plist.end(), it->m_p )) {
+                    if ( insert_pos != it )
+                        *insert_pos = *it;
+                    ++insert_pos;
+                }
+                else
+                    it->free();
+            }
+
+            size_t const nFreed = static_cast<size_t>( pending_.end() - insert_pos );
+            pending_.erase( insert_pos, pending_.end());
+            backlog_.fetch_sub( nFreed, atomics::memory_order_relaxed );
+            free_count_.fetch_add( nFreed, atomics::memory_order_relaxed );
+        }
+
+        batch* alloc_batch( size_t nSize )
+        {
+            size_t const nBytes = sizeof( batch ) + sizeof( retired_ptr ) * nSize;
+            batch* b = reinterpret_cast<batch*>( Allocator::allocate( ( nBytes + sizeof( void* ) - 1 ) / sizeof( void* )));
+            b->next_ = nullptr;
+            b->size_ = nSize;
+            return b;
+        }
+
+        void free_batch( batch* b )
+        {
+            Allocator::deallocate( reinterpret_cast<void**>( b ), 0 );
+        }
+
+    private:
+        atomics::atomic<batch*> queue_;     ///< MPSC list of offloaded batches
+        atomics::atomic<size_t> backlog_;   ///< count of queued and pending retired pointers
+        size_t const            max_backlog_;
+
+        std::thread             thread_;
+        std::mutex              mutex_;
+        std::condition_variable cv_;
+        bool                    quit_;
+
+        retired_vector          pending_;   ///< guarded retired pointers, private for reclamation thread
+
+        // statistics
+        atomics::atomic<size_t> offload_count_;
+        atomics::atomic<size_t> offload_retired_count_;
+        atomics::atomic<size_t> reject_count_;
+        atomics::atomic<size_t> free_count_;
+    };
+
+}}} // namespace cds::gc::details
+//@endcond
+
+#endif // #ifndef CDSLIB_GC_DETAILS_DISPOSE_THREAD_H
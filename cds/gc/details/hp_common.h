@@ -112,7 +112,7 @@ namespace cds { namespace gc { namespace hp { namespace common {
     };
 
     /// Array of guards
-    template <size_t Capacity>
+    template <size_t Capacity, class Guard = guard>
     class guard_array
     {
     public:
@@ -128,7 +128,7 @@ namespace cds { namespace gc { namespace hp { namespace common {
             return c_nCapacity;
         }
 
-        guard* operator[]( size_t idx ) const noexcept
+        Guard* operator[]( size_t idx ) const noexcept
         {
             assert( idx < capacity());
             return arr_[idx];
@@ -151,16 +151,16 @@ namespace cds { namespace gc { namespace hp { namespace common {
             arr_[idx]->clear();
         }
 
-        guard* release( size_t idx ) noexcept
+        Guard* release( size_t idx ) noexcept
         {
             assert( idx < capacity());
 
-            guard* g = arr_[idx];
+            Guard* g = arr_[idx];
             arr_[idx] = nullptr;
             return g;
         }
 
-        void reset( size_t idx, guard* g ) noexcept
+        void reset( size_t idx, Guard* g ) noexcept
         {
             assert( idx < capacity());
             assert( arr_[idx] == nullptr );
@@ -169,7 +169,7 @@ namespace cds { namespace gc { namespace hp { namespace common {
         }
 
     private:
-        guard*  arr_[c_nCapacity];
+        Guard*  arr_[c_nCapacity];
     };
 
 
@@ -0,0 +1,368 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2017
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef CDSLIB_GC_DETAILS_TELEMETRY_H
+#define CDSLIB_GC_DETAILS_TELEMETRY_H
+
+#include <chrono>
+#include <algorithm>
+#include <cds/algo/atomic.h>
+#include <cds/algo/bitop.h>
+#include <cds/os/thread.h>
+#include <cds/gc/details/retired_ptr.h>
+#include <cds/user_setup/cache_line.h>
+
+namespace cds { namespace gc {
+
+    /// Reclamation telemetry
+    /**
+        All GCs of the library (\p gc::HP, \p gc::DHP, \p gc::HE and all RCU flavors) gather
+        the reclamation telemetry unconditionally. Unlike the internal statistics (\p CDS_ENABLE_HPSTAT)
+        the telemetry may be read at any time from any thread by static \p telemetry() function of the GC:
+        \code
+        cds::gc::HP::telemetry_snapshot st;
+        cds::gc::HP::telemetry( st );
+        if ( st.backlog_bytes > nMemoryLimit && st.blocking_thread != cds::OS::c_NullThreadId ) {
+            // st.blocking_thread prevents the reclamation
+        }
+        \endcode
+
+        The overhead is kept low by sampling: the retire-to-free age and the size of the retired objects
+        are gathered for 1/64 of the retired objects only. An object is sampled or not depending on its address.
+        The disposer of the sampled object is replaced by a thunk that records the age and calls the original disposer.
+    */
+    namespace telemetry {
+
+        /// Log2 histogram of durations in microseconds
+        struct histogram
+        {
+            static constexpr size_t const c_nBucketCount = 32;  ///< Bucket count
+
+            /// Counters: \p bucket[0] - less than 1 us, \p bucket[i] - [2**(i-1), 2**i) us; the last bucket has no upper bound
+            uint64_t bucket[c_nBucketCount];
+
+            //@cond
+            histogram()
+            {
+                clear();
+            }
+            //@endcond
+
+            /// Resets all counters
+            void clear()
+            {
+                std::fill( bucket, bucket + c_nBucketCount, uint64_t( 0 ));
+            }
+
+            /// Returns total count of the values
+            uint64_t count() const
+            {
+                uint64_t n = 0;
+                for ( uint64_t c : bucket )
+                    n += c;
+                return n;
+            }
+
+            /// Returns upper bound of bucket \p nBucket, in microseconds
+            static uint64_t upper_bound( size_t nBucket )
+            {
+                return nBucket < c_nBucketCount - 1 ? uint64_t( 1 ) << nBucket : ~uint64_t( 0 );
+            }
+
+            /// Returns upper bound of the bucket containing \p nPercent percentile, in microseconds; 0 if the histogram is empty
+            uint64_t percentile( unsigned int nPercent ) const
+            {
+                uint64_t const nCount = count();
+                if ( nCount == 0 )
+                    return 0;
+
+                uint64_t const nRank = ( nCount * std::min( nPercent, 100u ) + 99 ) / 100;
+                uint64_t n = 0;
+                for ( size_t i = 0; i < c_nBucketCount; ++i ) {
+                    n += bucket[i];
+                    if ( n >= nRank && n > 0 )
+                        return upper_bound( i );
+                }
+                return upper_bound( c_nBucketCount - 1 );
+            }
+
+            /// Returns the bucket index for \p nValue microseconds
+            static size_t bucket_index( uint64_t nValue )
+            {
+                return std::min( static_cast<size_t>( cds::bitop::MSB( nValue )), c_nBucketCount - 1 );
+            }
+        };
+
+        /// Reclamation telemetry snapshot
+        struct snapshot
+        {
+            size_t      backlog_count;  ///< Count of retired objects that are not freed yet
+            size_t      backlog_bytes;  ///< Estimated size of \p backlog_count objects (average size of the sampled objects * \p backlog_count)
+            histogram   retire_age;     ///< Retire-to-free age of the sampled objects
+            histogram   reclaim_time;   ///< Duration of \p scan() (HP, DHP, HE) or grace period (RCU)
+            cds::OS::ThreadId blocking_thread; ///< The thread that has blocked last reclamation cycle, \p cds::OS::c_NullThreadId if none
+
+            //@cond
+            snapshot()
+                : backlog_count( 0 )
+                , backlog_bytes( 0 )
+                , blocking_thread( cds::OS::c_NullThreadId )
+            {}
+            //@endcond
+        };
+
+        //@cond
+        namespace details {
+            typedef std::chrono::steady_clock clock_type;
+            typedef cds::gc::details::free_retired_ptr_func free_retired_ptr_func;
+
+            // An object is sampled depending on its address: 1/64 of addresses are sampled
+            static inline bool is_sampled( void const* p )
+            {
+                uint64_t const h = static_cast<uint64_t>( reinterpret_cast<uintptr_t>( p ) >> 4 ) * 0x9E3779B97F4A7C15ull;
+                return p && ( h >> 58 ) == 0;
+            }
+
+            template <typename T>
+            struct object_size
+            {
+                static constexpr size_t const value = sizeof( T );
+            };
+
+            template <>
+            struct object_size<void>
+            {
+                static constexpr size_t const value = 0;
+            };
+
+            template <>
+            struct object_size<void const>
+            {
+                static constexpr size_t const value = 0;
+            };
+
+            class atomic_histogram
+            {
+            public:
+                atomic_histogram()
+                {
+                    for ( auto& b : bucket_ )
+                        b.store( 0, atomics::memory_order_relaxed );
+                }
+
+                void add( clock_type::duration d )
+                {
+                    uint64_t const usec = static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::microseconds>( d ).count());
+                    bucket_[histogram::bucket_index( usec )].fetch_add( 1, atomics::memory_order_relaxed );
+                }
+
+                void get( histogram& h ) const
+                {
+                    for ( size_t i = 0; i < histogram::c_nBucketCount; ++i )
+                        h.bucket[i] = bucket_[i].load( atomics::memory_order_relaxed );
+                }
+
+            private:
+                atomics::atomic<uint64_t> bucket_[histogram::c_nBucketCount];
+            };
+
+            // Count of retired and freed objects of a thread record.
+            // The counters are changed by the owner of the record only and can be read by any thread
+            class thread_counter
+            {
+            public:
+                thread_counter()
+                    : retired_( 0 )
+                    , freed_( 0 )
+                {}
+
+                void retire() noexcept
+                {
+                    retired_.store( retired_.load( atomics::memory_order_relaxed ) + 1, atomics::memory_order_relaxed );
+                }
+
+                void free( size_t nCount ) noexcept
+                {
+                    if ( nCount )
+                        freed_.store( freed_.load( atomics::memory_order_relaxed ) + nCount, atomics::memory_order_relaxed );
+                }
+
+                size_t retired() const noexcept
+                {
+                    return retired_.load( atomics::memory_order_relaxed );
+                }
+
+                size_t freed() const noexcept
+                {
+                    return freed_.load( atomics::memory_order_relaxed );
+                }
+
+            private:
+                atomics::atomic<size_t> retired_;
+                atomics::atomic<size_t> freed_;
+            };
+
+            // Telemetry collector of a GC instance
+            class collector
+            {
+            public:
+                static constexpr size_t const c_nSampleTableSize = 256;  // must be power of 2
+                static constexpr size_t const c_nProbeLength = 8;
+
+                collector()
+                    : blocking_thread_( cds::OS::c_NullThreadId )
+                    , sampled_bytes_( 0 )
+                    , sampled_count_( 0 )
+                {
+                    for ( auto& s : samples_ )
+                        s.p_.store( nullptr, atomics::memory_order_relaxed );
+                }
+
+                // Accounts the size of sampled object
+                void sample_size( size_t nSize ) noexcept
+                {
+                    if ( nSize ) {
+                        sampled_bytes_.fetch_add( nSize, atomics::memory_order_relaxed );
+                        sampled_count_.fetch_add( 1, atomics::memory_order_relaxed );
+                    }
+                }
+
+                // Stamps the sampled pointer p by current time and replaces its disposer by free_thunk<Locator>
+                // If the sample table is full the object is not sampled
+                template <class Locator>
+                void sample( void* p, free_retired_ptr_func& func ) noexcept
+                {
+                    assert( is_sampled( p ));
+                    size_t const nStart = hash( p );
+                    for ( size_t i = 0; i < c_nProbeLength; ++i ) {
+                        sample_slot& s = samples_[( nStart + i ) & ( c_nSampleTableSize - 1 )];
+                        void* expected = nullptr;
+                        if ( s.p_.load( atomics::memory_order_relaxed ) == nullptr
+                            && s.p_.compare_exchange_strong( expected, p, atomics::memory_order_acquire, atomics::memory_order_relaxed ))
+                        {
+                            s.func_ = func;
+                            s.time_ = clock_type::now();
+                            func = free_thunk<Locator>;
+                            return;
+                        }
+                    }
+                }
+
+                // Records the age of sampled pointer p and returns its original disposer
+                // Returns nullptr if p is not found in the sample table
+                free_retired_ptr_func release( void* p ) noexcept
+                {
+                    // sample() places p within c_nProbeLength slots from hash( p )
+                    size_t const nStart = hash( p );
+                    for ( size_t i = 0; i < c_nProbeLength; ++i ) {
+                        sample_slot& s = samples_[( nStart + i ) & ( c_nSampleTableSize - 1 )];
+                        if ( s.p_.load( atomics::memory_order_relaxed ) == p ) {
+                            free_retired_ptr_func func = s.func_;
+                            retire_age_.add( clock_type::now() - s.time_ );
+
+                            // The slot must be freed before the disposer call:
+                            // the memory can be reused and retired again just after that
+                            s.p_.store( nullptr, atomics::memory_order_release );
+                            return func;
+                        }
+                    }
+                    return nullptr;
+                }
+
+                clock_type::time_point reclaim_start() const noexcept
+                {
+                    return clock_type::now();
+                }
+
+                // Ends the reclamation cycle started at tStart; if the cycle has not been blocked the blocking thread is reset
+                void reclaim_end( clock_type::time_point tStart, bool bBlocked ) noexcept
+                {
+                    reclaim_time_.add( clock_type::now() - tStart );
+                    if ( !bBlocked )
+                        blocking_thread_.store( cds::OS::c_NullThreadId, atomics::memory_order_relaxed );
+                }
+
+                void blocked_by( cds::OS::ThreadId id ) noexcept
+                {
+                    blocking_thread_.store( id, atomics::memory_order_relaxed );
+                }
+
+                void get( snapshot& st, size_t nBacklog ) const
+                {
+                    st.backlog_count = nBacklog;
+                    size_t const nSampled = sampled_count_.load( atomics::memory_order_relaxed );
+                    st.backlog_bytes = nSampled
+                        ? static_cast<size_t>( static_cast<double>( sampled_bytes_.load( atomics::memory_order_relaxed )) / nSampled * nBacklog )
+                        : 0;
+                    retire_age_.get( st.retire_age );
+                    reclaim_time_.get( st.reclaim_time );
+                    st.blocking_thread = blocking_thread_.load( atomics::memory_order_relaxed );
+                }
+
+            private:
+                template <class Locator>
+                static void free_thunk( void* p )
+                {
+                    // The retired pointer is published to the reclaiming thread after sample(),
+                    // so the slot of p is always found. If it is not (the pointer was sampled by other collector),
+                    // the original disposer is lost: leaking the object is safer than calling a wrong one
+                    free_retired_ptr_func func = Locator::get().release( p );
+                    assert( func != nullptr );
+                    if ( func )
+                        func( p );
+                }
+
+                static size_t hash( void const* p ) noexcept
+                {
+                    return static_cast<size_t>( reinterpret_cast<uintptr_t>( p ) >> 4 );
+                }
+
+                struct sample_slot {
+                    atomics::atomic<void*>  p_;
+                    free_retired_ptr_func   func_;
+                    clock_type::time_point  time_;
+                };
+
+            private:
+                atomic_histogram    retire_age_;
+                atomic_histogram    reclaim_time_;
+                atomics::atomic<cds::OS::ThreadId> blocking_thread_;
+                atomics::atomic<size_t> sampled_bytes_;
+                atomics::atomic<size_t> sampled_count_;
+                char pad_[cds::c_nCacheLineSize];
+                sample_slot         samples_[c_nSampleTableSize];
+            };
+        } // namespace details
+        //@endcond
+
+    } // namespace telemetry
+}} // namespace cds::gc
+
+#endif // #ifndef CDSLIB_GC_DETAILS_TELEMETRY_H
@@ -33,6 +33,7 @@
 
 #include <exception>
 #include <cds/gc/details/hp_common.h>
+#include <cds/gc/details/telemetry.h>
 #include <cds/details/lib.h>
 #include <cds/threading/model.h>
 #include <cds/intrusive/free_list_selector.h>
@@ -74,6 +75,65 @@ namespace cds { namespace gc {
         };
         //@endcond
 
+        //@cond
+        /// Thread-private cache of free blocks
+        /**
+            The cache keeps a few free blocks of the thread record so that
+            the thread does not touch the global free-list when its guard or
+            retired storage is shrunk and grown again. The blocks that do not fit
+            into the cache are returned to the global free-list of the allocator.
+        */
+        template <typename Block>
+        class block_cache
+        {
+        public:
+            static size_t const c_capacity = 4; ///< Max count of cached blocks
+
+            block_cache() noexcept
+                : count_( 0 )
+#       ifdef CDS_ENABLE_HPSTAT
+                , hit_count_( 0 )
+#       endif
+            {}
+
+            block_cache( block_cache const& ) = delete;
+            block_cache( block_cache&& ) = delete;
+
+            Block* get() noexcept
+            {
+                if ( count_ ) {
+                    CDS_HPSTAT( ++hit_count_ );
+                    return blocks_[--count_];
+                }
+                return nullptr;
+            }
+
+            bool put( Block* block ) noexcept
+            {
+                if ( count_ < c_capacity ) {
+                    blocks_[count_++] = block;
+                    return true;
+                }
+                return false;
+            }
+
+            bool empty() const noexcept
+            {
+                return count_ == 0;
+            }
+
+        private:
+            Block*  blocks_[c_capacity];
+            size_t  count_;
+#       ifdef CDS_ENABLE_HPSTAT
+        public:
+            size_t  hit_count_;
+#       endif
+        };
+
+        typedef block_cache< guard_block > guard_block_cache;
+        //@endcond
+
         //@cond
         /// \p guard_block allocator (global object)
         class hp_allocator
@@ -83,15 +143,30 @@ namespace cds { namespace gc {
             static hp_allocator& instance();
 
             CDS_EXPORT_API guard_block* alloc();
+            CDS_EXPORT_API guard_block* alloc( guard_block_cache& cache );
+
             void free( guard_block* block )
             {
                 free_list_.put( block );
             }
 
+            void free( guard_block* block, guard_block_cache& cache )
+            {
+                if ( !cache.put( block ))
+                    free( block );
+            }
+
+            void flush( guard_block_cache& cache )
+            {
+                while ( guard_block* block = cache.get())
+                    free( block );
+            }
+
         private:
             hp_allocator()
 #ifdef CDS_ENABLE_HPSTAT
                 : block_allocated_(0)
+                , block_reused_(0)
 #endif
             {}
             CDS_EXPORT_API ~hp_allocator();
@@ -101,6 +176,7 @@ namespace cds { namespace gc {
 #ifdef CDS_ENABLE_HPSTAT
         public:
             atomics::atomic<size_t>         block_allocated_;   ///< count of allocated blocks
+            atomics::atomic<size_t>         block_reused_;      ///< count of blocks taken from \p free_list_
 #endif
         };
         //@endcond
@@ -133,6 +209,7 @@ namespace cds { namespace gc {
             ~thread_hp_storage()
             {
                 clear();
+                flush_cache();
             }
 
             guard* alloc()
@@ -197,13 +274,19 @@ namespace cds { namespace gc {
                 hp_allocator& a = hp_allocator::instance();
                 for ( guard_block* p = extended_list_.load( atomics::memory_order_relaxed ); p; ) {
                     guard_block* next = p->next_block_.load( atomics::memory_order_relaxed );
-                    a.free( p );
+                    a.free( p, block_cache_ );
                     p = next;
                 }
 
                 extended_list_.store( nullptr, atomics::memory_order_release );
             }
 
+            void flush_cache()
+            {
+                if ( !block_cache_.empty())
+                    hp_allocator::instance().flush( block_cache_ );
+            }
+
             void init()
             {
                 assert( extended_list_.load(atomics::memory_order_relaxed) == nullptr );
@@ -220,7 +303,7 @@ namespace cds { namespace gc {
             {
                 assert( free_head_ == nullptr );
 
-                guard_block* block = hp_allocator::instance().alloc();
+                guard_block* block = hp_allocator::instance().alloc( block_cache_ );
                 block->next_block_.store( extended_list_.load( atomics::memory_order_relaxed ), atomics::memory_order_release );
                 extended_list_.store( block, atomics::memory_order_release );
                 free_head_ = block->first();
@@ -232,6 +315,7 @@ namespace cds { namespace gc {
             atomics::atomic<guard_block*> extended_list_;    ///< Head of extended guard blocks allocated for the thread
             guard* const    array_;            ///< initial HP array
             size_t const    initial_capacity_; ///< Capacity of \p array_
+            guard_block_cache block_cache_;    ///< Free extended blocks kept for the thread
 #       ifdef CDS_ENABLE_HPSTAT
         public:
             size_t          alloc_guard_count_;
@@ -262,6 +346,8 @@ namespace cds { namespace gc {
                 return first() + c_capacity;
             }
         };
+
+        typedef block_cache< retired_block > retired_block_cache;
         //@endcond
 
         //@cond
@@ -272,25 +358,41 @@ namespace cds { namespace gc {
             static retired_allocator& instance();
 
             CDS_EXPORT_API retired_block* alloc();
+            CDS_EXPORT_API retired_block* alloc( retired_block_cache& cache );
+
             void free( retired_block* block )
             {
                 block->next_ = nullptr;
                 free_list_.put( block );
             }
 
+            void free( retired_block* block, retired_block_cache& cache )
+            {
+                if ( !cache.put( block ))
+                    free( block );
+            }
+
+            void flush( retired_block_cache& cache )
+            {
+                while ( retired_block* block = cache.get())
+                    free( block );
+            }
+
         private:
             retired_allocator()
 #ifdef CDS_ENABLE_HPSTAT
                 : block_allocated_(0)
+                , block_reused_(0)
 #endif
             {}
             CDS_EXPORT_API ~retired_allocator();
 
         private:
-            cds::intrusive::FreeListImpl    free_list_; ///< list of free \p guard_block
+            cds::intrusive::FreeListImpl    free_list_; ///< list of free \p retired_block
 #ifdef CDS_ENABLE_HPSTAT
         public:
             atomics::atomic<size_t> block_allocated_; ///< Count of allocated blocks
+            atomics::atomic<size_t> block_reused_;    ///< Count of blocks taken from \p free_list_
 #endif
         };
         //@endcond
@@ -320,6 +422,7 @@ namespace cds { namespace gc {
             {
                 assert( empty());
                 fini();
+                flush_cache();
             }
 
             bool push( retired_ptr const& p ) noexcept
@@ -356,11 +459,23 @@ namespace cds { namespace gc {
                 return ret;
             }
 
+            /// Returns the count of retired pointers in the array
+            size_t size() const
+            {
+                if ( current_block_ == nullptr )
+                    return 0;
+
+                size_t nSize = current_cell_ - current_block_->first();
+                for ( retired_block* block = list_head_; block != current_block_; block = block->next_ )
+                    nSize += retired_block::c_capacity;
+                return nSize;
+            }
+
         private: // called by smr
             void init()
             {
                 if ( list_head_ == nullptr ) {
-                    retired_block* block = retired_allocator::instance().alloc();
+                    retired_block* block = retired_allocator::instance().alloc( block_cache_ );
                     assert( block->next_ == nullptr );
 
                     current_block_ =
@@ -377,7 +492,7 @@ namespace cds { namespace gc {
                 retired_allocator& alloc = retired_allocator::instance();
                 for ( retired_block* p = list_head_; p; ) {
                     retired_block* next = p->next_;
-                    alloc.free( p );
+                    alloc.free( p, block_cache_ );
                     p = next;
                 }
 
@@ -395,7 +510,7 @@ namespace cds { namespace gc {
                 assert( current_block_ == list_tail_ );
                 assert( current_cell_ == current_block_->last());
 
-                retired_block* block = retired_allocator::instance().alloc();
+                retired_block* block = retired_allocator::instance().alloc( block_cache_ );
                 assert( block->next_ == nullptr );
 
                 current_block_ = list_tail_ = list_tail_->next_ = block;
@@ -410,6 +525,12 @@ namespace cds { namespace gc {
                     || ( current_block_ == list_head_ && current_cell_ == current_block_->first());
             }
 
+            void flush_cache()
+            {
+                if ( !block_cache_.empty())
+                    retired_allocator::instance().flush( block_cache_ );
+            }
+
         private:
             retired_block*          current_block_;
             retired_ptr*            current_cell_;  // in current_block_
@@ -417,6 +538,7 @@ namespace cds { namespace gc {
             retired_block*          list_head_;
             retired_block*          list_tail_;
             size_t                  block_count_;
+            retired_block_cache     block_cache_;   ///< Free retired blocks kept for the thread
 #       ifdef CDS_ENABLE_HPSTAT
         public:
             size_t  retire_call_count_;
@@ -440,6 +562,18 @@ namespace cds { namespace gc {
             size_t  retired_block_count;    ///< Count of retired blocks allocated
             size_t  hp_extend_count;        ///< Count of hp array \p extend() call
             size_t  retired_extend_count;   ///< Count of retired array \p extend() call
+            size_t  hp_block_cache_hit;     ///< Count of HP blocks taken from the thread's block cache
+            size_t  hp_block_reuse_count;   ///< Count of HP blocks taken from the global free-list
+            size_t  retired_block_cache_hit;    ///< Count of retired blocks taken from the thread's block cache
+            size_t  retired_block_reuse_count;  ///< Count of retired blocks taken from the global free-list
+
+            size_t  offload_count;          ///< Count of retired batches passed to the dispose thread
+            size_t  offload_retired_count;  ///< Count of retired pointers passed to the dispose thread
+            size_t  offload_reject_count;   ///< Count of batches rejected by the dispose thread due to back-pressure
+            size_t  dispose_thread_free_count; ///< Count of pointers freed by the dispose thread (included in \p free_count)
+
+            size_t  throttle_count;         ///< Count of \p retire() calls throttled by the watermark, see \p DHP::set_watermark()
+            size_t  stalled_guard_count;    ///< Count of stalled guard reports, see \p DHP::set_watermark()
 
                                         /// Default ctor
             stat()
@@ -460,15 +594,40 @@ namespace cds { namespace gc {
                     hp_block_count =
                     retired_block_count =
                     hp_extend_count =
-                    retired_extend_count = 0;
+                    retired_extend_count =
+                    hp_block_cache_hit =
+                    hp_block_reuse_count =
+                    retired_block_cache_hit =
+                    retired_block_reuse_count =
+                    offload_count =
+                    offload_retired_count =
+                    offload_reject_count =
+                    dispose_thread_free_count =
+                    throttle_count =
+                    stalled_guard_count = 0;
             }
         };
 
+        /// Guard that keeps the retired pointers of a thread above the watermark
+        /**
+            See \p DHP::set_watermark()
+        */
+        struct stalled_guard {
+            cds::OS::ThreadId   owner;      ///< The thread owning the guard
+            void const*         guarded;    ///< The pointer protected by the guard
+            size_t              backlog;    ///< Count of retired pointers of the thread that has called \p scan()
+            size_t              stall_count; ///< Count of consecutive \p scan() calls of the thread blocked by the same guard and pointer
+        };
+
+        /// Stalled guard callback, see \p DHP::set_watermark()
+        typedef void( *stalled_guard_callback )( stalled_guard const& );
+
         //@cond
         /// Per-thread data
         struct thread_data {
             thread_hp_storage   hazards_;   ///< Hazard pointers private to the thread
             retired_array       retired_;   ///< Retired data private to the thread
+            cds::gc::telemetry::details::thread_counter telemetry_; ///< Count of retired and freed pointers for telemetry
 
             char pad1_[cds::c_nCacheLineSize];
             atomics::atomic<unsigned int> sync_; ///< dummy var to introduce synchronizes-with relationship between threads
@@ -478,6 +637,8 @@ namespace cds { namespace gc {
             size_t              free_call_count_;
             size_t              scan_call_count_;
             size_t              help_scan_call_count_;
+            size_t              throttle_call_count_;
+            size_t              stalled_guard_call_count_;
 #       endif
 
             // CppCheck warn: pad1_ and pad2_ is uninitialized in ctor
@@ -489,6 +650,8 @@ namespace cds { namespace gc {
                 , free_call_count_(0)
                 , scan_call_count_(0)
                 , help_scan_call_count_(0)
+                , throttle_call_count_(0)
+                , stalled_guard_call_count_(0)
 #       endif
             {}
 
@@ -508,6 +671,7 @@ namespace cds { namespace gc {
         class smr
         {
             struct thread_record;
+            struct reclaimer;
 
         public:
             /// Returns the instance of Hazard Pointer \ref smr
@@ -596,10 +760,89 @@ namespace cds { namespace gc {
             /// Get internal statistics
             CDS_EXPORT_API void statistics( stat& st );
 
+            /// Get reclamation telemetry
+            CDS_EXPORT_API void telemetry( cds::gc::telemetry::snapshot& st );
+
+            /// Starts background dispose thread
+            /**
+                After this call a thread whose retired array is full passes its retired pointers
+                to the background dispose thread instead of calling \p scan() itself.
+                If the dispose thread has more than \p nMaxBacklog retired pointers not yet freed,
+                the mutator thread calls \p scan() as usual (back-pressure).
+                Default \p nMaxBacklog is <tt>64 * retired_block::c_capacity</tt>.
+
+                The dispose thread is attached to \p cds::threading::Manager, so the disposers may retire other pointers.
+                The dispose thread is stopped by \p destruct().
+                The function does nothing if the dispose thread is already started.
+            */
+            CDS_EXPORT_API void start_dispose_thread( size_t nMaxBacklog = 0 );
+
+            /// Checks if the background dispose thread is started
+            bool has_dispose_thread() const noexcept
+            {
+                return reclaimer_.load( atomics::memory_order_relaxed ) != nullptr;
+            }
+
+            /// Sets the watermark of retired pointers per thread (bounded-backlog mode)
+            /**
+                See \p DHP::set_watermark()
+            */
+            void set_watermark( size_t nWatermark, stalled_guard_callback pCallback = nullptr ) noexcept
+            {
+                stalled_callback_.store( pCallback, atomics::memory_order_relaxed );
+                watermark_.store( nWatermark, atomics::memory_order_release );
+            }
+
+            /// Returns the watermark of retired pointers per thread, 0 - bounded-backlog mode is off
+            size_t watermark() const noexcept
+            {
+                return watermark_.load( atomics::memory_order_relaxed );
+            }
+
         public: // for internal use only
             /// The main garbage collecting function
             CDS_EXPORT_API void scan( thread_data* pRec );
 
+            /// Called when the retired array of \p pRec is full
+            /**
+                Passes retired pointers to the dispose thread if it is started,
+                otherwise calls \p scan().
+                If \p pRec still has more retired pointers than the watermark, calls \p throttle()
+            */
+            void flush_retired( thread_data* pRec )
+            {
+                if ( has_dispose_thread())
+                    offload( pRec );
+                else
+                    scan( pRec );
+
+                size_t const nWatermark = watermark();
+                if ( nWatermark && pRec->retired_.size() >= nWatermark )
+                    throttle( pRec );
+            }
+
+            /// Back-pressure for the thread whose retired pointer count is above the watermark
+            /**
+                The function repeats \p help_scan() with back-off until the retired pointer count
+                of \p pRec drops below the watermark or the retry limit is reached.
+                The limit is needed since the thread may itself hold the guard
+                protecting its retired pointer.
+            */
+            CDS_EXPORT_API void throttle( thread_data* pRec );
+
+            /// Passes retired pointers of \p pRec to the dispose thread; calls \p scan() on back-pressure
+            CDS_EXPORT_API void offload( thread_data* pRec );
+
+            /// Samples retired pointer \p p of size \p nSize for telemetry
+            static void sample( retired_ptr& p, size_t nSize )
+            {
+                if ( cds::gc::telemetry::details::is_sampled( p.m_p )) {
+                    cds::gc::telemetry::details::collector& c = instance().telemetry_;
+                    c.sample_size( nSize );
+                    c.sample< telemetry_locator >( p.m_p, p.m_funcFree );
+                }
+            }
+
             /// Helper scan routine
             /**
                 The function guarantees that every node that is eligible for reuse is eventually freed, barring
@@ -640,6 +883,23 @@ namespace cds { namespace gc {
             /// Free HP SMR thread-private data
             CDS_EXPORT_API void free_thread_data( thread_record* pRec );
 
+            /// Copies all non-null hazard pointers to \p plist
+            template <typename Vector>
+            void collect_hazards( Vector& plist );
+
+            /// Searches the guard protecting \p p; returns \p nullptr if not found
+            guard const* find_guard( void const* p, cds::OS::ThreadId& owner );
+
+            /// Reports the guard \p g protecting the first retired pointer of \p pRec to the stalled guard callback
+            void report_stalled_guard( thread_record* pRec, guard const* g, cds::OS::ThreadId owner, size_t nBacklog );
+
+            struct telemetry_locator {
+                static cds::gc::telemetry::details::collector& get()
+                {
+                    return instance().telemetry_;
+                }
+            };
+
         private:
             static CDS_EXPORT_API smr* instance_;
 
@@ -650,6 +910,11 @@ namespace cds { namespace gc {
 
             // temporaries
             std::atomic<size_t> last_plist_size_;   ///< HP array size in last scan() call
+
+            atomics::atomic<reclaimer*> reclaimer_; ///< background dispose thread, \p nullptr if not started
+            atomics::atomic<size_t>     watermark_; ///< max retired pointer count per thread, 0 - bounded-backlog mode is off
+            atomics::atomic<stalled_guard_callback> stalled_callback_; ///< stalled guard callback, may be \p nullptr
+            cds::gc::telemetry::details::collector telemetry_; ///< reclamation telemetry
         };
         //@endcond
 
@@ -717,6 +982,15 @@ namespace cds { namespace gc {
         /// Internal statistics
         typedef dhp::stat stat;
 
+        /// Reclamation telemetry snapshot, see \p cds::gc::telemetry
+        typedef cds::gc::telemetry::snapshot telemetry_snapshot;
+
+        /// Stalled guard info, see \p set_watermark()
+        typedef dhp::stalled_guard stalled_guard;
+
+        /// Stalled guard callback, see \p set_watermark()
+        typedef dhp::stalled_guard_callback stalled_guard_callback;
+
         /// Dynamic Hazard Pointer guard
         /**
             A guard is a hazard pointer.
@@ -1393,8 +1667,11 @@ namespace cds { namespace gc {
         static void retire( T * p, void (* func)(void *))
         {
             dhp::thread_data* rec = dhp::smr::tls();
-            if ( !rec->retired_.push( dhp::retired_ptr( p, func )))
-                dhp::smr::instance().scan( rec );
+            dhp::retired_ptr rp( p, func );
+            dhp::smr::sample( rp, cds::gc::telemetry::details::object_size<T>::value );
+            rec->telemetry_.retire();
+            if ( !rec->retired_.push( rp ))
+                dhp::smr::instance().flush_retired( rec );
         }
 
         /// Retire pointer \p p with functor of type \p Disposer
@@ -1449,8 +1726,7 @@ namespace cds { namespace gc {
         template <class Disposer, typename T>
         static void retire( T* p )
         {
-            if ( !dhp::smr::tls()->retired_.push( dhp::retired_ptr( p, cds::details::static_functor<Disposer, T>::call )))
-                scan();
+            retire( p, cds::details::static_functor<Disposer, T>::call );
         }
 
         /// Checks if Dynamic Hazard Pointer GC is constructed and may be used
@@ -1459,6 +1735,44 @@ namespace cds { namespace gc {
             return dhp::smr::isUsed();
         }
 
+        /// Starts background dispose thread (opt-in)
+        /**
+            By default a thread whose retired array is full calls \p scan() itself.
+            After calling this function such thread just passes its retired pointers
+            to the background dispose thread and continues.
+            The thread falls back to \p scan() only if the dispose thread has more than \p nMaxBacklog
+            retired pointers not yet freed. Default \p nMaxBacklog is <tt>64 * dhp::retired_block::c_capacity</tt>.
+
+            The dispose thread is stopped in \p %DHP destructor.
+        */
+        static void start_dispose_thread( size_t nMaxBacklog = 0 )
+        {
+            dhp::smr::instance().start_dispose_thread( nMaxBacklog );
+        }
+
+        /// Turns on bounded-backlog mode (opt-in)
+        /**
+            By default the retired array of a thread grows without bound while some thread
+            holds a guard for a long time, for example, when the thread is preempted inside \p find().
+            In bounded-backlog mode, when a thread has \p nWatermark or more retired pointers after \p scan():
+            - the guard protecting the oldest retired pointer of the thread is reported to \p pCallback.
+              \p stalled_guard::stall_count is the count of consecutive scans blocked by the same guard and pointer,
+              so a long-held guard is reported with growing \p stall_count;
+            - the retired array is extended only if \p scan() cannot free any pointer,
+              so \p retire() calls \p scan() more often;
+            - \p retire() caller helps to reclaim: it repeats \p help_scan() with back-off until its retired pointer count
+              drops below \p nWatermark. The retry count is limited since the caller may itself hold the blocking guard.
+
+            The callback is called from \p scan() of the retiring thread and may be called concurrently
+            from several threads. It must not use %DHP.
+
+            \p nWatermark = 0 turns the bounded-backlog mode off. The function may be called at any time.
+        */
+        static void set_watermark( size_t nWatermark, stalled_guard_callback pCallback = nullptr )
+        {
+            dhp::smr::instance().set_watermark( nWatermark, pCallback );
+        }
+
         /// Forced GC cycle call for current thread
         /**
             Usually, this function should not be called directly.
@@ -1530,6 +1844,16 @@ namespace cds { namespace gc {
             \endcode
         */
         CDS_EXPORT_API static stat const& postmortem_statistics();
+
+        /// Returns reclamation telemetry
+        /**
+            Unlike \p statistics(), the telemetry is gathered always and may be read at any time from any thread.
+            See \p cds::gc::telemetry for details.
+        */
+        static void telemetry( telemetry_snapshot& st )
+        {
+            dhp::smr::instance().telemetry( st );
+        }
     };
 
 }} // namespace cds::gc
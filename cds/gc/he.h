@@ -0,0 +1,1524 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2017
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef CDSLIB_GC_HE_SMR_H
+#define CDSLIB_GC_HE_SMR_H
+
+#include <exception>
+#include <cds/gc/details/hp_common.h>
+#include <cds/gc/details/telemetry.h>
+#include <cds/details/lib.h>
+#include <cds/threading/model.h>
+#include <cds/details/throw_exception.h>
+#include <cds/details/static_functor.h>
+#include <cds/details/marked_ptr.h>
+#include <cds/user_setup/cache_line.h>
+
+namespace cds { namespace gc {
+
+    /// Hazard Era SMR implementation details
+    namespace he {
+        /// Hazard pointer type
+        using cds::gc::hp::common::hazard_ptr;
+
+        /// Retired pointer disposer
+        using cds::gc::hp::common::disposer_func;
+
+        /// Era type
+        typedef uint64_t era_t;
+
+        /// Era value meaning "no era is reserved"
+        static constexpr era_t const c_nNoEra = 0;
+
+        /// Exception "Not enough Hazard Era guards"
+        class not_enought_hazard_ptr: public std::length_error
+        {
+        //@cond
+        public:
+            not_enought_hazard_ptr()
+                : std::length_error( "Not enough Hazard Era guards" )
+            {}
+        //@endcond
+        };
+
+        /// Exception "Hazard Era SMR is not initialized"
+        class not_initialized: public std::runtime_error
+        {
+        //@cond
+        public:
+            not_initialized()
+                : std::runtime_error( "Global Hazard Era SMR object is not initialized" )
+            {}
+        //@endcond
+        };
+
+        //@cond
+        /// Hazard era guard
+        /**
+            The guard holds the reserved era and the pointer value.
+            The pointer is a real hazard pointer only if it is set by \p assign();
+            \p protect() stores the pointer without a fence since the pointer is protected by the reserved era.
+        */
+        class guard
+        {
+        public:
+            guard() noexcept
+                : hp_( nullptr )
+                , era_( c_nNoEra )
+                , next_( nullptr )
+            {}
+
+            hazard_ptr get() const noexcept
+            {
+                return hp_.load( atomics::memory_order_acquire );
+            }
+
+            hazard_ptr get( atomics::memory_order order ) const noexcept
+            {
+                return hp_.load( order );
+            }
+
+            template <typename T>
+            T* get_as() const noexcept
+            {
+                return reinterpret_cast<T*>( get());
+            }
+
+            template <typename T>
+            void set( T* ptr ) noexcept
+            {
+                hp_.store( reinterpret_cast<hazard_ptr>( ptr ), atomics::memory_order_release );
+            }
+
+            void clear( atomics::memory_order order ) noexcept
+            {
+                hp_.store( nullptr, order );
+            }
+
+            void clear() noexcept
+            {
+                clear( atomics::memory_order_release );
+            }
+
+            era_t era( atomics::memory_order order = atomics::memory_order_relaxed ) const noexcept
+            {
+                return era_.load( order );
+            }
+
+            /// Publishes era \p e; this is the only place where the full fence is required
+            void reserve( era_t e ) noexcept
+            {
+                era_.store( e, atomics::memory_order_relaxed );
+                atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+            }
+
+            void unreserve() noexcept
+            {
+                era_.store( c_nNoEra, atomics::memory_order_release );
+            }
+
+            /// Loads \p toGuard under reserved era; the era is republished only if the global \p clock has been changed
+            template <typename T, class Func>
+            T protect( atomics::atomic<T> const& toGuard, Func f, atomics::atomic<era_t> const& clock ) noexcept
+            {
+                era_t prev_era = era_.load( atomics::memory_order_relaxed );
+                for ( ;; ) {
+                    T pCur = toGuard.load( atomics::memory_order_acquire );
+                    era_t const cur_era = clock.load( atomics::memory_order_seq_cst );
+                    if ( cds_likely( cur_era == prev_era )) {
+                        hp_.store( reinterpret_cast<hazard_ptr>( f( pCur )), atomics::memory_order_relaxed );
+                        return pCur;
+                    }
+                    reserve( cur_era );
+                    prev_era = cur_era;
+                }
+            }
+
+        private:
+            atomics::atomic<hazard_ptr> hp_;
+            atomics::atomic<era_t>      era_;
+
+        public:
+            guard* next_;   // free guard list
+        };
+
+        /// Array of hazard era guards
+        template <size_t Capacity>
+        using guard_array = cds::gc::hp::common::guard_array< Capacity, guard >;
+
+        /// Retired pointer stamped by the era of retirement
+        struct retired_ptr: public cds::gc::details::retired_ptr
+        {
+            typedef cds::gc::details::retired_ptr base_class;
+
+            era_t   era_;   ///< Global era at the moment of retiring
+
+            retired_ptr() noexcept
+                : era_( c_nNoEra )
+            {}
+
+            template <typename T>
+            retired_ptr( T* p, disposer_func func, era_t era ) noexcept
+                : base_class( p, func )
+                , era_( era )
+            {}
+        };
+        //@endcond
+
+        //@cond
+        /// Per-thread hazard era storage
+        class thread_hp_storage {
+        public:
+            thread_hp_storage( guard* arr, size_t nSize ) noexcept
+                : free_head_( arr )
+                , array_( arr )
+                , capacity_( nSize )
+#       ifdef CDS_ENABLE_HPSTAT
+                , alloc_guard_count_(0)
+                , free_guard_count_(0)
+#       endif
+            {
+                // Initialize guards
+                new( arr ) guard[nSize];
+
+                for ( guard* pEnd = arr + nSize - 1; arr < pEnd; ++arr )
+                    arr->next_ = arr + 1;
+                arr->next_ = nullptr;
+            }
+
+            thread_hp_storage() = delete;
+            thread_hp_storage( thread_hp_storage const& ) = delete;
+            thread_hp_storage( thread_hp_storage&& ) = delete;
+
+            size_t capacity() const noexcept
+            {
+                return capacity_;
+            }
+
+            bool full() const noexcept
+            {
+                return free_head_ == nullptr;
+            }
+
+            guard* alloc()
+            {
+#       ifdef CDS_DISABLE_SMR_EXCEPTION
+                assert( !full());
+#       else
+                if ( full())
+                    CDS_THROW_EXCEPTION( not_enought_hazard_ptr());
+#       endif
+                guard* g = free_head_;
+                free_head_ = g->next_;
+                CDS_HPSTAT( ++alloc_guard_count_ );
+                return g;
+            }
+
+            void free( guard* g ) noexcept
+            {
+                assert( g >= array_ && g < array_ + capacity());
+
+                if ( g ) {
+                    g->clear( atomics::memory_order_relaxed );
+                    g->unreserve();
+                    g->next_ = free_head_;
+                    free_head_ = g;
+                    CDS_HPSTAT( ++free_guard_count_ );
+                }
+            }
+
+            template< size_t Capacity>
+            size_t alloc( guard_array<Capacity>& arr )
+            {
+                size_t i;
+                guard* g = free_head_;
+                for ( i = 0; i < Capacity && g; ++i ) {
+                    arr.reset( i, g );
+                    g = g->next_;
+                }
+
+#       ifdef CDS_DISABLE_SMR_EXCEPTION
+                assert( i == Capacity );
+#       else
+                if ( i != Capacity )
+                    CDS_THROW_EXCEPTION( not_enought_hazard_ptr());
+#       endif
+                free_head_ = g;
+                CDS_HPSTAT( alloc_guard_count_ += Capacity );
+                return i;
+            }
+
+            template <size_t Capacity>
+            void free( guard_array<Capacity>& arr ) noexcept
+            {
+                guard* gList = free_head_;
+                for ( size_t i = 0; i < Capacity; ++i ) {
+                    guard* g = arr[i];
+                    if ( g ) {
+                        g->clear( atomics::memory_order_relaxed );
+                        g->unreserve();
+                        g->next_ = gList;
+                        gList = g;
+                        CDS_HPSTAT( ++free_guard_count_ );
+                    }
+                }
+                free_head_ = gList;
+            }
+
+            // cppcheck-suppress functionConst
+            void clear()
+            {
+                for ( guard* cur = array_, *last = array_ + capacity(); cur < last; ++cur ) {
+                    cur->clear( atomics::memory_order_relaxed );
+                    cur->unreserve();
+                }
+            }
+
+            guard& operator[]( size_t idx )
+            {
+                assert( idx < capacity());
+
+                return array_[idx];
+            }
+
+            static size_t calc_array_size( size_t capacity )
+            {
+                return sizeof( guard ) * capacity;
+            }
+
+        private:
+            guard*          free_head_; ///< Head of free guard list
+            guard* const    array_;     ///< guard array
+            size_t const    capacity_;  ///< guard array capacity
+#       ifdef CDS_ENABLE_HPSTAT
+        public:
+            size_t          alloc_guard_count_;
+            size_t          free_guard_count_;
+#       endif
+        };
+        //@endcond
+
+        //@cond
+        /// Per-thread retired array
+        /**
+            Unlike \p hp::retired_array, the capacity is not bounded: a stalled reader holding an old era
+            can prevent reclamation of any object retired after that era, so \p smr::scan() extends the array
+            when it cannot free enough pointers.
+        */
+        class retired_array
+        {
+        public:
+            retired_array( retired_ptr* arr, size_t capacity ) noexcept
+                : current_( arr )
+                , last_( arr + capacity )
+                , retired_( arr )
+#       ifdef CDS_ENABLE_HPSTAT
+                , retire_call_count_(0)
+                , extend_call_count_(0)
+#       endif
+            {}
+
+            retired_array() = delete;
+            retired_array( retired_array const& ) = delete;
+            retired_array( retired_array&& ) = delete;
+
+            size_t capacity() const noexcept
+            {
+                return last_ - retired_;
+            }
+
+            size_t size() const noexcept
+            {
+                return current_.load(atomics::memory_order_relaxed) - retired_;
+            }
+
+            bool push( retired_ptr const& p ) noexcept
+            {
+                retired_ptr* cur = current_.load( atomics::memory_order_relaxed );
+                *cur = p;
+                CDS_HPSTAT( ++retire_call_count_ );
+                current_.store( cur + 1, atomics::memory_order_relaxed );
+                return cur + 1 < last_;
+            }
+
+            retired_ptr* first() const noexcept
+            {
+                return retired_;
+            }
+
+            retired_ptr* last() const noexcept
+            {
+                return current_.load( atomics::memory_order_relaxed );
+            }
+
+            void reset( size_t nSize ) noexcept
+            {
+                current_.store( first() + nSize, atomics::memory_order_relaxed );
+            }
+
+            void interthread_clear()
+            {
+                current_.exchange( first(), atomics::memory_order_acq_rel );
+            }
+
+            // Moves retired pointers to new storage \p arr of \p capacity, returns old storage
+            // Can be called only by the owner thread
+            retired_ptr* relocate( retired_ptr* arr, size_t capacity ) noexcept
+            {
+                size_t const nSize = size();
+                assert( nSize < capacity );
+
+                std::copy( retired_, retired_ + nSize, arr );
+                retired_ptr* old = retired_;
+                retired_ = arr;
+                last_ = arr + capacity;
+                current_.store( arr + nSize, atomics::memory_order_relaxed );
+                CDS_HPSTAT( ++extend_call_count_ );
+                return old;
+            }
+
+            bool full() const noexcept
+            {
+                return current_.load( atomics::memory_order_relaxed ) == last_;
+            }
+
+            static size_t calc_array_size( size_t capacity )
+            {
+                return sizeof( retired_ptr ) * capacity;
+            }
+
+        private:
+            atomics::atomic<retired_ptr*> current_;
+            retired_ptr*                  last_;
+            retired_ptr*                  retired_;
+#       ifdef CDS_ENABLE_HPSTAT
+        public:
+            size_t  retire_call_count_;
+            size_t  extend_call_count_;
+#       endif
+        };
+        //@endcond
+
+        /// Internal statistics
+        struct stat {
+            size_t  guard_allocated;    ///< Count of allocated guards
+            size_t  guard_freed;        ///< Count of freed guards
+            size_t  retired_count;      ///< Count of retired pointers
+            size_t  free_count;         ///< Count of free pointers
+            size_t  scan_count;         ///< Count of \p scan() call
+            size_t  help_scan_count;    ///< Count of \p help_scan() call
+
+            size_t  thread_rec_count;   ///< Count of thread records
+            size_t  retired_extend_count; ///< Count of retired array extending
+            size_t  era_advance_count;  ///< Count of global era increments
+            size_t  era_guarded_count;  ///< Count of retired pointers kept by \p scan() due to reserved era
+
+            /// Default ctor
+            stat()
+            {
+                clear();
+            }
+
+            /// Clears all counters
+            void clear()
+            {
+                guard_allocated =
+                    guard_freed =
+                    retired_count =
+                    free_count =
+                    scan_count =
+                    help_scan_count =
+                    thread_rec_count =
+                    retired_extend_count =
+                    era_advance_count =
+                    era_guarded_count = 0;
+            }
+        };
+
+        //@cond
+        /// Per-thread data
+        struct thread_data {
+            thread_hp_storage   hazards_;   ///< Hazard era guards private to the thread
+            retired_array       retired_;   ///< Retired data private to the thread
+            size_t              retire_since_advance_; ///< Count of retire() calls since last era increment by the thread
+            cds::gc::telemetry::details::thread_counter telemetry_; ///< Count of retired and freed pointers for telemetry
+
+            char pad1_[cds::c_nCacheLineSize];
+            atomics::atomic<unsigned int> sync_; ///< dummy var to introduce synchronizes-with relationship between threads
+            char pad2_[cds::c_nCacheLineSize];
+
+#       ifdef CDS_ENABLE_HPSTAT
+            // Internal statistics:
+            size_t              free_count_;
+            size_t              scan_count_;
+            size_t              help_scan_count_;
+            size_t              era_advance_count_;
+            size_t              era_guarded_count_;
+#       endif
+
+            // CppCheck warn: pad1_ and pad2_ is uninitialized in ctor
+            // cppcheck-suppress uninitMemberVar
+            thread_data( guard* guards, size_t guard_count, retired_ptr* retired_arr, size_t retired_capacity )
+                : hazards_( guards, guard_count )
+                , retired_( retired_arr, retired_capacity )
+                , retire_since_advance_( 0 )
+                , sync_(0)
+#       ifdef CDS_ENABLE_HPSTAT
+                , free_count_(0)
+                , scan_count_(0)
+                , help_scan_count_(0)
+                , era_advance_count_(0)
+                , era_guarded_count_(0)
+#       endif
+            {}
+
+            thread_data() = delete;
+            thread_data( thread_data const& ) = delete;
+            thread_data( thread_data&& ) = delete;
+
+            void sync()
+            {
+                sync_.fetch_add( 1, atomics::memory_order_acq_rel );
+            }
+        };
+        //@endcond
+
+        //@cond
+        /// Hazard Era SMR (Safe Memory Reclamation)
+        class smr
+        {
+            struct thread_record;
+
+        public:
+            /// Returns the instance of Hazard Era \ref smr
+            static smr& instance()
+            {
+#       ifdef CDS_DISABLE_SMR_EXCEPTION
+                assert( instance_ != nullptr );
+#       else
+                if ( !instance_ )
+                    CDS_THROW_EXCEPTION( not_initialized());
+#       endif
+                return *instance_;
+            }
+
+            /// Creates Hazard Era SMR singleton
+            /**
+                Hazard Era SMR is a singleton. If HE instance is not initialized then the function creates the instance.
+                Otherwise it does nothing.
+
+                Parameters:
+                - \p nHazardPtrCount - guard count per thread. Default is 8.
+                - \p nMaxThreadCount - expected max count of threads, used for initial sizing only. Default is 100.
+                - \p nInitialRetiredPtrCount - initial capacity of retired array of each thread.
+                    Default is <tt>2 * nHazardPtrCount * nMaxThreadCount</tt>. The array is extended if needed.
+                - \p nEraFrequency - a thread increments the global era on each \p nEraFrequency retire call. Default is 64.
+            */
+            static CDS_EXPORT_API void construct(
+                size_t nHazardPtrCount = 0,         ///< Guard count per thread
+                size_t nMaxThreadCount = 0,         ///< Expected max count of simultaneous working thread
+                size_t nInitialRetiredPtrCount = 0, ///< Initial capacity of the array of retired objects for the thread
+                size_t nEraFrequency = 0            ///< Era increment frequency
+            );
+
+            /// Destroys global instance of \ref smr
+            /**
+                The parameter \p bDetachAll should be used carefully: if its value is \p true,
+                then the object destroyed automatically detaches all attached threads. This feature
+                can be useful when you have no control over the thread termination, for example,
+                when \p libcds is injected into existing external thread.
+            */
+            static CDS_EXPORT_API void destruct(
+                bool bDetachAll = false     ///< Detach all threads
+            );
+
+            /// Checks if global SMR object is constructed and may be used
+            static bool isUsed() noexcept
+            {
+                return instance_ != nullptr;
+            }
+
+            /// Set memory management functions
+            /**
+                @note This function may be called <b>BEFORE</b> creating an instance
+                of Hazard Era SMR
+
+                SMR object allocates some memory for thread-specific data and for
+                creating SMR object.
+                By default, a standard \p new and \p delete operators are used for this.
+            */
+            static CDS_EXPORT_API void set_memory_allocator(
+                void* ( *alloc_func )( size_t size ),
+                void (*free_func )( void * p )
+            );
+
+            /// Returns guard count per thread
+            size_t get_hazard_ptr_count() const noexcept
+            {
+                return hazard_ptr_count_;
+            }
+
+            /// Returns expected max thread count
+            size_t get_max_thread_count() const noexcept
+            {
+                return max_thread_count_;
+            }
+
+            /// Returns initial capacity of retired pointer array
+            size_t get_initial_retired_ptr_count() const noexcept
+            {
+                return initial_retired_ptr_count_;
+            }
+
+            /// Returns era increment frequency
+            size_t get_era_frequency() const noexcept
+            {
+                return era_frequency_;
+            }
+
+            /// Returns the global era clock
+            atomics::atomic<era_t> const& era_clock() const noexcept
+            {
+                return global_era_;
+            }
+
+            /// Returns the era for the pointer retired by \p pRec; increments the global era each \p get_era_frequency() call
+            era_t retire_era( thread_data* pRec ) noexcept
+            {
+                if ( ++pRec->retire_since_advance_ >= era_frequency_ ) {
+                    pRec->retire_since_advance_ = 0;
+                    CDS_HPSTAT( ++pRec->era_advance_count_ );
+                    return global_era_.fetch_add( 1, atomics::memory_order_seq_cst ) + 1;
+                }
+                return global_era_.load( atomics::memory_order_seq_cst );
+            }
+
+            /// Checks that required guard count \p nCountNeeded is less or equal then max guard count
+            /**
+                If <tt> nRequiredCount > get_hazard_ptr_count()</tt> then the exception \p not_enought_hazard_ptr is thrown
+            */
+            static void check_hazard_ptr_count( size_t nRequiredCount )
+            {
+                if ( instance().get_hazard_ptr_count() < nRequiredCount ) {
+#       ifdef CDS_DISABLE_SMR_EXCEPTION
+                    assert( false );    // not enough hazard ptr
+#       else
+                    CDS_THROW_EXCEPTION( not_enought_hazard_ptr());
+#       endif
+                }
+            }
+
+            /// Returns thread-local data for the current thread
+            static CDS_EXPORT_API thread_data* tls();
+
+            static CDS_EXPORT_API void attach_thread();
+            static CDS_EXPORT_API void detach_thread();
+
+            /// Get internal statistics
+            CDS_EXPORT_API void statistics( stat& st );
+
+            /// Get reclamation telemetry
+            CDS_EXPORT_API void telemetry( cds::gc::telemetry::snapshot& st );
+
+        public: // for internal use only
+            /// The main garbage collecting function
+            /**
+                The function increments the global era, then collects the minimal era reserved by all threads
+                and all hazard pointers set by \p assign().
+                A retired pointer is freed if its retire era is less than the minimal reserved era
+                and the pointer is not a hazard pointer. The birth era is not taken into account, see \p HE.
+                The hazard pointer list is kept in the thread record and is reused by subsequent scans.
+                If less than a quarter of retired pointers is freed, the retired array is extended.
+            */
+            CDS_EXPORT_API void scan( thread_data* pRec );
+
+            /// Helper scan routine
+            /**
+                The function moves retired pointers of the terminated threads to the current thread
+                and calls \p scan().
+            */
+            CDS_EXPORT_API void help_scan( thread_data* pThis );
+
+            /// Samples retired pointer \p p of size \p nSize for telemetry
+            void sample( retired_ptr& p, size_t nSize )
+            {
+                if ( cds::gc::telemetry::details::is_sampled( p.m_p )) {
+                    telemetry_.sample_size( nSize );
+                    telemetry_.sample< telemetry_locator >( p.m_p, p.m_funcFree );
+                }
+            }
+
+        private:
+            CDS_EXPORT_API smr(
+                size_t nHazardPtrCount,
+                size_t nMaxThreadCount,
+                size_t nInitialRetiredPtrCount,
+                size_t nEraFrequency
+            );
+
+            CDS_EXPORT_API ~smr();
+
+            CDS_EXPORT_API void detach_all_thread();
+
+            /// Allocates Hazard Era SMR thread private data
+            CDS_EXPORT_API thread_record* alloc_thread_data();
+
+            /// Free HE SMR thread-private data
+            CDS_EXPORT_API void free_thread_data( thread_record* pRec );
+
+            CDS_EXPORT_API thread_record* create_thread_data();
+            static CDS_EXPORT_API void destroy_thread_data( thread_record* pRec );
+
+            /// Doubles retired array of \p pRec
+            CDS_EXPORT_API void extend_retired( thread_data* pRec );
+
+            struct telemetry_locator {
+                static cds::gc::telemetry::details::collector& get()
+                {
+                    return instance().telemetry_;
+                }
+            };
+
+        private:
+            static CDS_EXPORT_API smr* instance_;
+
+            char pad1_[cds::c_nCacheLineSize];
+            atomics::atomic<era_t>          global_era_;    ///< Global era clock
+            char pad2_[cds::c_nCacheLineSize - sizeof( atomics::atomic<era_t> )];
+
+            atomics::atomic< thread_record*> thread_list_;   ///< Head of thread list
+            size_t const    hazard_ptr_count_;      ///< max count of thread's guards
+            size_t const    max_thread_count_;      ///< expected max count of thread
+            size_t const    initial_retired_ptr_count_; ///< initial capacity of retired array of each thread
+            size_t const    era_frequency_;         ///< era increment frequency
+            cds::gc::telemetry::details::collector telemetry_; ///< reclamation telemetry
+        };
+        //@endcond
+
+        //@cond
+        // for backward compatibility
+        typedef smr GarbageCollector;
+        //@endcond
+
+    } // namespace he
+
+    /// Hazard Era SMR
+    /**  @ingroup cds_garbage_collector
+
+        Implementation of Hazard Eras safe memory reclamation schema.
+
+        Sources:
+            - [2017] Pedro Ramalhete, Andreia Correia "Brief Announcement: Hazard Eras - Non-Blocking
+                Memory Reclamation"
+            - [2018] Haosen Wen et al. "Interval-Based Memory Reclamation"
+
+        \p %HE is a drop-in replacement for \p cds::gc::HP: it has the same \p Guard, \p GuardArray,
+        \p guarded_ptr and \p retire() interface, so any HP-based container can be instantiated with \p %cds::gc::HE.
+
+        The difference is in how a guard protects a pointer. \p HP::Guard::protect() stores the pointer into
+        the hazard pointer slot and issues a full fence for every protected pointer.
+        \p HE::Guard::protect() publishes the current global era instead; the era (and hence the fence)
+        is republished only when the global era has been changed since the guard's last \p protect().
+        Traversing a list therefore costs one fence per guard per operation instead of one fence per node.
+
+        Each retired pointer is stamped with the global era of its retirement. \p scan() frees the pointer
+        if no guard reserves an era less than or equal to the retire era.
+
+        @warning This is not the full Hazard Eras algorithm: it is the hazard pointer schema with era-ordered
+        retirement. Hazard Eras requires the birth era of each object, that is the global era at the moment
+        of its allocation, and frees the object if no reserved era falls into <tt>[birth era, retire era]</tt>.
+        The intrusive nodes of \p libcds containers have no field for the birth era, so \p %HE does not
+        record it and treats it as zero. The consequence is that a reader stalled inside an operation
+        prevents reclamation of all objects retired after its reserved era, including the objects
+        allocated after that era which the reader cannot reach. The memory is still bounded by the count
+        of retired objects; the retired array is extended automatically in that case.
+
+        \p Guard::assign() is used for pointers already protected by other means, for example, copying
+        from another guard. Such a pointer is stored as a classic hazard pointer with a full fence,
+        and \p scan() does not free it too.
+
+        The global era is incremented by \p scan() and by each \p nEraFrequency retire call of a thread.
+
+        See \ref cds_how_to_use "How to use" section for details how to apply SMR schema.
+    */
+    class HE
+    {
+    public:
+        /// Native guarded pointer type
+        typedef he::hazard_ptr guarded_pointer;
+
+        /// Atomic reference
+        template <typename T> using atomic_ref = atomics::atomic<T *>;
+
+        /// Atomic marked pointer
+        template <typename MarkedPtr> using atomic_marked_ptr = atomics::atomic<MarkedPtr>;
+
+        /// Atomic type
+        template <typename T> using atomic_type = atomics::atomic<T>;
+
+        /// Exception "Not enough Hazard Era guards"
+        typedef he::not_enought_hazard_ptr not_enought_hazard_ptr_exception;
+
+        /// Internal statistics
+        typedef he::stat stat;
+
+        /// Reclamation telemetry snapshot, see \p cds::gc::telemetry
+        typedef cds::gc::telemetry::snapshot telemetry_snapshot;
+
+        /// Hazard Era guard
+        /**
+            The guard reserves an era and keeps the protected pointer.
+            Additionally, the \p %Guard class manages allocation and deallocation of the guard slot.
+
+            \p %Guard object is movable but not copyable.
+
+            The guard object can be in two states:
+            - unlinked - the guard is not linked with any internal slot.
+              In this state no operation except \p link() and move assignment is supported.
+            - linked (default) - the guard allocates an internal slot and completely operable.
+
+            Due to performance reason the implementation does not check state of the guard in runtime.
+
+            @warning Move assignment transfers the guard in unlinked state, use with care.
+        */
+        class Guard
+        {
+        public:
+            /// Default ctor allocates a guard from thread-private storage
+            /**
+                @warning Can throw \p not_enought_hazard_ptr if internal guard array is exhausted.
+            */
+            Guard()
+                : guard_( he::smr::tls()->hazards_.alloc())
+            {}
+
+            /// Initilalizes an unlinked guard i.e. the guard contains no slot. Used for move semantics support
+            explicit Guard( std::nullptr_t ) noexcept
+                : guard_( nullptr )
+            {}
+
+            /// Move ctor - \p src guard becomes unlinked (transfer internal guard ownership)
+            Guard( Guard&& src ) noexcept
+                : guard_( src.guard_ )
+            {
+                src.guard_ = nullptr;
+            }
+
+            /// Move assignment: the internal guards are swapped between \p src and \p this
+            /**
+                @warning \p src will become in unlinked state if \p this was unlinked on entry.
+            */
+            Guard& operator=( Guard&& src ) noexcept
+            {
+                std::swap( guard_, src.guard_ );
+                return *this;
+            }
+
+            /// Copy ctor is prohibited - the guard is not copyable
+            Guard( Guard const& ) = delete;
+
+            /// Copy assignment is prohibited
+            Guard& operator=( Guard const& ) = delete;
+
+            /// Frees the internal slot if the guard is in linked state
+            ~Guard()
+            {
+                unlink();
+            }
+
+            /// Checks if the guard object linked with any internal slot
+            bool is_linked() const
+            {
+                return guard_ != nullptr;
+            }
+
+            /// Links the guard with internal slot if the guard is in unlinked state
+            /**
+                @warning Can throw \p not_enought_hazard_ptr_exception if internal guard array is exhausted.
+            */
+            void link()
+            {
+                if ( !guard_ )
+                    guard_ = he::smr::tls()->hazards_.alloc();
+            }
+
+            /// Unlinks the guard from internal slot; the guard becomes in unlinked state
+            void unlink()
+            {
+                if ( guard_ ) {
+                    he::smr::tls()->hazards_.free( guard_ );
+                    guard_ = nullptr;
+                }
+            }
+
+            /// Protects a pointer of type \p atomic<T*>
+            /**
+                Return the value of \p toGuard
+
+                The function loads \p toGuard under the era reserved by the guard.
+                If the global era has been changed, the function reserves new era and repeats loading.
+            */
+            template <typename T>
+            T protect( atomics::atomic<T> const& toGuard )
+            {
+                assert( guard_ != nullptr );
+                return guard_->protect( toGuard, []( T p ) { return p; }, he::smr::instance().era_clock());
+            }
+
+            /// Protects a converted pointer of type \p atomic<T*>
+            /**
+                Return the value of \p toGuard
+
+                The function is useful for intrusive containers when \p toGuard is a node pointer
+                that should be converted to a pointer to the value type before protecting.
+                The parameter \p f of type Func is a functor that makes this conversion:
+                \code
+                    struct functor {
+                        value_type * operator()( T * p );
+                    };
+                \endcode
+                Actually, the result of <tt> f( toGuard.load()) </tt> is stored in the guard.
+            */
+            template <typename T, class Func>
+            T protect( atomics::atomic<T> const& toGuard, Func f )
+            {
+                assert( guard_ != nullptr );
+                return guard_->protect( toGuard, f, he::smr::instance().era_clock());
+            }
+
+            /// Store \p p to the guard
+            /**
+                The function stores \p p as a classic hazard pointer (with a full fence), no loop is performed.
+                Can be used for a pointer that cannot be changed concurrently or for already guarded pointer.
+            */
+            template <typename T>
+            T * assign( T* p )
+            {
+                assert( guard_ != nullptr );
+
+                guard_->set( p );
+                he::smr::tls()->sync();
+                return p;
+            }
+
+            //@cond
+            std::nullptr_t assign( std::nullptr_t )
+            {
+                assert( guard_ != nullptr );
+
+                guard_->clear();
+                return nullptr;
+            }
+            //@endcond
+
+            /// Copy a value guarded from \p src guard to \p this guard (valid only in linked state)
+            void copy( Guard const& src )
+            {
+                assign( src.get_native());
+            }
+
+            /// Store marked pointer \p p to the guard
+            /**
+                The function just assigns <tt>p.ptr()</tt>, no loop is performed.
+                Can be used for a marked pointer that cannot be changed concurrently or for already guarded pointer.
+            */
+            template <typename T, int BITMASK>
+            T * assign( cds::details::marked_ptr<T, BITMASK> p )
+            {
+                return assign( p.ptr());
+            }
+
+            /// Clear value of the guard (valid only in linked state)
+            /**
+                The reserved era is kept until the guard is freed.
+            */
+            void clear()
+            {
+                assign( nullptr );
+            }
+
+            /// Get the value currently protected (valid only in linked state)
+            template <typename T>
+            T * get() const
+            {
+                assert( guard_ != nullptr );
+                return guard_->get_as<T>();
+            }
+
+            /// Get native guarded pointer stored (valid only in linked state)
+            guarded_pointer get_native() const
+            {
+                assert( guard_ != nullptr );
+                return guard_->get();
+            }
+
+            //@cond
+            he::guard* release()
+            {
+                he::guard* g = guard_;
+                guard_ = nullptr;
+                return g;
+            }
+
+            he::guard*& guard_ref()
+            {
+                return guard_;
+            }
+            //@endcond
+
+        private:
+            //@cond
+            he::guard* guard_;
+            //@endcond
+        };
+
+        /// Array of Hazard Era guards
+        /**
+            The class is intended for allocating an array of guards.
+            Template parameter \p Count defines the size of the array.
+        */
+        template <size_t Count>
+        class GuardArray
+        {
+        public:
+            /// Rebind array for other size \p Count2
+            template <size_t Count2>
+            struct rebind {
+                typedef GuardArray<Count2>  other;   ///< rebinding result
+            };
+
+            /// Array capacity
+            static constexpr const size_t c_nCapacity = Count;
+
+        public:
+            /// Default ctor allocates \p Count guards
+            GuardArray()
+            {
+                he::smr::tls()->hazards_.alloc( guards_ );
+            }
+
+            /// Move ctor is prohibited
+            GuardArray( GuardArray&& ) = delete;
+
+            /// Move assignment is prohibited
+            GuardArray& operator=( GuardArray&& ) = delete;
+
+            /// Copy ctor is prohibited
+            GuardArray( GuardArray const& ) = delete;
+
+            /// Copy assignment is prohibited
+            GuardArray& operator=( GuardArray const& ) = delete;
+
+            /// Frees allocated guards
+            ~GuardArray()
+            {
+                he::smr::tls()->hazards_.free( guards_ );
+            }
+
+            /// Protects a pointer of type \p atomic<T*>
+            /**
+                Return the value of \p toGuard
+
+                The function loads \p toGuard under the era reserved by the slot \p nIndex.
+                If the global era has been changed, the function reserves new era and repeats loading.
+            */
+            template <typename T>
+            T protect( size_t nIndex, atomics::atomic<T> const& toGuard )
+            {
+                assert( nIndex < capacity());
+                return guards_[nIndex]->protect( toGuard, []( T p ) { return p; }, he::smr::instance().era_clock());
+            }
+
+            /// Protects a pointer of type \p atomic<T*>
+            /**
+                Return the value of \p toGuard
+
+                The function is useful for intrusive containers when \p toGuard is a node pointer
+                that should be converted to a pointer to the value type before guarding.
+                The parameter \p f of type Func is a functor that makes this conversion:
+                \code
+                    struct functor {
+                        value_type * operator()( T * p );
+                    };
+                \endcode
+                Actually, the result of <tt> f( toGuard.load()) </tt> is stored in the slot.
+            */
+            template <typename T, class Func>
+            T protect( size_t nIndex, atomics::atomic<T> const& toGuard, Func f )
+            {
+                assert( nIndex < capacity());
+                return guards_[nIndex]->protect( toGuard, f, he::smr::instance().era_clock());
+            }
+
+            /// Store \p to the slot \p nIndex
+            /**
+                The function stores \p p as a classic hazard pointer (with a full fence), no loop is performed.
+            */
+            template <typename T>
+            T * assign( size_t nIndex, T * p )
+            {
+                assert( nIndex < capacity());
+
+                guards_.set( nIndex, p );
+                he::smr::tls()->sync();
+                return p;
+            }
+
+            /// Store marked pointer \p p to the guard
+            /**
+                The function just assigns <tt>p.ptr()</tt>, no loop is performed.
+                Can be used for a marked pointer that cannot be changed concurrently or for already guarded pointer.
+            */
+            template <typename T, int BITMASK>
+            T * assign( size_t nIndex, cds::details::marked_ptr<T, BITMASK> p )
+            {
+                return assign( nIndex, p.ptr());
+            }
+
+            /// Copy guarded value from \p src guard to slot at index \p nIndex
+            void copy( size_t nIndex, Guard const& src )
+            {
+                assign( nIndex, src.get_native());
+            }
+
+            /// Copy guarded value from slot \p nSrcIndex to the slot \p nDestIndex
+            void copy( size_t nDestIndex, size_t nSrcIndex )
+            {
+                assign( nDestIndex, get_native( nSrcIndex ));
+            }
+
+            /// Clear value of the slot \p nIndex
+            void clear( size_t nIndex )
+            {
+                guards_.clear( nIndex );
+            }
+
+            /// Get current value of slot \p nIndex
+            template <typename T>
+            T * get( size_t nIndex ) const
+            {
+                assert( nIndex < capacity());
+                return guards_[nIndex]->template get_as<T>();
+            }
+
+            /// Get native guarded pointer stored
+            guarded_pointer get_native( size_t nIndex ) const
+            {
+                assert( nIndex < capacity());
+                return guards_[nIndex]->get();
+            }
+
+            //@cond
+            he::guard* release( size_t nIndex ) noexcept
+            {
+                return guards_.release( nIndex );
+            }
+            //@endcond
+
+            /// Capacity of the guard array
+            static constexpr size_t capacity()
+            {
+                return c_nCapacity;
+            }
+
+        private:
+            //@cond
+            he::guard_array<c_nCapacity> guards_;
+            //@endcond
+        };
+
+        /// Guarded pointer
+        /**
+            A guarded pointer is a pair of a pointer and GC's guard.
+            Usually, it is used for returning a pointer to an element of a lock-free container.
+            The guard prevents the pointer to be early disposed (freed) by SMR.
+            After destructing \p %guarded_ptr object the pointer can be disposed (freed) automatically at any time.
+
+            Template arguments:
+            - \p GuardedType - a type which the guard stores
+            - \p ValueType - a value type
+            - \p Cast - a functor for converting <tt>GuardedType*</tt> to <tt>ValueType*</tt>. Default is \p void (no casting).
+
+            See \p cds::gc::HP::guarded_ptr for details.
+        */
+        template <typename GuardedType, typename ValueType=GuardedType, typename Cast=void >
+        class guarded_ptr
+        {
+            //@cond
+            struct trivial_cast {
+                ValueType * operator()( GuardedType * p ) const
+                {
+                    return p;
+                }
+            };
+
+            template <typename GT, typename VT, typename C> friend class guarded_ptr;
+            //@endcond
+
+        public:
+            typedef GuardedType guarded_type; ///< Guarded type
+            typedef ValueType   value_type;   ///< Value type
+
+            /// Functor for casting \p guarded_type to \p value_type
+            typedef typename std::conditional< std::is_same<Cast, void>::value, trivial_cast, Cast >::type value_cast;
+
+        public:
+            /// Creates empty guarded pointer
+            guarded_ptr() noexcept
+                : guard_(nullptr)
+            {}
+
+            //@cond
+            explicit guarded_ptr( he::guard* g ) noexcept
+                : guard_( g )
+            {}
+
+            /// Initializes guarded pointer with \p p
+            explicit guarded_ptr( guarded_type* p ) noexcept
+                : guard_( nullptr )
+            {
+                reset(p);
+            }
+            explicit guarded_ptr( std::nullptr_t ) noexcept
+                : guard_( nullptr )
+            {}
+            //@endcond
+
+            /// Move ctor
+            guarded_ptr( guarded_ptr&& gp ) noexcept
+                : guard_( gp.guard_ )
+            {
+                gp.guard_ = nullptr;
+            }
+
+            /// Move ctor
+            template <typename GT, typename VT, typename C>
+            guarded_ptr( guarded_ptr<GT, VT, C>&& gp ) noexcept
+                : guard_( gp.guard_ )
+            {
+                gp.guard_ = nullptr;
+            }
+
+            /// Ctor from \p Guard
+            explicit guarded_ptr( Guard&& g ) noexcept
+                : guard_( g.release())
+            {}
+
+            /// The guarded pointer is not copy-constructible
+            guarded_ptr( guarded_ptr const& gp ) = delete;
+
+            /// Clears the guarded pointer
+            /**
+                \ref release() is called if guarded pointer is not \ref empty()
+            */
+            ~guarded_ptr() noexcept
+            {
+                release();
+            }
+
+            /// Move-assignment operator
+            guarded_ptr& operator=( guarded_ptr&& gp ) noexcept
+            {
+                std::swap( guard_, gp.guard_ );
+                return *this;
+            }
+
+            /// Move-assignment from \p Guard
+            guarded_ptr& operator=( Guard&& g ) noexcept
+            {
+                std::swap( guard_, g.guard_ref());
+                return *this;
+            }
+
+            /// The guarded pointer is not copy-assignable
+            guarded_ptr& operator=(guarded_ptr const& gp) = delete;
+
+            /// Returns a pointer to guarded value
+            value_type * operator ->() const noexcept
+            {
+                assert( !empty());
+                return value_cast()( guard_->get_as<guarded_type>());
+            }
+
+            /// Returns a reference to guarded value
+            value_type& operator *() noexcept
+            {
+                assert( !empty());
+                return *value_cast()( guard_->get_as<guarded_type>());
+            }
+
+            /// Returns const reference to guarded value
+            value_type const& operator *() const noexcept
+            {
+                assert( !empty());
+                return *value_cast()( guard_->get_as<guarded_type>());
+            }
+
+            /// Checks if the guarded pointer is \p nullptr
+            bool empty() const noexcept
+            {
+                return !guard_ || guard_->get( atomics::memory_order_relaxed ) == nullptr;
+            }
+
+            /// \p bool operator returns <tt>!empty()</tt>
+            explicit operator bool() const noexcept
+            {
+                return !empty();
+            }
+
+            /// Clears guarded pointer
+            /**
+                If the guarded pointer has been released, the pointer can be disposed (freed) at any time.
+                Dereferncing the guarded pointer after \p release() is dangerous.
+            */
+            void release() noexcept
+            {
+                free_guard();
+            }
+
+            //@cond
+            // For internal use only!!!
+            void reset(guarded_type * p) noexcept
+            {
+                alloc_guard();
+                assert( guard_ );
+                guard_->set(p);
+                he::smr::tls()->sync();
+            }
+            //@endcond
+
+        private:
+            //@cond
+            void alloc_guard()
+            {
+                if ( !guard_ )
+                    guard_ = he::smr::tls()->hazards_.alloc();
+            }
+
+            void free_guard()
+            {
+                if ( guard_ ) {
+                    he::smr::tls()->hazards_.free( guard_ );
+                    guard_ = nullptr;
+                }
+            }
+            //@endcond
+
+        private:
+            //@cond
+            he::guard* guard_;
+            //@endcond
+        };
+
+    public:
+        /// Initializes %HE singleton
+        /**
+            The constructor initializes Hazard Era SMR singleton with passed parameters.
+            If the instance does not yet exist then the function creates the instance.
+            Otherwise it does nothing.
+
+            Parameters:
+            - \p nHazardPtrCount - guard count per thread. Usually it is small number (up to 10) depending from
+                the data structure algorithms. If \p nHazardPtrCount = 0, the defaul value 8 is used
+            - \p nMaxThreadCount - expected max count of thread with using %HE GC in your application. Default is 100.
+                Unlike \p HP, this is not an upper bound, it is used for initial sizing only.
+            - \p nInitialRetiredPtrCount - initial capacity of array of retired pointers for each thread.
+                Default is <tt>2 * nHazardPtrCount * nMaxThreadCount</tt>. The array is extended on demand.
+            - \p nEraFrequency - each thread increments the global era on every \p nEraFrequency retire call.
+                Less value means more frequent era republication in \p Guard::protect() but faster reclamation.
+                Default is 64.
+        */
+        HE(
+            size_t nHazardPtrCount = 0,         ///< Guard count per thread
+            size_t nMaxThreadCount = 0,         ///< Expected max count of simultaneous working thread in your application
+            size_t nInitialRetiredPtrCount = 0, ///< Initial capacity of the array of retired objects for the thread
+            size_t nEraFrequency = 0            ///< Era increment frequency
+        )
+        {
+            he::smr::construct(
+                nHazardPtrCount,
+                nMaxThreadCount,
+                nInitialRetiredPtrCount,
+                nEraFrequency
+            );
+        }
+
+        /// Terminates GC singleton
+        /**
+            The destructor destroys %HE global object. After calling of this function you may \b NOT
+            use CDS data structures based on \p %cds::gc::HE.
+            Usually, %HE object is destroyed at the end of your \p main().
+        */
+        ~HE()
+        {
+            he::smr::destruct( true );
+        }
+
+        /// Checks that required guard count \p nCountNeeded is less or equal then max guard count
+        /**
+            If <tt> nRequiredCount > max_hazard_count()</tt> then the exception \p not_enought_hazard_ptr is thrown
+        */
+        static void check_available_guards( size_t nCountNeeded )
+        {
+            he::smr::check_hazard_ptr_count( nCountNeeded );
+        }
+
+        /// Set memory management functions
+        /**
+            @note This function may be called <b>BEFORE</b> creating an instance
+            of Hazard Era SMR
+
+            SMR object allocates some memory for thread-specific data and for
+            creating SMR object.
+            By default, a standard \p new and \p delete operators are used for this.
+        */
+        static void set_memory_allocator(
+            void* ( *alloc_func )( size_t size ),   ///< \p malloc() function
+            void( *free_func )( void * p )          ///< \p free() function
+        )
+        {
+            he::smr::set_memory_allocator( alloc_func, free_func );
+        }
+
+        /// Returns guard count per thread
+        static size_t max_hazard_count()
+        {
+            return he::smr::instance().get_hazard_ptr_count();
+        }
+
+        /// Returns expected max thread count
+        static size_t max_thread_count()
+        {
+            return he::smr::instance().get_max_thread_count();
+        }
+
+        /// Returns initial capacity of retired pointer array
+        static size_t retired_array_capacity()
+        {
+            return he::smr::instance().get_initial_retired_ptr_count();
+        }
+
+        /// Returns era increment frequency
+        static size_t era_frequency()
+        {
+            return he::smr::instance().get_era_frequency();
+        }
+
+        /// Retire pointer \p p with function \p func
+        /**
+            The function places pointer \p p to array of pointers ready for removing
+            (so called retired pointer array) and stamps it by current global era.
+            The pointer can be safely removed when no guard reserves an era less than or equal to the stamp
+            and no guard holds \p p as a hazard pointer.
+            \p func is a disposer: when \p p can be safely removed, \p func is called.
+        */
+        template <typename T>
+        static void retire( T * p, void( *func )( void * ))
+        {
+            he::smr& gc = he::smr::instance();
+            he::thread_data* rec = he::smr::tls();
+            he::retired_ptr rp( p, func, gc.retire_era( rec ));
+            gc.sample( rp, cds::gc::telemetry::details::object_size<T>::value );
+            rec->telemetry_.retire();
+            if ( !rec->retired_.push( rp ))
+                gc.scan( rec );
+        }
+
+        /// Retire pointer \p p with functor of type \p Disposer
+        /**
+            The function places pointer \p p to array of pointers ready for removing
+            (so called retired pointer array).
+
+            See \p cds::gc::HP::retire() for \p Disposer requirements.
+        */
+        template <class Disposer, typename T>
+        static void retire( T * p )
+        {
+            retire( p, cds::details::static_functor<Disposer, T>::call );
+        }
+
+        /// Checks if Hazard Era GC is constructed and may be used
+        static bool isUsed()
+        {
+            return he::smr::isUsed();
+        }
+
+        /// Forces SMR call for current thread
+        /**
+            Usually, this function should not be called directly.
+        */
+        static void scan()
+        {
+            he::smr::instance().scan( he::smr::tls());
+        }
+
+        /// Synonym for \p scan()
+        static void force_dispose()
+        {
+            scan();
+        }
+
+        /// Returns internal statistics
+        /**
+            The function clears \p st before gathering statistics.
+
+            @note Internal statistics is available only if you compile
+            \p libcds and your program with \p -DCDS_ENABLE_HPSTAT.
+        */
+        static void statistics( stat& st )
+        {
+            he::smr::instance().statistics( st );
+        }
+
+        /// Returns post-mortem statistics
+        /**
+            Post-mortem statistics is gathered in the \p %HE object destructor
+            and can be accessible after destructing the global \p %HE object.
+
+            @note Internal statistics is available only if you compile
+            \p libcds and your program with \p -DCDS_ENABLE_HPSTAT.
+        */
+        CDS_EXPORT_API static stat const& postmortem_statistics();
+
+        /// Returns reclamation telemetry
+        /**
+            Unlike \p statistics(), the telemetry is gathered always and may be read at any time from any thread.
+            The blocking thread is the thread that reserves the minimal era when \p scan() cannot free most of retired pointers.
+            See \p cds::gc::telemetry for details.
+        */
+        static void telemetry( telemetry_snapshot& st )
+        {
+            he::smr::instance().telemetry( st );
+        }
+    };
+
+}} // namespace cds::gc
+
+#endif // #ifndef CDSLIB_GC_HE_SMR_H
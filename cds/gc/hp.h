@@ -33,6 +33,7 @@
 
 #include <exception>
 #include <cds/gc/details/hp_common.h>
+#include <cds/gc/details/telemetry.h>
 #include <cds/details/lib.h>
 #include <cds/threading/model.h>
 #include <cds/details/throw_exception.h>
@@ -299,6 +300,21 @@ namespace cds { namespace gc {
                 current_.exchange( first(), atomics::memory_order_acq_rel );
             }
 
+            // Moves retired pointers to new storage \p arr of \p capacity, returns old storage
+            // Can be called only by the owner thread
+            retired_ptr* relocate( retired_ptr* arr, size_t capacity ) noexcept
+            {
+                size_t const nSize = size();
+                assert( nSize < capacity );
+
+                std::copy( retired_, retired_ + nSize, arr );
+                retired_ptr* old = retired_;
+                retired_ = arr;
+                last_ = arr + capacity;
+                current_.store( arr + nSize, atomics::memory_order_relaxed );
+                return old;
+            }
+
             bool full() const noexcept
             {
                 return current_.load( atomics::memory_order_relaxed ) == last_;
@@ -311,8 +327,8 @@ namespace cds { namespace gc {
 
         private:
             atomics::atomic<retired_ptr*> current_;
-            retired_ptr* const            last_;
-            retired_ptr* const            retired_;
+            retired_ptr*                  last_;
+            retired_ptr*                  retired_;
 #       ifdef CDS_ENABLE_HPSTAT
         public:
             size_t  retire_call_count_;
@@ -330,6 +346,16 @@ namespace cds { namespace gc {
             size_t  help_scan_count;    ///< Count of \p help_scan() call
 
             size_t  thread_rec_count;   ///< Count of thread records
+            size_t  retired_resize_count; ///< Count of retired array resizing (\p elastic capacity mode only)
+
+            size_t  offload_count;          ///< Count of retired batches passed to the dispose thread
+            size_t  offload_retired_count;  ///< Count of retired pointers passed to the dispose thread
+            size_t  offload_reject_count;   ///< Count of batches rejected by the dispose thread due to back-pressure
+            size_t  dispose_thread_free_count; ///< Count of pointers freed by the dispose thread (included in \p free_count)
+
+            size_t  simd_scan_count;    ///< Count of \p vectorized_scan() call resolved by SIMD compare kernel
+            size_t  hash_scan_count;    ///< Count of \p vectorized_scan() call resolved by hash set lookup
+            size_t  snapshot_hp_count;  ///< Total count of non-null hazard pointers copied to snapshots by \p vectorized_scan()
 
             /// Default ctor
             stat()
@@ -346,7 +372,15 @@ namespace cds { namespace gc {
                     free_count =
                     scan_count =
                     help_scan_count =
-                    thread_rec_count = 0;
+                    thread_rec_count =
+                    retired_resize_count =
+                    offload_count =
+                    offload_retired_count =
+                    offload_reject_count =
+                    dispose_thread_free_count =
+                    simd_scan_count =
+                    hash_scan_count =
+                    snapshot_hp_count = 0;
             }
         };
 
@@ -355,6 +389,7 @@ namespace cds { namespace gc {
         struct thread_data {
             thread_hp_storage   hazards_;   ///< Hazard pointers private to the thread
             retired_array       retired_;   ///< Retired data private to the thread
+            cds::gc::telemetry::details::thread_counter telemetry_; ///< Count of retired and freed pointers for telemetry
 
             char pad1_[cds::c_nCacheLineSize];
             atomics::atomic<unsigned int> sync_; ///< dummy var to introduce synchronizes-with relationship between threads
@@ -365,6 +400,10 @@ namespace cds { namespace gc {
             size_t              free_count_;
             size_t              scan_count_;
             size_t              help_scan_count_;
+            size_t              retired_resize_count_;
+            size_t              simd_scan_count_;
+            size_t              hash_scan_count_;
+            size_t              snapshot_hp_count_;
 #       endif
 
             // CppCheck warn: pad1_ and pad2_ is uninitialized in ctor
@@ -377,6 +416,10 @@ namespace cds { namespace gc {
                 , free_count_(0)
                 , scan_count_(0)
                 , help_scan_count_(0)
+                , retired_resize_count_(0)
+                , simd_scan_count_(0)
+                , hash_scan_count_(0)
+                , snapshot_hp_count_(0)
 #       endif
             {}
 
@@ -394,7 +437,14 @@ namespace cds { namespace gc {
         /// \p smr::scan() strategy
         enum scan_type {
             classic,    ///< classic scan as described in Michael's works (see smr::classic_scan())
-            inplace     ///< inplace scan without allocation (see smr::inplace_scan())
+            inplace,    ///< inplace scan without allocation (see smr::inplace_scan())
+            vectorized  ///< scan against cache-aligned hazard snapshot with SIMD compare (see smr::vectorized_scan())
+        };
+
+        /// Retired array capacity policy
+        enum capacity_mode {
+            fixed_capacity,     ///< retired array capacity is computed once from \p nMaxThreadCount
+            elastic_capacity    ///< retired array capacity follows the count of attached threads
         };
 
         //@cond
@@ -402,8 +452,12 @@ namespace cds { namespace gc {
         class smr
         {
             struct thread_record;
+            struct reclaimer;
 
         public:
+            /// Max hazard pointer snapshot size for linear SIMD search in \p vectorized_scan()
+            static constexpr size_t const c_nVectorizedScanLinearLimit = 128;
+
             /// Returns the instance of Hazard Pointer \ref smr
             static smr& instance()
             {
@@ -429,12 +483,17 @@ namespace cds { namespace gc {
                 - \p nMaxRetiredPtrCount - capacity of array of retired pointers for each thread. Must be greater than
                     <tt> nHazardPtrCount * nMaxThreadCount </tt>
                     Default is <tt>2 * nHazardPtrCount * nMaxThreadCount</tt>
+
+                If \p nCapacityMode is \p elastic_capacity, \p nMaxThreadCount is not used for sizing retired arrays.
+                Instead, each thread resizes its retired array after \p scan() to <tt>2 * nHazardPtrCount * N</tt>,
+                where \p N is current count of attached threads; \p nMaxRetiredPtrCount is the lower bound of the capacity.
             */
             static CDS_EXPORT_API void construct(
                 size_t nHazardPtrCount = 0,     ///< Hazard pointer count per thread
                 size_t nMaxThreadCount = 0,     ///< Max count of simultaneous working thread in your application
                 size_t nMaxRetiredPtrCount = 0, ///< Capacity of the array of retired objects for the thread
-                scan_type nScanType = inplace   ///< Scan type (see \ref scan_type enum)
+                scan_type nScanType = inplace,  ///< Scan type (see \ref scan_type enum)
+                capacity_mode nCapacityMode = fixed_capacity ///< Retired array capacity policy (see \ref capacity_mode enum)
             );
 
             // for back-copatibility
@@ -511,6 +570,38 @@ namespace cds { namespace gc {
                 return scan_type_;
             }
 
+            /// Get retired array capacity policy
+            capacity_mode get_capacity_mode() const
+            {
+                return capacity_mode_;
+            }
+
+            /// Returns current count of attached threads
+            size_t get_thread_count() const noexcept
+            {
+                return thread_count_.load( atomics::memory_order_relaxed );
+            }
+
+            /// Starts background dispose thread
+            /**
+                After this call a thread whose retired array is full passes its retired pointers
+                to the background dispose thread instead of calling \p scan() itself.
+                If the dispose thread has more than \p nMaxBacklog retired pointers not yet freed,
+                the mutator thread calls \p scan() as usual (back-pressure).
+                Default \p nMaxBacklog is <tt>16 * max( get_max_retired_ptr_count(), 2 * get_hazard_ptr_count() * get_max_thread_count())</tt>.
+
+                The dispose thread is attached to \p cds::threading::Manager, so the disposers may retire other pointers.
+                The dispose thread is stopped by \p destruct().
+                The function does nothing if the dispose thread is already started.
+            */
+            CDS_EXPORT_API void start_dispose_thread( size_t nMaxBacklog = 0 );
+
+            /// Checks if the background dispose thread is started
+            bool has_dispose_thread() const noexcept
+            {
+                return reclaimer_.load( atomics::memory_order_relaxed ) != nullptr;
+            }
+
             /// Checks that required hazard pointer count \p nRequiredCount is less or equal then max hazard pointer count
             /**
                 If <tt> nRequiredCount > get_hazard_ptr_count()</tt> then the exception \p not_enought_hazard_ptr is thrown
@@ -535,6 +626,9 @@ namespace cds { namespace gc {
             /// Get internal statistics
             CDS_EXPORT_API void statistics( stat& st );
 
+            /// Get reclamation telemetry
+            CDS_EXPORT_API void telemetry( cds::gc::telemetry::snapshot& st );
+
         public: // for internal use only
             /// The main garbage collecting function
             /**
@@ -544,12 +638,51 @@ namespace cds { namespace gc {
                 There are the following scan algorithm:
                 - \ref hzp_gc_classic_scan "classic_scan" allocates memory for internal use
                 - \ref hzp_gc_inplace_scan "inplace_scan" does not allocate any memory
+                - \ref hzp_gc_vectorized_scan "vectorized_scan" filters retired pointers against
+                  a hazard pointer snapshot using SIMD compare kernel
 
                 Use \p set_scan_type() member function to setup appropriate scan algorithm.
             */
             void scan( thread_data* pRec )
             {
+                size_t const nRetired = pRec->retired_.size();
+                auto const tStart = telemetry_.reclaim_start();
+
                 ( this->*scan_func_ )( pRec );
+
+                // The scan that cannot free at least a half of retired pointers is blocked by some guard
+                size_t const nKept = pRec->retired_.size();
+                bool const bBlocked = nKept > 0 && nKept * 2 >= nRetired;
+                pRec->telemetry_.free( nRetired - nKept );
+                if ( bBlocked )
+                    find_blocking_thread( pRec );
+                telemetry_.reclaim_end( tStart, bBlocked );
+
+                if ( capacity_mode_ == elastic_capacity )
+                    resize_retired( pRec );
+            }
+
+            /// Samples retired pointer \p p of size \p nSize for telemetry
+            static void sample( retired_ptr& p, size_t nSize )
+            {
+                if ( cds::gc::telemetry::details::is_sampled( p.m_p )) {
+                    cds::gc::telemetry::details::collector& c = instance().telemetry_;
+                    c.sample_size( nSize );
+                    c.sample< telemetry_locator >( p.m_p, p.m_funcFree );
+                }
+            }
+
+            /// Called when the retired array of \p pRec is full
+            /**
+                Passes retired pointers to the dispose thread if it is started,
+                otherwise calls \p scan()
+            */
+            void flush_retired( thread_data* pRec )
+            {
+                if ( has_dispose_thread())
+                    offload( pRec );
+                else
+                    scan( pRec );
             }
 
             /// Helper scan routine
@@ -568,7 +701,8 @@ namespace cds { namespace gc {
                 size_t nHazardPtrCount,     ///< Hazard pointer count per thread
                 size_t nMaxThreadCount,     ///< Max count of simultaneous working thread in your application
                 size_t nMaxRetiredPtrCount, ///< Capacity of the array of retired objects for the thread
-                scan_type nScanType         ///< Scan type (see \ref scan_type enum)
+                scan_type nScanType,        ///< Scan type (see \ref scan_type enum)
+                capacity_mode nCapacityMode ///< Retired array capacity policy (see \ref capacity_mode enum)
             );
 
             CDS_EXPORT_API ~smr();
@@ -608,8 +742,42 @@ namespace cds { namespace gc {
             */
             CDS_EXPORT_API void inplace_scan( thread_data* pRec );
 
+            /// Vectorized scan algorithm
+            /** @anchor hzp_gc_vectorized_scan
+                The first stage copies all non-null hazard pointers into per-thread cache-aligned snapshot.
+                The snapshot buffer is owned by the thread record and reused between calls,
+                so in the steady state the algorithm does not allocate any memory.
+
+                The second stage filters the retired pointers against the snapshot.
+                If the snapshot is small (up to \p c_nVectorizedScanLinearLimit pointers) each retired pointer
+                is compared with the whole snapshot by SIMD compare kernel selected at run-time
+                (AVX2 or SSE2 on x86-64, plain loop on other platforms).
+                For large snapshot (many threads) the algorithm builds an open-addressing hash set
+                of hazard pointers and looks up each retired pointer in it.
+
+                The kernel selected is counted in \p stat::simd_scan_count and \p stat::hash_scan_count.
+            */
+            CDS_EXPORT_API void vectorized_scan( thread_data* pRec );
+
+            /// Adjusts retired array capacity of \p pRec to current thread count (\p elastic_capacity mode only)
+            CDS_EXPORT_API void resize_retired( thread_data* pRec );
+
+            /// Passes retired pointers of \p pRec to the dispose thread; calls \p scan() on back-pressure
+            CDS_EXPORT_API void offload( thread_data* pRec );
+
+            /// Sets the owner of the guard protecting the first retired pointer of \p pRec as the blocking thread of telemetry
+            CDS_EXPORT_API void find_blocking_thread( thread_data* pRec );
+
+            struct telemetry_locator {
+                static cds::gc::telemetry::details::collector& get()
+                {
+                    return instance().telemetry_;
+                }
+            };
+
         private:
             CDS_EXPORT_API thread_record* create_thread_data();
+            size_t calc_elastic_retired_size( size_t nSize ) const;
             static CDS_EXPORT_API void destroy_thread_data( thread_record* pRec );
 
             /// Allocates Hazard Pointer SMR thread private data
@@ -627,7 +795,11 @@ namespace cds { namespace gc {
             size_t const    max_thread_count_;      ///< max count of thread
             size_t const    max_retired_ptr_count_; ///< max count of retired ptr per thread
             scan_type const scan_type_;             ///< scan type (see \ref scan_type enum)
+            capacity_mode const capacity_mode_;     ///< retired array capacity policy (see \ref capacity_mode enum)
+            atomics::atomic<size_t> thread_count_;  ///< count of attached threads
+            atomics::atomic<reclaimer*> reclaimer_; ///< background dispose thread, \p nullptr if not started
             void ( smr::*scan_func_ )( thread_data* pRec );
+            cds::gc::telemetry::details::collector telemetry_; ///< reclamation telemetry
         };
         //@endcond
 
@@ -674,6 +846,9 @@ namespace cds { namespace gc {
         /// Internal statistics
         typedef hp::stat stat;
 
+        /// Reclamation telemetry snapshot, see \p cds::gc::telemetry
+        typedef cds::gc::telemetry::snapshot telemetry_snapshot;
+
         /// Hazard Pointer guard
         /**
             A guard is a hazard pointer.
@@ -1287,8 +1462,15 @@ namespace cds { namespace gc {
     public:
         /// \p scan() type
         enum class scan_type {
-            classic = hp::classic,    ///< classic scan as described in Michael's papers
-            inplace = hp::inplace     ///< inplace scan without allocation
+            classic = hp::classic,      ///< classic scan as described in Michael's papers
+            inplace = hp::inplace,      ///< inplace scan without allocation
+            vectorized = hp::vectorized ///< SIMD scan against cache-aligned hazard pointer snapshot
+        };
+
+        /// Retired array capacity policy
+        enum class capacity_mode {
+            fixed = hp::fixed_capacity,     ///< capacity is computed once from max thread count
+            elastic = hp::elastic_capacity  ///< capacity follows current count of attached threads
         };
 
         /// Initializes %HP singleton
@@ -1303,19 +1485,26 @@ namespace cds { namespace gc {
             - \p nMaxThreadCount - max count of thread with using Hazard Pointer GC in your application. Default is 100.
             - \p nMaxRetiredPtrCount - capacity of array of retired pointers for each thread. Must be greater than
                 <tt> nHazardPtrCount * nMaxThreadCount </tt>. Default is <tt>2 * nHazardPtrCount * nMaxThreadCount </tt>.
+
+            With \p capacity_mode::elastic the retired array of each thread is resized on \p scan()
+            to <tt>2 * nHazardPtrCount * N</tt> where \p N is current count of attached threads,
+            so \p nMaxThreadCount is not an upper bound and \p nMaxRetiredPtrCount is the lower bound of the capacity.
+            The thread records are reused preferably by threads running on the same NUMA node.
         */
         HP(
             size_t nHazardPtrCount = 0,     ///< Hazard pointer count per thread
             size_t nMaxThreadCount = 0,     ///< Max count of simultaneous working thread in your application
             size_t nMaxRetiredPtrCount = 0, ///< Capacity of the array of retired objects for the thread
-            scan_type nScanType = scan_type::inplace   ///< Scan type (see \p scan_type enum)
+            scan_type nScanType = scan_type::inplace,   ///< Scan type (see \p scan_type enum)
+            capacity_mode nCapacityMode = capacity_mode::fixed ///< Retired array capacity policy (see \p capacity_mode enum)
         )
         {
             hp::smr::construct(
                 nHazardPtrCount,
                 nMaxThreadCount,
                 nMaxRetiredPtrCount,
-                static_cast<hp::scan_type>(nScanType)
+                static_cast<hp::scan_type>(nScanType),
+                static_cast<hp::capacity_mode>(nCapacityMode)
             );
         }
 
@@ -1369,11 +1558,36 @@ namespace cds { namespace gc {
         }
 
         /// Returns capacity of retired pointer array
+        /**
+            For \p capacity_mode::elastic the function returns the lower bound of the capacity
+        */
         static size_t retired_array_capacity()
         {
             return hp::smr::instance().get_max_retired_ptr_count();
         }
 
+        /// Returns current count of threads attached to %HP
+        static size_t thread_count()
+        {
+            return hp::smr::instance().get_thread_count();
+        }
+
+        /// Starts background dispose thread (opt-in)
+        /**
+            By default a thread whose retired array is full calls \p scan() itself, that may take
+            a long time if the thread count is large. After calling this function such thread just passes
+            its retired pointers to the background dispose thread and continues.
+            The thread falls back to \p scan() only if the dispose thread has more than \p nMaxBacklog
+            retired pointers not yet freed. Default \p nMaxBacklog is <tt>16 * retired_array_capacity()</tt>
+            (for \p capacity_mode::elastic - 16 times the capacity needed for \p max_thread_count() threads).
+
+            The dispose thread is stopped in \p %HP destructor.
+        */
+        static void start_dispose_thread( size_t nMaxBacklog = 0 )
+        {
+            hp::smr::instance().start_dispose_thread( nMaxBacklog );
+        }
+
         /// Retire pointer \p p with function \p func
         /**
             The function places pointer \p p to array of pointers ready for removing.
@@ -1384,8 +1598,11 @@ namespace cds { namespace gc {
         static void retire( T * p, void( *func )( void * ))
         {
             hp::thread_data* rec = hp::smr::tls();
-            if ( !rec->retired_.push( hp::retired_ptr( p, func )))
-                hp::smr::instance().scan( rec );
+            hp::retired_ptr rp( p, func );
+            hp::smr::sample( rp, cds::gc::telemetry::details::object_size<T>::value );
+            rec->telemetry_.retire();
+            if ( !rec->retired_.push( std::move( rp )))
+                hp::smr::instance().flush_retired( rec );
         }
 
         /// Retire pointer \p p with functor of type \p Disposer
@@ -1440,8 +1657,7 @@ namespace cds { namespace gc {
         template <class Disposer, typename T>
         static void retire( T * p )
         {
-            if ( !hp::smr::tls()->retired_.push( hp::retired_ptr( p, cds::details::static_functor<Disposer, T>::call )))
-                scan();
+            retire( p, cds::details::static_functor<Disposer, T>::call );
         }
 
         /// Get current scan strategy
@@ -1527,6 +1743,16 @@ namespace cds { namespace gc {
             \endcode
         */
         CDS_EXPORT_API static stat const& postmortem_statistics();
+
+        /// Returns reclamation telemetry
+        /**
+            Unlike \p statistics(), the telemetry is gathered always and may be read at any time from any thread.
+            See \p cds::gc::telemetry for details.
+        */
+        static void telemetry( telemetry_snapshot& st )
+        {
+            hp::smr::instance().telemetry( st );
+        }
     };
 
 }} // namespace cds::gc
@@ -35,6 +35,7 @@
 #include <type_traits>
 #include <mutex>
 #include <functional>   // ref
+#include <cstring>      // memcpy
 #include <cds/intrusive/details/base.h>
 #include <cds/opt/compare.h>
 #include <cds/opt/hash.h>
@@ -95,6 +96,36 @@ namespace cds { namespace intrusive {
             //@endcond
         };
 
+        /// Option specifying the depth of breadth-first cuckoo path search
+        /**
+            By default, when all candidate buckets of a new item are full, \p CuckooSet resizes the table.
+            If \p Depth is not zero, the set first searches the cuckoo graph breadth-first
+            for the shortest chain of at most \p Depth displacements that ends in a bucket having a free slot,
+            and moves the items along that chain. The table is resized only if no such chain exists.
+            In this mode an item is inserted into any non-full bucket without relocating,
+            so the buckets are filled up to the probe set size.
+
+            The search is most effective with bucketized probe set <tt>cuckoo::vector<Capacity></tt>:
+            with 4-way buckets (<tt>cuckoo::vector<4></tt>) and \p Depth 4..5 the table runs
+            at 90-95% occupancy without resizing. The search locks the buckets it visits one by one,
+            and each item is moved under the locks of its buckets after checking that it is still in place;
+            if the path has been changed by another thread the table is resized.
+            The search visits up to <tt>Arity * (Capacity * (Arity - 1))^Depth</tt> buckets,
+            so large depths increase the cost of inserting into a nearly full table.
+
+            Default is 0 - no path search.
+        */
+        template <unsigned int Depth>
+        struct bfs_depth
+        {
+            //@cond
+            template <typename Base>
+            struct pack: public Base {
+                static unsigned int const bfs_depth = Depth;
+            };
+            //@endcond
+        };
+
 
         //@cond
         // Probeset type placeholders
@@ -399,6 +430,8 @@ namespace cds { namespace intrusive {
             typedef striping_stat       real_stat;
             typedef empty_striping_stat empty_stat;
 
+            static bool const c_bOptimisticRead = false;
+
             template <typename Stat2>
             struct rebind_statistics {
                 typedef striping<lock_type, c_nArity, allocator_type, Stat2> other;
@@ -651,6 +684,8 @@ namespace cds { namespace intrusive {
             typedef refinable_stat          real_stat;
             typedef empty_refinable_stat    empty_stat;
 
+            static bool const c_bOptimisticRead = false;
+
             template <typename Stat2>
             struct rebind_statistics {
                 typedef refinable< lock_type, c_nArity, back_off, allocator_type, Stat2>    other;
@@ -984,6 +1019,429 @@ namespace cds { namespace intrusive {
             }
         };
 
+        /// Internal statistics for \ref optimistic mutex policy
+        struct optimistic_stat: public striping_stat
+        {
+            counter_type   m_nReadCount         ;  ///< Count of successful optimistic (lock-free) lookups
+            counter_type   m_nReadRetryCount    ;  ///< Count of optimistic lookup retries caused by concurrent bucket modification
+            counter_type   m_nReadFallbackCount ;  ///< Count of lookups that gave up optimistic reading and have locked the buckets
+            counter_type   m_nSynchronizeCount  ;  ///< Count of \p synchronize() calls
+
+            //@cond
+            void    onOptimisticRead()          { ++m_nReadCount; }
+            void    onOptimisticReadRetry()     { ++m_nReadRetryCount; }
+            void    onOptimisticReadFallback()  { ++m_nReadFallbackCount; }
+            void    onSynchronize()             { ++m_nSynchronizeCount; }
+            //@endcond
+        };
+
+        /// Dummy internal statistics for \ref optimistic mutex policy
+        struct empty_optimistic_stat: public empty_striping_stat
+        {
+            //@cond
+            void    onOptimisticRead()          const {}
+            void    onOptimisticReadRetry()     const {}
+            void    onOptimisticReadFallback()  const {}
+            void    onSynchronize()             const {}
+            //@endcond
+        };
+
+        /// Optimistic concurrent access policy
+        /**
+            This is one of available \p opt::mutex_policy option type for \p CuckooSet
+
+            The policy is a lock striping (see \p cuckoo::striping) where each lock of the lock array
+            carries a version counter, like in MemC3 and libcuckoo optimistic cuckoo hashing.
+            The version is odd while the lock is held and it is incremented on each lock/unlock,
+            so any modification of a bucket changes the version of its lock.
+
+            Only the modifying operations (insert, erase, relocation and resizing) acquire the locks.
+            The lookups (\p find(), \p contains() and so on) never lock: the lookup reads the versions
+            of the bucket locks, searches the buckets and then checks that the versions are unchanged.
+            If a concurrent writer has changed a bucket the lookup is retried;
+            after \p c_nReadRetryLimit failed attempts the lookup locks the buckets.
+            Thus, read-mostly workloads scale like an uncontended hash table.
+
+            The lookups in progress are counted by the policy in two generations of per-thread striped counters,
+            like in the general-purpose user-space RCU. \p synchronize() switches the generation
+            and waits until the lookups of the previous generation are finished.
+            The resizing calls it before freeing the old bucket tables, so the tables are freed immediately.
+
+            Since the lookups read the buckets without locks, \p CuckooSet with this policy has
+            the following requirements:
+            - an item unlinked from the set (by \p erase() or \p unlink()) may still be read
+                by concurrent lookups. The item must not be freed while the lookups started before
+                its unlinking are running: call \p CuckooSet::synchronize() before freeing the item,
+                use other deferred reclamation for the items (for example, \p cds::urcu)
+                or free the items when the set is quiescent.
+                \p clear() waits for the lookups in progress itself.
+                \p container::CuckooSet and \p container::CuckooMap call \p synchronize() before freeing the erased node,
+                so the erasing waits for the lookups in progress.
+            - the functor passed to \p find() is called without any lock, so it has the same semantics
+                as in the lock-free containers of the library: the item cannot be freed while the functor is executed
+                but it may be changed or unlinked by other threads.
+                The functor must not erase items from the set or resize it since these operations wait for the lookups in progress.
+
+            Template arguments:
+            - \p Arity - unsigned int constant that specifies an arity. The arity is the count of hash functors, i.e., the
+                count of lock arrays. Default value is 2.
+            - \p BackOff - back-off strategy for spinning on the locks. Default is \p cds::backoff::Default
+            - \p Alloc - allocator type used for lock array memory allocation. Default is \p CDS_DEFAULT_ALLOCATOR.
+            - \p Stat - internal statistics type. Note that this template argument is automatically selected by \ref CuckooSet
+                class according to its \p opt::stat option.
+        */
+        template <
+            unsigned int Arity = 2,
+            typename BackOff = cds::backoff::Default,
+            class Alloc = CDS_DEFAULT_ALLOCATOR,
+            class Stat = empty_optimistic_stat
+        >
+        class optimistic
+        {
+        public:
+            typedef BackOff         back_off        ;   ///< back-off strategy
+            typedef Alloc           allocator_type  ;   ///< allocator type
+            static unsigned int const c_nArity = Arity ;    ///< the arity
+            typedef Stat            statistics_type ;   ///< Internal statistics type (\ref optimistic_stat or \ref empty_optimistic_stat)
+
+            static unsigned int const c_nReadRetryLimit = 16;  ///< Max count of optimistic lookup attempts before locking
+            static unsigned int const c_nReaderStripeCount = 16;    ///< Count of lookup counters in each generation
+
+            /// Versioned recursive spin-lock
+            /**
+                The version is odd while the lock is held by a thread.
+            */
+            class lock_type
+            {
+                atomics::atomic<size_t>         m_nVersion;     ///< lock version; odd - the lock is held
+                atomics::atomic<OS::ThreadId>   m_OwnerId;      ///< Owner thread id
+                unsigned int                    m_nLockCount;   ///< Recursion depth
+
+            public:
+                /// Creates unlocked lock with zero version
+                lock_type()
+                    : m_nVersion( 0 )
+                    , m_OwnerId( OS::c_NullThreadId )
+                    , m_nLockCount( 0 )
+                {}
+
+                /// Tries to acquire the lock
+                bool try_lock()
+                {
+                    OS::ThreadId tid = OS::get_current_thread_id();
+                    // Only the owner itself can see its id here
+                    if ( m_OwnerId.load( atomics::memory_order_relaxed ) == tid ) {
+                        ++m_nLockCount;
+                        return true;
+                    }
+
+                    size_t nVersion = m_nVersion.load( atomics::memory_order_relaxed );
+                    if ( ( nVersion & 1 ) == 0
+                        && m_nVersion.compare_exchange_strong( nVersion, nVersion + 1, atomics::memory_order_acquire, atomics::memory_order_relaxed ))
+                    {
+                        // the odd version must be visible before any change of the buckets protected
+                        atomics::atomic_thread_fence( atomics::memory_order_release );
+                        m_OwnerId.store( tid, atomics::memory_order_relaxed );
+                        m_nLockCount = 1;
+                        return true;
+                    }
+                    return false;
+                }
+
+                /// Acquires the lock
+                void lock()
+                {
+                    back_off bkoff;
+                    while ( !try_lock()) {
+                        while ( m_nVersion.load( atomics::memory_order_relaxed ) & 1 )
+                            bkoff();
+                    }
+                }
+
+                /// Releases the lock
+                void unlock()
+                {
+                    assert( m_OwnerId.load( atomics::memory_order_relaxed ) == OS::get_current_thread_id());
+                    assert( m_nLockCount > 0 );
+                    if ( --m_nLockCount == 0 ) {
+                        m_OwnerId.store( OS::c_NullThreadId, atomics::memory_order_relaxed );
+                        m_nVersion.fetch_add( 1, atomics::memory_order_release );
+                    }
+                }
+
+                /// Returns current version of the lock
+                size_t version( atomics::memory_order order ) const
+                {
+                    return m_nVersion.load( order );
+                }
+            };
+
+            //@cond
+            typedef optimistic_stat         real_stat;
+            typedef empty_optimistic_stat   empty_stat;
+
+            static bool const c_bOptimisticRead = true;
+
+            template <typename Stat2>
+            struct rebind_statistics {
+                typedef optimistic<c_nArity, back_off, allocator_type, Stat2> other;
+            };
+            //@endcond
+
+            typedef cds::sync::lock_array< lock_type, cds::sync::pow2_select_policy, allocator_type >    lock_array_type ;   ///< lock array type
+
+        protected:
+            //@cond
+            class lock_array: public lock_array_type
+            {
+            public:
+                // placeholder ctor
+                lock_array(): lock_array_type( typename lock_array_type::select_cell_policy(2)) {}
+
+                // real ctor
+                lock_array( size_t nCapacity ): lock_array_type( nCapacity, typename lock_array_type::select_cell_policy(nCapacity)) {}
+
+                lock_type const& cell( size_t nHash ) const
+                {
+                    return lock_array_type::at( lock_array_type::m_SelectCellPolicy( nHash, lock_array_type::size()));
+                }
+            };
+            //@endcond
+
+            // Counter of the lookups in progress
+            struct reader_counter {
+                atomics::atomic<size_t> nCount;
+                char pad_[cds::c_nCacheLineSize - sizeof( atomics::atomic<size_t> )];
+
+                reader_counter()
+                    : nCount( 0 )
+                {}
+            };
+            //@endcond
+
+        protected:
+            //@cond
+            lock_array      m_Locks[c_nArity] ;   ///< array of \p lock_array_type
+            statistics_type m_Stat              ; ///< internal statistics
+
+            reader_counter          m_Readers[2][c_nReaderStripeCount]; ///< lookups in progress, two generations
+            atomics::atomic<size_t> m_nReaderEpoch;     ///< current generation of the lookups
+            std::mutex              m_SyncLock;         ///< serializes \p synchronize() calls
+            //@endcond
+
+            //@cond
+            static size_t reader_stripe()
+            {
+                static atomics::atomic<size_t> s_nNextStripe( 0 );
+                static thread_local size_t const s_nStripe = s_nNextStripe.fetch_add( 1, atomics::memory_order_relaxed ) % c_nReaderStripeCount;
+                return s_nStripe;
+            }
+            //@endcond
+
+        public:
+            //@cond
+            class scoped_cell_lock {
+                lock_type * m_guard[c_nArity];
+
+            public:
+                scoped_cell_lock( optimistic& policy, size_t const* arrHash )
+                {
+                    for ( unsigned int i = 0; i < c_nArity; ++i ) {
+                        m_guard[i] = &( policy.m_Locks[i].at( policy.m_Locks[i].lock( arrHash[i] )));
+                    }
+                    policy.m_Stat.onCellLock();
+                }
+
+                ~scoped_cell_lock()
+                {
+                    for ( unsigned int i = 0; i < c_nArity; ++i )
+                        m_guard[i]->unlock();
+                }
+            };
+
+            class scoped_cell_trylock
+            {
+                lock_type * m_guard[c_nArity];
+                bool        m_bLocked;
+
+            public:
+                scoped_cell_trylock( optimistic& policy, size_t const* arrHash )
+                {
+                    size_t nCell = policy.m_Locks[0].try_lock( arrHash[0] );
+                    m_bLocked = nCell != lock_array_type::c_nUnspecifiedCell;
+                    if ( m_bLocked ) {
+                        m_guard[0] = &(policy.m_Locks[0].at(nCell));
+                        for ( unsigned int i = 1; i < c_nArity; ++i ) {
+                            m_guard[i] = &( policy.m_Locks[i].at( policy.m_Locks[i].lock( arrHash[i] )));
+                        }
+                    }
+                    else {
+                        std::fill( m_guard, m_guard + c_nArity, nullptr );
+                    }
+                    policy.m_Stat.onCellTryLock();
+                }
+                ~scoped_cell_trylock()
+                {
+                    if ( m_bLocked ) {
+                        for ( unsigned int i = 0; i < c_nArity; ++i )
+                            m_guard[i]->unlock();
+                    }
+                }
+
+                bool locked() const
+                {
+                    return m_bLocked;
+                }
+            };
+
+            // Locking entire lock array #0 changes the version of each lock in it,
+            // so full lock invalidates all optimistic lookups in progress
+            class scoped_full_lock {
+                std::unique_lock< lock_array_type >   m_guard;
+            public:
+                scoped_full_lock( optimistic& policy )
+                    : m_guard( policy.m_Locks[0] )
+                {
+                    policy.m_Stat.onFullLock();
+                }
+
+                /// Ctor for scoped_resize_lock - no statistics is incremented
+                scoped_full_lock( optimistic& policy, bool )
+                    : m_guard( policy.m_Locks[0] )
+                {}
+            };
+
+            class scoped_resize_lock: public scoped_full_lock {
+            public:
+                scoped_resize_lock( optimistic& policy )
+                    : scoped_full_lock( policy, false )
+                {
+                    policy.m_Stat.onResizeLock();
+                }
+            };
+
+            // The lookup in progress, see synchronize()
+            class scoped_reader {
+                atomics::atomic<size_t>& m_nCount;
+            public:
+                explicit scoped_reader( optimistic& policy )
+                    : m_nCount( policy.read_enter())
+                {}
+
+                ~scoped_reader()
+                {
+                    read_leave( m_nCount );
+                }
+            };
+            //@endcond
+
+        public:
+            /// Constructor
+            optimistic(
+                size_t nLockCount          ///< The size of lock array. Must be power of two.
+            )
+                : m_nReaderEpoch( 0 )
+            {
+                // Trick: initialize the array of locks
+                for ( unsigned int i = 0; i < c_nArity; ++i ) {
+                    lock_array * pArr = m_Locks + i;
+                    pArr->lock_array::~lock_array();
+                    new ( pArr ) lock_array( nLockCount );
+                }
+            }
+
+            /// Returns lock array size
+            /**
+                Lock array size is unchanged during \p optimistic object lifetime
+            */
+            size_t lock_count() const
+            {
+                return m_Locks[0].size();
+            }
+
+            //@cond
+            void resize( size_t )
+            {
+                m_Stat.onResize();
+            }
+
+            // Enters the lookup; returns the counter to be passed to read_leave().
+            // The bucket tables cannot be freed until read_leave() is called
+            atomics::atomic<size_t>& read_enter()
+            {
+                // acquire: the lookup that sees new generation sees the changes made before synchronize()
+                atomics::atomic<size_t>& nCount = m_Readers[m_nReaderEpoch.load( atomics::memory_order_acquire ) & 1][reader_stripe()].nCount;
+                nCount.fetch_add( 1, atomics::memory_order_seq_cst );
+                return nCount;
+            }
+
+            static void read_leave( atomics::atomic<size_t>& nCount )
+            {
+                nCount.fetch_sub( 1, atomics::memory_order_release );
+            }
+
+            // Starts optimistic read of the buckets specified by arrHash.
+            // Returns false if a bucket is being modified now
+            bool read_begin( size_t const* arrHash, size_t * arrVersion ) const
+            {
+                for ( unsigned int i = 0; i < c_nArity; ++i ) {
+                    // seq_cst: the lookup not seen by synchronize() sees the lock versions changed before synchronize()
+                    arrVersion[i] = m_Locks[i].cell( arrHash[i] ).version( atomics::memory_order_seq_cst );
+                    if ( arrVersion[i] & 1 )
+                        return false;
+                }
+                return true;
+            }
+
+            // Checks that the buckets have not been changed since read_begin()
+            bool read_validate( size_t const* arrHash, size_t const* arrVersion ) const
+            {
+                atomics::atomic_thread_fence( atomics::memory_order_acquire );
+                for ( unsigned int i = 0; i < c_nArity; ++i ) {
+                    if ( m_Locks[i].cell( arrHash[i] ).version( atomics::memory_order_relaxed ) != arrVersion[i] )
+                        return false;
+                }
+                return true;
+            }
+
+            /// Waits until all lookups started before the call are finished
+            /**
+                After the function returns no lookup can access the data unlinked from the set before the call.
+                The function must not be called from the functor of \p find().
+            */
+            void synchronize()
+            {
+                std::unique_lock< std::mutex > sl( m_SyncLock );
+
+                size_t const nEpoch = m_nReaderEpoch.fetch_add( 1, atomics::memory_order_acq_rel );
+                atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+
+                back_off bkoff;
+                for ( reader_counter& r : m_Readers[nEpoch & 1] ) {
+                    while ( r.nCount.load( atomics::memory_order_acquire ) != 0 )
+                        bkoff();
+                }
+                m_Stat.onSynchronize();
+            }
+
+            void onOptimisticRead()         { m_Stat.onOptimisticRead(); }
+            void onOptimisticReadRetry()    { m_Stat.onOptimisticReadRetry(); }
+            void onOptimisticReadFallback() { m_Stat.onOptimisticReadFallback(); }
+            //@endcond
+
+            /// Returns the arity of \p optimistic mutex policy
+            constexpr unsigned int arity() const noexcept
+            {
+                return c_nArity;
+            }
+
+            /// Returns internal statistics
+            statistics_type const& statistics() const
+            {
+                return m_Stat;
+            }
+        };
+
         /// \p CuckooSet internal statistics
         struct stat {
             typedef cds::atomicity::event_counter   counter_type ;  ///< Counter type
@@ -1027,6 +1485,10 @@ namespace cds { namespace intrusive {
             counter_type    m_nFindWithSuccess         ;   ///< Count of success \p find_with() function call
             counter_type    m_nFindWithFailed          ;   ///< Count of failed \p find_with() function call
 
+            counter_type    m_nPathSearchCount      ;   ///< Count of breadth-first cuckoo path searches
+            counter_type    m_nPathFailedCount      ;   ///< Count of path searches that have not found a free slot
+            counter_type    m_nPathMoveCount        ;   ///< Count of items moved along the cuckoo paths found
+
             //@cond
             void    onRelocateCall()        { ++m_nRelocateCallCount; }
             void    onRelocateRound()       { ++m_nRelocateRoundCount; }
@@ -1063,6 +1525,10 @@ namespace cds { namespace intrusive {
 
             void    onFindWithSuccess()     { ++m_nFindWithSuccess; }
             void    onFindWithFailed()      { ++m_nFindWithFailed; }
+
+            void    onPathSearch()          { ++m_nPathSearchCount; }
+            void    onPathFailed()          { ++m_nPathFailedCount; }
+            void    onPathMove()            { ++m_nPathMoveCount; }
             //@endcond
         };
 
@@ -1104,6 +1570,10 @@ namespace cds { namespace intrusive {
 
             void    onFindWithSuccess()     const {}
             void    onFindWithFailed()      const {}
+
+            void    onPathSearch()          const {}
+            void    onPathFailed()          const {}
+            void    onPathMove()            const {}
             //@endcond
         };
 
@@ -1140,6 +1610,8 @@ namespace cds { namespace intrusive {
                 Available opt::mutex_policy types:
                 - \p cuckoo::striping - simple, but the lock array is not resizable
                 - \p cuckoo::refinable - resizable lock array, but more complex access to set data.
+                - \p cuckoo::optimistic - lock striping with versioned locks; the lookups do not lock the buckets.
+                    See the requirements for the items in \p cuckoo::optimistic description.
 
                 Default is \p cuckoo::striping.
             */
@@ -1187,6 +1659,9 @@ namespace cds { namespace intrusive {
 
             /// Internal statistics. Available statistics: \p cuckoo::stat, \p cuckoo::empty_stat
             typedef empty_stat                  stat;
+
+            /// Depth of breadth-first cuckoo path search, see \p cuckoo::bfs_depth. Default is 0 - no path search
+            static unsigned int const bfs_depth = 0;
         };
 
         /// Metafunction converting option list to \p CuckooSet traits
@@ -1200,7 +1675,7 @@ namespace cds { namespace intrusive {
                 The hash functors are passed as <tt> std::tuple< H1, H2, ... Hn > </tt>. The number of hash functors specifies
                 the number \p k - the count of hash tables in cuckoo hashing.
             - \p opt::mutex_policy - concurrent access policy.
-                Available policies: \p cuckoo::striping, \p cuckoo::refinable.
+                Available policies: \p cuckoo::striping, \p cuckoo::refinable, \p cuckoo::optimistic.
                 Default is \p %cuckoo::striping.
             - \p opt::equal_to - key equality functor like \p std::equal_to.
                 If this functor is defined then the probe-set will be unordered.
@@ -1219,6 +1694,8 @@ namespace cds { namespace intrusive {
                 freeing nodes. Default is \p intrusive::opt::v::empty_disposer
             - \p opt::stat - internal statistics. Possibly types: \p cuckoo::stat, \p cuckoo::empty_stat.
                 Default is \p %cuckoo::empty_stat
+            - \p cuckoo::bfs_depth - the depth of breadth-first cuckoo path search used instead of resizing
+                when the buckets of a new item are full. Default is 0 - no path search.
 
             The probe set traits \p cuckoo::probeset_type and \p cuckoo::store_hash are taken from \p node type
             specified by \p opt::hook option.
@@ -1322,7 +1799,7 @@ namespace cds { namespace intrusive {
                     return iterator();
                 }
 
-                void insert_after( iterator it, node_type * p )
+                void insert_after( iterator it, node_type * p, size_t /*nHash*/ )
                 {
                     node_type * pPrev = it.pNode;
                     if ( pPrev ) {
@@ -1383,6 +1860,11 @@ namespace cds { namespace intrusive {
                 {
                     return nSize;
                 }
+
+                bool tag_equal( iterator /*it*/, size_t /*nHash*/ ) const
+                {
+                    return true;
+                }
             };
 
             template <typename Node, unsigned int Capacity>
@@ -1397,20 +1879,32 @@ namespace cds { namespace intrusive {
 
             protected:
                 node_type *     m_arrNode[c_nCapacity];
+                uint8_t         m_arrTag[c_nCapacity];  // one-byte fingerprints of the items' hash values
                 unsigned int    m_nSize;
 
                 void shift_up( unsigned int nFrom )
                 {
                     assert( m_nSize < c_nCapacity );
 
-                    if ( nFrom < m_nSize )
+                    if ( nFrom < m_nSize ) {
                         std::copy_backward( m_arrNode + nFrom, m_arrNode + m_nSize, m_arrNode + m_nSize + 1 );
+                        std::copy_backward( m_arrTag + nFrom, m_arrTag + m_nSize, m_arrTag + m_nSize + 1 );
+                    }
                 }
 
                 void shift_down( node_type ** pFrom )
                 {
                     assert( m_arrNode <= pFrom && pFrom < m_arrNode + m_nSize);
                     std::copy( pFrom + 1, m_arrNode + m_nSize, pFrom );
+
+                    uint8_t * pTag = m_arrTag + ( pFrom - m_arrNode );
+                    std::copy( pTag + 1, m_arrTag + m_nSize, pTag );
+                }
+
+                static uint8_t fingerprint( size_t nHash )
+                {
+                    // The low bits of the hash are used as the bucket index, so take the high byte of the mixed hash
+                    return static_cast<uint8_t>(( static_cast<uint64_t>( nHash ) * 0x9E3779B97F4A7C15ULL ) >> 56 );
                 }
             public:
                 class iterator
@@ -1469,6 +1963,7 @@ namespace cds { namespace intrusive {
                     : m_nSize(0)
                 {
                     memset( m_arrNode, 0, sizeof(m_arrNode));
+                    memset( m_arrTag, 0, sizeof(m_arrTag));
                     static_assert(( std::is_same<typename node_type::probeset_type, probeset_type>::value ), "Incompatible node type" );
                 }
 
@@ -1481,19 +1976,15 @@ namespace cds { namespace intrusive {
                     return iterator(m_arrNode + size());
                 }
 
-                void insert_after( iterator it, node_type * p )
+                void insert_after( iterator it, node_type * p, size_t nHash )
                 {
                     assert( m_nSize < c_nCapacity );
                     assert( !it.pArr || (m_arrNode <= it.pArr && it.pArr <= m_arrNode + m_nSize));
 
-                    if ( it.pArr ) {
-                        shift_up( static_cast<unsigned int>(it.pArr - m_arrNode) + 1 );
-                        it.pArr[1] = p;
-                    }
-                    else {
-                        shift_up(0);
-                        m_arrNode[0] = p;
-                    }
+                    unsigned int const nPos = it.pArr ? static_cast<unsigned int>( it.pArr - m_arrNode ) + 1 : 0;
+                    shift_up( nPos );
+                    m_arrNode[nPos] = p;
+                    m_arrTag[nPos] = fingerprint( nHash );
                     ++m_nSize;
                 }
 
@@ -1522,6 +2013,14 @@ namespace cds { namespace intrusive {
                 {
                     return m_nSize;
                 }
+
+                // Compares the fingerprint of the slot with the fingerprint of nHash
+                // without access to the item
+                bool tag_equal( iterator it, size_t nHash ) const
+                {
+                    assert( m_arrNode <= it.pArr && it.pArr < m_arrNode + c_nCapacity );
+                    return m_arrTag[ it.pArr - m_arrNode ] == fingerprint( nHash );
+                }
             };
 
             template <typename Node, unsigned int ArraySize>
@@ -1575,6 +2074,25 @@ namespace cds { namespace intrusive {
                     pos.itFound = probeset.end();
                     return false;
                 }
+
+                // Search without bucket lock; no more than nLimit nodes are examined
+                template <typename BucketEntry, typename Q, typename Compare>
+                static typename BucketEntry::node_type * find_unlocked( BucketEntry& probeset, unsigned int /*nTable*/, size_t /*nHash*/, Q const& val, Compare cmp, unsigned int nLimit )
+                {
+                    typedef typename BucketEntry::iterator  bucket_iterator;
+                    typedef typename BucketEntry::node_type node_type;
+
+                    for ( bucket_iterator it = probeset.begin(), itEnd = probeset.end(); it != itEnd && nLimit; ++it, --nLimit ) {
+                        // the bucket may be changed concurrently, so null slot is possible
+                        node_type * pNode = it.operator->();
+                        if ( !pNode )
+                            break;
+                        int cmpRes = cmp( *NodeTraits::to_value_ptr( *pNode ), val );
+                        if ( cmpRes >= 0 )
+                            return cmpRes == 0 ? pNode : nullptr;
+                    }
+                    return nullptr;
+                }
             };
 
             template <typename NodeTraits>
@@ -1590,7 +2108,10 @@ namespace cds { namespace intrusive {
                     bucket_iterator itPrev;
 
                     for ( bucket_iterator it = probeset.begin(), itEnd = probeset.end(); it != itEnd; ++it ) {
-                        if ( hash_ops<node_type, node_type::hash_array_size>::equal_to( *it, nTable, nHash ) && eq( *NodeTraits::to_value_ptr(*it), val )) {
+                        if ( probeset.tag_equal( it, nHash )
+                            && hash_ops<node_type, node_type::hash_array_size>::equal_to( *it, nTable, nHash )
+                            && eq( *NodeTraits::to_value_ptr(*it), val ))
+                        {
                             pos.itFound = it;
                             pos.itPrev = itPrev;
                             return true;
@@ -1602,6 +2123,26 @@ namespace cds { namespace intrusive {
                     pos.itFound = probeset.end();
                     return false;
                 }
+
+                // Search without bucket lock; no more than nLimit nodes are examined
+                template <typename BucketEntry, typename Q, typename EqualTo>
+                static typename BucketEntry::node_type * find_unlocked( BucketEntry& probeset, unsigned int nTable, size_t nHash, Q const& val, EqualTo eq, unsigned int nLimit )
+                {
+                    typedef typename BucketEntry::iterator  bucket_iterator;
+                    typedef typename BucketEntry::node_type node_type;
+
+                    for ( bucket_iterator it = probeset.begin(), itEnd = probeset.end(); it != itEnd && nLimit; ++it, --nLimit ) {
+                        // the bucket may be changed concurrently, so null slot is possible
+                        if ( !probeset.tag_equal( it, nHash ))
+                            continue;
+                        node_type * pNode = it.operator->();
+                        if ( !pNode )
+                            break;
+                        if ( hash_ops<node_type, node_type::hash_array_size>::equal_to( *pNode, nTable, nHash ) && eq( *NodeTraits::to_value_ptr( *pNode ), val ))
+                            return pNode;
+                    }
+                    return nullptr;
+                }
             };
 
         }   // namespace details
@@ -1927,6 +2468,8 @@ namespace cds { namespace intrusive {
 
         typedef cuckoo::details::contains< node_traits, c_isSorted > contains_action;
 
+        static bool const c_bOptimisticRead = mutex_policy::c_bOptimisticRead;
+
         template <typename Predicate>
         struct predicate_wrapper {
             typedef typename std::conditional< c_isSorted, cds::opt::details::make_comparator_from_less<Predicate>, Predicate>::type   type;
@@ -1939,6 +2482,7 @@ namespace cds { namespace intrusive {
         static unsigned int const   c_nDefaultProbesetSize = 4;   ///< default probeset size
         static size_t const         c_nDefaultInitialSize = 16;   ///< default initial size
         static unsigned int const   c_nRelocateLimit = c_nArity * 2 - 1; ///< Count of attempts to relocate before giving up
+        static unsigned int const   c_nBfsDepth = traits::bfs_depth;    ///< Max length of cuckoo path, see \p cuckoo::bfs_depth
 
     protected:
         bucket_entry *      m_BucketTable[ c_nArity ] ; ///< Bucket tables
@@ -2020,9 +2564,32 @@ namespace cds { namespace intrusive {
             free_bucket_tables( m_BucketTable, m_nBucketMask.load( atomics::memory_order_relaxed ) + 1 );
         }
 
+        void retire_bucket_tables( bucket_entry ** pTable, size_t nCapacity, std::false_type )
+        {
+            free_bucket_tables( pTable, nCapacity );
+        }
+
+        void retire_bucket_tables( bucket_entry ** pTable, size_t nCapacity, std::true_type )
+        {
+            // Optimistic lookups do not lock, so a lookup may still read the old tables.
+            // The tables are freed when all lookups started before the resizing are finished
+            m_MutexPolicy.synchronize();
+            free_bucket_tables( pTable, nCapacity );
+        }
+
+        void synchronize( std::false_type )
+        {
+            // The lookups lock the buckets
+        }
+
+        void synchronize( std::true_type )
+        {
+            m_MutexPolicy.synchronize();
+        }
+
         static constexpr unsigned int const c_nUndefTable = (unsigned int) -1;
         template <typename Q, typename Predicate >
-        unsigned int contains( position * arrPos, size_t * arrHash, Q const& val, Predicate pred )
+        unsigned int contains( position * arrPos, size_t const* arrHash, Q const& val, Predicate pred )
         {
             // Buckets must be locked
 
@@ -2063,8 +2630,65 @@ namespace cds { namespace intrusive {
         bool find_( Q& val, Predicate pred, Func f )
         {
             hash_array arrHash;
-            position arrPos[ c_nArity ];
             hashing( arrHash, val );
+            return find_( arrHash, val, pred, f, std::integral_constant<bool, c_bOptimisticRead>());
+        }
+
+        template <typename Q, typename Predicate, typename Func>
+        bool find_( size_t const* arrHash, Q& val, Predicate pred, Func f, std::true_type )
+        {
+            // Optimistic lookup: read the buckets without locking and check the lock versions after
+            hash_array arrVersion;
+            bucket_entry * pTable[c_nArity];
+
+            typename mutex_policy::back_off bkoff;
+            for ( unsigned int nAttempt = 0; nAttempt < mutex_policy::c_nReadRetryLimit; ++nAttempt ) {
+                if ( nAttempt ) {
+                    m_MutexPolicy.onOptimisticReadRetry();
+                    bkoff();
+                }
+
+                // The bucket tables and the items cannot be freed while the lookup is in progress
+                typename mutex_policy::scoped_reader sr( m_MutexPolicy );
+                if ( !m_MutexPolicy.read_begin( arrHash, arrVersion ))
+                    continue;
+
+                // Snapshot of the bucket tables. The check below guarantees that no resizing
+                // has been started yet so the snapshot is consistent
+                CDS_TSAN_ANNOTATE_IGNORE_READS_BEGIN;
+                size_t const nMask = m_nBucketMask.load( atomics::memory_order_acquire );
+                memcpy( pTable, m_BucketTable, sizeof( pTable ));
+                CDS_TSAN_ANNOTATE_IGNORE_READS_END;
+                if ( !m_MutexPolicy.read_validate( arrHash, arrVersion ))
+                    continue;
+
+                node_type * pNode = nullptr;
+                CDS_TSAN_ANNOTATE_IGNORE_READS_BEGIN;
+                for ( unsigned int i = 0; i < c_nArity && !pNode; ++i )
+                    pNode = contains_action::find_unlocked( pTable[i][arrHash[i] & nMask], i, arrHash[i], val, pred, m_nProbesetSize );
+                CDS_TSAN_ANNOTATE_IGNORE_READS_END;
+
+                if ( m_MutexPolicy.read_validate( arrHash, arrVersion )) {
+                    m_MutexPolicy.onOptimisticRead();
+                    if ( pNode ) {
+                        f( *node_traits::to_value_ptr( *pNode ), val );
+                        m_Stat.onFindSuccess();
+                        return true;
+                    }
+                    m_Stat.onFindFailed();
+                    return false;
+                }
+            }
+
+            // Too many concurrent changes of the buckets
+            m_MutexPolicy.onOptimisticReadFallback();
+            return find_( arrHash, val, pred, f, std::false_type());
+        }
+
+        template <typename Q, typename Predicate, typename Func>
+        bool find_( size_t const* arrHash, Q& val, Predicate pred, Func f, std::false_type )
+        {
+            position arrPos[ c_nArity ];
             scoped_cell_lock sl( m_MutexPolicy, arrHash );
 
             unsigned int nTable = contains( arrPos, arrHash, val, pred );
@@ -2117,7 +2741,7 @@ namespace cds { namespace intrusive {
                         if ( bkt.size() < m_nProbesetThreshold ) {
                             position pos;
                             contains_action::find( bkt, pos, i, arrHash[i], *pVal, key_predicate()) ; // must return false!
-                            bkt.insert_after( pos.itPrev, node_traits::to_node_ptr( pVal ));
+                            bkt.insert_after( pos.itPrev, node_traits::to_node_ptr( pVal ), arrHash[i] );
                             m_Stat.onSuccessRelocateRound();
                             return true;
                         }
@@ -2131,7 +2755,7 @@ namespace cds { namespace intrusive {
                         if ( bkt.size() < m_nProbesetSize ) {
                             position pos;
                             contains_action::find( bkt, pos, i, arrHash[i], *pVal, key_predicate()) ; // must return false!
-                            bkt.insert_after( pos.itPrev, node_traits::to_node_ptr( pVal ));
+                            bkt.insert_after( pos.itPrev, node_traits::to_node_ptr( pVal ), arrHash[i] );
                             nTable = i;
                             memcpy( arrGoalHash, arrHash, sizeof(arrHash));
                             m_Stat.onRelocateAboveThresholdRound();
@@ -2141,7 +2765,7 @@ namespace cds { namespace intrusive {
                     }
 
                     // all probeset is full, relocating fault
-                    refBucket.insert_after( typename bucket_entry::iterator(), node_traits::to_node_ptr( pVal ));
+                    refBucket.insert_after( typename bucket_entry::iterator(), node_traits::to_node_ptr( pVal ), arrHash[nTable] );
                     m_Stat.onFailedRelocate();
                     return false;
                 }
@@ -2189,7 +2813,7 @@ namespace cds { namespace intrusive {
                             for ( unsigned int i = 0; i < c_nArity; ++i ) {
                                 bucket_entry& refBucket = bucket( i, arrHash[i] );
                                 if ( refBucket.size() < m_nProbesetThreshold ) {
-                                    refBucket.insert_after( arrPos[i].itPrev, &*it );
+                                    refBucket.insert_after( arrPos[i].itPrev, &*it, arrHash[i] );
                                     m_Stat.onResizeSuccessMove();
                                     goto do_next;
                                 }
@@ -2198,7 +2822,7 @@ namespace cds { namespace intrusive {
                             for ( unsigned int i = 0; i < c_nArity; ++i ) {
                                 bucket_entry& refBucket = bucket( i, arrHash[i] );
                                 if ( refBucket.size() < m_nProbesetSize ) {
-                                    refBucket.insert_after( arrPos[i].itPrev, &*it );
+                                    refBucket.insert_after( arrPos[i].itPrev, &*it, arrHash[i] );
                                     assert( refBucket.size() > 1 );
                                     copy_hash( arrHash, *node_traits::to_value_ptr( *refBucket.begin()));
                                     m_Stat.onResizeRelocateCall();
@@ -2211,7 +2835,142 @@ namespace cds { namespace intrusive {
                     }
                 }
             }
-            free_bucket_tables( pOldTable, nOldCapacity );
+            retire_bucket_tables( pOldTable, nOldCapacity, std::integral_constant<bool, c_bOptimisticRead>());
+        }
+
+        // Entry of breadth-first cuckoo path search queue
+        struct bfs_entry {
+            size_t          nHash;      // the bucket is bucket( nTable, nHash )
+            node_type *     pMoved;     // the item of parent bucket that would be moved to this bucket; nullptr for root
+            size_t          arrMovedHash[c_nArity]; // hash values of pMoved
+            size_t          nParent;    // index of parent entry
+            unsigned int    nTable;
+            unsigned int    nDepth;     // count of displacements from root
+        };
+        typedef cds::details::Allocator< bfs_entry, allocator > bfs_queue_allocator;
+
+        // Moves pNode from table nFrom to table nTo. arrHash are the hash values of pNode obtained when it was in the set
+        bool move_item( node_type * pNode, size_t const* arrHash, unsigned int nFrom, unsigned int nTo )
+        {
+            scoped_cell_lock guard( m_MutexPolicy, arrHash );
+
+            // The item may be removed from the set, so do not access it until it is found by address
+            bucket_entry& refFrom = bucket( nFrom, arrHash[nFrom] );
+            bucket_iterator itPrev;
+            bucket_iterator it = refFrom.begin();
+            for ( bucket_iterator itEnd = refFrom.end(); it != itEnd && &*it != pNode; ++it )
+                itPrev = it;
+            if ( it == refFrom.end())
+                return false;
+
+            value_type& val = *node_traits::to_value_ptr( *pNode );
+            hash_array arrCurHash;
+            copy_hash( arrCurHash, val );
+            if ( memcmp( arrCurHash, arrHash, sizeof( arrCurHash )) != 0 )
+                return false;   // pNode has been reused for another item
+
+            bucket_entry& refTo = bucket( nTo, arrHash[nTo] );
+            if ( refTo.size() >= m_nProbesetSize )
+                return false;
+
+            refFrom.remove( itPrev, it );
+
+            position pos;
+            contains_action::find( refTo, pos, nTo, arrHash[nTo], val, key_predicate()) ; // must return false!
+            refTo.insert_after( pos.itPrev, pNode, arrHash[nTo] );
+            m_Stat.onPathMove();
+            return true;
+        }
+
+        // Breadth-first cuckoo path search: finds the shortest chain of displacements
+        // that frees a slot in one of the buckets of arrHash, and moves the items along the chain.
+        // Each bucket is examined under its lock, and each move locks the item moved and checks it again.
+        // Returns false if no chain of c_nBfsDepth displacements or less is found, or the chain has been broken
+        // by concurrent modification; the table should be resized in that case
+        bool make_free_slot( size_t const* arrHash )
+        {
+            if ( c_nBfsDepth == 0 )
+                return false;
+
+            m_Stat.onPathSearch();
+
+            // Max count of queue entries: the buckets at depth 0..c_nBfsDepth
+            size_t nQueueCapacity = 0;
+            for ( size_t nLevel = c_nArity, nDepth = 0; nDepth <= c_nBfsDepth; ++nDepth, nLevel *= m_nProbesetSize * ( c_nArity - 1 ))
+                nQueueCapacity += nLevel;
+
+            bfs_queue_allocator alloc;
+            bfs_entry * pQueue = alloc.NewArray( nQueueCapacity );
+            size_t nTail = 0;
+            for ( unsigned int i = 0; i < c_nArity; ++i ) {
+                bfs_entry& root = pQueue[nTail++];
+                root.nHash = arrHash[i];
+                root.pMoved = nullptr;
+                root.nParent = 0;
+                root.nTable = i;
+                root.nDepth = 0;
+            }
+
+            size_t nFound = nQueueCapacity;
+            bool bFreeRoot = false;
+            for ( size_t nHead = 0; nHead < nTail; ++nHead ) {
+                bfs_entry const& entry = pQueue[nHead];
+
+                hash_array arrBucketHash;
+                std::fill( arrBucketHash, arrBucketHash + c_nArity, entry.nHash );
+                scoped_cell_lock guard( m_MutexPolicy, arrBucketHash );
+
+                bucket_entry& refBucket = bucket( entry.nTable, entry.nHash );
+                if ( refBucket.size() < m_nProbesetSize ) {
+                    if ( entry.pMoved )
+                        nFound = nHead;
+                    else
+                        bFreeRoot = true;   // another thread has freed a slot
+                    break;
+                }
+
+                if ( entry.nDepth < c_nBfsDepth ) {
+                    for ( bucket_iterator it = refBucket.begin(), itEnd = refBucket.end(); it != itEnd; ++it ) {
+                        hash_array arrItemHash;
+                        copy_hash( arrItemHash, *node_traits::to_value_ptr( *it ));
+                        for ( unsigned int i = 0; i < c_nArity; ++i ) {
+                            if ( i == entry.nTable )
+                                continue;
+
+                            if ( nTail == nQueueCapacity )
+                                break;  // the bucket is overfilled by relocating
+                            bfs_entry& child = pQueue[nTail++];
+                            child.nHash = arrItemHash[i];
+                            child.pMoved = &*it;
+                            memcpy( child.arrMovedHash, arrItemHash, sizeof( arrItemHash ));
+                            child.nParent = nHead;
+                            child.nTable = i;
+                            child.nDepth = entry.nDepth + 1;
+                        }
+                    }
+                }
+            }
+
+            // Move the items from the end of the path:
+            // each move frees a slot for the previous item of the path
+            bool bResult = bFreeRoot;
+            if ( nFound != nQueueCapacity ) {
+                bResult = true;
+                for ( size_t nEntry = nFound; pQueue[nEntry].pMoved; nEntry = pQueue[nEntry].nParent ) {
+                    bfs_entry const& entry = pQueue[nEntry];
+                    if ( !move_item( entry.pMoved, entry.arrMovedHash, pQueue[entry.nParent].nTable, entry.nTable )) {
+                        // The path has been changed by other thread; the items moved are still in the set
+                        bResult = false;
+                        break;
+                    }
+                }
+            }
+
+            alloc.Delete( pQueue, nQueueCapacity );
+
+            if ( !bResult )
+                m_Stat.onPathFailed();
+            return bResult;
         }
 
         constexpr static unsigned int calc_probeset_size( unsigned int nProbesetSize ) noexcept
@@ -2402,7 +3161,7 @@ namespace cds { namespace intrusive {
                     for ( unsigned int i = 0; i < c_nArity; ++i ) {
                         bucket_entry& refBucket = bucket( i, arrHash[i] );
                         if ( refBucket.size() < m_nProbesetThreshold ) {
-                            refBucket.insert_after( arrPos[i].itPrev, pNode );
+                            refBucket.insert_after( arrPos[i].itPrev, pNode, arrHash[i] );
                             f( val );
                             ++m_ItemCounter;
                             m_Stat.onInsertSuccess();
@@ -2413,9 +3172,14 @@ namespace cds { namespace intrusive {
                     for ( unsigned int i = 0; i < c_nArity; ++i ) {
                         bucket_entry& refBucket = bucket( i, arrHash[i] );
                         if ( refBucket.size() < m_nProbesetSize ) {
-                            refBucket.insert_after( arrPos[i].itPrev, pNode );
+                            refBucket.insert_after( arrPos[i].itPrev, pNode, arrHash[i] );
                             f( val );
                             ++m_ItemCounter;
+                            constexpr_if ( c_nBfsDepth != 0 ) {
+                                // full buckets are handled by cuckoo path search, no relocating is needed
+                                m_Stat.onInsertSuccess();
+                                return true;
+                            }
                             nGoalTable = i;
                             assert( refBucket.size() > 1 );
                             copy_hash( arrHash, *node_traits::to_value_ptr( *refBucket.begin()));
@@ -2424,8 +3188,10 @@ namespace cds { namespace intrusive {
                     }
                 }
 
-                m_Stat.onInsertResize();
-                resize();
+                if ( !make_free_slot( arrHash )) {
+                    m_Stat.onInsertResize();
+                    resize();
+                }
             }
 
         do_relocate:
@@ -2496,7 +3262,7 @@ namespace cds { namespace intrusive {
                     for ( unsigned int i = 0; i < c_nArity; ++i ) {
                         bucket_entry& refBucket = bucket( i, arrHash[i] );
                         if ( refBucket.size() < m_nProbesetThreshold ) {
-                            refBucket.insert_after( arrPos[i].itPrev, pNode );
+                            refBucket.insert_after( arrPos[i].itPrev, pNode, arrHash[i] );
                             func( true, val, val );
                             ++m_ItemCounter;
                             m_Stat.onUpdateSuccess();
@@ -2507,9 +3273,14 @@ namespace cds { namespace intrusive {
                     for ( unsigned int i = 0; i < c_nArity; ++i ) {
                         bucket_entry& refBucket = bucket( i, arrHash[i] );
                         if ( refBucket.size() < m_nProbesetSize ) {
-                            refBucket.insert_after( arrPos[i].itPrev, pNode );
+                            refBucket.insert_after( arrPos[i].itPrev, pNode, arrHash[i] );
                             func( true, val, val );
                             ++m_ItemCounter;
+                            constexpr_if ( c_nBfsDepth != 0 ) {
+                                // full buckets are handled by cuckoo path search, no relocating is needed
+                                m_Stat.onUpdateSuccess();
+                                return std::make_pair( true, true );
+                            }
                             nGoalTable = i;
                             assert( refBucket.size() > 1 );
                             copy_hash( arrHash, *node_traits::to_value_ptr( *refBucket.begin()));
@@ -2518,8 +3289,10 @@ namespace cds { namespace intrusive {
                     }
                 }
 
-                m_Stat.onUpdateResize();
-                resize();
+                if ( !make_free_slot( arrHash )) {
+                    m_Stat.onUpdateResize();
+                    resize();
+                }
             }
 
         do_relocate:
@@ -2766,6 +3539,10 @@ namespace cds { namespace intrusive {
             // locks entire array
             scoped_full_lock sl( m_MutexPolicy );
 
+            // cuckoo::optimistic: no lookup can start while the entire array is locked,
+            // so it is enough to wait for the lookups in progress
+            synchronize( std::integral_constant<bool, c_bOptimisticRead>());
+
             for ( unsigned int i = 0; i < c_nArity; ++i ) {
                 bucket_entry * pEntry = m_BucketTable[i];
                 bucket_entry * pEnd = pEntry + m_nBucketMask.load( atomics::memory_order_relaxed ) + 1;
@@ -2776,6 +3553,20 @@ namespace cds { namespace intrusive {
             m_ItemCounter.reset();
         }
 
+        /// Waits until all lookups started before the call are finished
+        /**
+            The function is intended for \p cuckoo::optimistic mutex policy: the lookups do not lock the buckets,
+            so an item unlinked by \p erase() or \p unlink() may still be read by the lookups in progress.
+            After \p %synchronize() returns, the items unlinked before the call can be freed.
+
+            The function must not be called from the functor of \p find().
+            For other mutex policies the function does nothing.
+        */
+        void synchronize()
+        {
+            synchronize( std::integral_constant<bool, c_bOptimisticRead>());
+        }
+
         /// Checks if the set is empty
         /**
             Emptiness is checked by item counting: if item count is zero then the set is empty.
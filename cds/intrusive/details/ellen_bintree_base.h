@@ -364,6 +364,205 @@ namespace cds { namespace intrusive {
             //@endcond
         };
 
+        //@cond
+        namespace details {
+            template <typename T, size_t Capacity, typename Alloc>
+            class allocator_cache
+            {
+                struct free_block {
+                    free_block * m_pNext;
+                };
+                static_assert( sizeof( T ) >= sizeof( free_block ), "The type is too small for allocator_cache" );
+
+                typedef typename Alloc::template rebind<T>::other base_allocator;
+
+#   ifdef CDS_CXX11_THREAD_LOCAL_SUPPORT
+                // Per-thread state is trivially destructible, so it may be accessed
+                // from the destructors of other thread-local objects (for example, when the GC
+                // frees the retired nodes on thread detaching after the cache has been flushed)
+                struct cache_data {
+                    free_block *    pHead;
+                    size_t          nSize;
+                    bool            bClosed;
+                };
+
+                struct cache_cleaner {
+                    ~cache_cleaner()
+                    {
+                        cache_data& cache = data();
+                        cache.bClosed = true;
+                        while ( cache.pHead ) {
+                            free_block * p = cache.pHead;
+                            cache.pHead = p->m_pNext;
+                            base_allocator().deallocate( reinterpret_cast<T *>( p ), 1 );
+                        }
+                        cache.nSize = 0;
+                    }
+                };
+
+                static cache_data& data()
+                {
+                    static thread_local cache_data s_data;
+                    return s_data;
+                }
+
+                static void register_cleaner()
+                {
+                    static thread_local cache_cleaner s_cleaner;
+                    CDS_UNUSED( s_cleaner );
+                }
+
+            public:
+                static T * allocate()
+                {
+                    cache_data& cache = data();
+                    if ( cache.pHead ) {
+                        free_block * p = cache.pHead;
+                        cache.pHead = p->m_pNext;
+                        --cache.nSize;
+                        return reinterpret_cast<T *>( p );
+                    }
+                    return base_allocator().allocate( 1 );
+                }
+
+                static void deallocate( T * p )
+                {
+                    cache_data& cache = data();
+                    if ( cache.nSize < Capacity && !cache.bClosed ) {
+                        if ( !cache.pHead )
+                            register_cleaner();
+                        free_block * pBlock = reinterpret_cast<free_block *>( p );
+                        pBlock->m_pNext = cache.pHead;
+                        cache.pHead = pBlock;
+                        ++cache.nSize;
+                    }
+                    else
+                        base_allocator().deallocate( p, 1 );
+                }
+#   else
+            public:
+                static T * allocate()
+                {
+                    return base_allocator().allocate( 1 );
+                }
+
+                static void deallocate( T * p )
+                {
+                    base_allocator().deallocate( p, 1 );
+                }
+#   endif
+            };
+        } // namespace details
+        //@endcond
+
+        /// Per-thread cached allocator for internal nodes and update descriptors
+        /**
+            Each insertion into \p EllenBinTree allocates an internal node and an update descriptor,
+            each deletion allocates an update descriptor. These objects are freed by the tree's GC
+            when no thread can reference them. \p %cached_allocator keeps a small per-thread free-list
+            of freed blocks: a block freed by the GC goes to the free-list of the thread that performs
+            the reclamation and it is reused by the next allocation in that thread
+            without calling the underlying allocator.
+
+            Unlike \p cds::memory::vyukov_queue_pool the allocator has no shared state
+            and does not need any static pool object. The tree rebinds the allocator to its internal node
+            and update descriptor types; each type has its own free-list.
+            When a thread terminates its free-lists are returned to \p Alloc.
+            If the compiler does not support \p thread_local keyword, the allocator just forwards
+            the calls to \p Alloc.
+
+            Template arguments:
+            - \p T - value type
+            - \p Capacity - max number of blocks in the per-thread free-list, default is 256.
+                The GC frees retired nodes in batches, so the capacity should be comparable with the batch size
+            - \p Alloc - underlying allocator, default is \ref CDS_DEFAULT_ALLOCATOR
+
+            Only single-object allocation is cached. Usage:
+            \code
+            struct my_traits: public cds::intrusive::ellen_bintree::traits {
+                typedef cds::intrusive::ellen_bintree::cached_allocator<> node_allocator;
+                typedef cds::intrusive::ellen_bintree::cached_allocator<> update_desc_allocator;
+            };
+            \endcode
+        */
+        template <typename T = int, size_t Capacity = 256, typename Alloc = CDS_DEFAULT_ALLOCATOR>
+        class cached_allocator
+        {
+            //@cond
+            typedef details::allocator_cache< T, Capacity, Alloc > cache_type;
+            //@endcond
+        public:
+            typedef T           value_type;     ///< Value type
+            typedef T*          pointer;        ///< Pointer to value type
+            typedef size_t      size_type;      ///< Size type
+            typedef ptrdiff_t   difference_type;///< Difference type
+
+            static constexpr size_t const c_nCapacity = Capacity; ///< Max size of the per-thread free-list
+
+            /// Rebinds the allocator to type \p Other
+            template <typename Other>
+            struct rebind {
+                typedef cached_allocator< Other, Capacity, Alloc > other; ///< Rebinding result
+            };
+
+        public:
+            //@cond
+            cached_allocator() noexcept
+            {}
+
+            template <typename Other>
+            cached_allocator( cached_allocator< Other, Capacity, Alloc > const& ) noexcept
+            {}
+            //@endcond
+
+            /// Allocates \p n objects of type \p T
+            pointer allocate( size_type n, void const* /*hint*/ = nullptr )
+            {
+                if ( n == 1 )
+                    return cache_type::allocate();
+                return typename Alloc::template rebind<T>::other().allocate( n );
+            }
+
+            /// Deallocates \p n objects of type \p T pointed by \p p
+            void deallocate( pointer p, size_type n ) noexcept
+            {
+                if ( n == 1 )
+                    cache_type::deallocate( p );
+                else
+                    typename Alloc::template rebind<T>::other().deallocate( p, n );
+            }
+
+            //@cond
+            size_type max_size() const noexcept
+            {
+                return size_t(-1) / sizeof( value_type );
+            }
+
+            template <typename U, typename... Args>
+            void construct( U* p, Args&&... args )
+            {
+                new( static_cast<void *>( p )) U( std::forward<Args>( args )... );
+            }
+
+            template <typename U>
+            void destroy( U* p )
+            {
+                p->~U();
+            }
+
+            template <typename Other>
+            bool operator ==( cached_allocator< Other, Capacity, Alloc > const& ) const noexcept
+            {
+                return true;
+            }
+            template <typename Other>
+            bool operator !=( cached_allocator< Other, Capacity, Alloc > const& ) const noexcept
+            {
+                return false;
+            }
+            //@endcond
+        };
+
         /// EllenBinTree internal statistics
         template <typename Counter = cds::atomicity::event_counter>
         struct stat {
@@ -538,12 +737,16 @@ namespace cds { namespace intrusive {
 
                 Also notice that size of update descriptor is constant and not dependent on the type of data
                 stored in the tree so single free-list object can be used for several \p EllenBinTree object.
+                Another choice is \p ellen_bintree::cached_allocator that keeps per-thread free-lists
+                and needs no static pool object.
             */
             typedef CDS_DEFAULT_ALLOCATOR update_desc_allocator;
 
             /// Allocator for internal nodes
             /**
                 The allocator type is used for \p ellen_bintree::internal_node.
+                Internal nodes are allocated on each insertion and freed by GC,
+                \p ellen_bintree::cached_allocator may be used to avoid calling the heap for each of them.
             */
             typedef CDS_DEFAULT_ALLOCATOR node_allocator;
 
@@ -594,7 +797,9 @@ namespace cds { namespace intrusive {
                 for the free-list of update descriptors, see cds::memory::vyukov_queue_pool free-list implementation.
                 Also notice that size of update descriptor is constant and not dependent on the type of data
                 stored in the tree so single free-list object can be used for all \p %EllenBinTree objects.
+                \p ellen_bintree::cached_allocator with per-thread free-lists may be used as well.
             - \p opt::node_allocator - the allocator for internal nodes. Default is \ref CDS_DEFAULT_ALLOCATOR.
+                \p ellen_bintree::cached_allocator may be used to cache internal nodes per thread.
             - \p opt::stat - internal statistics, by default it is disabled (\p ellen_bintree::empty_stat)
                 To enable statistics use \p \p ellen_bintree::stat
             - \p opt::backoff - back-off strategy, by default no strategy is used (\p cds::backoff::empty)
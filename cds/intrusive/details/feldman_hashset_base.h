@@ -37,6 +37,7 @@
 #include <cds/intrusive/details/base.h>
 #include <cds/opt/compare.h>
 #include <cds/algo/atomic.h>
+#include <cds/algo/int_algo.h>
 #include <cds/algo/split_bitstring.h>
 #include <cds/details/marked_ptr.h>
 #include <cds/urcu/options.h>
@@ -116,6 +117,7 @@ namespace cds { namespace intrusive {
             event_counter   m_nSlotConverting;  ///< Number of events when we encounter a slot while it is converting to array node
 
             event_counter   m_nArrayNodeCount;  ///< Number of array nodes
+            event_counter   m_nArrayNodeFreed;  ///< Number of array nodes collapsed by \p compact()
             event_counter   m_nHeight;          ///< Current height of the tree
 
             //@cond
@@ -137,6 +139,7 @@ namespace cds { namespace intrusive {
             void onSlotChanged()                { ++m_nSlotChanged;         }
             void onSlotConverting()             { ++m_nSlotConverting;      }
             void onArrayNodeCreated()           { ++m_nArrayNodeCount;      }
+            void onArrayNodeFreed()             { ++m_nArrayNodeFreed;      }
             void height( size_t h )             { if (m_nHeight < h ) m_nHeight = h; }
             //@endcond
         };
@@ -162,6 +165,7 @@ namespace cds { namespace intrusive {
             void onSlotChanged()                const {}
             void onSlotConverting()             const {}
             void onArrayNodeCreated()           const {}
+            void onArrayNodeFreed()             const {}
             void height(size_t)                 const {}
             //@endcond
         };
@@ -359,6 +363,45 @@ namespace cds { namespace intrusive {
             //@endcond
         };
 
+        /// Geometry of the multi-level array: head and array node size
+        /**
+            Use \p geometry::for_size() to select the geometry by the expected item count:
+            \code
+            typedef cds::intrusive::FeldmanHashSet< cds::gc::HP, foo, foo_traits > set_type;
+            set_type theSet( cds::intrusive::feldman_hashset::geometry::for_size( 100000000 ));
+            \endcode
+        */
+        struct geometry
+        {
+            size_t head_bits;   ///< 2<sup>head_bits</sup> is the size of head array
+            size_t array_bits;  ///< 2<sup>array_bits</sup> is the size of array node
+
+            /// Max \p head_bits selected by \p for_size(), the head array is 128M on 64bit platform
+            static constexpr size_t const c_nMaxHeadBits = 24;
+
+            /// Selects the geometry for \p nExpectedSize items
+            /**
+                The head array is sized to hold about one item per slot (up to <tt>2**c_nMaxHeadBits</tt> slots),
+                so most of the items are found in the head array or on the first level.
+                The array node is small if the head is large enough: only hash collisions in the head slot
+                need an array node, and a large sparse array node wastes memory. If the head is capped,
+                the array node grows with the count of items per head slot.
+            */
+            static geometry for_size( size_t nExpectedSize )
+            {
+                geometry g;
+                g.head_bits = nExpectedSize > 16 ? cds::beans::log2ceil( nExpectedSize ) : 4;
+                if ( g.head_bits > c_nMaxHeadBits )
+                    g.head_bits = c_nMaxHeadBits;
+
+                size_t const nLoad = ( nExpectedSize >> g.head_bits ) + 1;  // items per head slot
+                g.array_bits = cds::beans::log2ceil( nLoad ) + 2;
+                if ( g.array_bits > 8 )
+                    g.array_bits = 8;
+                return g;
+            }
+        };
+
         //@cond
         namespace details {
             template <typename HashType, size_t HashSize >
@@ -467,15 +510,31 @@ namespace cds { namespace intrusive {
                 array_node * pArr;
                 typename hash_splitter::uint_type nSlot;
                 size_t nHeight;
+#           ifdef CDS_DEBUG
+                multilevel_array& owner;    // compact_tree() checks that no traversal is in progress
+#           endif
 
                 traverse_data( hash_type const& hash, multilevel_array& arr )
                     : splitter( hash )
+#           ifdef CDS_DEBUG
+                    , owner( arr )
+#           endif
                 {
+                    CDS_DEBUG_ONLY( arr.m_nTraverseCount.fetch_add( 1, atomics::memory_order_acq_rel ); )
                     reset( arr );
                 }
 
+#           ifdef CDS_DEBUG
+                ~traverse_data()
+                {
+                    owner.m_nTraverseCount.fetch_sub( 1, atomics::memory_order_acq_rel );
+                }
+#           endif
+
                 void reset( multilevel_array& arr )
                 {
+                    // the set is being compacted by another thread: compact() precondition is violated
+                    assert( !arr.m_bCompacting.load( atomics::memory_order_acquire ));
                     splitter.reset();
                     pArr = arr.head();
                     nSlot = splitter.cut( static_cast<unsigned>( arr.metrics().head_node_size_log ));
@@ -488,11 +547,19 @@ namespace cds { namespace intrusive {
             feldman_hashset::details::metrics const m_Metrics;
             array_node *      m_Head;
             mutable stat      m_Stat;
+#       ifdef CDS_DEBUG
+            atomics::atomic<size_t> m_nTraverseCount;   // count of traversals in progress
+            atomics::atomic<bool>   m_bCompacting;      // compact_tree() is in progress
+#       endif
 
         public:
             multilevel_array(size_t head_bits, size_t array_bits )
                 : m_Metrics(feldman_hashset::details::metrics::make( head_bits, array_bits, c_hash_size ))
                 , m_Head( alloc_head_node())
+#       ifdef CDS_DEBUG
+                , m_nTraverseCount( 0 )
+                , m_bCompacting( false )
+#       endif
             {
                 assert( hash_splitter::is_correct( static_cast<unsigned>( metrics().head_node_size_log )));
                 assert( hash_splitter::is_correct( static_cast<unsigned>( metrics().array_node_size_log )));
@@ -531,6 +598,27 @@ namespace cds { namespace intrusive {
                 } // while
             }
 
+            // Non-blocking step of traverse() used by batched searches.
+            // Loads the current slot of pos; if it is an array node moves pos one level down
+            // and prefetches the slot of the next level.
+            // Returns the slot loaded: the search is over if slot.bits() == 0
+            node_ptr traverse_step( traverse_data& pos )
+            {
+                node_ptr slot = pos.pArr->nodes[pos.nSlot].load( memory_model::memory_order_acquire );
+                if ( slot.bits() == flag_array_node ) {
+                    assert( slot.ptr() != nullptr );
+                    assert( !pos.splitter.eos());
+                    pos.nSlot = pos.splitter.cut( static_cast<unsigned>( metrics().array_node_size_log ));
+                    assert( static_cast<size_t>( pos.nSlot ) < metrics().array_node_size );
+                    pos.pArr = to_array( slot.ptr());
+                    ++pos.nHeight;
+                    cds_prefetch( &pos.pArr->nodes[pos.nSlot] );
+                }
+                else if ( slot.bits() == flag_array_converting )
+                    stats().onSlotConverting();
+                return slot;
+            }
+
             size_t head_size() const
             {
                 return m_Metrics.head_node_size;
@@ -563,6 +651,61 @@ namespace cds { namespace intrusive {
                 return m_Metrics;
             }
 
+            size_t compact_tree()
+            {
+                // The function is not thread-safe: the array nodes are freed immediately
+                // since the traversal does not guard them.
+                // Debug build checks that no operation is in progress and no one starts during compacting
+#           ifdef CDS_DEBUG
+                bool const bCompacting = m_bCompacting.exchange( true, atomics::memory_order_acq_rel );
+                assert( !bCompacting );
+                assert( m_nTraverseCount.load( atomics::memory_order_acquire ) == 0 );
+#           endif
+
+                size_t nFreed = 0;
+                node_ptr single;
+                compact_array_node( m_Head, head_size(), single, nFreed );
+
+#           ifdef CDS_DEBUG
+                assert( m_nTraverseCount.load( atomics::memory_order_acquire ) == 0 );
+                m_bCompacting.store( false, atomics::memory_order_release );
+#           endif
+                return nFreed;
+            }
+
+            // Collapses child array nodes of pArr that contain at most one data node into the parent slot.
+            // Returns the count of data nodes in pArr or size_t(-1) if pArr still has a child array node
+            size_t compact_array_node( array_node * pArr, size_t nSize, node_ptr& single, size_t& nFreed )
+            {
+                size_t nCount = 0;
+                bool bHasArray = false;
+                for ( atomic_node_ptr * p = pArr->nodes, *pLast = p + nSize; p != pLast; ++p ) {
+                    node_ptr slot = p->load( memory_model::memory_order_acquire );
+                    if ( slot.bits() == flag_array_node ) {
+                        array_node * pChild = to_array( slot.ptr());
+                        node_ptr childSingle;
+                        if ( compact_array_node( pChild, array_node_size(), childSingle, nFreed ) > 1 ) {
+                            bHasArray = true;
+                            continue;
+                        }
+
+                        // The data node found (if any) is placed to the slot that leads to it,
+                        // so the search for its hash finds it one level above
+                        p->store( childSingle, memory_model::memory_order_release );
+                        free_array_node( pChild, array_node_size());
+                        stats().onArrayNodeFreed();
+                        ++nFreed;
+                        slot = childSingle;
+                    }
+                    assert( slot.bits() == 0 );
+                    if ( slot.ptr()) {
+                        single = slot;
+                        ++nCount;
+                    }
+                }
+                return bHasArray ? ~size_t( 0 ) : nCount;
+            }
+
             void destroy_tree()
             {
                 // The function is not thread-safe. For use in dtor only
@@ -31,11 +31,13 @@
 #ifndef CDSLIB_INTRUSIVE_DETAILS_MICHAEL_SET_BASE_H
 #define CDSLIB_INTRUSIVE_DETAILS_MICHAEL_SET_BASE_H
 
+#include <cstddef>
 #include <cds/intrusive/details/base.h>
 #include <cds/opt/compare.h>
 #include <cds/opt/hash.h>
 #include <cds/algo/bitop.h>
 #include <cds/algo/atomic.h>
+#include <cds/user_setup/cache_line.h>
 
 namespace cds { namespace intrusive {
 
@@ -72,6 +74,71 @@ namespace cds { namespace intrusive {
                 and in destructor for destroying bucket table
             */
             typedef CDS_DEFAULT_ALLOCATOR   allocator;
+
+            /// Cache-line bucket layout
+            /**
+                If \p true, each bucket of the hash table is aligned to the cache line and
+                the space left in the line after the list head is used as a small lookup cache:
+                an array of node pointers with one-byte hash fingerprints packed into one word.
+                A successful lookup publishes the node found into the bucket's cache,
+                so the next lookup of the key compares the fingerprints first and
+                touches only one node instead of traversing the bucket list.
+                The ordered list is still the primary storage: the cache is a lookup hint only,
+                the erasing operations remove the node from the cache before the node is retired.
+
+                The option is supported for \p MichaelList buckets of \p intrusive::MichaelHashSet
+                and for \p container::MichaelKVList buckets of \p container::MichaelHashMap
+                based on \p gc::HP, \p gc::DHP and \p gc::HE.
+                The hash functor should be default-constructible since the bucket calls it to get the fingerprint of the key.
+
+                Default is \p false.
+            */
+            static const bool cache_line_bucket = false;
+
+            /// Growth mode
+            /**
+                If \p true, the hash table doubles its bucket array when the item count exceeds
+                <tt>bucket_count() * nLoadFactor</tt>, where \p nLoadFactor is the constructor argument.
+                The buckets are moved to the new table incrementally: each updating operation
+                that finds the table growing migrates one bucket of the old table before doing its own work.
+                There is no global stop: the lookups stay lock-free during the migration,
+                the updating operations wait only if their own bucket is being migrated at the moment.
+                \p find() with a functor is a lookup like \p contains(), it never waits for the migration.
+                The migration copies the items, so the item should not be changed through the \p find() functor,
+                \p guarded_ptr or an iterator: the change made while the bucket is being copied is lost.
+                \p begin() finishes the migration in progress, the iterator keeps the traversed table guarded.
+
+                The option is supported only for \p container::MichaelHashMap based on \p container::MichaelKVList.
+                The item counter should not be \p atomicity::empty_item_counter,
+                \p mapped_type should be copy-constructible.
+
+                Default is \p false.
+            */
+            static const bool resizable = false;
+        };
+
+        /// [type-option] Cache-line bucket layout, see \p traits::cache_line_bucket
+        template <bool Value>
+        struct cache_line_bucket
+        {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                enum { cache_line_bucket = Value };
+            };
+            //@endcond
+        };
+
+        /// [type-option] Growth mode, see \p traits::resizable
+        template <bool Value>
+        struct resizable
+        {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                enum { resizable = Value };
+            };
+            //@endcond
         };
 
         /// Metafunction converting option list to traits struct
@@ -81,6 +148,10 @@ namespace cds { namespace intrusive {
             - \p opt::item_counter - optional, specifies item counting policy. See \p traits::item_counter
                 for default type.
             - \p opt::allocator - optional, bucket table allocator. Default is \ref CDS_DEFAULT_ALLOCATOR.
+            - \p michael_set::cache_line_bucket - optional, cache-line bucket layout with inline hash tags.
+                See \p traits::cache_line_bucket for explanation. Default is \p false.
+            - \p michael_set::resizable - optional, growth mode of \p container::MichaelHashMap.
+                See \p traits::resizable for explanation. Default is \p false.
         */
         template <typename... Options>
         struct make_traits {
@@ -101,6 +172,162 @@ namespace cds { namespace intrusive {
                 return ( exp2 < nBucketCount ? exp2 * 2 : exp2 ) - 1;
             }
 
+            // Bucket table allocator
+            // Over-aligned bucket (cache_line_bucket) is placed into the memory allocated by char-rebound Allocator:
+            // the standard allocators do not respect the alignment of the type before C++17
+            template <typename Bucket, typename Allocator, bool OverAligned = ( alignof( Bucket ) > alignof( std::max_align_t ))>
+            struct bucket_table_allocator: public Allocator::template rebind< Bucket >::other
+            {};
+
+            template <typename Bucket, typename Allocator>
+            struct bucket_table_allocator< Bucket, Allocator, true >
+            {
+                typedef typename Allocator::template rebind< char >::other char_allocator;
+
+                static size_t raw_size( size_t nCount )
+                {
+                    return nCount * sizeof( Bucket ) + alignof( Bucket ) + sizeof( char* );
+                }
+
+                Bucket * allocate( size_t nCount )
+                {
+                    char * pRaw = char_allocator().allocate( raw_size( nCount ));
+                    uintptr_t const nAligned = ( reinterpret_cast<uintptr_t>( pRaw ) + sizeof( char* ) + alignof( Bucket ) - 1 )
+                        & ~uintptr_t( alignof( Bucket ) - 1 );
+
+                    // the raw pointer is kept just before the table
+                    reinterpret_cast<char**>( nAligned )[-1] = pRaw;
+                    return reinterpret_cast<Bucket *>( nAligned );
+                }
+
+                void deallocate( Bucket * pTable, size_t nCount )
+                {
+                    char_allocator().deallocate( reinterpret_cast<char**>( pTable )[-1], raw_size( nCount ));
+                }
+            };
+
+            // Inline hash tags of cache-line bucket
+            // Node is the type guarded and retired by the bucket list, ListSize is the size of the list head.
+            // The slots are lookup hints: a slot may point to any live node of the bucket;
+            // the node erasing must call erase() before the node is retired and while the node is guarded
+            template <typename GC, typename Node, size_t ListSize>
+            class tag_array
+            {
+            public:
+                typedef GC   gc;
+                typedef Node node_type;
+
+                static size_t const c_nSlotCount =
+                    ListSize + sizeof( uint64_t ) + sizeof( node_type* ) > c_nCacheLineSize ? 1 :
+                    ( c_nCacheLineSize - ListSize - sizeof( uint64_t )) / sizeof( node_type* ) > 8 ? 8 :
+                    ( c_nCacheLineSize - ListSize - sizeof( uint64_t )) / sizeof( node_type* );
+
+            private:
+                static uint64_t const c_nLowBits = 0x0101010101010101ULL;
+
+                atomics::atomic<uint64_t>     m_nTags;                  // fingerprint of slot i is i-th byte
+                atomics::atomic<node_type *>  m_arrSlot[c_nSlotCount];
+
+            public:
+                tag_array()
+                    : m_nTags( 0 )
+                {
+                    for ( auto& slot : m_arrSlot )
+                        slot.store( nullptr, atomics::memory_order_relaxed );
+                }
+
+                /// Calculates one-byte fingerprint of hash value
+                static uint8_t fingerprint( size_t nHash )
+                {
+                    // The low bits of the hash are used as the bucket index, so take the high byte of the mixed hash
+                    return static_cast<uint8_t>(( static_cast<uint64_t>( nHash ) * 0x9E3779B97F4A7C15ULL ) >> 56 );
+                }
+
+                /// Searches the slots with fingerprint \p nTag
+                /**
+                    For each candidate slot the node is protected by \p guard and checked by \p pred.
+                    Returns the node found, the node is guarded by \p guard.
+                */
+                template <typename Predicate>
+                node_type * find( typename gc::Guard& guard, uint8_t nTag, Predicate pred )
+                {
+                    // SWAR byte matching: the high bit of each byte equal to nTag is set;
+                    // the false positives are possible, they are filtered out by pred
+                    uint64_t const x = m_nTags.load( atomics::memory_order_acquire ) ^ ( nTag * c_nLowBits );
+                    for ( uint64_t nMatch = ( x - c_nLowBits ) & ~x & ( c_nLowBits << 7 ); nMatch; nMatch &= nMatch - 1 ) {
+                        size_t const nSlot = static_cast<size_t>( bitop::LSBnz( nMatch )) / 8;
+                        if ( nSlot >= c_nSlotCount )
+                            break;
+
+                        node_type * p = guard.protect( m_arrSlot[nSlot] );
+                        if ( p && pred( *p ))
+                            return p;
+                    }
+                    guard.clear();
+                    return nullptr;
+                }
+
+                /// Publishes guarded node \p p found by the fingerprint \p nTag
+                /**
+                    \p is_marked predicate checks whether the node is logically deleted.
+                */
+                template <typename MarkPredicate>
+                void publish( node_type * p, uint8_t nTag, MarkPredicate is_marked )
+                {
+                    // Take a free slot or evict the slot chosen by the fingerprint
+                    size_t nSlot = nTag % c_nSlotCount;
+                    for ( size_t i = 0; i < c_nSlotCount; ++i ) {
+                        if ( m_arrSlot[i].load( atomics::memory_order_relaxed ) == nullptr ) {
+                            nSlot = i;
+                            break;
+                        }
+                    }
+
+                    uint64_t const nMask = uint64_t( 0xFF ) << ( nSlot * 8 );
+                    uint64_t nTags = m_nTags.load( atomics::memory_order_relaxed );
+                    while ( !m_nTags.compare_exchange_weak( nTags, ( nTags & ~nMask ) | ( uint64_t( nTag ) << ( nSlot * 8 )),
+                        atomics::memory_order_release, atomics::memory_order_relaxed ))
+                    {}
+                    m_arrSlot[nSlot].store( p, atomics::memory_order_release );
+
+                    // Pairs with the fence in erase(): either the eraser sees p in the slot
+                    // or we see the deletion mark of p
+                    atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+                    if ( is_marked( *p ))
+                        m_arrSlot[nSlot].compare_exchange_strong( p, nullptr, atomics::memory_order_relaxed, atomics::memory_order_relaxed );
+                }
+
+                /// Removes the logically deleted node \p p from the slots
+                void erase( node_type * p )
+                {
+                    atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+                    for ( auto& slot : m_arrSlot ) {
+                        node_type * cur = p;
+                        if ( slot.load( atomics::memory_order_relaxed ) == p )
+                            slot.compare_exchange_strong( cur, nullptr, atomics::memory_order_relaxed, atomics::memory_order_relaxed );
+                    }
+                }
+            };
+
+            // Cache-line bucket for OrderedList, specialized for supported list types
+            template <typename OrderedList, typename Hash>
+            class tagged_bucket
+            {
+                static_assert( sizeof( OrderedList ) == 0, "cache_line_bucket option is not supported for this ordered list type" );
+            };
+
+            template <typename OrderedList, typename Hash, bool CacheLineBucket>
+            struct bucket_type_selector
+            {
+                typedef OrderedList type;
+            };
+
+            template <typename OrderedList, typename Hash>
+            struct bucket_type_selector< OrderedList, Hash, true >
+            {
+                typedef tagged_bucket< OrderedList, Hash > type;
+            };
+
             template <typename OrderedList, bool IsConst>
             struct list_iterator_selector;
 
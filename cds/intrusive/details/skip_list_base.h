@@ -437,6 +437,141 @@ namespace cds { namespace intrusive {
         /// Turbo-Pascal generator, max height 16
         typedef turbo< 16 > turbo16;
 
+        /// Option specifying inline allocation of node towers
+        /**
+            By default, intrusive \p SkipListSet allocates the tower of a node which height is more than 1
+            (the array of next pointers for levels <tt>1 .. height - 1</tt>) separately from the item
+            by \p opt::allocator, and frees it when the item is disposed.
+
+            If \p Enable is \p true, \p SkipListSet does not allocate the towers: each item is expected to be
+            allocated together with its tower in one memory block by \p skip_list::inline_tower_allocator.
+            Inserting and searching touch only one allocation per item then.
+            An item with no tower is inserted as a node of height 1.
+            The tower is freed with the item, so the disposer should be \p inline_tower_allocator::disposer
+            or should call \p inline_tower_allocator::Delete().
+
+            Non-intrusive skip-list containers always allocate a node with its tower in one block.
+        */
+        template <bool Enable>
+        struct inline_tower {
+            //@cond
+            template <typename Base>
+            struct pack: public Base
+            {
+                static bool const inline_tower = Enable;
+            };
+            //@endcond
+        };
+
+        /// Allocator of items with inline node tower
+        /**
+            The allocator creates an item of type \p T and the tower of its skip-list node in one memory block:
+            the tower is a trailing array of next pointers placed right after the item.
+            The height of the tower is produced by random level generator \p RandomGen.
+            Use it with \p skip_list::inline_tower option of \p SkipListSet.
+
+            Template arguments:
+            - \p T - item type
+            - \p Hook - the hook of the skip-list, \p skip_list::base_hook, \p skip_list::member_hook or \p skip_list::traits_hook.
+                It should be the same as \p opt::hook option of the set.
+            - \p Alloc - memory allocator, default is \ref CDS_DEFAULT_ALLOCATOR
+            - \p RandomGen - random level generator, see \p skip_list::random_level_generator. Default is \p turbo32
+
+            Example:
+            \code
+            typedef cds::intrusive::skip_list::base_hook< cds::opt::gc< cds::gc::HP >> my_hook;
+            typedef cds::intrusive::skip_list::inline_tower_allocator< my_data, my_hook > my_allocator;
+
+            typedef cds::intrusive::SkipListSet< cds::gc::HP, my_data,
+                typename cds::intrusive::skip_list::make_traits<
+                    cds::intrusive::opt::hook< my_hook >
+                    ,cds::intrusive::opt::compare< my_data_cmp >
+                    ,cds::intrusive::skip_list::inline_tower< true >
+                    ,cds::intrusive::opt::disposer< my_allocator::disposer >
+                >::type
+            > my_set;
+
+            my_allocator alloc;
+            my_set s;
+            s.insert( *alloc.New( "key" ));
+            \endcode
+        */
+        template <typename T, typename Hook, typename Alloc = CDS_DEFAULT_ALLOCATOR, typename RandomGen = turbo32>
+        class inline_tower_allocator
+        {
+        public:
+            typedef T           value_type;             ///< Item type
+            typedef Hook        hook;                   ///< Hook type
+            typedef RandomGen   random_level_generator; ///< Random level generator
+            typedef typename hook::node_type node_type; ///< Node type
+            typedef typename get_node_traits< value_type, node_type, hook >::type node_traits; ///< node traits
+
+        protected:
+            //@cond
+            typedef typename node_type::tower_item_type tower_item_type;
+            typedef typename Alloc::template rebind<unsigned char>::other allocator_type;
+
+            static size_t const c_nTowerItemSize = sizeof( tower_item_type );
+            static size_t const c_nItemPadding = sizeof( value_type ) % c_nTowerItemSize;
+            static size_t const c_nItemSize = sizeof( value_type ) + ( c_nItemPadding ? ( c_nTowerItemSize - c_nItemPadding ) : 0 );
+
+            random_level_generator  m_RandomLevelGen;
+            //@endcond
+
+        public:
+            /// Size of memory block for an item with the tower of height \p nHeight
+            static constexpr size_t item_size( unsigned int nHeight ) noexcept
+            {
+                return c_nItemSize + ( nHeight - 1 ) * c_nTowerItemSize;
+            }
+
+            /// Creates an item from \p args with the tower of random height
+            template <typename... Args>
+            value_type * New( Args&&... args )
+            {
+                return NewWithHeight( m_RandomLevelGen() + 1, std::forward<Args>( args )... );
+            }
+
+            /// Creates an item from \p args with the tower of height \p nHeight
+            template <typename... Args>
+            static value_type * NewWithHeight( unsigned int nHeight, Args&&... args )
+            {
+                assert( nHeight > 0 && nHeight <= c_nHeightLimit );
+
+                unsigned char * pMem = allocator_type().allocate( item_size( nHeight ));
+                assert( (reinterpret_cast<uintptr_t>( pMem ) & ( alignof( value_type ) - 1 )) == 0 );
+
+                value_type * pVal = new( pMem ) value_type( std::forward<Args>( args )... );
+                if ( nHeight > 1 ) {
+                    tower_item_type * pTower = reinterpret_cast<tower_item_type *>( pMem + c_nItemSize );
+                    for ( unsigned int i = 0; i < nHeight - 1; ++i )
+                        new( pTower + i ) tower_item_type( nullptr );
+                    node_traits::to_node_ptr( pVal )->make_tower( nHeight, pTower );
+                }
+                return pVal;
+            }
+
+            /// Destroys the item \p pVal created by \p New() and frees its memory block
+            static void Delete( value_type * pVal )
+            {
+                assert( pVal != nullptr );
+
+                unsigned int const nHeight = node_traits::to_node_ptr( pVal )->height();
+                pVal->~value_type();
+                allocator_type().deallocate( reinterpret_cast<unsigned char *>( pVal ), item_size( nHeight ));
+            }
+
+            /// Disposer functor calling \p Delete()
+            struct disposer {
+                //@cond
+                void operator()( value_type * pVal ) const
+                {
+                    Delete( pVal );
+                }
+                //@endcond
+            };
+        };
+
         /// \p SkipListSet internal statistics
         template <typename EventCounter = cds::atomicity::event_counter>
         struct stat {
@@ -478,6 +613,7 @@ namespace cds { namespace intrusive {
             event_counter   m_nExtractWhileFind     ; ///< Count of extracted item while searching (RCU only)
             event_counter   m_nMarkFailed           ; ///< Count of failed node marking (logical deletion mark)
             event_counter   m_nEraseContention      ; ///< Count of key erasing contention encountered
+            event_counter   m_nFingerRestart        ; ///< Count of finger searches of \p insert_sorted() restarted from the head
 
             //@cond
             void onAddNode( unsigned int nHeight )
@@ -525,6 +661,7 @@ namespace cds { namespace intrusive {
             void onExtractMaxRetry()        { ++m_nExtractMaxRetries; }
             void onMarkFailed()             { ++m_nMarkFailed;        }
             void onEraseContention()        { ++m_nEraseContention;   }
+            void onFingerRestart()          { ++m_nFingerRestart;     }
             //@endcond
         };
 
@@ -567,6 +704,7 @@ namespace cds { namespace intrusive {
             void onExtractMaxRetry()        const {}
             void onMarkFailed()             const {}
             void onEraseContention()        const {}
+            void onFingerRestart()          const {}
             //@endcond
         };
 
@@ -663,6 +801,9 @@ namespace cds { namespace intrusive {
             */
             typedef opt::v::rcu_throw_deadlock      rcu_check_deadlock;
 
+            /// Inline tower allocation, see \p skip_list::inline_tower. Default is \p false
+            static bool const inline_tower = false;
+
             //@cond
             // For internal use only!!!
             typedef opt::none                       internal_node_builder;
@@ -693,6 +834,8 @@ namespace cds { namespace intrusive {
             - \p opt::back_off - back-off strategy, default is \p cds::backoff::Default.
             - \p opt::stat - internal statistics. By default, it is disabled (\p skip_list::empty_stat).
                 To enable it use \p skip_list::stat
+            - \p skip_list::inline_tower - if \p true, the items are allocated together with their towers
+                by \p skip_list::inline_tower_allocator. Default is \p false.
         */
         template <typename... Options>
         struct make_traits {
@@ -766,6 +909,48 @@ namespace cds { namespace intrusive {
                 };
             };
 
+            // The towers are allocated together with the items by inline_tower_allocator
+            template <typename NodeType>
+            struct inline_node_builder
+            {
+                typedef NodeType node_type;
+
+                template <typename RandomGen>
+                static node_type * make_tower( node_type * pNode, RandomGen& /*gen*/ )
+                {
+                    return pNode;
+                }
+
+                static node_type * make_tower( node_type * pNode, unsigned int /*nHeight*/ )
+                {
+                    return pNode;
+                }
+
+                static void dispose_tower( node_type * /*pNode*/ )
+                {}
+
+                struct node_disposer {
+                    void operator()( node_type * /*pNode*/ ) const
+                    {}
+                };
+            };
+
+            template <typename Traits, typename NodeType, typename AtomicNodePtr, typename Alloc, typename InternalBuilder = typename Traits::internal_node_builder>
+            struct select_node_builder
+            {
+                typedef InternalBuilder type;
+            };
+
+            template <typename Traits, typename NodeType, typename AtomicNodePtr, typename Alloc>
+            struct select_node_builder< Traits, NodeType, AtomicNodePtr, Alloc, cds::opt::none >
+            {
+                typedef typename std::conditional<
+                    Traits::inline_tower
+                    ,inline_node_builder< NodeType >
+                    ,intrusive_node_builder< NodeType, AtomicNodePtr, Alloc >
+                >::type type;
+            };
+
             // Forward declaration
             template <class GC, typename NodeTraits, typename BackOff, bool IsConst>
             class iterator;
@@ -160,6 +160,9 @@ namespace cds { namespace intrusive {
             counter_type    m_nInitBucketContention; ///< Count of bucket init contention encountered
             counter_type    m_nBusyWaitBucketInit;   ///< Count of busy wait cycle while a bucket is initialized
             counter_type    m_nBucketsExhausted;     ///< Count of failed bucket allocation
+            counter_type    m_nLookupTraversed;      ///< Total count of nodes compared by \p find(), \p contains() and \p get()
+            counter_type    m_nSkipHit;              ///< Count of searches started from a skip pointer instead of the bucket head
+            counter_type    m_nSkipCreated;          ///< Count of skip pointers set by long lookups
 
             //@cond
             void onInsertSuccess()       { ++m_nInsertSuccess; }
@@ -187,6 +190,9 @@ namespace cds { namespace intrusive {
             void onBucketInitContenton() { ++m_nInitBucketContention; }
             void onBusyWaitBucketInit()  { ++m_nBusyWaitBucketInit; }
             void onBucketsExhausted()    { ++m_nBucketsExhausted; }
+            void onLookupTraversed( size_t nCount ) { m_nLookupTraversed += nCount; }
+            void onSkipHit()             { ++m_nSkipHit; }
+            void onSkipCreated()         { ++m_nSkipCreated; }
             //@endcond
         };
 
@@ -211,6 +217,9 @@ namespace cds { namespace intrusive {
             void onBucketInitContenton() const {}
             void onBusyWaitBucketInit()  const {}
             void onBucketsExhausted()    const {}
+            void onLookupTraversed( size_t ) const {}
+            void onSkipHit()             const {}
+            void onSkipCreated()         const {}
             //@endcond
         };
 
@@ -314,6 +323,42 @@ namespace cds { namespace intrusive {
                 - \p cds::intrusive::TaggedFreeList - if architecture and/or compiler supports double-width CAS primitive
             */
             typedef FreeListImpl free_list;
+
+            /// Count of skip pointers in each auxiliary node
+            /**
+                A bucket of the split-ordered list is a segment of the list that starts from the bucket's auxiliary node.
+                When the load factor is high the segment is long and the search inside it is a linear scan.
+                If \p skip_pointers is not zero, each auxiliary node keeps a small array of \p skip_pointers
+                pointers to auxiliary nodes of finer buckets lying inside its segment. Slot \p j of the array
+                of bucket \p b points to the head of bucket <tt>b + (j << L)</tt>, where <tt>2**L</tt> is the current
+                bucket count, so the search can skip the first part of the segment.
+                The slot is set lazily by a lookup that has traversed more than <tt>2 * skip_pointers</tt> nodes.
+
+                Skip targets are auxiliary nodes, which are never removed from the list, so no extra
+                hazard pointers are needed. To have room for skip targets the bucket table capacity is
+                multiplied by \p skip_pointers, but the regular growth of the bucket count
+                is still limited by the capacity requested in the constructor.
+
+                The value must be a power of two; 0 (the default) disables skip pointers.
+                Skip pointers are supported by \p SplitListSet for \p gc::HP and \p gc::DHP only,
+                the \p gc::nogc and RCU-based split-lists ignore this option.
+            */
+            static const size_t skip_pointers = 0;
+        };
+
+        /// [value-option] Count of skip pointers in auxiliary node
+        /**
+            See \p traits::skip_pointers for explanation. \p Count must be a power of two or zero.
+        */
+        template <size_t Count>
+        struct skip_pointers
+        {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                enum : size_t { skip_pointers = Count };
+            };
+            //@endcond
         };
 
         /// [value-option] Split-list dynamic bucket table option
@@ -353,12 +398,37 @@ namespace cds { namespace intrusive {
                 To enable internal statistics use \p split_list::stat.
             - \p opt::padding - a padding to solve false-sharing issues; default is cache-line padding
             - \p opt::free_list - a free-list implementation, see \p traits::free_list
+            - \p split_list::skip_pointers - count of skip pointers in auxiliary node, see \p traits::skip_pointers.
+                Default is 0 (no skip pointers)
         */
         template <typename... Options>
         struct make_traits {
             typedef typename cds::opt::make_options< traits, Options...>::type type  ;   ///< Result of metafunction
         };
 
+        //@cond
+        namespace details {
+            // Skip pointers of an auxiliary node, see traits::skip_pointers
+            template <typename AuxNode, size_t Count>
+            struct skip_array
+            {
+                static_assert( (Count & (Count - 1)) == 0, "split_list::skip_pointers must be a power of two" );
+
+                atomics::atomic<AuxNode*> m_arrSkip[Count];
+
+                skip_array()
+                {
+                    for ( size_t i = 0; i < Count; ++i )
+                        m_arrSkip[i].store( nullptr, atomics::memory_order_relaxed );
+                }
+            };
+
+            template <typename AuxNode>
+            struct skip_array<AuxNode, 0>
+            {};
+        } // namespace details
+        //@endcond
+
         /// Static bucket table
         /**
             Non-resizeable bucket table for \p SplitListSet class.
@@ -374,6 +444,7 @@ namespace cds { namespace intrusive {
             - \p opt::memory_model - memory model used. Possible types are \p opt::v::sequential_consistent, \p opt::v::relaxed_ordering
             - \p opt::free_list - free-list implementation; default is \p TaggedFreeList if the processor supports double-with CAS
                  otherwise \p FreeList.
+            - \p split_list::skip_pointers - count of skip pointers in auxiliary node, default is 0
         */
         template <typename GC, typename Node, typename... Options>
         class static_bucket_table
@@ -384,6 +455,7 @@ namespace cds { namespace intrusive {
                 typedef CDS_DEFAULT_ALLOCATOR       allocator;
                 typedef opt::v::relaxed_ordering    memory_model;
                 typedef FreeListImpl                free_list;
+                static const size_t                 skip_pointers = 0;
             };
             typedef typename opt::make_options< default_options, Options... >::type options;
             //@endcond
@@ -397,6 +469,7 @@ namespace cds { namespace intrusive {
 
             /// Auxiliary node type
             struct aux_node_type: public node_type, public free_list::node
+                , public details::skip_array< aux_node_type, options::skip_pointers >
             {
 #           ifdef CDS_DEBUG
                 atomics::atomic<bool> m_busy;
@@ -541,6 +614,7 @@ namespace cds { namespace intrusive {
             - \p opt::memory_model - memory model used. Possible types are \p opt::v::sequential_consistent, \p opt::v::relaxed_ordering
             - \p opt::free_list - free-list implementation; default is \p TaggedFreeList if the processor supports double-with CAS
                 otherwise \p FreeList.
+            - \p split_list::skip_pointers - count of skip pointers in auxiliary node, default is 0
             */
         template <typename GC, typename Node, typename... Options>
         class expandable_bucket_table
@@ -551,6 +625,7 @@ namespace cds { namespace intrusive {
                 typedef CDS_DEFAULT_ALLOCATOR       allocator;
                 typedef opt::v::relaxed_ordering    memory_model;
                 typedef FreeListImpl                free_list;
+                static const size_t                 skip_pointers = 0;
             };
             typedef typename opt::make_options< default_options, Options... >::type options;
             //@endcond
@@ -568,6 +643,7 @@ namespace cds { namespace intrusive {
 
             /// Auxiliary node type
             struct aux_node_type: public node_type, public free_list::node
+                , public details::skip_array< aux_node_type, options::skip_pointers >
             {
 #           ifdef CDS_DEBUG
                 atomics::atomic<bool> m_busy;
@@ -872,6 +948,26 @@ namespace cds { namespace intrusive {
                 {}
             };
 
+            // Comparator wrapper counting the nodes compared by a search
+            template <typename Compare>
+            struct counting_compare
+            {
+                Compare cmp;
+                size_t* pCount;
+
+                counting_compare( Compare c, size_t& nCount )
+                    : cmp( c )
+                    , pCount( &nCount )
+                {}
+
+                template <typename Q1, typename Q2>
+                int operator()( Q1 const& v1, Q2 const& v2 ) const
+                {
+                    ++*pCount;
+                    return cmp( v1, v2 );
+                }
+            };
+
             template <class OrderedList, class Traits, bool Iterable >
             class ordered_list_adapter;
 
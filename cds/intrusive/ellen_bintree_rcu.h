@@ -1246,6 +1246,59 @@ namespace cds { namespace intrusive {
             return get_( key, compare_functor());
         }
 
+        /// Calls \p f for each item with key in range <tt>[lo, hi)</tt> in ascending key order
+        /** @anchor cds_intrusive_EllenBinTree_rcu_for_each_in_range
+            The function visits all items whose key is not less than \p lo and less than \p hi.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+
+            The items are streamed one by one: each next item is located by a separate descent from the root
+            for the smallest key greater than the key of the previous item, so the range is never copied.
+            The traversal is not atomic, but it is linearizable per key: every item passed to \p f
+            was in the tree when it was found, and the keys are strictly increasing.
+            Items inserted or deleted concurrently in the part of the range not yet visited may or may not be visited.
+
+            The functor can change non-key fields of \p item. The functor does not serialize simultaneous access
+            to the tree \p item. The functor must not call other member functions of the tree.
+
+            The function applies RCU lock internally for whole traversal, so the functor is called
+            in the RCU critical section. For very long ranges consider splitting the range into several calls
+            to allow RCU to reclaim retired nodes.
+
+            The function returns the number of items visited.
+        */
+        template <typename Q, typename Func>
+        size_t for_each_in_range( Q const& lo, Q const& hi, Func f ) const
+        {
+            return for_each_in_range_( lo, hi, node_compare(), f );
+        }
+
+        /// Calls \p f for each item with key in range <tt>[lo, hi)</tt> using \p pred for key comparing
+        /**
+            The function is an analog of \ref cds_intrusive_EllenBinTree_rcu_for_each_in_range "for_each_in_range(Q const&, Q const&, Func)"
+            but \p pred is used for key comparison.
+            \p Less functor has the interface like \p std::less and should meet \ref cds_intrusive_EllenBinTree_rcu_less
+            "Predicate requirements".
+            \p pred must imply the same element order as the comparator used for building the tree.
+        */
+        template <typename Q, typename Less, typename Func>
+        size_t for_each_in_range_with( Q const& lo, Q const& hi, Less pred, Func f ) const
+        {
+            CDS_UNUSED( pred );
+            typedef ellen_bintree::details::compare<
+                key_type,
+                value_type,
+                opt::details::make_comparator_from_less<Less>,
+                node_traits
+            > compare_functor;
+
+            return for_each_in_range_( lo, hi, compare_functor(), f );
+        }
+
         /// Checks if the tree is empty
         bool empty() const
         {
@@ -1529,6 +1582,74 @@ namespace cds { namespace intrusive {
             return nCmp == 0;
         }
 
+        template <typename KeyValue, typename Compare>
+        leaf_node * search_successor( KeyValue const& key, Compare cmp, bool bStrict ) const
+        {
+            // Finds the leftmost leaf with key >= key (bStrict == false) or with key > key (bStrict == true).
+            // If the leaf reached is less than key, the answer is the leftmost leaf of the right subtree
+            // of the last internal node where the search goes left
+            assert( gc::is_locked());
+
+            internal_node * pParent;
+            internal_node * pCandidate;
+            tree_node *     pLeaf;
+            update_ptr      updParent;
+            bool            bLeftmost;
+
+        retry:
+            pCandidate = nullptr;
+            bLeftmost = false;
+            pLeaf = const_cast<internal_node *>( &m_Root );
+            while ( true ) {
+                while ( pLeaf->is_internal()) {
+                    pParent = static_cast<internal_node *>( pLeaf );
+                    updParent = pParent->m_pUpdate.load( memory_model::memory_order_acquire );
+
+                    switch ( updParent.bits()) {
+                        case update_desc::DFlag:
+                        case update_desc::Mark:
+                            m_Stat.onSearchRetry();
+                            goto retry;
+                    }
+
+                    bool bRight = false;
+                    if ( !bLeftmost ) {
+                        bRight = cmp( key, *pParent ) >= 0;
+                        if ( !bRight )
+                            pCandidate = pParent;
+                    }
+                    pLeaf = pParent->get_child( bRight, memory_model::memory_order_acquire );
+                }
+
+                if ( bLeftmost )
+                    break;
+
+                int nCmp = cmp( key, *static_cast<leaf_node *>( pLeaf ));
+                if ( bStrict ? nCmp < 0 : nCmp <= 0 )
+                    break;
+
+                // All leaves of the left subtree of pCandidate are less than key
+                if ( !pCandidate )
+                    return nullptr;
+
+                updParent = pCandidate->m_pUpdate.load( memory_model::memory_order_acquire );
+                switch ( updParent.bits()) {
+                    case update_desc::DFlag:
+                    case update_desc::Mark:
+                        m_Stat.onSearchRetry();
+                        goto retry;
+                }
+
+                pLeaf = pCandidate->get_child( true, memory_model::memory_order_acquire );
+                bLeftmost = true;
+            }
+
+            assert( pLeaf->is_leaf());
+            if ( pLeaf->infinite_key())
+                return nullptr;
+            return static_cast<leaf_node *>( pLeaf );
+        }
+
         bool search_min( search_result& res ) const
         {
             assert( gc::is_locked());
@@ -1933,6 +2054,23 @@ namespace cds { namespace intrusive {
             return false;
         }
 
+        template <typename Q, typename Compare, typename Func>
+        size_t for_each_in_range_( Q const& lo, Q const& hi, Compare cmp, Func f ) const
+        {
+            size_t nCount = 0;
+
+            rcu_lock l;
+            for ( leaf_node * pLeaf = search_successor( lo, cmp, false );
+                  pLeaf && cmp( hi, *pLeaf ) > 0;
+                  pLeaf = search_successor( *node_traits::to_value_ptr( pLeaf ), node_compare(), true ))
+            {
+                f( *node_traits::to_value_ptr( pLeaf ));
+                ++nCount;
+            }
+
+            return nCount;
+        }
+
         template <typename Q, typename Compare>
         value_type * get_( Q const& key, Compare cmp ) const
         {
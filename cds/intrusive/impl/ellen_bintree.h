@@ -794,6 +794,56 @@ namespace cds { namespace intrusive {
             return get_with_( key, pred );
         }
 
+        /// Calls \p f for each item with key in range <tt>[lo, hi)</tt> in ascending key order
+        /** @anchor cds_intrusive_EllenBinTree_for_each_in_range
+            The function visits all items whose key is not less than \p lo and less than \p hi.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+
+            The items are streamed one by one: each next item is located by a separate descent from the root
+            for the smallest key greater than the key of the previous item, so the range is never copied.
+            The traversal is not atomic, but it is linearizable per key: every item passed to \p f
+            was in the tree when it was found, and the keys are strictly increasing.
+            Items inserted or deleted concurrently in the part of the range not yet visited may or may not be visited.
+
+            The functor can change non-key fields of \p item. The item is guarded during functor is executing,
+            so it cannot be disposed. The functor does not serialize simultaneous access to the tree \p item.
+            The functor must not call other member functions of the tree.
+
+            The function returns the number of items visited.
+        */
+        template <typename Q, typename Func>
+        size_t for_each_in_range( Q const& lo, Q const& hi, Func f ) const
+        {
+            return for_each_in_range_( lo, hi, node_compare(), f );
+        }
+
+        /// Calls \p f for each item with key in range <tt>[lo, hi)</tt> using \p pred for key comparing
+        /**
+            The function is an analog of \ref cds_intrusive_EllenBinTree_for_each_in_range "for_each_in_range(Q const&, Q const&, Func)"
+            but \p pred is used for key comparison.
+            \p Less functor has the interface like \p std::less and should meet \ref cds_intrusive_EllenBinTree_less
+            "Predicate requirements".
+            \p pred must imply the same element order as the comparator used for building the tree.
+        */
+        template <typename Q, typename Less, typename Func>
+        size_t for_each_in_range_with( Q const& lo, Q const& hi, Less pred, Func f ) const
+        {
+            CDS_UNUSED( pred );
+            typedef ellen_bintree::details::compare<
+                key_type,
+                value_type,
+                opt::details::make_comparator_from_less<Less>,
+                node_traits
+            > compare_functor;
+
+            return for_each_in_range_( lo, hi, compare_functor(), f );
+        }
+
         /// Checks if the tree is empty
         bool empty() const
         {
@@ -1014,6 +1064,87 @@ namespace cds { namespace intrusive {
             return nCmp == 0;
         }
 
+        template <typename KeyValue, typename Compare>
+        bool search_successor( search_result& res, KeyValue const& key, Compare cmp, bool bStrict ) const
+        {
+            // Finds the leftmost leaf with key >= key (bStrict == false) or with key > key (bStrict == true).
+            // The last internal node where the search goes left is kept in Guard_GrandParent:
+            // if the leaf reached is less than key, the answer is the leftmost leaf of its right subtree
+            internal_node * pParent;
+            internal_node * pCandidate;
+            update_ptr      updParent;
+            bool            bLeftmost;
+
+        retry:
+            pCandidate = nullptr;
+            bLeftmost = false;
+            tree_node * pLeaf = const_cast<internal_node *>( &m_Root );
+            while ( true ) {
+                while ( pLeaf->is_internal()) {
+                    res.guards.copy( search_result::Guard_Parent, search_result::Guard_Leaf );
+                    pParent = static_cast<internal_node *>( pLeaf );
+
+                    updParent = search_protect_update( res, pParent->m_pUpdate );
+
+                    switch ( updParent.bits()) {
+                        case update_desc::DFlag:
+                        case update_desc::Mark:
+                            m_Stat.onSearchRetry();
+                            goto retry;
+                    }
+
+                    bool bRight = false;
+                    if ( !bLeftmost ) {
+                        bRight = cmp( key, *pParent ) >= 0;
+                        if ( !bRight ) {
+                            res.guards.copy( search_result::Guard_GrandParent, search_result::Guard_Parent );
+                            pCandidate = pParent;
+                        }
+                    }
+
+                    pLeaf = protect_child_node( res, pParent, bRight, updParent );
+                    if ( !pLeaf ) {
+                        m_Stat.onSearchRetry();
+                        goto retry;
+                    }
+                }
+
+                if ( bLeftmost )
+                    break;
+
+                int nCmp = cmp( key, *static_cast<leaf_node *>( pLeaf ));
+                if ( bStrict ? nCmp < 0 : nCmp <= 0 )
+                    break;
+
+                // All leaves of the left subtree of pCandidate are less than key
+                if ( !pCandidate )
+                    return false;
+
+                res.guards.copy( search_result::Guard_Parent, search_result::Guard_GrandParent );
+                updParent = search_protect_update( res, pCandidate->m_pUpdate );
+                switch ( updParent.bits()) {
+                    case update_desc::DFlag:
+                    case update_desc::Mark:
+                        m_Stat.onSearchRetry();
+                        goto retry;
+                }
+
+                pLeaf = protect_child_node( res, pCandidate, true, updParent );
+                if ( !pLeaf ) {
+                    m_Stat.onSearchRetry();
+                    goto retry;
+                }
+                bLeftmost = true;
+            }
+
+            assert( pLeaf->is_leaf());
+            if ( pLeaf->infinite_key())
+                return false;
+
+            res.pLeaf = static_cast<leaf_node *>( pLeaf );
+            return true;
+        }
+
         bool search_min( search_result& res ) const
         {
             internal_node * pParent;
@@ -1551,6 +1682,30 @@ namespace cds { namespace intrusive {
             return false;
         }
 
+        template <typename Q, typename Compare, typename Func>
+        size_t for_each_in_range_( Q const& lo, Q const& hi, Compare cmp, Func f ) const
+        {
+            typename gc::Guard guard;
+            search_result   res;
+            size_t          nCount = 0;
+
+            if ( !search_successor( res, lo, cmp, false ))
+                return 0;
+
+            while ( cmp( hi, *res.pLeaf ) > 0 ) {
+                // The leaf is guarded by res.guards; keep it guarded while searching its successor
+                value_type * pVal = guard.assign( node_traits::to_value_ptr( res.pLeaf ));
+                f( *pVal );
+                ++nCount;
+
+                // The successor is searched by the item itself, so the tree's own comparator is used
+                if ( !search_successor( res, *pVal, node_compare(), true ))
+                    break;
+            }
+
+            return nCount;
+        }
+
         template <typename Q>
         guarded_ptr get_( Q const& val ) const
         {
@@ -31,6 +31,7 @@
 #ifndef CDSLIB_INTRUSIVE_IMPL_FELDMAN_HASHSET_H
 #define CDSLIB_INTRUSIVE_IMPL_FELDMAN_HASHSET_H
 
+#include <algorithm>    // std::fill
 #include <functional>   // std::ref
 #include <iterator>     // std::iterator_traits
 #include <vector>
@@ -145,6 +146,9 @@ namespace cds { namespace intrusive {
         /// Count of hazard pointers required
         static constexpr size_t const c_nHazardPtrCount = 2;
 
+        /// Max count of hashes searched simultaneously by \p find_batch()
+        static constexpr size_t const c_nBatchSize = 32;
+
         /// The size of hash_type in bytes, see \p feldman_hashset::traits::hash_size for explanation
         static constexpr size_t const c_hash_size = base_class::c_hash_size;
 
@@ -578,6 +582,11 @@ namespace cds { namespace intrusive {
             : base_class( head_bits, array_bits )
         {}
 
+        /// Creates empty set with the geometry \p g, see \p feldman_hashset::geometry::for_size()
+        explicit FeldmanHashSet( feldman_hashset::geometry const& g )
+            : base_class( g.head_bits, g.array_bits )
+        {}
+
         /// Destructs the set and frees all data
         ~FeldmanHashSet()
         {
@@ -868,6 +877,47 @@ namespace cds { namespace intrusive {
             return guarded_ptr();
         }
 
+        /// Finds a batch of hashes
+        /**
+            The function searches \p nCount hashes from the array \p pHashes and calls the functor \p f
+            for each item found. The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( size_t nIndex, value_type& item );
+            };
+            \endcode
+            where \p nIndex is the index of the hash in \p pHashes, \p item is the item found.
+            The functor is called in ascending order of \p nIndex; the same restrictions as for \p find() apply.
+
+            The result is the same as calling \p find() for each hash, but the trie walks of
+            up to \p c_nBatchSize hashes are interleaved: on each round every unfinished search goes one level down
+            and prefetches the slot of the next level, so the cache misses of different searches overlap.
+
+            The function returns the count of hashes found.
+        */
+        template <typename Func>
+        size_t find_batch( hash_type const* pHashes, size_t nCount, Func f )
+        {
+            size_t nFound = 0;
+            for ( size_t nStart = 0; nStart < nCount; nStart += c_nBatchSize ) {
+                size_t const nChunk = nCount - nStart < c_nBatchSize ? nCount - nStart : c_nBatchSize;
+                nFound += find_chunk( pHashes + nStart, nChunk, [&f, nStart]( size_t nIndex, value_type& item ) { f( nStart + nIndex, item ); } );
+            }
+            return nFound;
+        }
+
+        /// Checks whether the set contains a batch of hashes
+        /**
+            The function sets <tt>pResult[i]</tt> to \p true if the set contains <tt>pHashes[i]</tt>, \p false otherwise,
+            for \p i from 0 to \p nCount - 1. The function returns the count of hashes found.
+            See \p find_batch() for details.
+        */
+        size_t contains_batch( hash_type const* pHashes, size_t nCount, bool* pResult )
+        {
+            std::fill( pResult, pResult + nCount, false );
+            return find_batch( pHashes, nCount, [pResult]( size_t nIndex, value_type& ) { pResult[nIndex] = true; } );
+        }
+
         /// Clears the set (non-atomic)
         /**
             The function unlink all data node from the set.
@@ -881,6 +931,30 @@ namespace cds { namespace intrusive {
             clear_array( head(), head_size());
         }
 
+        /// Collapses sparse array nodes (not thread-safe)
+        /**
+            The multi-level array never shrinks by itself: after mass erasing the tree keeps
+            deep chains of almost empty array nodes that cost memory and levels visited per lookup.
+            The function walks the tree bottom-up and replaces each array node containing
+            at most one data node and no child array node by that data node (or by an empty slot).
+            A node with two or more items cannot be collapsed since their hashes are different
+            on that level.
+
+            The function is not thread-safe: no other thread may access the set
+            and no iterator may exist during the call. The array nodes are freed immediately,
+            without GC retirement, since the lookups do not guard the array nodes they pass.
+            The debug build asserts that no other operation is in progress or started during the call.
+
+            The set never collapses array nodes automatically: \p erase() leaves the array nodes in place,
+            call \p compact() explicitly at a quiescent point, for example, after mass erasing.
+
+            Returns the count of array nodes freed.
+        */
+        size_t compact()
+        {
+            return base_class::compact_tree();
+        }
+
         /// Checks if the set is empty
         /**
             Emptiness is checked by item counting: if item count is zero then the set is empty.
@@ -1088,6 +1162,78 @@ namespace cds { namespace intrusive {
 
     protected:
         //@cond
+        template <typename Func>
+        size_t find_chunk( hash_type const* pHashes, size_t nCount, Func f )
+        {
+            assert( nCount <= c_nBatchSize );
+
+            typedef typename std::aligned_storage< sizeof( traverse_data ), alignof( traverse_data )>::type traverse_data_storage;
+            traverse_data_storage posStorage[c_nBatchSize];
+            traverse_data* pos = reinterpret_cast<traverse_data*>( posStorage );
+            node_ptr slots[c_nBatchSize];
+            bool     bDone[c_nBatchSize];
+
+            for ( size_t i = 0; i < nCount; ++i ) {
+                new( pos + i ) traverse_data( pHashes[i], *this );
+                cds_prefetch( &pos[i].pArr->nodes[pos[i].nSlot] );
+                bDone[i] = false;
+            }
+
+            // Walk down all tries level by level
+            back_off bkoff;
+            for ( size_t nActive = nCount; nActive != 0; ) {
+                bool bProgress = false;
+                for ( size_t i = 0; i < nCount; ++i ) {
+                    if ( bDone[i] )
+                        continue;
+                    slots[i] = base_class::traverse_step( pos[i] );
+                    if ( slots[i].bits() == 0 ) {
+                        // data node; it may be retired already but prefetch is harmless
+                        if ( slots[i].ptr())
+                            cds_prefetch( slots[i].ptr());
+                        bDone[i] = true;
+                        --nActive;
+                        bProgress = true;
+                    }
+                    else if ( slots[i].bits() == base_class::flag_array_node )
+                        bProgress = true;
+                }
+                if ( !bProgress )
+                    bkoff();    // all remaining slots are converting to array nodes
+            }
+
+            // Check the data nodes found
+            hash_comparator cmp;
+            typename gc::Guard guard;
+            size_t nFound = 0;
+            for ( size_t i = 0; i < nCount; ++i ) {
+                value_type * p;
+                if ( guard.protect( pos[i].pArr->nodes[pos[i].nSlot], []( node_ptr ptr ) -> value_type* { return ptr.ptr(); }) != slots[i] ) {
+                    // slot value has been changed - search again
+                    stats().onSlotChanged();
+                    p = search( pHashes[i], guard );
+                }
+                else if ( slots[i].ptr() && cmp( pHashes[i], hash_accessor()( *slots[i].ptr())) == 0 ) {
+                    stats().onFindSuccess();
+                    p = slots[i].ptr();
+                }
+                else {
+                    stats().onFindFailed();
+                    p = nullptr;
+                }
+
+                // p is guarded by HP
+                if ( p ) {
+                    f( i, *p );
+                    ++nFound;
+                }
+            }
+
+            for ( size_t i = 0; i < nCount; ++i )
+                pos[i].~traverse_data();
+            return nFound;
+        }
+
         value_type * search( hash_type const& hash, typename gc::Guard& guard )
         {
             traverse_data pos( hash, *this );
@@ -1177,6 +1177,18 @@ namespace cds { namespace intrusive {
             clear();
         }
 
+        // Resizable MichaelHashMap support
+        // Calls f( value_type& ) for each item that is not marked as deleted.
+        // The list must be frozen: only unlinking of the items already marked may be done concurrently.
+        // The traversal helps to unlink the marked items and restarts if the helping fails,
+        // so an item may be visited more than once.
+        template <typename Func>
+        void scan_frozen_at( atomic_node_ptr& refHead, Func f )
+        {
+            position pos;
+            search( refHead, 0, pos, [&f]( value_type& item, int ) -> int { f( item ); return -1; });
+        }
+
         //@endcond
 
     protected:
@@ -403,13 +403,7 @@ namespace cds { namespace intrusive {
 
     protected:
         //@cond
-        typedef skip_list::details::intrusive_node_builder< node_type, atomic_node_ptr, allocator_type > intrusive_node_builder;
-
-        typedef typename std::conditional<
-            std::is_same< typename traits::internal_node_builder, cds::opt::none >::value
-            ,intrusive_node_builder
-            ,typename traits::internal_node_builder
-        >::type node_builder;
+        typedef typename skip_list::details::select_node_builder< traits, node_type, atomic_node_ptr, allocator_type >::type node_builder;
 
         typedef std::unique_ptr< node_type, typename node_builder::node_disposer > scoped_node_ptr;
 
@@ -606,6 +600,51 @@ namespace cds { namespace intrusive {
             }
         }
 
+        /// Inserts a sorted range of items
+        /**
+            The function inserts the items of range <tt>[itFirst, itLast)</tt> that are not in the set yet.
+            \p Iterator dereferencing should produce \p value_type&.
+
+            The function is intended for bulk loading of the set and for merging
+            a sorted batch into populated set. If the range is sorted in ascending order
+            of the keys, the search for the insert position of each item starts from the predecessors of the previous item
+            (a finger search) instead of the head of the skip-list. Loading a sorted range into the empty set takes
+            expected <tt>O(N)</tt> time instead of <tt>O(N log N)</tt> for \p insert() calls; merging costs
+            about <tt>O(log D)</tt> per item where \p D is the distance from the previous item.
+            The range may be unsorted: an item that is less than the previous one is searched from the head.
+
+            The function is thread-safe: several threads can load disjoint key ranges concurrently,
+            and the set can be modified by other threads while loading.
+
+            The items that have not been inserted (their keys are already in the set) are not changed,
+            the caller is responsible for them.
+
+            Returns the count of items inserted.
+        */
+        template <typename Iterator>
+        size_t insert_sorted( Iterator itFirst, Iterator itLast )
+        {
+            return insert_sorted( itFirst, itLast, []( value_type& ) {} );
+        }
+
+        /// Inserts a sorted range of items
+        /**
+            The function is similar to \p insert_sorted( Iterator, Iterator ) but calls \p f
+            for each item inserted, see \p insert( value_type&, Func ).
+        */
+        template <typename Iterator, typename Func>
+        size_t insert_sorted( Iterator itFirst, Iterator itLast, Func f )
+        {
+            position pos;
+            bool bFinger = false;
+            size_t nCount = 0;
+            for ( ; itFirst != itLast; ++itFirst ) {
+                if ( insert_at_finger( *itFirst, pos, bFinger, f ))
+                    ++nCount;
+            }
+            return nCount;
+        }
+
         /// Updates the node
         /**
             The operation performs inserting or changing data with lock-free manner.
@@ -1336,6 +1375,137 @@ namespace cds { namespace intrusive {
             return ( pos.pCur = pCur.ptr()) != nullptr;
         }
 
+        // Finger search: finds the position of val starting from pos.pPrev[] found for the previous key less than val.
+        // pos.pPrev[nLevel] is not before pos.pPrev[nLevel + 1] in the list, so on each level the search starts
+        // from pos.pPrev[nLevel] until the search has moved forward on an upper level.
+        // If a start node is deleted the search is repeated from the head
+        bool find_position_from( value_type const& val, position& pos )
+        {
+            node_type * pPred = m_Head.head();
+            marked_node_ptr pSucc;
+            marked_node_ptr pCur;
+            key_comparator cmp;
+            int nCmp = 1;
+            bool bMoved = false;
+
+            // Hazard pointer array:
+            //  pPred: [nLevel * 2]
+            //  pSucc: [nLevel * 2 + 1]
+            // pos.pPrev[nLevel] is guarded by [nLevel * 2]
+
+            for ( int nLevel = static_cast<int>( c_nMaxHeight - 1 ); nLevel >= 0; --nLevel ) {
+                if ( bMoved )
+                    pos.guards.assign( nLevel * 2, node_traits::to_value_ptr( pPred ));
+                else
+                    pPred = pos.pPrev[nLevel];
+
+                while ( true ) {
+                    pCur = pPred->next( nLevel ).load( memory_model::memory_order_acquire );
+                    if ( pCur.all() == nullptr ) {
+                        // end of list at level nLevel
+                        break;
+                    }
+
+                    pCur = pos.guards.protect( nLevel * 2 + 1, pPred->next( nLevel ), gc_protect );
+                    if ( pCur.bits()) {
+                        // pPred is logically deleted
+                        m_Stat.onFingerRestart();
+                        return find_position( val, pos, cmp, false );
+                    }
+
+                    if ( pCur.ptr() == nullptr )
+                        break;
+
+                    pSucc = pCur->next( nLevel ).load( memory_model::memory_order_acquire );
+
+                    if ( pPred->next( nLevel ).load( memory_model::memory_order_acquire ).all() != pCur.ptr()) {
+                        m_Stat.onFingerRestart();
+                        return find_position( val, pos, cmp, false );
+                    }
+
+                    if ( pSucc.bits()) {
+                        // pCur is logically deleted
+                        help_remove( nLevel, pPred, pCur );
+                        m_Stat.onFingerRestart();
+                        return find_position( val, pos, cmp, false );
+                    }
+
+                    nCmp = cmp( *node_traits::to_value_ptr( pCur.ptr()), val );
+                    if ( nCmp < 0 ) {
+                        pPred = pCur.ptr();
+                        pos.guards.copy( nLevel * 2, nLevel * 2 + 1 );   // pPrev guard := cur guard
+                        bMoved = true;
+                    }
+                    else
+                        break;
+                }
+
+                pos.pPrev[nLevel] = pPred;
+                pos.pSucc[nLevel] = pCur.ptr();
+            }
+
+            pos.pCur = pCur.ptr();
+            return pCur.ptr() && nCmp == 0;
+        }
+
+        // Inserts val using finger search from pos if bFinger is true.
+        // On return pos.pPrev[] contains the predecessors of val at all levels (or val itself), so pos is a finger for the next key
+        template <typename Func>
+        bool insert_at_finger( value_type& val, position& pos, bool& bFinger, Func f )
+        {
+            typename gc::Guard gNew;
+            gNew.assign( &val );
+
+            node_type * pNode = node_traits::to_node_ptr( val );
+            scoped_node_ptr scp( pNode );
+            unsigned int nHeight = pNode->height();
+            bool bTowerOk = pNode->has_tower();
+            bool bTowerMade = false;
+
+            // The finger is useful only if the previous key is less than val
+            if ( bFinger && pos.pPrev[0] != m_Head.head() && key_comparator()( *node_traits::to_value_ptr( pos.pPrev[0] ), val ) >= 0 )
+                bFinger = false;
+
+            while ( true )
+            {
+                bool bFound = bFinger ? find_position_from( val, pos ) : find_position( val, pos, key_comparator(), false );
+                bFinger = true;
+
+                if ( bFound ) {
+                    if ( !bTowerMade )
+                        scp.release();
+
+                    m_Stat.onInsertFailed();
+                    return false;
+                }
+
+                if ( !bTowerOk ) {
+                    build_node( pNode );
+                    nHeight = pNode->height();
+                    bTowerMade = pNode->has_tower();
+                    bTowerOk = true;
+                }
+
+                if ( !insert_at_position( val, pNode, pos, f )) {
+                    m_Stat.onInsertRetry();
+                    continue;
+                }
+
+                // The new node is the predecessor of the next key at its levels
+                for ( unsigned int nLevel = 0; nLevel < nHeight; ++nLevel ) {
+                    pos.pPrev[nLevel] = pNode;
+                    pos.guards.assign( nLevel * 2, &val );
+                }
+
+                increase_height( nHeight );
+                ++m_ItemCounter;
+                m_Stat.onAddNode( nHeight );
+                m_Stat.onInsertSuccess();
+                scp.release();
+                return true;
+            }
+        }
+
         bool renew_insert_position( value_type& val, node_type * pNode, position& pos )
         {
             node_type * pPred;
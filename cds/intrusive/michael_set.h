@@ -36,6 +36,191 @@
 
 namespace cds { namespace intrusive {
 
+    //@cond
+    template <class GC, typename T, class Traits>
+    class MichaelList;
+
+    namespace michael_set { namespace details {
+
+        // Cache-line bucket for MichaelList
+        template <class GC, typename T, class Traits, typename Hash>
+        class alignas( cds::c_nCacheLineSize ) tagged_bucket< cds::intrusive::MichaelList< GC, T, Traits >, Hash >
+            : public cds::intrusive::MichaelList< GC, T, Traits >
+        {
+            typedef cds::intrusive::MichaelList< GC, T, Traits > base_class;
+
+        public:
+            typedef typename base_class::gc             gc;
+            typedef typename base_class::value_type     value_type;
+            typedef typename base_class::key_comparator key_comparator;
+            typedef typename base_class::guarded_ptr    guarded_ptr;
+
+        protected:
+            typedef typename base_class::node_traits     node_traits;
+            typedef typename base_class::marked_node_ptr marked_node_ptr;
+            typedef michael_set::details::tag_array< gc, value_type, sizeof( base_class ) > tag_array;
+
+            tag_array m_Tags;
+
+        public:
+            tagged_bucket()
+            {}
+
+            template <typename Stat>
+            explicit tagged_bucket( Stat& st )
+                : base_class( st )
+            {}
+
+            bool unlink( value_type& val )
+            {
+                typename gc::Guard guard;
+                guard.assign( &val );
+                if ( base_class::unlink( val )) {
+                    m_Tags.erase( &val );
+                    return true;
+                }
+                return false;
+            }
+
+            template <typename Q>
+            bool erase( Q const& key )
+            {
+                return erase( key, []( value_type& ) {} );
+            }
+
+            template <typename Q, typename Less>
+            bool erase_with( Q const& key, Less pred )
+            {
+                return erase_with( key, pred, []( value_type& ) {} );
+            }
+
+            template <typename Q, typename Func>
+            bool erase( Q const& key, Func f )
+            {
+                // The functor is called while the node is guarded
+                return base_class::erase( key, [this, &f]( value_type& val ) {
+                    m_Tags.erase( &val );
+                    f( val );
+                });
+            }
+
+            template <typename Q, typename Less, typename Func>
+            bool erase_with( Q const& key, Less pred, Func f )
+            {
+                return base_class::erase_with( key, pred, [this, &f]( value_type& val ) {
+                    m_Tags.erase( &val );
+                    f( val );
+                });
+            }
+
+            template <typename Q>
+            guarded_ptr extract( Q const& key )
+            {
+                guarded_ptr gp( base_class::extract( key ));
+                if ( gp )
+                    m_Tags.erase( &*gp );
+                return gp;
+            }
+
+            template <typename Q, typename Less>
+            guarded_ptr extract_with( Q const& key, Less pred )
+            {
+                guarded_ptr gp( base_class::extract_with( key, pred ));
+                if ( gp )
+                    m_Tags.erase( &*gp );
+                return gp;
+            }
+
+            template <typename Q, typename Func>
+            bool find( Q& key, Func f )
+            {
+                return find_( key, f );
+            }
+
+            template <typename Q, typename Func>
+            bool find( Q const& key, Func f )
+            {
+                return find_( key, f );
+            }
+
+            template <typename Q, typename Less, typename Func>
+            bool find_with( Q& key, Less pred, Func f )
+            {
+                return base_class::find_with( key, pred, f );
+            }
+
+            template <typename Q, typename Less, typename Func>
+            bool find_with( Q const& key, Less pred, Func f )
+            {
+                return base_class::find_with( key, pred, f );
+            }
+
+            template <typename Q>
+            bool contains( Q const& key )
+            {
+                return !get( key ).empty();
+            }
+
+            template <typename Q, typename Less>
+            bool contains( Q const& key, Less pred )
+            {
+                return base_class::contains( key, pred );
+            }
+
+            template <typename Q>
+            guarded_ptr get( Q const& key )
+            {
+                uint8_t const nTag = tag_array::fingerprint( Hash()( key ));
+                {
+                    typename gc::Guard guard;
+                    if ( m_Tags.find( guard, nTag, [&key]( value_type& val ) { return !is_marked( val ) && key_comparator()( val, key ) == 0; } )) {
+                        base_class::m_Stat.onFindSuccess();
+                        return guarded_ptr( std::move( guard ));
+                    }
+                }
+
+                guarded_ptr gp( base_class::get( key ));
+                if ( gp )
+                    m_Tags.publish( &*gp, nTag, &is_marked );
+                return gp;
+            }
+
+            void clear()
+            {
+                typename gc::Guard guard;
+                while ( true ) {
+                    marked_node_ptr head = guard.protect( base_class::m_pHead, []( marked_node_ptr p ) -> value_type* {
+                        return node_traits::to_value_ptr( p.ptr());
+                    });
+                    if ( head.ptr() == nullptr )
+                        break;
+
+                    value_type& val = *node_traits::to_value_ptr( *head.ptr());
+                    if ( base_class::unlink( val ))
+                        m_Tags.erase( &val );
+                }
+            }
+
+        protected:
+            static bool is_marked( value_type& val )
+            {
+                return node_traits::to_node_ptr( val )->m_pNext.load( atomics::memory_order_acquire ).bits() != 0;
+            }
+
+            template <typename Q, typename Func>
+            bool find_( Q& key, Func f )
+            {
+                guarded_ptr gp( get( key ));
+                if ( gp ) {
+                    f( *gp, key );
+                    return true;
+                }
+                return false;
+            }
+        };
+    }} // namespace michael_set::details
+    //@endcond
+
     /// Michael's hash set
     /** @ingroup cds_intrusive_map
         \anchor cds_intrusive_MichaelHashSet_hp
@@ -275,12 +460,16 @@ namespace cds { namespace intrusive {
         //@cond
         typedef typename ordered_list::template select_stat_wrapper< typename ordered_list::stat > bucket_stat;
 
-        typedef typename ordered_list::template rebind_traits<
-            cds::opt::item_counter< cds::atomicity::empty_item_counter >
-            , cds::opt::stat< typename bucket_stat::wrapped_stat >
+        typedef typename michael_set::details::bucket_type_selector<
+            typename ordered_list::template rebind_traits<
+                cds::opt::item_counter< cds::atomicity::empty_item_counter >
+                , cds::opt::stat< typename bucket_stat::wrapped_stat >
+            >::type
+            , hash
+            , traits::cache_line_bucket
         >::type internal_bucket_type;
 
-        typedef typename allocator::template rebind< internal_bucket_type >::other bucket_table_allocator;
+        typedef michael_set::details::bucket_table_allocator< internal_bucket_type, allocator > bucket_table_allocator;
         //@endcond
 
     public:
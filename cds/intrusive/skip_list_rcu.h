@@ -556,13 +556,7 @@ namespace cds { namespace intrusive {
 
     protected:
         //@cond
-        typedef skip_list::details::intrusive_node_builder< node_type, atomic_node_ptr, allocator_type > intrusive_node_builder;
-
-        typedef typename std::conditional<
-            std::is_same< typename traits::internal_node_builder, cds::opt::none >::value
-            ,intrusive_node_builder
-            ,typename traits::internal_node_builder
-        >::type node_builder;
+        typedef typename skip_list::details::select_node_builder< traits, node_type, atomic_node_ptr, allocator_type >::type node_builder;
 
         typedef std::unique_ptr< node_type, typename node_builder::node_disposer >    scoped_node_ptr;
 
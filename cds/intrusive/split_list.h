@@ -296,8 +296,13 @@ namespace cds { namespace intrusive {
             , opt::allocator< typename traits::allocator >
             , opt::memory_model< memory_model >
             , opt::free_list< typename traits::free_list >
+            , split_list::skip_pointers< traits::skip_pointers >
         >::type bucket_table;
 
+        /// Count of skip pointers in auxiliary node, see \p split_list::traits::skip_pointers
+        static constexpr const size_t c_nSkipCount = traits::skip_pointers;
+        typedef std::integral_constant< bool, c_nSkipCount != 0 > skip_enabled;
+
         typedef typename bucket_table::aux_node_type aux_node_type;   ///< auxiliary node type
         //@endcond
 
@@ -556,7 +561,7 @@ namespace cds { namespace intrusive {
             size_t nItemCount           ///< estimate average of item count
             , size_t nLoadFactor = 1    ///< load factor - average item count per bucket. Small integer up to 8, default is 1.
             )
-            : m_Buckets( nItemCount, nLoadFactor )
+            : m_Buckets( c_nSkipCount ? nItemCount * c_nSkipCount : nItemCount, nLoadFactor )
             , m_nBucketCountLog2(1)
             , m_nMaxItemCount( max_item_count(2, m_Buckets.load_factor()))
         {
@@ -587,7 +592,7 @@ namespace cds { namespace intrusive {
         bool insert( value_type& val )
         {
             size_t nHash = hash_value( val );
-            aux_node_type * pHead = get_bucket( nHash );
+            aux_node_type * pHead = get_search_head( nHash );
             assert( pHead != nullptr );
 
             node_traits::to_node_ptr( val )->m_nHash = split_list::regular_hash<bit_reversal>( nHash );
@@ -625,7 +630,7 @@ namespace cds { namespace intrusive {
         bool insert( value_type& val, Func f )
         {
             size_t nHash = hash_value( val );
-            aux_node_type * pHead = get_bucket( nHash );
+            aux_node_type * pHead = get_search_head( nHash );
             assert( pHead != nullptr );
 
             node_traits::to_node_ptr( val )->m_nHash = split_list::regular_hash<bit_reversal>( nHash );
@@ -683,7 +688,7 @@ namespace cds { namespace intrusive {
         std::pair<bool, bool> update( value_type& val, Func func, bool bAllowInsert = true )
         {
             size_t nHash = hash_value( val );
-            aux_node_type * pHead = get_bucket( nHash );
+            aux_node_type * pHead = get_search_head( nHash );
             assert( pHead != nullptr );
 
             node_traits::to_node_ptr( val )->m_nHash = split_list::regular_hash<bit_reversal>( nHash );
@@ -730,7 +735,7 @@ namespace cds { namespace intrusive {
 #endif
         {
             size_t nHash = hash_value( val );
-            aux_node_type * pHead = get_bucket( nHash );
+            aux_node_type * pHead = get_search_head( nHash );
             assert( pHead != nullptr );
 
             node_traits::to_node_ptr( val )->m_nHash = split_list::regular_hash<bit_reversal>( nHash );
@@ -760,7 +765,7 @@ namespace cds { namespace intrusive {
         bool unlink( value_type& val )
         {
             size_t nHash = hash_value( val );
-            aux_node_type * pHead = get_bucket( nHash );
+            aux_node_type * pHead = get_search_head( nHash );
             assert( pHead != nullptr );
 
             if ( m_List.unlink_at( pHead, val )) {
@@ -1269,6 +1274,83 @@ namespace cds { namespace intrusive {
             return pHead;
         }
 
+        // Returns the node to start the search of \p nHash from: the bucket head or the farthest valid skip target
+        aux_node_type * get_search_head( size_t nHash )
+        {
+            size_t nShift;
+            return get_search_head( nHash, nShift );
+        }
+
+        aux_node_type * get_search_head( size_t nHash, size_t& nShift )
+        {
+            nShift = m_nBucketCountLog2.load( memory_model::memory_order_relaxed );
+            return skip_forward( get_bucket( nHash ), nHash, nShift, skip_enabled());
+        }
+
+        aux_node_type * skip_forward( aux_node_type * pHead, size_t /*nHash*/, size_t& /*nShift*/, std::false_type )
+        {
+            return pHead;
+        }
+
+        aux_node_type * skip_forward( aux_node_type * pHead, size_t nHash, size_t& nShift, std::true_type )
+        {
+            size_t const nSkipLog2 = bitop::MSBnz( c_nSkipCount );
+            size_t const nKey = split_list::regular_hash<bit_reversal>( nHash );
+
+            // Any auxiliary node preceding the key in split order is a valid start of the search:
+            // aux nodes are never removed from the list
+            while ( nShift < sizeof( size_t ) * 8 ) {
+                aux_node_type * pSkip = pHead->m_arrSkip[( nHash >> nShift ) & ( c_nSkipCount - 1 )].load( memory_model::memory_order_acquire );
+                if ( pSkip == nullptr || pSkip->m_nHash <= pHead->m_nHash || pSkip->m_nHash >= nKey )
+                    break;
+                m_Stat.onSkipHit();
+                pHead = pSkip;
+                nShift += nSkipLog2;
+            }
+            return pHead;
+        }
+
+        void on_lookup( aux_node_type * pHead, size_t nShift, size_t nHash, size_t nTraversed )
+        {
+            m_Stat.onLookupTraversed( nTraversed );
+            if ( nTraversed > 2 * c_nSkipCount )
+                set_skip( pHead, nShift, nHash, skip_enabled());
+        }
+
+        void set_skip( aux_node_type * /*pHead*/, size_t /*nShift*/, size_t /*nHash*/, std::false_type )
+        {}
+
+        void set_skip( aux_node_type * pHead, size_t nShift, size_t nHash, std::true_type )
+        {
+            // The lookup started from pHead has been too long:
+            // make the bucket of the next nSkipLog2 hash bits the skip target of pHead
+            size_t const nSkipLog2 = bitop::MSBnz( c_nSkipCount );
+            if ( nShift + nSkipLog2 >= sizeof( size_t ) * 8 )
+                return;
+
+            size_t const nTarget = nHash & (( static_cast<size_t>( 1 ) << ( nShift + nSkipLog2 )) - 1 );
+            if ( nTarget >= m_Buckets.capacity())
+                return;
+
+            aux_node_type * pTarget = m_Buckets.bucket( nTarget );
+            if ( pTarget == nullptr )
+                pTarget = init_bucket( nTarget );
+            if ( pTarget->m_nHash <= pHead->m_nHash )
+                return;
+
+            auto& slot = pHead->m_arrSkip[( nHash >> nShift ) & ( c_nSkipCount - 1 )];
+            if ( slot.load( memory_model::memory_order_relaxed ) != pTarget ) {
+                slot.store( pTarget, memory_model::memory_order_release );
+                m_Stat.onSkipCreated();
+            }
+        }
+
+        // Max bucket count reachable by regular growth; the rest of the table is reserved for skip targets
+        size_t bucket_capacity() const
+        {
+            return c_nSkipCount ? m_Buckets.capacity() / c_nSkipCount : m_Buckets.capacity();
+        }
+
         void init()
         {
             // GC and OrderedList::gc must be the same
@@ -1301,7 +1383,7 @@ namespace cds { namespace intrusive {
 
             size_t sz = m_nBucketCountLog2.load( memory_model::memory_order_relaxed );
             const size_t nBucketCount = static_cast<size_t>(1) << sz;
-            if ( nBucketCount < m_Buckets.capacity()) {
+            if ( nBucketCount < bucket_capacity()) {
                 // we may grow the bucket table
                 const size_t nLoadFactor = m_Buckets.load_factor();
                 if ( nMaxCount < max_item_count( nBucketCount, nLoadFactor ))
@@ -1320,13 +1402,15 @@ namespace cds { namespace intrusive {
         {
             size_t nHash = hash_value( val );
             split_list::details::search_value_type<Q>  sv( val, split_list::regular_hash<bit_reversal>( nHash ));
-            aux_node_type * pHead = get_bucket( nHash );
+            size_t nShift;
+            aux_node_type * pHead = get_search_head( nHash, nShift );
             assert( pHead != nullptr );
 
-            return m_Stat.onFind(
-                m_List.find_at( pHead, sv, cmp,
-                    [&f]( value_type& item, split_list::details::search_value_type<Q>& v ) { f( item, v.val ); } )
-            );
+            size_t nTraversed = 0;
+            bool const bFound = m_List.find_at( pHead, sv, split_list::details::counting_compare<Compare>( cmp, nTraversed ),
+                [&f]( value_type& item, split_list::details::search_value_type<Q>& v ) { f( item, v.val ); } );
+            on_lookup( pHead, nShift, nHash, nTraversed );
+            return m_Stat.onFind( bFound );
         }
 
         template <typename Q, typename Compare>
@@ -1334,10 +1418,14 @@ namespace cds { namespace intrusive {
         {
             size_t nHash = hash_value( val );
             split_list::details::search_value_type<Q const>  sv( val, split_list::regular_hash<bit_reversal>( nHash ));
-            aux_node_type * pHead = get_bucket( nHash );
+            size_t nShift;
+            aux_node_type * pHead = get_search_head( nHash, nShift );
             assert( pHead != nullptr );
 
-            return m_Stat.onFind( m_List.find_at( pHead, sv, cmp ));
+            size_t nTraversed = 0;
+            bool const bFound = m_List.find_at( pHead, sv, split_list::details::counting_compare<Compare>( cmp, nTraversed ));
+            on_lookup( pHead, nShift, nHash, nTraversed );
+            return m_Stat.onFind( bFound );
         }
 
         template <typename Q, typename Compare>
@@ -1345,7 +1433,7 @@ namespace cds { namespace intrusive {
         {
             size_t nHash = hash_value( val );
             split_list::details::search_value_type<Q const>  sv( val, split_list::regular_hash<bit_reversal>( nHash ));
-            aux_node_type * pHead = get_bucket( nHash );
+            aux_node_type * pHead = get_search_head( nHash );
             assert( pHead != nullptr );
 
             return iterator( m_List.find_iterator_at( pHead, sv, cmp ), m_List.end());
@@ -1356,10 +1444,13 @@ namespace cds { namespace intrusive {
         {
             size_t nHash = hash_value( val );
             split_list::details::search_value_type<Q const>  sv( val, split_list::regular_hash<bit_reversal>( nHash ));
-            aux_node_type * pHead = get_bucket( nHash );
+            size_t nShift;
+            aux_node_type * pHead = get_search_head( nHash, nShift );
             assert( pHead != nullptr );
 
-            guarded_ptr gp = m_List.get_at( pHead, sv, cmp );
+            size_t nTraversed = 0;
+            guarded_ptr gp = m_List.get_at( pHead, sv, split_list::details::counting_compare<Compare>( cmp, nTraversed ));
+            on_lookup( pHead, nShift, nHash, nTraversed );
             m_Stat.onFind( !gp.empty());
             return gp;
         }
@@ -1381,7 +1472,7 @@ namespace cds { namespace intrusive {
         {
             size_t nHash = hash_value( val );
             split_list::details::search_value_type<Q const>  sv( val, split_list::regular_hash<bit_reversal>( nHash ));
-            aux_node_type * pHead = get_bucket( nHash );
+            aux_node_type * pHead = get_search_head( nHash );
             assert( pHead != nullptr );
 
             if ( m_List.erase_at( pHead, sv, cmp, f )) {
@@ -1398,7 +1489,7 @@ namespace cds { namespace intrusive {
         {
             size_t nHash = hash_value( val );
             split_list::details::search_value_type<Q const>  sv( val, split_list::regular_hash<bit_reversal>( nHash ));
-            aux_node_type * pHead = get_bucket( nHash );
+            aux_node_type * pHead = get_search_head( nHash );
             assert( pHead != nullptr );
 
             if ( m_List.erase_at( pHead, sv, cmp )) {
@@ -1415,7 +1506,7 @@ namespace cds { namespace intrusive {
         {
             size_t nHash = hash_value( val );
             split_list::details::search_value_type<Q const> sv( val, split_list::regular_hash<bit_reversal>( nHash ));
-            aux_node_type * pHead = get_bucket( nHash );
+            aux_node_type * pHead = get_search_head( nHash );
             assert( pHead != nullptr );
 
             guarded_ptr gp = m_List.extract_at( pHead, sv, cmp );
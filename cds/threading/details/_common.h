@@ -33,6 +33,7 @@
 
 #include <cds/urcu/details/gp_decl.h>
 #include <cds/urcu/details/sh_decl.h>
+#include <cds/urcu/details/mb_decl.h>
 #include <cds/algo/elimination_tls.h>
 
 namespace cds {
@@ -137,6 +138,9 @@ namespace cds {
 #ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
             cds::urcu::details::thread_data< cds::urcu::signal_buffered_tag > *    m_pSHBRCU;
 #endif
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+            cds::urcu::details::thread_data< cds::urcu::general_membarrier_tag > * m_pGPMRCU;
+#endif
 
             //@endcond
 
@@ -161,6 +165,9 @@ namespace cds {
                 , m_pGPTRCU( nullptr )
 #ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
                 , m_pSHBRCU( nullptr )
+#endif
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+                , m_pGPMRCU( nullptr )
 #endif
                 , m_nFakeProcessorNumber( s_nLastUsedProcNo.fetch_add(1, atomics::memory_order_relaxed) % s_nProcCount )
                 , m_nAttachCount(0)
@@ -173,6 +180,9 @@ namespace cds {
                 assert( m_pGPTRCU == nullptr );
 #ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
                 assert( m_pSHBRCU == nullptr );
+#endif
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+                assert( m_pGPMRCU == nullptr );
 #endif
             }
 
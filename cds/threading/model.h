@@ -70,6 +70,13 @@ namespace cds { namespace threading {
         return p ? p->m_pSHBRCU : nullptr;
     }
 #endif
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+    template<>
+    inline cds::urcu::details::thread_data<cds::urcu::general_membarrier_tag> * getRCU<cds::urcu::general_membarrier_tag>()
+    {
+        return Manager::thread_data()->m_pGPMRCU;
+    }
+#endif
 
     static inline cds::algo::elimination::record& elimination_record()
     {
@@ -33,8 +33,11 @@
 
 #include <cds/algo/atomic.h>
 #include <cds/gc/details/retired_ptr.h>
+#include <cds/gc/details/telemetry.h>
 #include <cds/details/allocator.h>
 #include <cds/os/thread.h>
+#include <mutex>    // unique_lock
+#include <cds/sync/spinlock.h>
 #include <cds/details/marked_ptr.h>
 
 namespace cds {
@@ -111,8 +114,11 @@ namespace cds {
           %RCU: \ref general_instant, \ref general_buffered, \ref general_threaded.
         - \p signal_buffered: the signal-handling %RCU presents an implementation having low read-side overhead and
           requiring only that the application give up one POSIX signal to %RCU update processing.
+        - \p general_membarrier: like the signal-handling %RCU, the readers have no memory fences,
+          but the writer forces memory barriers on the reader threads by Linux \p membarrier() system call.
 
         @note The signal-handled %RCU is defined only for UNIX-like systems, not for Windows.
+        The membarrier-based %RCU is defined only for Linux.
 
         @anchor cds_urcu_type
         <b>RCU implementation type</b>
@@ -122,6 +128,7 @@ namespace cds {
         - \ref general_buffered - general purpose RCU with deferred (buffered) reclamation
         - \ref general_threaded - general purpose RCU with special reclamation thread
         - \ref signal_buffered - signal-handling RCU with deferred (buffered) reclamation
+        - \ref general_membarrier - membarrier-based RCU with deferred (buffered) reclamation
 
         You cannot create an object of any of those classes directly.
         Instead, you should use wrapper classes.
@@ -139,6 +146,8 @@ namespace cds {
             include file <tt><cds/urcu/general_threaded.h></tt>
         - \ref cds_urcu_signal_buffered_gc "gc<signal_buffered>" - signal-handling RCU with deferred (buffered) reclamation
             include file <tt><cds/urcu/signal_buffered.h></tt>
+        - \ref cds_urcu_general_membarrier_gc "gc<general_membarrier>" - membarrier-based RCU with deferred (buffered) reclamation
+            include file <tt><cds/urcu/general_membarrier.h></tt>
 
         Any RCU-related container in \p libcds expects that its \p RCU template parameter is one of those wrapper.
 
@@ -149,6 +158,7 @@ namespace cds {
         - \ref general_buffered_tag - for \ref general_buffered
         - \ref general_threaded_tag - for \ref general_threaded
         - \ref signal_buffered_tag - for \ref signal_buffered
+        - \ref general_membarrier_tag - for \ref general_membarrier
 
         @anchor cds_urcu_performance
         <b>Performance</b>
@@ -223,6 +233,9 @@ namespace cds {
 
 #   if (CDS_OS_INTERFACE == CDS_OSI_UNIX || defined(CDS_DOXYGEN_INVOKED)) && !defined(CDS_THREAD_SANITIZER_ENABLED)
 #       define CDS_URCU_SIGNAL_HANDLING_ENABLED 1
+#   endif
+#   if (CDS_OS_TYPE == CDS_OS_LINUX || defined(CDS_DOXYGEN_INVOKED)) && !defined(CDS_THREAD_SANITIZER_ENABLED)
+#       define CDS_URCU_MEMBARRIER_ENABLED 1
 #   endif
 
         /// General-purpose URCU type
@@ -259,6 +272,16 @@ namespace cds {
             typedef general_purpose_rcu     rcu_class ; ///< The URCU type
         };
 
+#   ifdef CDS_URCU_MEMBARRIER_ENABLED
+        /// Membarrier-based URCU type
+        struct membarrier_rcu {
+            //@cond
+            static uint32_t const c_nControlBit = 0x80000000;
+            static uint32_t const c_nNestMask   = c_nControlBit - 1;
+            //@endcond
+        };
+#   endif
+
 #   ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
         /// Tag for signal_buffered URCU
         struct signal_buffered_tag: public signal_handling_rcu {
@@ -266,6 +289,13 @@ namespace cds {
         };
 #   endif
 
+#   ifdef CDS_URCU_MEMBARRIER_ENABLED
+        /// Tag for general_membarrier URCU
+        struct general_membarrier_tag: public membarrier_rcu {
+            typedef membarrier_rcu     rcu_class ; ///< The URCU type
+        };
+#   endif
+
         ///@anchor cds_urcu_retired_ptr Retired pointer, i.e. pointer that ready for reclamation
         typedef cds::gc::details::retired_ptr   retired_ptr;
         using cds::gc::make_retired_ptr;
@@ -287,12 +317,83 @@ namespace cds {
             class singleton;
 
             //@cond
+            template <class Instance>
+            struct telemetry_locator;
+
             class singleton_vtbl {
             protected:
+                singleton_vtbl()
+                    : m_nRetiredCount( 0 )
+                    , m_nFreedCount( 0 )
+                {}
+
                 virtual ~singleton_vtbl()
                 {}
             public:
                 virtual void retire_ptr( retired_ptr& p ) = 0;
+
+                cds::gc::telemetry::details::collector& telemetry_collector()
+                {
+                    return m_Telemetry;
+                }
+
+                // Accounts the size of retired object p for telemetry
+                void sample_size( void const* p, size_t nSize )
+                {
+                    if ( cds::gc::telemetry::details::is_sampled( p ))
+                        m_Telemetry.sample_size( nSize );
+                }
+
+            protected:
+                // Samples retired pointer p for telemetry; Instance is the holder of the singleton pointer s_pRCU
+                template <class Instance>
+                void sample_retired( retired_ptr& p )
+                {
+                    if ( cds::gc::telemetry::details::is_sampled( p.m_p ))
+                        m_Telemetry.sample< telemetry_locator< Instance >>( p.m_p, p.m_funcFree );
+                }
+
+                // Counts retired pointer p in the backlog of buffered RCU and samples it
+                template <class Instance>
+                void account_retired( retired_ptr& p )
+                {
+                    m_nRetiredCount.fetch_add( 1, atomics::memory_order_relaxed );
+                    sample_retired< Instance >( p );
+                }
+
+                // Removes nCount freed pointers from the backlog of buffered RCU
+                void account_freed( size_t nCount )
+                {
+                    if ( nCount )
+                        m_nFreedCount.fetch_add( nCount, atomics::memory_order_relaxed );
+                }
+
+                // Returns the backlog of buffered RCU; nExtraFreed - the count of pointers freed outside of the singleton
+                size_t backlog( size_t nExtraFreed = 0 ) const
+                {
+                    size_t const nFreed = m_nFreedCount.load( atomics::memory_order_relaxed ) + nExtraFreed;
+                    size_t const nRetired = m_nRetiredCount.load( atomics::memory_order_relaxed );
+                    return nRetired > nFreed ? nRetired - nFreed : 0;
+                }
+
+                void get_telemetry( cds::gc::telemetry::snapshot& st, size_t nBacklog ) const
+                {
+                    m_Telemetry.get( st, nBacklog );
+                }
+
+            protected:
+                cds::gc::telemetry::details::collector m_Telemetry;
+                atomics::atomic<size_t> m_nRetiredCount;
+                atomics::atomic<size_t> m_nFreedCount;
+            };
+
+            template <class Instance>
+            struct telemetry_locator
+            {
+                static cds::gc::telemetry::details::collector& get()
+                {
+                    return Instance::s_pRCU->telemetry_collector();
+                }
             };
 
             class gc_common
@@ -307,15 +408,18 @@ namespace cds {
             struct thread_list_record {
                 atomics::atomic<ThreadData*>  m_pNext;   ///< Next item in thread list
                 atomics::atomic<OS::ThreadId> m_idOwner; ///< Owner thread id; 0 - the record is free (not owned)
+                unsigned int                  m_nShard;  ///< Shard of \p sharded_thread_list the record belongs to
 
                 thread_list_record()
                     : m_pNext( nullptr )
                     , m_idOwner( cds::OS::c_NullThreadId )
+                    , m_nShard( 0 )
                 {}
 
                 explicit thread_list_record( OS::ThreadId owner )
                     : m_pNext( nullptr )
                     , m_idOwner( owner )
+                    , m_nShard( 0 )
                 {}
 
                 ~thread_list_record()
@@ -418,6 +522,255 @@ namespace cds {
             };
             //@endcond
 
+            //@cond
+            /// Reader registry sharded by processor
+            /**
+                The thread records are kept in per-processor shards, a thread registers its record
+                in the shard of the processor it is running on (the shard count and the current processor
+                function are usually taken from \p cds::OS::topology). Each shard counts its owned (active) records,
+                so the grace period detection skips the shards without active readers.
+
+                The records of detached threads are reused by new threads. When the count of free records
+                in the shard exceeds the count of active ones, \p compact() unlinks the free records from
+                the shard list and keeps them in the shard's spare list for reuse, so the list walked
+                by the grace period detection is proportional to the count of active readers.
+                The records are deallocated only in the destructor since a concurrent \p alloc() may traverse
+                an unlinked record.
+            */
+            template <typename RCUtag, class Alloc = CDS_DEFAULT_ALLOCATOR >
+            class sharded_thread_list {
+            public:
+                typedef thread_data<RCUtag>                             thread_record;
+                typedef cds::details::Allocator< thread_record, Alloc > allocator_type;
+
+                static size_t const c_nMaxShardCount = 64;  ///< Max shard count
+                static size_t const c_nCompactThreshold = 8; ///< Min count of free records in the shard to compact it
+
+            private:
+                struct shard {
+                    atomics::atomic<thread_record *> m_pHead;       ///< Head of shard's record list
+                    atomics::atomic<size_t>          m_nActive;     ///< Count of owned records
+                    atomics::atomic<size_t>          m_nRecords;    ///< Count of records in the list
+                    thread_record *                  m_pSpare;      ///< Free records unlinked by \p compact(), guarded by \p m_Lock
+                    cds::sync::spin                  m_Lock;
+                    char pad_[cds::c_nCacheLineSize];
+
+                    shard()
+                        : m_pHead( nullptr )
+                        , m_nActive( 0 )
+                        , m_nRecords( 0 )
+                        , m_pSpare( nullptr )
+                    {}
+                };
+                typedef cds::details::Allocator< shard, Alloc > shard_allocator;
+
+                shard *         m_Shards;
+                size_t const    m_nShardCount;
+                unsigned int ( * const m_fnCurrentProcessor )();
+
+            public:
+                sharded_thread_list( size_t nShardCount, unsigned int ( *fnCurrentProcessor )())
+                    : m_nShardCount( calc_shard_count( nShardCount ))
+                    , m_fnCurrentProcessor( fnCurrentProcessor )
+                {
+                    m_Shards = shard_allocator().NewArray( m_nShardCount );
+                }
+
+                ~sharded_thread_list()
+                {
+                    destroy();
+                    shard_allocator().Delete( m_Shards, m_nShardCount );
+                }
+
+                thread_record * alloc()
+                {
+                    cds::OS::ThreadId const nullThreadId = cds::OS::c_NullThreadId;
+                    cds::OS::ThreadId const curThreadId  = cds::OS::get_current_thread_id();
+                    unsigned int const nShard = static_cast<unsigned int>( m_fnCurrentProcessor() % m_nShardCount );
+                    shard& sh = m_Shards[nShard];
+
+                    // Count the record before it becomes owned, see flip_and_wait()
+                    sh.m_nActive.fetch_add( 1, atomics::memory_order_seq_cst );
+
+                    // First, try to reuse a spare record of the shard
+                    thread_record * pRec;
+                    {
+                        std::unique_lock< cds::sync::spin > lock( sh.m_Lock );
+                        pRec = sh.m_pSpare;
+                        if ( pRec )
+                            sh.m_pSpare = pRec->m_list.m_pNext.load( atomics::memory_order_relaxed );
+                    }
+                    if ( pRec ) {
+                        pRec->m_list.m_idOwner.store( curThreadId, atomics::memory_order_seq_cst );
+                        push( sh, pRec );
+                        return pRec;
+                    }
+
+                    // Then, try to reuse a free record of the shard
+                    for ( pRec = sh.m_pHead.load( atomics::memory_order_acquire ); pRec; pRec = pRec->m_list.m_pNext.load( atomics::memory_order_relaxed )) {
+                        cds::OS::ThreadId thId = nullThreadId;
+                        if ( pRec->m_list.m_idOwner.compare_exchange_strong( thId, curThreadId, atomics::memory_order_seq_cst, atomics::memory_order_relaxed ))
+                            return pRec;
+                    }
+
+                    // No records available for reuse
+                    // Allocate and push a new record
+                    pRec = allocator_type().New( curThreadId );
+                    pRec->m_list.m_nShard = nShard;
+                    push( sh, pRec );
+                    return pRec;
+                }
+
+                void retire( thread_record * pRec )
+                {
+                    assert( pRec != nullptr );
+                    pRec->m_list.m_idOwner.store( cds::OS::c_NullThreadId, atomics::memory_order_release );
+                    m_Shards[ pRec->m_list.m_nShard ].m_nActive.fetch_sub( 1, atomics::memory_order_release );
+                }
+
+                void detach_all()
+                {
+                    cds::OS::ThreadId const nullThreadId = cds::OS::c_NullThreadId;
+
+                    for ( size_t i = 0; i < m_nShardCount; ++i ) {
+                        for ( thread_record * pRec = head( i, atomics::memory_order_acquire ); pRec; pRec = pRec->m_list.m_pNext.load( atomics::memory_order_relaxed )) {
+                            if ( pRec->m_list.m_idOwner.load( atomics::memory_order_relaxed ) != nullThreadId )
+                                retire( pRec );
+                        }
+                    }
+                }
+
+                size_t shard_count() const
+                {
+                    return m_nShardCount;
+                }
+
+                thread_record * head( size_t nShard, atomics::memory_order mo ) const
+                {
+                    return m_Shards[nShard].m_pHead.load( mo );
+                }
+
+                size_t active_count( size_t nShard ) const
+                {
+                    return m_Shards[nShard].m_nActive.load( atomics::memory_order_seq_cst );
+                }
+
+                /// Unlinks free records from the shards having too many of them
+                /**
+                    Must be called under RCU writer lock: only one thread may compact the list at a time
+                    and no grace period detection should walk the list concurrently.
+                */
+                void compact()
+                {
+                    for ( size_t i = 0; i < m_nShardCount; ++i ) {
+                        shard& sh = m_Shards[i];
+                        size_t const nActive = sh.m_nActive.load( atomics::memory_order_relaxed );
+                        size_t const nRecords = sh.m_nRecords.load( atomics::memory_order_relaxed );
+                        if ( nRecords > nActive && nRecords - nActive >= c_nCompactThreshold && nRecords - nActive > nActive )
+                            compact( sh );
+                    }
+                }
+
+            private:
+                static size_t calc_shard_count( size_t nCount )
+                {
+                    return nCount == 0 ? 1 : nCount > c_nMaxShardCount ? c_nMaxShardCount : nCount;
+                }
+
+                void push( shard& sh, thread_record * pRec )
+                {
+                    thread_record * pOldHead = sh.m_pHead.load( atomics::memory_order_acquire );
+                    do {
+                        // Compiler barriers: assignment MUST BE inside the loop
+                        CDS_COMPILER_RW_BARRIER;
+                        pRec->m_list.m_pNext.store( pOldHead, atomics::memory_order_relaxed );
+                        CDS_COMPILER_RW_BARRIER;
+                    } while ( !sh.m_pHead.compare_exchange_weak( pOldHead, pRec, atomics::memory_order_acq_rel, atomics::memory_order_acquire ));
+                    sh.m_nRecords.fetch_add( 1, atomics::memory_order_relaxed );
+                }
+
+                void compact( shard& sh )
+                {
+                    cds::OS::ThreadId const nullThreadId = cds::OS::c_NullThreadId;
+                    cds::OS::ThreadId const curThreadId = cds::OS::get_current_thread_id();
+
+                    thread_record * pSpare = nullptr;
+                    thread_record * pPrev = nullptr;
+                    for ( thread_record * pCur = sh.m_pHead.load( atomics::memory_order_acquire ); pCur; ) {
+                        thread_record * pNext = pCur->m_list.m_pNext.load( atomics::memory_order_relaxed );
+
+                        // Claim the free record so that alloc() cannot reuse it
+                        cds::OS::ThreadId thId = nullThreadId;
+                        if ( pCur->m_list.m_idOwner.compare_exchange_strong( thId, curThreadId, atomics::memory_order_seq_cst, atomics::memory_order_relaxed )) {
+                            bool bUnlinked = true;
+                            if ( pPrev )
+                                pPrev->m_list.m_pNext.store( pNext, atomics::memory_order_release );
+                            else {
+                                // The head may be changed by concurrent push()
+                                thread_record * pExpected = pCur;
+                                bUnlinked = sh.m_pHead.compare_exchange_strong( pExpected, pNext, atomics::memory_order_acq_rel, atomics::memory_order_relaxed );
+                            }
+
+                            if ( bUnlinked ) {
+                                // A concurrent alloc() standing on the record goes on along the spare chain;
+                                // spare records are not free, so alloc() just does not reuse them
+                                sh.m_nRecords.fetch_sub( 1, atomics::memory_order_relaxed );
+                                pCur->m_list.m_pNext.store( pSpare, atomics::memory_order_relaxed );
+                                pSpare = pCur;
+                                pCur = pNext;
+                                continue;
+                            }
+
+                            pCur->m_list.m_idOwner.store( nullThreadId, atomics::memory_order_release );
+                        }
+
+                        pPrev = pCur;
+                        pCur = pNext;
+                    }
+
+                    if ( pSpare ) {
+                        thread_record * pLast = pSpare;
+                        while ( pLast->m_list.m_pNext.load( atomics::memory_order_relaxed ))
+                            pLast = pLast->m_list.m_pNext.load( atomics::memory_order_relaxed );
+
+                        std::unique_lock< cds::sync::spin > lock( sh.m_Lock );
+                        pLast->m_list.m_pNext.store( sh.m_pSpare, atomics::memory_order_relaxed );
+                        sh.m_pSpare = pSpare;
+                    }
+                }
+
+                void destroy()
+                {
+                    allocator_type al;
+                    CDS_DEBUG_ONLY( cds::OS::ThreadId const nullThreadId = cds::OS::c_NullThreadId; )
+                    CDS_DEBUG_ONLY( cds::OS::ThreadId const mainThreadId = cds::OS::get_current_thread_id() ;)
+
+                    for ( size_t i = 0; i < m_nShardCount; ++i ) {
+                        shard& sh = m_Shards[i];
+                        thread_record * p = sh.m_pHead.exchange( nullptr, atomics::memory_order_acquire );
+                        while ( p ) {
+                            thread_record * pNext = p->m_list.m_pNext.load( atomics::memory_order_relaxed );
+
+                            assert( p->m_list.m_idOwner.load( atomics::memory_order_relaxed ) == nullThreadId
+                                || p->m_list.m_idOwner.load( atomics::memory_order_relaxed ) == mainThreadId
+                                );
+
+                            al.Delete( p );
+                            p = pNext;
+                        }
+
+                        p = sh.m_pSpare;
+                        sh.m_pSpare = nullptr;
+                        while ( p ) {
+                            thread_record * pNext = p->m_list.m_pNext.load( atomics::memory_order_relaxed );
+                            al.Delete( p );
+                            p = pNext;
+                        }
+                    }
+                }
+            };
+            //@endcond
+
             //@cond
             template <class ThreadGC>
             class scoped_lock {
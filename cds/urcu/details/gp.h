@@ -33,6 +33,7 @@
 
 #include <cds/urcu/details/gp_decl.h>
 #include <cds/threading/model.h>
+#include <cds/os/topology.h>
 
 //@cond
 namespace cds { namespace urcu { namespace details {
@@ -106,6 +107,13 @@ namespace cds { namespace urcu { namespace details {
 
 
     // gp_singleton
+    template <typename RCUtag>
+    inline gp_singleton<RCUtag>::gp_singleton()
+        : m_nGlobalControl(1)
+        , m_ThreadList( cds::OS::topology::processor_count(), &cds::OS::topology::current_processor )
+        , m_nGPSeq(0)
+    {}
+
     template <typename RCUtag>
     inline bool gp_singleton<RCUtag>::check_grace_period( typename gp_singleton<RCUtag>::thread_record * pRec ) const
     {
@@ -116,18 +124,67 @@ namespace cds { namespace urcu { namespace details {
 
     template <typename RCUtag>
     template <class Backoff>
-    inline void gp_singleton<RCUtag>::flip_and_wait( Backoff& bkoff )
+    inline bool gp_singleton<RCUtag>::flip_and_wait( Backoff& bkoff )
     {
         OS::ThreadId const nullThreadId = OS::c_NullThreadId;
+        bool bWaited = false;
         m_nGlobalControl.fetch_xor( general_purpose_rcu::c_nControlBit, atomics::memory_order_seq_cst );
 
-        for ( thread_record * pRec = m_ThreadList.head( atomics::memory_order_acquire ); pRec; pRec = pRec->m_list.m_pNext ) {
-            while ( pRec->m_list.m_idOwner.load( atomics::memory_order_acquire ) != nullThreadId && check_grace_period( pRec )) {
-                bkoff();
-                CDS_COMPILER_RW_BARRIER;
+        for ( size_t nShard = 0, nCount = m_ThreadList.shard_count(); nShard < nCount; ++nShard ) {
+            // A thread counts its record as active before it owns the record,
+            // so a shard without active records has no reader to wait for
+            if ( m_ThreadList.active_count( nShard ) == 0 )
+                continue;
+
+            for ( thread_record * pRec = m_ThreadList.head( nShard, atomics::memory_order_acquire ); pRec; pRec = pRec->m_list.m_pNext ) {
+                OS::ThreadId idOwner;
+                while ( ( idOwner = pRec->m_list.m_idOwner.load( atomics::memory_order_acquire )) != nullThreadId && check_grace_period( pRec )) {
+                    m_Telemetry.blocked_by( idOwner );
+                    bWaited = true;
+                    bkoff();
+                    CDS_COMPILER_RW_BARRIER;
+                }
+                bkoff.reset();
             }
-            bkoff.reset();
         }
+        return bWaited;
+    }
+
+    template <typename RCUtag>
+    inline uint64_t gp_singleton<RCUtag>::gp_snap() const
+    {
+        // The removal of the retired data must be visible before the sequence is read
+        atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+        uint64_t const nSeq = m_nGPSeq.load( atomics::memory_order_acquire );
+
+        // If a grace period is in progress, it could start before the removal,
+        // so the caller should wait for the next one
+        return ( nSeq + 3 ) & ~uint64_t( 1 );
+    }
+
+    template <typename RCUtag>
+    inline bool gp_singleton<RCUtag>::gp_done( uint64_t nSnap ) const
+    {
+        return m_nGPSeq.load( atomics::memory_order_acquire ) >= nSnap;
+    }
+
+    template <typename RCUtag>
+    template <class Backoff>
+    inline void gp_singleton<RCUtag>::wait_for_readers( Backoff& bkoff )
+    {
+        uint64_t const nSeq = m_nGPSeq.load( atomics::memory_order_relaxed );
+        assert(( nSeq & 1 ) == 0 );
+        auto const tStart = m_Telemetry.reclaim_start();
+
+        // seq_cst pairs with the fence in gp_snap(): a caller that does not see the odd sequence
+        // has its removal ordered before the flip below
+        m_nGPSeq.store( nSeq + 1, atomics::memory_order_seq_cst );
+        bool bWaited = flip_and_wait( bkoff );
+        bWaited |= flip_and_wait( bkoff );
+        m_nGPSeq.store( nSeq + 2, atomics::memory_order_release );
+        m_Telemetry.reclaim_end( tStart, bWaited );
+
+        m_ThreadList.compact();
     }
 
 
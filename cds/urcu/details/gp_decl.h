@@ -133,12 +133,11 @@ namespace cds { namespace urcu { namespace details {
 
     protected:
         atomics::atomic<uint32_t>    m_nGlobalControl;
-        thread_list< rcu_tag >          m_ThreadList;
+        sharded_thread_list< rcu_tag >  m_ThreadList;
+        atomics::atomic<uint64_t>    m_nGPSeq;  ///< Grace period sequence: odd - a grace period is in progress
 
     protected:
-        gp_singleton()
-            : m_nGlobalControl(1)
-        {}
+        gp_singleton();
 
         ~gp_singleton()
         {}
@@ -173,11 +172,25 @@ namespace cds { namespace urcu { namespace details {
             return m_nGlobalControl.load( mo );
         }
 
+    public:
+        // Grace period sharing
+        // The caller takes gp_snap() before acquiring the writer lock; if gp_done() is true
+        // when the lock is acquired, a full grace period has elapsed since the call
+        // and the caller need not start a new one.
+        uint64_t gp_snap() const;
+        bool gp_done( uint64_t nSnap ) const;
+
     protected:
         bool check_grace_period( thread_record * pRec ) const;
 
+        // Returns true if the function has waited for some reader
+        template <class Backoff>
+        bool flip_and_wait( Backoff& bkoff );
+
+        // Two flip_and_wait() calls bracketed by grace period sequence update;
+        // compacts the reader registry. Must be called under writer lock
         template <class Backoff>
-        void flip_and_wait( Backoff& bkoff );
+        void wait_for_readers( Backoff& bkoff );
     };
 
 #   define CDS_GP_RCU_DECLARE_SINGLETON( tag_ ) \
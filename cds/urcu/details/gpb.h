@@ -48,6 +48,8 @@ namespace cds { namespace urcu {
         that waits until all reader/updater threads end up their read-side critical sections,
         i.e. until the RCU quiescent state will come. After that the buffer and all retired objects are freed.
         This synchronization cycle may be called in any thread that calls \p retire_ptr function.
+        Concurrent synchronization cycles are shared: a thread that has been waiting for the lock
+        while another thread completed a full grace period frees the buffer without starting a new one.
 
         The \p Buffer contains items of \ref cds_urcu_retired_ptr "epoch_retired_ptr" type and it should support a queue interface with
         three function:
@@ -101,6 +103,7 @@ namespace cds { namespace urcu {
         atomics::atomic<uint64_t>  m_nCurEpoch;
         lock_type                  m_Lock;
         size_t const               m_nCapacity;
+        uint64_t                   m_nSafeEpoch;   ///< Max epoch covered by the last grace period, guarded by m_Lock
         //@endcond
 
     public:
@@ -121,6 +124,7 @@ namespace cds { namespace urcu {
             : m_Buffer( nBufferCapacity )
             , m_nCurEpoch(0)
             , m_nCapacity( nBufferCapacity )
+            , m_nSafeEpoch(0)
         {}
 
         ~general_buffered()
@@ -128,24 +132,27 @@ namespace cds { namespace urcu {
             clear_buffer( std::numeric_limits< uint64_t >::max());
         }
 
-        void flip_and_wait()
+        void wait_for_readers()
         {
             back_off bkoff;
-            base_class::flip_and_wait( bkoff );
+            base_class::wait_for_readers( bkoff );
         }
 
         void clear_buffer( uint64_t nEpoch )
         {
             epoch_retired_ptr p;
+            size_t nFreed = 0;
             while ( m_Buffer.pop( p )) {
                 if ( p.m_nEpoch <= nEpoch ) {
                     p.free();
+                    ++nFreed;
                 }
                 else {
                     push_buffer( std::move(p));
                     break;
                 }
             }
+            base_class::account_freed( nFreed );
         }
 
         // Return: \p true - synchronize has been called, \p false - otherwise
@@ -156,6 +163,7 @@ namespace cds { namespace urcu {
                 synchronize();
                 if ( !bPushed ) {
                     ep.free();
+                    base_class::account_freed( 1 );
                 }
                 return true;
             }
@@ -195,8 +203,10 @@ namespace cds { namespace urcu {
         */
         virtual void retire_ptr( retired_ptr& p ) override
         {
-            if ( p.m_p )
+            if ( p.m_p ) {
+                base_class::account_retired< singleton_ptr >( p );
                 push_buffer( epoch_retired_ptr( p, m_nCurEpoch.load( atomics::memory_order_relaxed )));
+            }
         }
 
         /// Retires the pointer chain [\p itFirst, \p itLast)
@@ -207,6 +217,7 @@ namespace cds { namespace urcu {
             while ( itFirst != itLast ) {
                 epoch_retired_ptr ep( *itFirst, nEpoch );
                 ++itFirst;
+                base_class::account_retired< singleton_ptr >( ep );
                 push_buffer( std::move(ep));
             }
         }
@@ -219,6 +230,7 @@ namespace cds { namespace urcu {
             for ( retired_ptr p{ e() }; p.m_p; ) {
                 epoch_retired_ptr ep( p, nEpoch );
                 p = e();
+                base_class::account_retired< singleton_ptr >( ep );
                 push_buffer( std::move(ep));
             }
         }
@@ -233,14 +245,21 @@ namespace cds { namespace urcu {
         //@cond
         bool synchronize( epoch_retired_ptr& ep )
         {
+            uint64_t const nSnap = base_class::gp_snap();
             uint64_t nEpoch;
             {
                 std::unique_lock<lock_type> sl( m_Lock );
                 if ( ep.m_p && m_Buffer.push( ep ))
                     return false;
-                nEpoch = m_nCurEpoch.fetch_add( 1, atomics::memory_order_relaxed );
-                flip_and_wait();
-                flip_and_wait();
+                if ( base_class::gp_done( nSnap )) {
+                    // A grace period started after the call has been completed by another thread
+                    nEpoch = m_nSafeEpoch;
+                }
+                else {
+                    nEpoch = m_nCurEpoch.fetch_add( 1, atomics::memory_order_relaxed );
+                    wait_for_readers();
+                    m_nSafeEpoch = nEpoch;
+                }
             }
             clear_buffer( nEpoch );
             return true;
@@ -252,6 +271,15 @@ namespace cds { namespace urcu {
         {
             return m_nCapacity;
         }
+
+        /// Returns reclamation telemetry
+        /**
+            The backlog is the count of retired pointers in the buffer.
+        */
+        void telemetry( cds::gc::telemetry::snapshot& st ) const
+        {
+            base_class::get_telemetry( st, base_class::backlog());
+        }
     };
 
     /// User-space general-purpose RCU with deferred (buffered) reclamation (stripped version)
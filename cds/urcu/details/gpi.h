@@ -47,6 +47,9 @@ namespace cds { namespace urcu {
         After that the retired object is freed immediately.
         Thus, the implementation blocks for any retired object
 
+        Concurrent \p synchronize() calls share grace periods: a writer that has been waiting
+        for the lock while another writer completed a full grace period does not start a new one.
+
         There is a wrapper \ref cds_urcu_general_instant_gc "gc<general_instant>" for \p %general_instant class
         that provides unified RCU interface. You should use this wrapper class instead \p %general_instant
 
@@ -107,10 +110,10 @@ namespace cds { namespace urcu {
         ~general_instant()
         {}
 
-        void flip_and_wait()
+        void wait_for_readers()
         {
             back_off bkoff;
-            base_class::flip_and_wait( bkoff );
+            base_class::wait_for_readers( bkoff );
         }
         //@endcond
 
@@ -141,6 +144,8 @@ namespace cds { namespace urcu {
         */
         virtual void retire_ptr( retired_ptr& p ) override
         {
+            if ( p.m_p )
+                base_class::sample_retired< singleton_ptr >( p );
             synchronize();
             if ( p.m_p )
                 p.free();
@@ -177,12 +182,17 @@ namespace cds { namespace urcu {
         }
 
         /// Waits to finish a grace period
+        /**
+            If another thread has completed a grace period that started after the call,
+            the function returns without starting a new one.
+        */
         void synchronize()
         {
             assert( !thread_gc::is_locked());
+            uint64_t const nSnap = base_class::gp_snap();
             std::unique_lock<lock_type> sl( m_Lock );
-            flip_and_wait();
-            flip_and_wait();
+            if ( !base_class::gp_done( nSnap ))
+                wait_for_readers();
         }
 
         //@cond
@@ -192,6 +202,15 @@ namespace cds { namespace urcu {
             return 1;
         }
         //@endcond
+
+        /// Returns reclamation telemetry
+        /**
+            \p %general_instant frees the pointer in \p retire_ptr() call, so the backlog is always empty.
+        */
+        void telemetry( cds::gc::telemetry::snapshot& st ) const
+        {
+            base_class::get_telemetry( st, 0 );
+        }
     };
 
     /// User-space general-purpose RCU with immediate reclamation (stripped version)
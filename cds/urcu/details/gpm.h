@@ -0,0 +1,308 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2017
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef CDSLIB_URCU_DETAILS_GPM_H
+#define CDSLIB_URCU_DETAILS_GPM_H
+
+#include <cds/urcu/details/mb.h>
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+
+#include <mutex>
+#include <limits>
+#include <cds/algo/backoff_strategy.h>
+#include <cds/container/vyukov_mpmc_cycle_queue.h>
+#include <cds/details/throw_exception.h>
+
+namespace cds { namespace urcu {
+
+    /// User-space membarrier-based RCU with deferred (buffered) reclamation
+    /**
+        @headerfile cds/urcu/general_membarrier.h
+
+        This URCU implementation is available for Linux only. The read-side critical section
+        contains no memory fences, only compiler barriers. Instead, the writer issues
+        one \p membarrier(MEMBARRIER_CMD_PRIVATE_EXPEDITED) system call per grace period
+        that executes a memory barrier on each running thread of the process.
+        Unlike \p signal_buffered, no POSIX signal is stated for RCU.
+        If the kernel does not support private expedited command (Linux 4.14 and above),
+        the slower \p MEMBARRIER_CMD_SHARED (Linux 4.3 and above) is used.
+        If \p membarrier() is not supported at all, \p Construct() throws \p membarrier_not_supported exception,
+        you may check it before by \p is_supported().
+
+        Like \p general_buffered, this URCU implementation contains an internal buffer where retired objects are
+        accumulated. When the buffer becomes full, the RCU \p synchronize function is called
+        that waits until all reader/updater threads end up their read-side critical sections,
+        i.e. until the RCU quiescent state will come. After that the buffer and all retired objects are freed.
+        This synchronization cycle may be called in any thread that calls \p retire_ptr function.
+
+        The \p Buffer contains items of \ref cds_urcu_retired_ptr "retired_ptr" type and it should support a queue interface with
+        three function:
+        - <tt> bool push( retired_ptr& p ) </tt> - places the retired pointer \p p into queue. If the function
+            returns \p false it means that the buffer is full and RCU synchronization cycle must be processed.
+        - <tt>bool pop( retired_ptr& p ) </tt> - pops queue's head item into \p p parameter; if the queue is empty
+            this function must return \p false
+        - <tt>size_t size()</tt> - returns queue's item count.
+
+        The buffer is considered as full if \p push returns \p false or the buffer size reaches the RCU threshold.
+
+        There is a wrapper \ref cds_urcu_general_membarrier_gc "gc<general_membarrier>" for \p %general_membarrier class
+        that provides unified RCU interface. You should use this wrapper class instead \p %general_membarrier
+
+        Template arguments:
+        - \p Buffer - buffer type. Default is cds::container::VyukovMPMCCycleQueue
+        - \p Lock - mutex type, default is \p std::mutex
+        - \p Backoff - back-off schema, default is cds::backoff::Default
+    */
+    template <
+        class Buffer = cds::container::VyukovMPMCCycleQueue< epoch_retired_ptr >
+        ,class Lock = std::mutex
+        ,class Backoff = cds::backoff::Default
+    >
+    class general_membarrier: public details::mb_singleton< general_membarrier_tag >
+    {
+        //@cond
+        typedef details::mb_singleton< general_membarrier_tag > base_class;
+        //@endcond
+    public:
+        typedef general_membarrier_tag rcu_tag ;  ///< RCU tag
+        typedef Buffer  buffer_type ;   ///< Buffer type
+        typedef Lock    lock_type   ;   ///< Lock type
+        typedef Backoff back_off    ;   ///< Back-off type
+
+        typedef base_class::thread_gc thread_gc ;   ///< Thread-side RCU part
+        typedef typename thread_gc::scoped_lock scoped_lock ; ///< Access lock class
+
+        //@cond
+        static bool const c_bBuffered = true ; ///< Bufferized RCU
+        //@endcond
+
+    protected:
+        //@cond
+        typedef details::mb_singleton_instance< rcu_tag >    singleton_ptr;
+        //@endcond
+
+    protected:
+        //@cond
+        buffer_type               m_Buffer;
+        atomics::atomic<uint64_t> m_nCurEpoch;
+        lock_type                 m_Lock;
+        size_t const              m_nCapacity;
+        //@endcond
+
+    public:
+        /// Returns singleton instance
+        static general_membarrier * instance()
+        {
+            return static_cast<general_membarrier *>( base_class::instance());
+        }
+        /// Checks if the singleton is created and ready to use
+        static bool isUsed()
+        {
+            return singleton_ptr::s_pRCU != nullptr;
+        }
+
+        /// Checks if the kernel supports \p membarrier() system call
+        static bool is_supported()
+        {
+            return base_class::membarrier_command() != 0;
+        }
+
+    protected:
+        //@cond
+        general_membarrier( size_t nBufferCapacity )
+            : m_Buffer( nBufferCapacity )
+            , m_nCurEpoch(0)
+            , m_nCapacity( nBufferCapacity )
+        {}
+
+        ~general_membarrier()
+        {
+            clear_buffer( std::numeric_limits< uint64_t >::max());
+        }
+
+        void clear_buffer( uint64_t nEpoch )
+        {
+            epoch_retired_ptr p;
+            size_t nFreed = 0;
+            while ( m_Buffer.pop( p )) {
+                if ( p.m_nEpoch <= nEpoch ) {
+                    p.free();
+                    ++nFreed;
+                }
+                else {
+                    push_buffer( std::move(p));
+                    break;
+                }
+            }
+            base_class::account_freed( nFreed );
+        }
+
+        bool push_buffer( epoch_retired_ptr&& ep )
+        {
+            bool bPushed = m_Buffer.push( ep );
+            if ( !bPushed || m_Buffer.size() >= capacity()) {
+                synchronize();
+                if ( !bPushed ) {
+                    ep.free();
+                    base_class::account_freed( 1 );
+                }
+                return true;
+            }
+            return false;
+        }
+        //@endcond
+
+    public:
+        /// Creates singleton object
+        /**
+            The \p nBufferCapacity parameter defines RCU threshold.
+
+            Throws \p membarrier_not_supported if the kernel does not support \p membarrier() system call.
+        */
+        static void Construct( size_t nBufferCapacity = 256 )
+        {
+            if ( !singleton_ptr::s_pRCU ) {
+                if ( !is_supported())
+                    CDS_THROW_EXCEPTION( membarrier_not_supported());
+                singleton_ptr::s_pRCU = new general_membarrier( nBufferCapacity );
+            }
+        }
+
+        /// Destroys singleton object
+        static void Destruct( bool bDetachAll = false )
+        {
+            if ( isUsed()) {
+                instance()->clear_buffer( std::numeric_limits< uint64_t >::max());
+                if ( bDetachAll )
+                    instance()->m_ThreadList.detach_all();
+                delete instance();
+                singleton_ptr::s_pRCU = nullptr;
+            }
+        }
+
+    public:
+        /// Retire \p p pointer
+        /**
+            The method pushes \p p pointer to internal buffer.
+            When the buffer becomes full \ref synchronize function is called
+            to wait for the end of grace period and then to free all pointers from the buffer.
+        */
+        virtual void retire_ptr( retired_ptr& p ) override
+        {
+            if ( p.m_p ) {
+                base_class::account_retired< singleton_ptr >( p );
+                push_buffer( epoch_retired_ptr( p, m_nCurEpoch.load( atomics::memory_order_relaxed )));
+            }
+        }
+
+        /// Retires the pointer chain [\p itFirst, \p itLast)
+        template <typename ForwardIterator>
+        void batch_retire( ForwardIterator itFirst, ForwardIterator itLast )
+        {
+            uint64_t nEpoch = m_nCurEpoch.load( atomics::memory_order_relaxed );
+            while ( itFirst != itLast ) {
+                epoch_retired_ptr ep( *itFirst, nEpoch );
+                ++itFirst;
+                base_class::account_retired< singleton_ptr >( ep );
+                push_buffer( std::move(ep));
+            }
+        }
+
+        /// Retires the pointer chain until \p Func returns \p nullptr retired pointer
+        template <typename Func>
+        void batch_retire( Func e )
+        {
+            uint64_t nEpoch = m_nCurEpoch.load( atomics::memory_order_relaxed );
+            for ( retired_ptr p{ e() }; p.m_p; ) {
+                epoch_retired_ptr ep( p, nEpoch );
+                p = e();
+                base_class::account_retired< singleton_ptr >( ep );
+                push_buffer( std::move(ep));
+            }
+        }
+
+        /// Wait to finish a grace period and then clear the buffer
+        void synchronize()
+        {
+            epoch_retired_ptr ep( retired_ptr(), m_nCurEpoch.load( atomics::memory_order_relaxed ));
+            synchronize( ep );
+        }
+
+        //@cond
+        bool synchronize( epoch_retired_ptr& ep )
+        {
+            uint64_t nEpoch;
+            {
+                std::unique_lock<lock_type> sl( m_Lock );
+                if ( ep.m_p && m_Buffer.push( ep ) && m_Buffer.size() < capacity())
+                    return false;
+                nEpoch = m_nCurEpoch.fetch_add( 1, atomics::memory_order_relaxed );
+
+                back_off bkOff;
+                base_class::wait_for_readers( bkOff );
+            }
+
+            clear_buffer( nEpoch );
+            return true;
+        }
+        //@endcond
+
+        /// Returns the threshold of internal buffer
+        size_t capacity() const
+        {
+            return m_nCapacity;
+        }
+
+        /// Returns reclamation telemetry
+        /**
+            The backlog is the count of retired pointers in the buffer.
+        */
+        void telemetry( cds::gc::telemetry::snapshot& st ) const
+        {
+            base_class::get_telemetry( st, base_class::backlog());
+        }
+    };
+
+
+    /// User-space membarrier-based RCU with deferred (buffered) reclamation (stripped version)
+    /**
+        @headerfile cds/urcu/general_membarrier.h
+
+        This short version of \p general_membarrier is intended for stripping debug info.
+        If you use \p %general_membarrier with default template arguments you may use
+        this stripped version. All functionality of both classes are identical.
+    */
+    class general_membarrier_stripped: public general_membarrier<>
+    {};
+
+}} // namespace cds::urcu
+
+#endif // #ifdef CDS_URCU_MEMBARRIER_ENABLED
+#endif // #ifndef CDSLIB_URCU_DETAILS_GPM_H
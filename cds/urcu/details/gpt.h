@@ -144,10 +144,10 @@ namespace cds { namespace urcu {
             , m_nCapacity( nBufferCapacity )
         {}
 
-        void flip_and_wait()
+        void wait_for_readers()
         {
             back_off bkoff;
-            base_class::flip_and_wait( bkoff );
+            base_class::wait_for_readers( bkoff );
         }
 
         // Return: true - synchronize has been called, false - otherwise
@@ -156,8 +156,10 @@ namespace cds { namespace urcu {
             bool bPushed = m_Buffer.push( p );
             if ( !bPushed || m_Buffer.size() >= capacity()) {
                 synchronize();
-                if ( !bPushed )
+                if ( !bPushed ) {
                     p.free();
+                    base_class::account_freed( 1 );
+                }
                 return true;
             }
             return false;
@@ -210,8 +212,10 @@ namespace cds { namespace urcu {
         */
         virtual void retire_ptr( retired_ptr& p ) override
         {
-            if ( p.m_p )
+            if ( p.m_p ) {
+                base_class::account_retired< singleton_ptr >( p );
                 push_buffer( epoch_retired_ptr( p, m_nCurEpoch.load( atomics::memory_order_acquire )));
+            }
         }
 
         /// Retires the pointer chain [\p itFirst, \p itLast)
@@ -222,6 +226,7 @@ namespace cds { namespace urcu {
             while ( itFirst != itLast ) {
                 epoch_retired_ptr ep( *itFirst, nEpoch );
                 ++itFirst;
+                base_class::account_retired< singleton_ptr >( ep );
                 push_buffer( std::move(ep));
             }
         }
@@ -234,6 +239,7 @@ namespace cds { namespace urcu {
             for ( retired_ptr p{ e() }; p.m_p; ) {
                 epoch_retired_ptr ep( p, nEpoch );
                 p = e();
+                base_class::account_retired< singleton_ptr >( ep );
                 push_buffer( std::move(ep));
             }
         }
@@ -250,8 +256,7 @@ namespace cds { namespace urcu {
             uint64_t nPrevEpoch = m_nCurEpoch.fetch_add( 1, atomics::memory_order_release );
             {
                 std::unique_lock<lock_type> sl( m_Lock );
-                flip_and_wait();
-                flip_and_wait();
+                wait_for_readers();
             }
             m_DisposerThread.dispose( m_Buffer, nPrevEpoch, bSync );
         }
@@ -266,6 +271,15 @@ namespace cds { namespace urcu {
         {
             return m_nCapacity;
         }
+
+        /// Returns reclamation telemetry
+        /**
+            The backlog is the count of retired pointers that are not freed yet by the disposer thread.
+        */
+        void telemetry( cds::gc::telemetry::snapshot& st ) const
+        {
+            base_class::get_telemetry( st, base_class::backlog( m_DisposerThread.free_count()));
+        }
     };
 
     /// User-space general-purpose RCU with deferred threaded reclamation (stripped version)
@@ -0,0 +1,210 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2017
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef CDSLIB_URCU_DETAILS_MB_H
+#define CDSLIB_URCU_DETAILS_MB_H
+
+#include <cds/urcu/details/mb_decl.h>
+
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+#include <cds/threading/model.h>
+#include <cds/os/topology.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+//@cond
+namespace cds { namespace urcu { namespace details {
+
+    // Inlines
+
+    // mb_thread_gc
+    template <typename RCUtag>
+    inline mb_thread_gc<RCUtag>::mb_thread_gc()
+    {
+        if ( !threading::Manager::isThreadAttached())
+            cds::threading::Manager::attachThread();
+    }
+
+    template <typename RCUtag>
+    inline mb_thread_gc<RCUtag>::~mb_thread_gc()
+    {
+        cds::threading::Manager::detachThread();
+    }
+
+    template <typename RCUtag>
+    inline typename mb_thread_gc<RCUtag>::thread_record * mb_thread_gc<RCUtag>::get_thread_record()
+    {
+        return cds::threading::getRCU<RCUtag>();
+    }
+
+    template <typename RCUtag>
+    inline void mb_thread_gc<RCUtag>::access_lock()
+    {
+        thread_record * pRec = get_thread_record();
+        assert( pRec != nullptr );
+
+        uint32_t tmp = pRec->m_nAccessControl.load( atomics::memory_order_relaxed );
+        if ( (tmp & rcu_class::c_nNestMask) == 0 ) {
+            pRec->m_nAccessControl.store( mb_singleton<RCUtag>::instance()->global_control_word(atomics::memory_order_relaxed),
+                atomics::memory_order_relaxed );
+
+            // No memory fence: the writer forces it by membarrier() system call
+            CDS_COMPILER_RW_BARRIER;
+        }
+        else {
+            // nested lock
+            pRec->m_nAccessControl.store( tmp + 1, atomics::memory_order_relaxed );
+        }
+    }
+
+    template <typename RCUtag>
+    inline void mb_thread_gc<RCUtag>::access_unlock()
+    {
+        thread_record * pRec = get_thread_record();
+        assert( pRec != nullptr );
+
+        uint32_t tmp = pRec->m_nAccessControl.load( atomics::memory_order_relaxed );
+        assert( (tmp & rcu_class::c_nNestMask) > 0 );
+
+        CDS_COMPILER_RW_BARRIER;
+        pRec->m_nAccessControl.store( tmp - 1, atomics::memory_order_release );
+    }
+
+    template <typename RCUtag>
+    inline bool mb_thread_gc<RCUtag>::is_locked()
+    {
+        thread_record * pRec = get_thread_record();
+        assert( pRec != nullptr );
+
+        return (pRec->m_nAccessControl.load( atomics::memory_order_relaxed ) & rcu_class::c_nNestMask) != 0;
+    }
+
+
+    // mb_singleton
+    template <typename RCUtag>
+    inline mb_singleton<RCUtag>::mb_singleton()
+        : m_nGlobalControl(1)
+        , m_ThreadList( cds::OS::topology::processor_count(), &cds::OS::topology::current_processor )
+        , m_nMembarrierCmd( membarrier_command())
+    {}
+
+    template <typename RCUtag>
+    inline int mb_singleton<RCUtag>::membarrier_command()
+    {
+#ifdef __NR_membarrier
+        long const nCmds = syscall( __NR_membarrier, c_nMembarrierQuery, 0 );
+        if ( nCmds > 0 ) {
+            // Private expedited command (Linux 4.14) interrupts only the threads of the process
+            // but the process must be registered first
+            if ( ( nCmds & c_nMembarrierPrivateExpedited ) && ( nCmds & c_nMembarrierRegisterPrivateExpedited )
+                && syscall( __NR_membarrier, c_nMembarrierRegisterPrivateExpedited, 0 ) == 0 )
+            {
+                return c_nMembarrierPrivateExpedited;
+            }
+
+            // Shared command (Linux 4.3) is much slower but still correct
+            if ( nCmds & c_nMembarrierShared )
+                return c_nMembarrierShared;
+        }
+#endif
+        return 0;
+    }
+
+    template <typename RCUtag>
+    inline void mb_singleton<RCUtag>::force_membar_all_threads()
+    {
+        assert( m_nMembarrierCmd != 0 );
+#ifdef __NR_membarrier
+        CDS_VERIFY( syscall( __NR_membarrier, m_nMembarrierCmd, 0 ) == 0 );
+#endif
+    }
+
+    template <typename RCUtag>
+    inline bool mb_singleton<RCUtag>::check_grace_period( thread_record * pRec ) const
+    {
+        uint32_t const v = pRec->m_nAccessControl.load( atomics::memory_order_acquire );
+        return (v & rcu_tag::c_nNestMask)
+            && ((( v ^ m_nGlobalControl.load( atomics::memory_order_relaxed )) & ~rcu_tag::c_nNestMask ));
+    }
+
+    template <typename RCUtag>
+    template <class Backoff>
+    inline bool mb_singleton<RCUtag>::wait_for_quiescent_state( Backoff& bkOff )
+    {
+        OS::ThreadId const nullThreadId = OS::c_NullThreadId;
+        bool bWaited = false;
+
+        for ( size_t nShard = 0, nCount = m_ThreadList.shard_count(); nShard < nCount; ++nShard ) {
+            if ( m_ThreadList.active_count( nShard ) == 0 )
+                continue;
+
+            for ( thread_record * pRec = m_ThreadList.head( nShard, atomics::memory_order_acquire ); pRec; pRec = pRec->m_list.m_pNext ) {
+                OS::ThreadId idOwner;
+                while ( ( idOwner = pRec->m_list.m_idOwner.load( atomics::memory_order_acquire )) != nullThreadId && check_grace_period( pRec )) {
+                    m_Telemetry.blocked_by( idOwner );
+                    bWaited = true;
+                    bkOff();
+                    CDS_COMPILER_RW_BARRIER;
+                }
+                bkOff.reset();
+            }
+        }
+        return bWaited;
+    }
+
+    template <typename RCUtag>
+    template <class Backoff>
+    inline void mb_singleton<RCUtag>::wait_for_readers( Backoff& bkOff )
+    {
+        // The readers have no memory fences. The only membarrier() call is placed after the first flip:
+        // - a reader that has announced its critical section before the call is visible to
+        //   both waits below;
+        // - a reader that starts its critical section after the call cannot see
+        //   the data removed before the flip.
+        // The reader's unlock is a release store, so the reader's loads inside the critical section
+        // happen before the writer's acquire load that observes the end of the section
+        auto const tStart = m_Telemetry.reclaim_start();
+        switch_next_epoch();
+        force_membar_all_threads();
+        bool bWaited = wait_for_quiescent_state( bkOff );
+
+        switch_next_epoch();
+        bkOff.reset();
+        bWaited |= wait_for_quiescent_state( bkOff );
+        m_Telemetry.reclaim_end( tStart, bWaited );
+
+        m_ThreadList.compact();
+    }
+
+}}} // namespace cds:urcu::details
+//@endcond
+
+#endif // #ifdef CDS_URCU_MEMBARRIER_ENABLED
+#endif // #ifndef CDSLIB_URCU_DETAILS_MB_H
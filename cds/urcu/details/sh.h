@@ -173,14 +173,20 @@ namespace cds { namespace urcu { namespace details {
 
     template <typename RCUtag>
     template <class Backoff>
-    void sh_singleton<RCUtag>::wait_for_quiescent_state( Backoff& bkOff )
+    bool sh_singleton<RCUtag>::wait_for_quiescent_state( Backoff& bkOff )
     {
         OS::ThreadId const nullThreadId = OS::c_NullThreadId;
+        bool bWaited = false;
 
         for ( thread_record * pRec = m_ThreadList.head( atomics::memory_order_acquire); pRec; pRec = pRec->m_list.m_pNext ) {
-            while ( pRec->m_list.m_idOwner.load( atomics::memory_order_acquire) != nullThreadId && check_grace_period( pRec ))
+            OS::ThreadId idOwner;
+            while ( ( idOwner = pRec->m_list.m_idOwner.load( atomics::memory_order_acquire)) != nullThreadId && check_grace_period( pRec )) {
+                m_Telemetry.blocked_by( idOwner );
+                bWaited = true;
                 bkOff();
+            }
         }
+        return bWaited;
     }
 
 }}} // namespace cds:urcu::details
@@ -199,8 +199,9 @@ namespace cds { namespace urcu { namespace details {
         }
         bool check_grace_period( thread_record * pRec ) const;
 
+        // Returns true if the function has waited for some reader
         template <class Backoff>
-        void wait_for_quiescent_state( Backoff& bkOff );
+        bool wait_for_quiescent_state( Backoff& bkOff );
     };
 
 #   define CDS_SIGRCU_DECLARE_SINGLETON( tag_ ) \
@@ -134,15 +134,18 @@ namespace cds { namespace urcu {
         void clear_buffer( uint64_t nEpoch )
         {
             epoch_retired_ptr p;
+            size_t nFreed = 0;
             while ( m_Buffer.pop( p )) {
                 if ( p.m_nEpoch <= nEpoch ) {
                     p.free();
+                    ++nFreed;
                 }
                 else {
                     push_buffer( std::move(p));
                     break;
                 }
             }
+            base_class::account_freed( nFreed );
         }
 
         bool push_buffer( epoch_retired_ptr&& ep )
@@ -152,6 +155,7 @@ namespace cds { namespace urcu {
                 synchronize();
                 if ( !bPushed ) {
                     ep.free();
+                    base_class::account_freed( 1 );
                 }
                 return true;
             }
@@ -193,8 +197,10 @@ namespace cds { namespace urcu {
         */
         virtual void retire_ptr( retired_ptr& p ) override
         {
-            if ( p.m_p )
+            if ( p.m_p ) {
+                base_class::account_retired< singleton_ptr >( p );
                 push_buffer( epoch_retired_ptr( p, m_nCurEpoch.load( atomics::memory_order_relaxed )));
+            }
         }
 
         /// Retires the pointer chain [\p itFirst, \p itLast)
@@ -205,6 +211,7 @@ namespace cds { namespace urcu {
             while ( itFirst != itLast ) {
                 epoch_retired_ptr ep( *itFirst, nEpoch );
                 ++itFirst;
+                base_class::account_retired< singleton_ptr >( ep );
                 push_buffer( std::move(ep));
             }
         }
@@ -217,6 +224,7 @@ namespace cds { namespace urcu {
             for ( retired_ptr p{ e() }; p.m_p; ) {
                 epoch_retired_ptr ep( p, nEpoch );
                 p = e();
+                base_class::account_retired< singleton_ptr >( ep );
                 push_buffer( std::move(ep));
             }
         }
@@ -237,16 +245,18 @@ namespace cds { namespace urcu {
                 if ( ep.m_p && m_Buffer.push( ep ) && m_Buffer.size() < capacity())
                     return false;
                 nEpoch = m_nCurEpoch.fetch_add( 1, atomics::memory_order_relaxed );
+                auto const tStart = m_Telemetry.reclaim_start();
 
                 back_off bkOff;
                 base_class::force_membar_all_threads( bkOff );
                 base_class::switch_next_epoch();
                 bkOff.reset();
-                base_class::wait_for_quiescent_state( bkOff );
+                bool bWaited = base_class::wait_for_quiescent_state( bkOff );
                 base_class::switch_next_epoch();
                 bkOff.reset();
-                base_class::wait_for_quiescent_state( bkOff );
+                bWaited |= base_class::wait_for_quiescent_state( bkOff );
                 base_class::force_membar_all_threads( bkOff );
+                m_Telemetry.reclaim_end( tStart, bWaited );
             }
 
             clear_buffer( nEpoch );
@@ -260,6 +270,15 @@ namespace cds { namespace urcu {
             return m_nCapacity;
         }
 
+        /// Returns reclamation telemetry
+        /**
+            The backlog is the count of retired pointers in the buffer.
+        */
+        void telemetry( cds::gc::telemetry::snapshot& st ) const
+        {
+            base_class::get_telemetry( st, base_class::backlog());
+        }
+
         /// Returns the signal number stated for RCU
         int signal_no() const
         {
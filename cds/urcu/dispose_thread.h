@@ -88,6 +88,9 @@ namespace cds { namespace urcu {
         // Quit flag
         bool    m_bQuit = false;
 
+        // Count of freed objects, written by disposing thread only
+        atomics::atomic<size_t> m_nFreeCount;
+
         // disposing pass sync
         condvar_type        m_cvReady;
         bool                m_bReady = false;
@@ -133,14 +136,17 @@ namespace cds { namespace urcu {
         void dispose_buffer( buffer_type * pBuf, uint64_t nCurEpoch )
         {
             epoch_retired_ptr * p;
+            size_t nFreed = 0;
             while ( ( p = pBuf->front()) != nullptr ) {
                 if ( p->m_nEpoch <= nCurEpoch ) {
                     p->free();
                     CDS_VERIFY( pBuf->pop_front());
+                    ++nFreed;
                 }
                 else
                     break;
             }
+            m_nFreeCount.store( m_nFreeCount.load( atomics::memory_order_relaxed ) + nFreed, atomics::memory_order_relaxed );
         }
         //@endcond
 
@@ -148,6 +154,7 @@ namespace cds { namespace urcu {
         //@cond
         dispose_thread()
             : m_pBuffer( nullptr )
+            , m_nFreeCount( 0 )
         {}
         //@endcond
 
@@ -220,6 +227,15 @@ namespace cds { namespace urcu {
                     m_cvReady.wait( lock );
             }
         }
+
+        /// Returns the count of objects freed by the reclamation thread
+        /**
+            The function is used by \ref general_threaded object to calculate its reclamation backlog.
+        */
+        size_t free_count() const
+        {
+            return m_nFreeCount.load( atomics::memory_order_relaxed );
+        }
     };
 }} // namespace cds::urcu
 
@@ -68,6 +68,9 @@ namespace cds { namespace urcu {
 
         using details::gc_common::atomic_marked_ptr;
 
+        /// Reclamation telemetry snapshot, see \p cds::gc::telemetry
+        typedef cds::gc::telemetry::snapshot telemetry_snapshot;
+
     public:
         /// Creates URCU \p %general_buffered singleton.
         gc( size_t nBufferCapacity = 256 )
@@ -99,6 +102,7 @@ namespace cds { namespace urcu {
         template <typename T>
         static void retire_ptr( T * p, free_retired_ptr_func pFunc )
         {
+            rcu_implementation::instance()->sample_size( p, cds::gc::telemetry::details::object_size<T>::value );
             retired_ptr rp( p, pFunc );
             retire_ptr( rp );
         }
@@ -122,6 +126,16 @@ namespace cds { namespace urcu {
             rcu_implementation::instance()->retire_ptr(p);
         }
 
+        /// Places the range [\p itFirst, \p itLast) of \p retired_ptr to internal buffer
+        /**
+            If the buffer is full, \ref synchronize function is invoked. The same as \p batch_retire().
+        */
+        template <typename ForwardIterator>
+        static void retire_ptr( ForwardIterator itFirst, ForwardIterator itLast )
+        {
+            rcu_implementation::instance()->batch_retire( itFirst, itLast );
+        }
+
         /// Frees chain [ \p itFirst, \p itLast) in one synchronization cycle
         template <typename ForwardIterator>
         static void batch_retire( ForwardIterator itFirst, ForwardIterator itLast )
@@ -170,6 +184,17 @@ namespace cds { namespace urcu {
             return thread_gc::is_locked();
         }
 
+        /// Returns reclamation telemetry
+        /**
+            The telemetry is gathered always and may be read at any time from any thread.
+            The blocking thread is the reader the last grace period has waited for.
+            See \p cds::gc::telemetry for details.
+        */
+        static void telemetry( telemetry_snapshot& st )
+        {
+            rcu_implementation::instance()->telemetry( st );
+        }
+
         /// Forces retired object removal
         /**
             This function calls \ref synchronize
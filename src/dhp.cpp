@@ -32,6 +32,8 @@
 #include <vector>
 
 #include <cds/gc/dhp.h>
+#include <cds/gc/details/dispose_thread.h>
+#include <cds/algo/backoff_strategy.h>
 #include <cds/os/thread.h>
 
 namespace cds { namespace gc { namespace dhp {
@@ -49,11 +51,26 @@ namespace cds { namespace gc { namespace dhp {
 
         struct defaults {
             static size_t const c_extended_guard_block_size = 16;
+            static unsigned const c_throttle_retry_count = 16;   // max help_scan() count in throttle()
         };
 
         void* ( *s_alloc_memory )( size_t size ) = default_alloc_memory;
         void( *s_free_memory )( void* p ) = default_free_memory;
 
+        // links guards in the block
+        guard_block* link_guards( guard_block* gb )
+        {
+            guard* p = gb->first();
+            for ( guard* last = p + defaults::c_extended_guard_block_size - 1; p != last; ++p ) {
+                p->clear( atomics::memory_order_relaxed );
+                p->next_ = p + 1;
+            }
+            p->next_ = nullptr;
+            p->clear();
+
+            return gb;
+        }
+
         template <typename T>
         class allocator
         {
@@ -76,6 +93,8 @@ namespace cds { namespace gc { namespace dhp {
             }
         };
 
+        typedef std::vector<void*, allocator<void*>> hp_vector;
+
         stat s_postmortem_stat;
     } // namespace
 
@@ -94,8 +113,10 @@ namespace cds { namespace gc { namespace dhp {
     {
         guard_block* gb;
         auto block = free_list_.get();
-        if ( block )
+        if ( block ) {
             gb = static_cast< guard_block* >( block );
+            CDS_HPSTAT( block_reused_.fetch_add( 1, atomics::memory_order_relaxed ));
+        }
         else {
             // allocate new block
             gb = new( s_alloc_memory( sizeof( guard_block ) + sizeof( guard ) * defaults::c_extended_guard_block_size )) guard_block;
@@ -104,16 +125,15 @@ namespace cds { namespace gc { namespace dhp {
             CDS_HPSTAT( block_allocated_.fetch_add( 1, atomics::memory_order_relaxed ));
         }
 
-        // links guards in the block
-        guard* p = gb->first();
-        for ( guard* last = p + defaults::c_extended_guard_block_size - 1; p != last; ++p ) {
-            p->clear( atomics::memory_order_relaxed );
-            p->next_ = p + 1;
-        }
-        p->next_ = nullptr;
-        p->clear();
+        return link_guards( gb );
+    }
 
-        return gb;
+    CDS_EXPORT_API guard_block* hp_allocator::alloc( guard_block_cache& cache )
+    {
+        guard_block* gb = cache.get();
+        if ( gb )
+            return link_guards( gb );
+        return alloc();
     }
 
     CDS_EXPORT_API retired_allocator::~retired_allocator()
@@ -128,8 +148,10 @@ namespace cds { namespace gc { namespace dhp {
     {
         retired_block* rb;
         auto block = free_list_.get();
-        if ( block )
+        if ( block ) {
             rb = static_cast< retired_block* >( block );
+            CDS_HPSTAT( block_reused_.fetch_add( 1, atomics::memory_order_relaxed ));
+        }
         else {
             // allocate new block
             rb = new( s_alloc_memory( sizeof( retired_block ) + sizeof( retired_ptr ) * retired_block::c_capacity )) retired_block;
@@ -141,20 +163,56 @@ namespace cds { namespace gc { namespace dhp {
         return rb;
     }
 
+    CDS_EXPORT_API retired_block* retired_allocator::alloc( retired_block_cache& cache )
+    {
+        retired_block* rb = cache.get();
+        if ( rb ) {
+            rb->next_ = nullptr;
+            return rb;
+        }
+        return alloc();
+    }
+
     struct smr::thread_record: thread_data
     {
         atomics::atomic<thread_record*>     m_pNextNode; ///< next hazard ptr record in list
         atomics::atomic<cds::OS::ThreadId>  m_idOwner;   ///< Owner thread id; 0 - the record is free (not owned)
         atomics::atomic<bool>               m_bFree;     ///< true if record is free (not owned)
+        hp_vector                           plist_;      ///< hazard pointer snapshot, kept between scan() calls to avoid reallocation
+
+        // The guard reported by last report_stalled_guard() call
+        guard const*                        stalled_guard_;
+        void const*                         stalled_ptr_;
+        size_t                              stall_count_;
 
         thread_record( guard* guards, size_t guard_count )
             : thread_data( guards, guard_count )
             , m_pNextNode( nullptr )
             , m_idOwner( cds::OS::c_NullThreadId )
             , m_bFree( false )
+            , stalled_guard_( nullptr )
+            , stalled_ptr_( nullptr )
+            , stall_count_( 0 )
         {}
     };
 
+    struct smr::reclaimer: public cds::gc::details::dispose_thread< reclaimer, allocator<void*>>
+    {
+        typedef cds::gc::details::dispose_thread< reclaimer, allocator<void*>> base_class;
+
+        smr& smr_;
+
+        reclaimer( smr& s, size_t nMaxBacklog )
+            : base_class( nMaxBacklog )
+            , smr_( s )
+        {}
+
+        void collect_hazards( base_class::hp_vector& plist )
+        {
+            smr_.collect_hazards( plist );
+        }
+    };
+
     /*static*/ CDS_EXPORT_API thread_data* smr::tls()
     {
         assert( tls_ != nullptr );
@@ -183,6 +241,11 @@ namespace cds { namespace gc { namespace dhp {
     /*static*/ CDS_EXPORT_API void smr::destruct( bool bDetachAll )
     {
         if ( instance_ ) {
+            // The dispose thread is attached to SMR, it should detach itself before other threads are detached
+            reclaimer* r = instance_->reclaimer_.load( atomics::memory_order_relaxed );
+            if ( r )
+                r->stop();
+
             if ( bDetachAll )
                 instance_->detach_all_thread();
 
@@ -195,6 +258,9 @@ namespace cds { namespace gc { namespace dhp {
     CDS_EXPORT_API smr::smr( size_t nInitialHazardPtrCount )
         : initial_hazard_count_( nInitialHazardPtrCount < 4 ? 16 : nInitialHazardPtrCount )
         , last_plist_size_( initial_hazard_count_ * 64 )
+        , reclaimer_( nullptr )
+        , watermark_( 0 )
+        , stalled_callback_( nullptr )
     {
         thread_list_.store( nullptr, atomics::memory_order_release );
     }
@@ -204,8 +270,19 @@ namespace cds { namespace gc { namespace dhp {
         CDS_DEBUG_ONLY( const cds::OS::ThreadId nullThreadId = cds::OS::c_NullThreadId; )
         CDS_DEBUG_ONLY( const cds::OS::ThreadId mainThreadId = cds::OS::get_current_thread_id(); )
 
+        // Stop the dispose thread; it frees all retired pointers passed to it
+        reclaimer* r = reclaimer_.load( atomics::memory_order_relaxed );
+        if ( r )
+            r->stop();
+
         CDS_HPSTAT( statistics( s_postmortem_stat ));
 
+        if ( r ) {
+            reclaimer_.store( nullptr, atomics::memory_order_relaxed );
+            r->~reclaimer();
+            s_free_memory( r );
+        }
+
         thread_record* pHead = thread_list_.load( atomics::memory_order_relaxed );
         thread_list_.store( nullptr, atomics::memory_order_release );
 
@@ -353,7 +430,7 @@ namespace cds { namespace gc { namespace dhp {
                 pRec->retired_.current_block_->next_ = nullptr;
                 while ( free_block ) {
                     retired_block* next = free_block->next_;
-                    retired_allocator_.free( free_block );
+                    retired_allocator_.free( free_block, pRec->retired_.block_cache_ );
                     free_block = next;
                     --pRec->retired_.block_count_;
                 }
@@ -364,8 +441,6 @@ namespace cds { namespace gc { namespace dhp {
     }
 
     namespace {
-        typedef std::vector<void*, allocator<void*>> hp_vector;
-
         inline void copy_hazards( hp_vector& vect, guard const* arr, size_t size )
         {
             for ( guard const* end = arr + size; arr != end; ++arr ) {
@@ -395,17 +470,9 @@ namespace cds { namespace gc { namespace dhp {
 
     } // namespace
 
-    CDS_EXPORT_API void smr::scan( thread_data* pThreadRec )
+    template <typename Vector>
+    void smr::collect_hazards( Vector& plist )
     {
-        thread_record* pRec = static_cast<thread_record*>( pThreadRec );
-
-        CDS_HPSTAT( ++pRec->scan_call_count_ );
-
-        hp_vector plist;
-        size_t plist_size = last_plist_size_.load( std::memory_order_relaxed );
-        plist.reserve( plist_size );
-
-        // Stage 1: Scan HP list and insert non-null values in plist
         thread_record* pNode = thread_list_.load( atomics::memory_order_acquire );
         while ( pNode ) {
             if ( pNode->m_idOwner.load( std::memory_order_relaxed ) != cds::OS::c_NullThreadId ) {
@@ -421,6 +488,72 @@ namespace cds { namespace gc { namespace dhp {
 
             pNode = pNode->m_pNextNode.load( atomics::memory_order_relaxed );
         }
+    }
+
+    guard const* smr::find_guard( void const* p, cds::OS::ThreadId& owner )
+    {
+        auto is_guarding = [p]( guard const& g ) { return g.get() == p; };
+
+        for ( thread_record* pNode = thread_list_.load( atomics::memory_order_acquire ); pNode; pNode = pNode->m_pNextNode.load( atomics::memory_order_relaxed )) {
+            owner = pNode->m_idOwner.load( atomics::memory_order_relaxed );
+            if ( owner == cds::OS::c_NullThreadId )
+                continue;
+
+            guard const* end = pNode->hazards_.array_ + pNode->hazards_.initial_capacity_;
+            guard const* g = std::find_if( static_cast<guard const*>( pNode->hazards_.array_ ), end, is_guarding );
+            if ( g != end )
+                return g;
+
+            for ( guard_block* block = pNode->hazards_.extended_list_.load( atomics::memory_order_acquire );
+                block;
+                block = block->next_block_.load( atomics::memory_order_acquire ))
+            {
+                end = block->first() + defaults::c_extended_guard_block_size;
+                g = std::find_if( static_cast<guard const*>( block->first()), end, is_guarding );
+                if ( g != end )
+                    return g;
+            }
+        }
+        return nullptr;
+    }
+
+    void smr::report_stalled_guard( thread_record* pRec, guard const* g, cds::OS::ThreadId owner, size_t nBacklog )
+    {
+        void const* p = pRec->retired_.list_head_->first()->m_p;
+        if ( pRec->stalled_guard_ == g && pRec->stalled_ptr_ == p )
+            ++pRec->stall_count_;
+        else {
+            pRec->stalled_guard_ = g;
+            pRec->stalled_ptr_ = p;
+            pRec->stall_count_ = 1;
+        }
+        CDS_HPSTAT( ++pRec->stalled_guard_call_count_ );
+
+        stalled_guard_callback pCallback = stalled_callback_.load( atomics::memory_order_relaxed );
+        if ( pCallback ) {
+            stalled_guard info;
+            info.owner = owner;
+            info.guarded = p;
+            info.backlog = nBacklog;
+            info.stall_count = pRec->stall_count_;
+            pCallback( info );
+        }
+    }
+
+    CDS_EXPORT_API void smr::scan( thread_data* pThreadRec )
+    {
+        thread_record* pRec = static_cast<thread_record*>( pThreadRec );
+
+        CDS_HPSTAT( ++pRec->scan_call_count_ );
+        auto const tStart = telemetry_.reclaim_start();
+
+        hp_vector& plist = pRec->plist_;
+        size_t plist_size = last_plist_size_.load( std::memory_order_relaxed );
+        plist.clear();
+        plist.reserve( plist_size );
+
+        // Stage 1: Scan HP list and insert non-null values in plist
+        collect_hazards( plist );
 
         // Store plist size for next scan() call (vector reallocation optimization)
         if ( plist.size() > plist_size )
@@ -432,6 +565,7 @@ namespace cds { namespace gc { namespace dhp {
         // Stage 2: Search plist
         size_t free_count = 0;
         size_t retired_count = 0;
+        size_t scanned_count = 0;
         retired_block* last_block = pRec->retired_.current_block_;
         retired_ptr*   last_block_cell = pRec->retired_.current_cell_;
 
@@ -443,6 +577,7 @@ namespace cds { namespace gc { namespace dhp {
             size_t const size = end_block ? last_block_cell - block->first() : retired_block::c_capacity;
 
             retired_count += retired_block::c_capacity;
+            scanned_count += size;
             free_count += retire_data( plist, pRec->retired_, block, size );
 
             if ( end_block )
@@ -450,9 +585,86 @@ namespace cds { namespace gc { namespace dhp {
         }
         CDS_HPSTAT( pRec->free_call_count_ += free_count );
 
-        // If the count of freed elements is too small, increase retired array
-        if ( free_count < retired_count / 4 && last_block == pRec->retired_.list_tail_ && last_block_cell == last_block->last())
+        // The scan that cannot free at least a half of retired pointers is blocked by some guard
+        size_t const kept_count = scanned_count - free_count;
+        bool const blocked = kept_count > 0 && kept_count * 2 >= scanned_count;
+        size_t const watermark = watermark_.load( atomics::memory_order_relaxed );
+        bool const over_watermark = watermark && kept_count >= watermark;
+        pRec->telemetry_.free( free_count );
+
+        if ( blocked || over_watermark ) {
+            cds::OS::ThreadId owner;
+            guard const* g = find_guard( pRec->retired_.list_head_->first()->m_p, owner );
+            if ( g ) {
+                if ( blocked )
+                    telemetry_.blocked_by( owner );
+                if ( over_watermark )
+                    report_stalled_guard( pRec, g, owner, kept_count );
+            }
+        }
+        if ( !over_watermark )
+            pRec->stall_count_ = 0;
+        telemetry_.reclaim_end( tStart, blocked );
+
+        // If the count of freed elements is too small, increase retired array.
+        // Above the watermark the array is extended only if it is still full
+        if ( last_block == pRec->retired_.list_tail_ && last_block_cell == last_block->last()
+            && ( over_watermark ? kept_count == retired_count : free_count < retired_count / 4 ))
+        {
             pRec->retired_.extend();
+        }
+    }
+
+    CDS_EXPORT_API void smr::start_dispose_thread( size_t nMaxBacklog )
+    {
+        if ( !reclaimer_.load( atomics::memory_order_acquire )) {
+            reclaimer* r = new( s_alloc_memory( sizeof( reclaimer ))) reclaimer( *this, nMaxBacklog ? nMaxBacklog : retired_block::c_capacity * 64 );
+            reclaimer* expected = nullptr;
+            if ( !reclaimer_.compare_exchange_strong( expected, r, atomics::memory_order_release, atomics::memory_order_relaxed )) {
+                r->stop();
+                r->~reclaimer();
+                s_free_memory( r );
+            }
+        }
+    }
+
+    CDS_EXPORT_API void smr::offload( thread_data* pRec )
+    {
+        reclaimer* r = reclaimer_.load( atomics::memory_order_acquire );
+        retired_array& retired = pRec->retired_;
+
+        size_t const nSize = retired.size();
+        bool const bOffloaded = r && r->offload( nSize, [&retired]( retired_ptr* dest ) {
+            for ( retired_block* block = retired.list_head_; ; block = block->next_ ) {
+                retired_ptr* last = block == retired.current_block_ ? retired.current_cell_ : block->last();
+                dest = std::copy( block->first(), last, dest );
+                if ( block == retired.current_block_ )
+                    break;
+            }
+        });
+
+        if ( bOffloaded ) {
+            // The retired blocks are kept for the thread
+            retired.current_block_ = retired.list_head_;
+            retired.current_cell_ = retired.list_head_->first();
+        }
+        else
+            scan( pRec );
+    }
+
+    CDS_EXPORT_API void smr::throttle( thread_data* pRec )
+    {
+        CDS_HPSTAT( ++pRec->throttle_call_count_ );
+
+        cds::backoff::Default bkoff;
+        for ( unsigned i = 0; i < defaults::c_throttle_retry_count; ++i ) {
+            size_t const nWatermark = watermark();
+            if ( !nWatermark || pRec->retired_.size() < nWatermark )
+                break;
+
+            bkoff();
+            help_scan( pRec );
+        }
     }
 
     CDS_EXPORT_API void smr::help_scan( thread_data* pThis )
@@ -524,19 +736,50 @@ namespace cds { namespace gc { namespace dhp {
             st.hp_extend_count      += hprec->hazards_.extend_call_count_;
             st.retired_count        += hprec->retired_.retire_call_count_;
             st.retired_extend_count += hprec->retired_.extend_call_count_;
+            st.hp_block_cache_hit   += hprec->hazards_.block_cache_.hit_count_;
+            st.retired_block_cache_hit += hprec->retired_.block_cache_.hit_count_;
             st.free_count           += hprec->free_call_count_;
             st.scan_count           += hprec->scan_call_count_;
             st.help_scan_count      += hprec->help_scan_call_count_;
+            st.throttle_count       += hprec->throttle_call_count_;
+            st.stalled_guard_count  += hprec->stalled_guard_call_count_;
             CDS_TSAN_ANNOTATE_IGNORE_READS_END;
         }
 
         CDS_TSAN_ANNOTATE_IGNORE_READS_BEGIN;
         st.hp_block_count = hp_allocator_.block_allocated_.load( atomics::memory_order_relaxed );
         st.retired_block_count = retired_allocator_.block_allocated_.load( atomics::memory_order_relaxed );
+        st.hp_block_reuse_count = hp_allocator_.block_reused_.load( atomics::memory_order_relaxed );
+        st.retired_block_reuse_count = retired_allocator_.block_reused_.load( atomics::memory_order_relaxed );
         CDS_TSAN_ANNOTATE_IGNORE_READS_END;
+
+        reclaimer* r = reclaimer_.load( atomics::memory_order_acquire );
+        if ( r ) {
+            st.offload_count = r->offload_count();
+            st.offload_retired_count = r->offload_retired_count();
+            st.offload_reject_count = r->reject_count();
+            st.dispose_thread_free_count = r->free_count();
+            st.free_count += st.dispose_thread_free_count;
+        }
 #   endif
     }
 
+    CDS_EXPORT_API void smr::telemetry( cds::gc::telemetry::snapshot& st )
+    {
+        size_t nRetired = 0;
+        size_t nFreed = 0;
+        for ( thread_record* hprec = thread_list_.load( atomics::memory_order_acquire ); hprec; hprec = hprec->m_pNextNode.load( atomics::memory_order_relaxed )) {
+            nRetired += hprec->telemetry_.retired();
+            nFreed += hprec->telemetry_.freed();
+        }
+
+        reclaimer* r = reclaimer_.load( atomics::memory_order_acquire );
+        if ( r )
+            nFreed += r->free_count();
+
+        // The counters are read non-atomically as a whole, so the difference may be negative for a moment
+        telemetry_.get( st, nRetired > nFreed ? nRetired - nFreed : 0 );
+    }
 
 }}} // namespace cds::gc::dhp
 
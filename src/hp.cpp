@@ -32,8 +32,22 @@
 #include <vector>
 
 #include <cds/gc/hp.h>
+#include <cds/gc/details/dispose_thread.h>
 #include <cds/os/thread.h>
 
+#if CDS_OS_TYPE == CDS_OS_LINUX
+#   include <unistd.h>
+#   include <sys/syscall.h>
+#endif
+
+#if CDS_PROCESSOR_ARCH == CDS_PROCESSOR_AMD64
+#   include <emmintrin.h>
+#   if CDS_COMPILER == CDS_COMPILER_GCC || CDS_COMPILER == CDS_COMPILER_CLANG
+#       include <immintrin.h>
+#       define CDS_HP_SCAN_AVX2_ENABLED
+#   endif
+#endif
+
 namespace cds { namespace gc { namespace hp {
 
     namespace {
@@ -84,6 +98,220 @@ namespace cds { namespace gc { namespace hp {
         }
 
         stat s_postmortem_stat;
+
+        // Returns NUMA node of current thread; 0 if the OS does not provide it
+        unsigned int current_numa_node()
+        {
+#if CDS_OS_TYPE == CDS_OS_LINUX && defined( SYS_getcpu )
+            unsigned int cpu;
+            unsigned int node;
+            if ( ::syscall( SYS_getcpu, &cpu, &node, nullptr ) == 0 )
+                return node;
+#endif
+            return 0;
+        }
+
+        // SIMD compare kernels for vectorized_scan()
+        // The kernels search pointer p in the array arr of size nSize.
+        // arr must be aligned on the cache line and nSize must be a multiple of c_nKernelWidth
+        size_t const c_nKernelWidth = 4;
+
+        typedef bool ( *find_kernel )( void* const* arr, size_t nSize, void* p );
+
+        bool find_generic( void* const* arr, size_t nSize, void* p )
+        {
+            for ( void* const* last = arr + nSize; arr != last; arr += c_nKernelWidth ) {
+                if ( ( arr[0] == p ) | ( arr[1] == p ) | ( arr[2] == p ) | ( arr[3] == p ))
+                    return true;
+            }
+            return false;
+        }
+
+#if CDS_PROCESSOR_ARCH == CDS_PROCESSOR_AMD64
+        bool find_sse2( void* const* arr, size_t nSize, void* p )
+        {
+            // SSE2 has no 64bit compare: compare 32bit halves and combine each half with its pair
+            __m128i const key = _mm_set1_epi64x( static_cast<long long>( reinterpret_cast<uintptr_t>( p )));
+            for ( void* const* last = arr + nSize; arr != last; arr += c_nKernelWidth ) {
+                __m128i lo = _mm_cmpeq_epi32( key, _mm_load_si128( reinterpret_cast<__m128i const*>( arr )));
+                __m128i hi = _mm_cmpeq_epi32( key, _mm_load_si128( reinterpret_cast<__m128i const*>( arr + 2 )));
+                lo = _mm_and_si128( lo, _mm_shuffle_epi32( lo, _MM_SHUFFLE( 2, 3, 0, 1 )));
+                hi = _mm_and_si128( hi, _mm_shuffle_epi32( hi, _MM_SHUFFLE( 2, 3, 0, 1 )));
+                if ( _mm_movemask_epi8( _mm_or_si128( lo, hi )))
+                    return true;
+            }
+            return false;
+        }
+#endif
+
+#ifdef CDS_HP_SCAN_AVX2_ENABLED
+        __attribute__(( target( "avx2" )))
+        bool find_avx2( void* const* arr, size_t nSize, void* p )
+        {
+            __m256i const key = _mm256_set1_epi64x( static_cast<long long>( reinterpret_cast<uintptr_t>( p )));
+            for ( void* const* last = arr + nSize; arr != last; arr += c_nKernelWidth ) {
+                __m256i cmp = _mm256_cmpeq_epi64( key, _mm256_load_si256( reinterpret_cast<__m256i const*>( arr )));
+                if ( _mm256_movemask_epi8( cmp ))
+                    return true;
+            }
+            return false;
+        }
+#endif
+
+        find_kernel select_find_kernel()
+        {
+#if defined( CDS_HP_SCAN_AVX2_ENABLED )
+            __builtin_cpu_init();
+            if ( __builtin_cpu_supports( "avx2" ))
+                return find_avx2;
+            return find_sse2;
+#elif CDS_PROCESSOR_ARCH == CDS_PROCESSOR_AMD64
+            return find_sse2;
+#else
+            return find_generic;
+#endif
+        }
+
+        find_kernel s_find_kernel = find_generic;
+
+        // Hazard pointer snapshot for vectorized_scan()
+        // The snapshot buffer is allocated on demand and is reused by subsequent scans of the owner thread
+        class hazard_snapshot
+        {
+        public:
+            hazard_snapshot()
+                : buf_( nullptr )
+                , arr_( nullptr )
+                , size_( 0 )
+                , capacity_( 0 )
+                , padded_size_( 0 )
+                , hash_table_( nullptr )
+                , hash_mask_( 0 )
+            {}
+
+            ~hazard_snapshot()
+            {
+                if ( buf_ )
+                    s_free_memory( buf_ );
+            }
+
+            void clear()
+            {
+                size_ = 0;
+                hash_mask_ = 0;
+            }
+
+            size_t size() const
+            {
+                return size_;
+            }
+
+            bool empty() const
+            {
+                return size_ == 0;
+            }
+
+            void push( void* p )
+            {
+                assert( p != nullptr );
+                if ( size_ == capacity_ )
+                    grow( capacity_ ? capacity_ * 2 : c_nCacheLineSize / sizeof( void* ) * 4 );
+                arr_[size_++] = p;
+            }
+
+            // Prepares the snapshot for searching
+            // Returns true if hash set is built, false for linear search
+            bool seal()
+            {
+                assert( !empty());
+
+                if ( size_ <= smr::c_nVectorizedScanLinearLimit ) {
+                    // Pad the array by a copy of the first element up to kernel width
+                    size_t const nPadded = ( size_ + c_nKernelWidth - 1 ) & ~( c_nKernelWidth - 1 );
+                    for ( size_t i = size_; i < nPadded; ++i )
+                        arr_[i] = arr_[0];
+                    padded_size_ = nPadded;
+                    hash_mask_ = 0;
+                    return false;
+                }
+
+                // Build open-addressing hash set just after the snapshot array
+                // with load factor <= 0.5
+                size_t nHashSize = c_nCacheLineSize / sizeof( void* );
+                while ( nHashSize < size_ * 2 )
+                    nHashSize *= 2;
+                size_t const nHashOffset = ( size_ + c_nKernelWidth - 1 ) & ~( c_nKernelWidth - 1 );
+                if ( nHashOffset + nHashSize > capacity_ )
+                    grow( nHashOffset + nHashSize );
+
+                void** table = arr_ + nHashOffset;
+                std::fill( table, table + nHashSize, nullptr );
+                hash_mask_ = nHashSize - 1;
+                for ( void* const* p = arr_, *const* last = arr_ + size_; p != last; ++p ) {
+                    for ( size_t idx = hash( *p );; idx = ( idx + 1 ) & hash_mask_ ) {
+                        if ( table[idx] == nullptr ) {
+                            table[idx] = *p;
+                            break;
+                        }
+                        if ( table[idx] == *p )
+                            break;
+                    }
+                }
+                hash_table_ = table;
+                return true;
+            }
+
+            bool contains( void* p ) const
+            {
+                if ( hash_mask_ == 0 )
+                    return s_find_kernel( arr_, padded_size_, p );
+
+                for ( size_t idx = hash( p );; idx = ( idx + 1 ) & hash_mask_ ) {
+                    void* item = hash_table_[idx];
+                    if ( item == p )
+                        return true;
+                    if ( item == nullptr )
+                        return false;
+                }
+            }
+
+        private:
+            size_t hash( void* p ) const
+            {
+                size_t h = static_cast<size_t>( reinterpret_cast<uintptr_t>( p ));
+                h ^= h >> 16;
+                h *= static_cast<size_t>( 0x45d9f3b45d9f3bULL );
+                h ^= h >> 16;
+                return h & hash_mask_;
+            }
+
+            void grow( size_t nCapacity )
+            {
+                // Cache-line aligned, the capacity is a multiple of c_nKernelWidth
+                nCapacity = ( nCapacity + c_nKernelWidth - 1 ) & ~( c_nKernelWidth - 1 );
+                void* buf = s_alloc_memory( nCapacity * sizeof( void* ) + c_nCacheLineSize );
+                void** arr = reinterpret_cast<void**>(
+                    ( reinterpret_cast<uintptr_t>( buf ) + c_nCacheLineSize - 1 ) & ~uintptr_t( c_nCacheLineSize - 1 ));
+
+                if ( size_ )
+                    std::copy( arr_, arr_ + size_, arr );
+                if ( buf_ )
+                    s_free_memory( buf_ );
+
+                buf_ = buf;
+                arr_ = arr;
+                capacity_ = nCapacity;
+            }
+
+        private:
+            void*   buf_;       // allocated buffer
+            void**  arr_;       // cache-line aligned snapshot array in buf_
+            size_t  size_;      // count of hazard pointers in the snapshot
+            size_t  capacity_;  // capacity of arr_
+            size_t  padded_size_;   // size_ rounded up to c_nKernelWidth
+            void**  hash_table_;    // hash set in arr_, valid if hash_mask_ != 0
+            size_t  hash_mask_;     // hash set size - 1; 0 - the hash set is not built
+        };
     } // namespace
 
     /*static*/ CDS_EXPORT_API smr* smr::instance_ = nullptr;
@@ -100,15 +328,45 @@ namespace cds { namespace gc { namespace hp {
         atomics::atomic<thread_record*>     m_pNextNode; ///< next hazard ptr record in list
         atomics::atomic<cds::OS::ThreadId>  m_idOwner;   ///< Owner thread id; 0 - the record is free (not owned)
         atomics::atomic<bool>               m_bFree;     ///< true if record is free (not owned)
+        hazard_snapshot                     m_Snapshot;  ///< Hazard pointer snapshot for vectorized_scan()
+        unsigned int const                  m_nNode;     ///< NUMA node the record has been created on
+        bool const                          m_bExternalRetired; ///< true if retired array is allocated separately (elastic capacity mode)
 
-        thread_record( guard* guards, size_t guard_count, retired_ptr* retired_arr, size_t retired_capacity )
+        thread_record( guard* guards, size_t guard_count, retired_ptr* retired_arr, size_t retired_capacity, bool bExternalRetired )
             : thread_data( guards, guard_count, retired_arr, retired_capacity )
             , m_pNextNode( nullptr )
             , m_idOwner( cds::OS::c_NullThreadId )
             , m_bFree( false )
+            , m_nNode( current_numa_node())
+            , m_bExternalRetired( bExternalRetired )
         {}
     };
 
+    struct smr::reclaimer: public cds::gc::details::dispose_thread< reclaimer, allocator<void*>>
+    {
+        typedef cds::gc::details::dispose_thread< reclaimer, allocator<void*>> base_class;
+
+        smr& smr_;
+
+        reclaimer( smr& s, size_t nMaxBacklog )
+            : base_class( nMaxBacklog )
+            , smr_( s )
+        {}
+
+        void collect_hazards( base_class::hp_vector& plist )
+        {
+            for ( thread_record* pNode = smr_.thread_list_.load( atomics::memory_order_acquire ); pNode; pNode = pNode->m_pNextNode.load( atomics::memory_order_relaxed )) {
+                if ( pNode->m_idOwner.load( atomics::memory_order_relaxed ) != cds::OS::c_NullThreadId ) {
+                    for ( size_t i = 0; i < smr_.get_hazard_ptr_count(); ++i ) {
+                        void* hptr = pNode->hazards_[i].get();
+                        if ( hptr )
+                            plist.push_back( hptr );
+                    }
+                }
+            }
+        }
+    };
+
     /*static*/ CDS_EXPORT_API void smr::set_memory_allocator(
         void* ( *alloc_func )( size_t size ),
         void( *free_func )( void * p )
@@ -122,16 +380,21 @@ namespace cds { namespace gc { namespace hp {
     }
 
 
-    /*static*/ CDS_EXPORT_API void smr::construct( size_t nHazardPtrCount, size_t nMaxThreadCount, size_t nMaxRetiredPtrCount, scan_type nScanType )
+    /*static*/ CDS_EXPORT_API void smr::construct( size_t nHazardPtrCount, size_t nMaxThreadCount, size_t nMaxRetiredPtrCount, scan_type nScanType, capacity_mode nCapacityMode )
     {
         if ( !instance_ ) {
-            instance_ = new( s_alloc_memory(sizeof(smr))) smr( nHazardPtrCount, nMaxThreadCount, nMaxRetiredPtrCount, nScanType );
+            instance_ = new( s_alloc_memory(sizeof(smr))) smr( nHazardPtrCount, nMaxThreadCount, nMaxRetiredPtrCount, nScanType, nCapacityMode );
         }
     }
 
     /*static*/ CDS_EXPORT_API void smr::destruct( bool bDetachAll )
     {
         if ( instance_ ) {
+            // The dispose thread is attached to SMR, it should detach itself before other threads are detached
+            reclaimer* r = instance_->reclaimer_.load( atomics::memory_order_relaxed );
+            if ( r )
+                r->stop();
+
             if ( bDetachAll )
                 instance_->detach_all_thread();
 
@@ -141,13 +404,21 @@ namespace cds { namespace gc { namespace hp {
         }
     }
 
-    CDS_EXPORT_API smr::smr( size_t nHazardPtrCount, size_t nMaxThreadCount, size_t nMaxRetiredPtrCount, scan_type nScanType )
+    CDS_EXPORT_API smr::smr( size_t nHazardPtrCount, size_t nMaxThreadCount, size_t nMaxRetiredPtrCount, scan_type nScanType, capacity_mode nCapacityMode )
         : hazard_ptr_count_( nHazardPtrCount == 0 ? defaults::c_nHazardPointerPerThread : nHazardPtrCount )
         , max_thread_count_( nMaxThreadCount == 0 ? defaults::c_nMaxThreadCount : nMaxThreadCount )
-        , max_retired_ptr_count_( calc_retired_size( nMaxRetiredPtrCount, hazard_ptr_count_, max_thread_count_ ))
+        // In elastic mode max_retired_ptr_count_ is the lower bound of retired array capacity
+        , max_retired_ptr_count_( calc_retired_size( nMaxRetiredPtrCount, hazard_ptr_count_, nCapacityMode == elastic_capacity ? 1 : max_thread_count_ ))
         , scan_type_( nScanType )
-        , scan_func_( nScanType == classic ? &smr::classic_scan : &smr::inplace_scan )
+        , capacity_mode_( nCapacityMode )
+        , thread_count_( 0 )
+        , reclaimer_( nullptr )
+        , scan_func_( nScanType == classic ? &smr::classic_scan
+            : nScanType == vectorized ? &smr::vectorized_scan
+            : &smr::inplace_scan )
     {
+        if ( nScanType == vectorized )
+            s_find_kernel = select_find_kernel();
         thread_list_.store( nullptr, atomics::memory_order_release );
     }
 
@@ -156,8 +427,19 @@ namespace cds { namespace gc { namespace hp {
         CDS_DEBUG_ONLY( const cds::OS::ThreadId nullThreadId = cds::OS::c_NullThreadId; )
         CDS_DEBUG_ONLY( const cds::OS::ThreadId mainThreadId = cds::OS::get_current_thread_id();)
 
+        // Stop the dispose thread; it frees all retired pointers passed to it
+        reclaimer* r = reclaimer_.load( atomics::memory_order_relaxed );
+        if ( r )
+            r->stop();
+
         CDS_HPSTAT( statistics( s_postmortem_stat ));
 
+        if ( r ) {
+            reclaimer_.store( nullptr, atomics::memory_order_relaxed );
+            r->~reclaimer();
+            s_free_memory( r );
+        }
+
         thread_record* pHead = thread_list_.load( atomics::memory_order_relaxed );
         thread_list_.store( nullptr, atomics::memory_order_release );
 
@@ -181,9 +463,36 @@ namespace cds { namespace gc { namespace hp {
     }
 
 
+    size_t smr::calc_elastic_retired_size( size_t nSize ) const
+    {
+        size_t const nThreadCount = thread_count_.load( atomics::memory_order_relaxed );
+        size_t nCapacity = calc_retired_size( max_retired_ptr_count_, hazard_ptr_count_, nThreadCount ? nThreadCount : 1 );
+
+        // The array should have enough room for new retired pointers
+        if ( nCapacity < nSize * 2 )
+            nCapacity = nSize * 2;
+        return nCapacity;
+    }
+
     CDS_EXPORT_API smr::thread_record* smr::create_thread_data()
     {
         size_t const guard_array_size = thread_hp_storage::calc_array_size( get_hazard_ptr_count());
+
+        if ( capacity_mode_ == elastic_capacity ) {
+            // Retired array is allocated separately since it can be resized
+            size_t const nCapacity = calc_elastic_retired_size( 0 );
+            uint8_t* mem = reinterpret_cast<uint8_t*>( s_alloc_memory( sizeof( thread_record ) + guard_array_size ));
+            retired_ptr* retired = reinterpret_cast<retired_ptr*>( s_alloc_memory( retired_array::calc_array_size( nCapacity )));
+
+            return new( mem ) thread_record(
+                reinterpret_cast<guard*>( mem + sizeof( thread_record )),
+                get_hazard_ptr_count(),
+                retired,
+                nCapacity,
+                true
+            );
+        }
+
         size_t const retired_array_size = retired_array::calc_array_size( get_max_retired_ptr_count());
         size_t const nSize = sizeof( thread_record ) + guard_array_size + retired_array_size;
 
@@ -213,7 +522,8 @@ namespace cds { namespace gc { namespace hp {
             reinterpret_cast<guard*>( mem + sizeof( thread_record )),
             get_hazard_ptr_count(),
             reinterpret_cast<retired_ptr*>( mem + sizeof( thread_record ) + guard_array_size ),
-            get_max_retired_ptr_count()
+            get_max_retired_ptr_count(),
+            false
         );
     }
 
@@ -222,6 +532,8 @@ namespace cds { namespace gc { namespace hp {
         // all retired pointers must be freed
         assert( pRec->retired_.size() == 0 );
 
+        if ( pRec->m_bExternalRetired )
+            s_free_memory( pRec->retired_.first());
         pRec->~thread_record();
         s_free_memory( pRec );
     }
@@ -233,13 +545,22 @@ namespace cds { namespace gc { namespace hp {
         const cds::OS::ThreadId nullThreadId = cds::OS::c_NullThreadId;
         const cds::OS::ThreadId curThreadId = cds::OS::get_current_thread_id();
 
+        thread_count_.fetch_add( 1, atomics::memory_order_relaxed );
+
         // First try to reuse a free (non-active) HP record
-        for ( hprec = thread_list_.load( atomics::memory_order_acquire ); hprec; hprec = hprec->m_pNextNode.load( atomics::memory_order_acquire )) {
-            cds::OS::ThreadId thId = nullThreadId;
-            if ( !hprec->m_idOwner.compare_exchange_strong( thId, curThreadId, atomics::memory_order_relaxed, atomics::memory_order_relaxed ))
-                continue;
-            hprec->m_bFree.store( false, atomics::memory_order_release );
-            return hprec;
+        // In elastic mode the records created on the current NUMA node are preferred
+        bool const bNodeLocal = capacity_mode_ == elastic_capacity;
+        unsigned int const nNode = bNodeLocal ? current_numa_node() : 0;
+        for ( int nPass = bNodeLocal ? 0 : 1; nPass < 2; ++nPass ) {
+            for ( hprec = thread_list_.load( atomics::memory_order_acquire ); hprec; hprec = hprec->m_pNextNode.load( atomics::memory_order_acquire )) {
+                if ( nPass == 0 && hprec->m_nNode != nNode )
+                    continue;
+                cds::OS::ThreadId thId = nullThreadId;
+                if ( !hprec->m_idOwner.compare_exchange_strong( thId, curThreadId, atomics::memory_order_relaxed, atomics::memory_order_relaxed ))
+                    continue;
+                hprec->m_bFree.store( false, atomics::memory_order_release );
+                return hprec;
+            }
         }
 
         // No HP records available for reuse
@@ -262,6 +583,7 @@ namespace cds { namespace gc { namespace hp {
         pRec->hazards_.clear();
         scan( pRec );
         help_scan( pRec );
+        thread_count_.fetch_sub( 1, atomics::memory_order_relaxed );
         pRec->m_idOwner.store( cds::OS::c_NullThreadId, atomics::memory_order_release );
     }
 
@@ -423,7 +745,7 @@ namespace cds { namespace gc { namespace hp {
             auto itEnd = plist.end();
             retired_ptr* insert_pos = first_retired;
             for ( retired_ptr* it = first_retired; it != last_retired; ++it ) {
-                if ( std::binary_search( itBegin, itEnd, first_retired->m_p )) {
+                if ( std::binary_search( itBegin, itEnd, it->m_p )) {
                     if ( insert_pos != it )
                         *insert_pos = *it;
                     ++insert_pos;
@@ -438,6 +760,132 @@ namespace cds { namespace gc { namespace hp {
         }
     }
 
+    CDS_EXPORT_API void smr::vectorized_scan( thread_data* pThreadRec )
+    {
+        thread_record* pRec = static_cast<thread_record*>( pThreadRec );
+
+        CDS_HPSTAT( ++pThreadRec->scan_count_ );
+
+        // Stage 1: Scan HP list and copy non-null values to the snapshot
+
+        hazard_snapshot& snapshot = pRec->m_Snapshot;
+        snapshot.clear();
+
+        thread_record* pNode = thread_list_.load( atomics::memory_order_acquire );
+        while ( pNode ) {
+            if ( pNode->m_idOwner.load( std::memory_order_relaxed ) != cds::OS::c_NullThreadId ) {
+                for ( size_t i = 0; i < get_hazard_ptr_count(); ++i ) {
+                    pRec->sync();
+                    void * hptr = pNode->hazards_[i].get();
+                    if ( hptr )
+                        snapshot.push( hptr );
+                }
+            }
+            pNode = pNode->m_pNextNode.load( atomics::memory_order_relaxed );
+        }
+
+        retired_array& retired = pRec->retired_;
+        retired_ptr* first_retired = retired.first();
+        retired_ptr* last_retired = retired.last();
+
+        if ( snapshot.empty()) {
+            // No guarded pointers - all retired pointers may be freed
+            for ( retired_ptr* it = first_retired; it != last_retired; ++it ) {
+                it->free();
+                CDS_HPSTAT( ++pRec->free_count_ );
+            }
+            retired.reset( 0 );
+            return;
+        }
+
+        CDS_HPSTAT( pRec->snapshot_hp_count_ += snapshot.size());
+        if ( snapshot.seal()) {
+            CDS_HPSTAT( ++pRec->hash_scan_count_ );
+        }
+        else {
+            CDS_HPSTAT( ++pRec->simd_scan_count_ );
+        }
+
+        // Stage 2: Filter retired pointers against the snapshot
+        retired_ptr* insert_pos = first_retired;
+        for ( retired_ptr* it = first_retired; it != last_retired; ++it ) {
+            if ( snapshot.contains( it->m_p )) {
+                if ( insert_pos != it )
+                    *insert_pos = *it;
+                ++insert_pos;
+            }
+            else {
+                it->free();
+                CDS_HPSTAT( ++pRec->free_count_ );
+            }
+        }
+
+        retired.reset( insert_pos - first_retired );
+    }
+
+    CDS_EXPORT_API void smr::resize_retired( thread_data* pThreadRec )
+    {
+        thread_record* pRec = static_cast<thread_record*>( pThreadRec );
+        assert( pRec->m_bExternalRetired );
+
+        retired_array& retired = pRec->retired_;
+        size_t const nCapacity = calc_elastic_retired_size( retired.size());
+        size_t const nCurCapacity = retired.capacity();
+
+        // Grow immediately, shrink with hysteresis to avoid resizing on every scan
+        if ( nCurCapacity < nCapacity || nCurCapacity > nCapacity * 4 ) {
+            retired_ptr* arr = reinterpret_cast<retired_ptr*>( s_alloc_memory( retired_array::calc_array_size( nCapacity )));
+            s_free_memory( retired.relocate( arr, nCapacity ));
+            CDS_HPSTAT( ++pRec->retired_resize_count_ );
+        }
+    }
+
+    CDS_EXPORT_API void smr::start_dispose_thread( size_t nMaxBacklog )
+    {
+        if ( !reclaimer_.load( atomics::memory_order_acquire )) {
+            if ( nMaxBacklog == 0 )
+                nMaxBacklog = std::max( get_max_retired_ptr_count(), calc_retired_size( 0, hazard_ptr_count_, max_thread_count_ )) * 16;
+
+            reclaimer* r = new( s_alloc_memory( sizeof( reclaimer ))) reclaimer( *this, nMaxBacklog );
+            reclaimer* expected = nullptr;
+            if ( !reclaimer_.compare_exchange_strong( expected, r, atomics::memory_order_release, atomics::memory_order_relaxed )) {
+                r->stop();
+                r->~reclaimer();
+                s_free_memory( r );
+            }
+        }
+    }
+
+    CDS_EXPORT_API void smr::offload( thread_data* pRec )
+    {
+        reclaimer* r = reclaimer_.load( atomics::memory_order_acquire );
+        retired_array& retired = pRec->retired_;
+
+        if ( r && r->offload( retired.first(), retired.last()))
+            retired.reset( 0 );
+        else
+            scan( pRec );
+    }
+
+    CDS_EXPORT_API void smr::find_blocking_thread( thread_data* pRec )
+    {
+        assert( pRec->retired_.size() > 0 );
+        void* const p = pRec->retired_.first()->m_p;
+
+        for ( thread_record* pNode = thread_list_.load( atomics::memory_order_acquire ); pNode; pNode = pNode->m_pNextNode.load( atomics::memory_order_relaxed )) {
+            cds::OS::ThreadId const owner = pNode->m_idOwner.load( atomics::memory_order_relaxed );
+            if ( owner == cds::OS::c_NullThreadId )
+                continue;
+
+            for ( size_t i = 0; i < get_hazard_ptr_count(); ++i ) {
+                if ( pNode->hazards_[i].get() == p ) {
+                    telemetry_.blocked_by( owner );
+                    return;
+                }
+            }
+        }
+    }
+
     CDS_EXPORT_API void smr::help_scan( thread_data* pThis )
     {
         assert( static_cast<thread_record*>( pThis )->m_idOwner.load( atomics::memory_order_relaxed ) == cds::OS::get_current_thread_id());
@@ -503,11 +951,41 @@ namespace cds { namespace gc { namespace hp {
             st.free_count      += hprec->free_count_;
             st.scan_count      += hprec->scan_count_;
             st.help_scan_count += hprec->help_scan_count_;
+            st.retired_resize_count += hprec->retired_resize_count_;
+            st.simd_scan_count += hprec->simd_scan_count_;
+            st.hash_scan_count += hprec->hash_scan_count_;
+            st.snapshot_hp_count += hprec->snapshot_hp_count_;
             CDS_TSAN_ANNOTATE_IGNORE_READS_END;
         }
+
+        reclaimer* r = reclaimer_.load( atomics::memory_order_acquire );
+        if ( r ) {
+            st.offload_count = r->offload_count();
+            st.offload_retired_count = r->offload_retired_count();
+            st.offload_reject_count = r->reject_count();
+            st.dispose_thread_free_count = r->free_count();
+            st.free_count += st.dispose_thread_free_count;
+        }
 #   endif
     }
 
+    CDS_EXPORT_API void smr::telemetry( cds::gc::telemetry::snapshot& st )
+    {
+        size_t nRetired = 0;
+        size_t nFreed = 0;
+        for ( thread_record* hprec = thread_list_.load( atomics::memory_order_acquire ); hprec; hprec = hprec->m_pNextNode.load( atomics::memory_order_relaxed )) {
+            nRetired += hprec->telemetry_.retired();
+            nFreed += hprec->telemetry_.freed();
+        }
+
+        reclaimer* r = reclaimer_.load( atomics::memory_order_acquire );
+        if ( r )
+            nFreed += r->free_count();
+
+        // The counters are read non-atomically as a whole, so the difference may be negative for a moment
+        telemetry_.get( st, nRetired > nFreed ? nRetired - nFreed : 0 );
+    }
+
 }}} // namespace cds::gc::hp
 
 CDS_EXPORT_API /*static*/ cds::gc::HP::stat const& cds::gc::HP::postmortem_statistics()
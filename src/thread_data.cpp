@@ -31,6 +31,7 @@
 #include <cds/threading/details/_common.h>
 #include <cds/gc/hp.h>
 #include <cds/gc/dhp.h>
+#include <cds/gc/he.h>
 
 namespace cds { namespace threading {
 
@@ -44,6 +45,8 @@ namespace cds { namespace threading {
                 cds::gc::hp::smr::attach_thread();
             if ( cds::gc::DHP::isUsed())
                 cds::gc::dhp::smr::attach_thread();
+            if ( cds::gc::HE::isUsed())
+                cds::gc::he::smr::attach_thread();
 
             if ( cds::urcu::details::singleton<cds::urcu::general_instant_tag>::isUsed())
                 m_pGPIRCU = cds::urcu::details::singleton<cds::urcu::general_instant_tag>::attach_thread();
@@ -54,6 +57,10 @@ namespace cds { namespace threading {
 #ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
             if ( cds::urcu::details::singleton<cds::urcu::signal_buffered_tag>::isUsed())
                 m_pSHBRCU = cds::urcu::details::singleton<cds::urcu::signal_buffered_tag>::attach_thread();
+#endif
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+            if ( cds::urcu::details::singleton<cds::urcu::general_membarrier_tag>::isUsed())
+                m_pGPMRCU = cds::urcu::details::singleton<cds::urcu::general_membarrier_tag>::attach_thread();
 #endif
         }
     }
@@ -61,6 +68,8 @@ namespace cds { namespace threading {
     CDS_EXPORT_API bool ThreadData::fini()
     {
         if ( --m_nAttachCount == 0 ) {
+            if ( cds::gc::HE::isUsed())
+                cds::gc::he::smr::detach_thread();
             if ( cds::gc::DHP::isUsed())
                 cds::gc::dhp::smr::detach_thread();
             if ( cds::gc::HP::isUsed())
@@ -83,6 +92,12 @@ namespace cds { namespace threading {
                 cds::urcu::details::singleton<cds::urcu::signal_buffered_tag>::detach_thread( m_pSHBRCU );
                 m_pSHBRCU = nullptr;
             }
+#endif
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+            if ( cds::urcu::details::singleton<cds::urcu::general_membarrier_tag>::isUsed()) {
+                cds::urcu::details::singleton<cds::urcu::general_membarrier_tag>::detach_thread( m_pGPMRCU );
+                m_pGPMRCU = nullptr;
+            }
 #endif
             return true;
         }
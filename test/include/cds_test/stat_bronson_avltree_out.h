@@ -32,6 +32,7 @@
 #define CDSTEST_STAT_BRONSONAVLTREE_OUT_H
 
 #include <cds_test/stress_test.h>
+#include <sstream>
 #include <cds/container/details/bronson_avltree_base.h>
 
 namespace cds_test {
@@ -43,11 +44,20 @@ namespace cds_test {
 
     static inline property_stream& operator <<( property_stream& o, cds::container::bronson_avltree::stat<> const& s )
     {
+        {
+            std::stringstream stm;
+            for ( unsigned int i = 0; i < sizeof( s.m_nFindLevelRetry ) / sizeof( s.m_nFindLevelRetry[0] ); ++i )
+                stm << " " << static_cast<size_t>( s.m_nFindLevelRetry[i] );
+            o << CDSSTRESS_STAT_OUT_( "stat.find_level_retry", stm.str().substr( 1 ).c_str());
+        }
+
         return o
             << CDSSTRESS_STAT_OUT( s, m_nFindSuccess )
             << CDSSTRESS_STAT_OUT( s, m_nFindFailed )
             << CDSSTRESS_STAT_OUT( s, m_nFindRetry )
             << CDSSTRESS_STAT_OUT( s, m_nFindWaitShrinking )
+            << CDSSTRESS_STAT_OUT( s, m_nFindOptimisticBackoff )
+            << CDSSTRESS_STAT_OUT( s, m_nFindOptimisticFallback )
             << CDSSTRESS_STAT_OUT( s, m_nInsertSuccess )
             << CDSSTRESS_STAT_OUT( s, m_nInsertFailed )
             << CDSSTRESS_STAT_OUT( s, m_nRelaxedInsertFailed )
@@ -74,6 +84,10 @@ namespace cds_test {
             << CDSSTRESS_STAT_OUT( s, m_nRightLeftRotation )
             << CDSSTRESS_STAT_OUT( s, m_nInsertRebalanceReq )
             << CDSSTRESS_STAT_OUT( s, m_nRemoveRebalanceReq )
+            << CDSSTRESS_STAT_OUT( s, m_nEraseRange )
+            << CDSSTRESS_STAT_OUT( s, m_nEraseRangeItem )
+            << CDSSTRESS_STAT_OUT( s, m_nRangeMovedItem )
+            << CDSSTRESS_STAT_OUT( s, m_nRangeSweepRetry )
             << CDSSTRESS_STAT_OUT( s, m_nRotateAfterRightRotation )
             << CDSSTRESS_STAT_OUT( s, m_nRemoveAfterRightRotation )
             << CDSSTRESS_STAT_OUT( s, m_nDamageAfterRightRotation )
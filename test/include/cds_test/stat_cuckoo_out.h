@@ -73,6 +73,21 @@ namespace cds_test {
         return o;
     }
 
+    static inline property_stream& operator <<( property_stream& o, cds::intrusive::cuckoo::optimistic_stat const& s )
+    {
+        return o
+            << static_cast<cds::intrusive::cuckoo::striping_stat const&>( s )
+            << CDSSTRESS_STAT_OUT( s, m_nReadCount )
+            << CDSSTRESS_STAT_OUT( s, m_nReadRetryCount )
+            << CDSSTRESS_STAT_OUT( s, m_nReadFallbackCount )
+            << CDSSTRESS_STAT_OUT( s, m_nSynchronizeCount );
+    }
+
+    static inline property_stream& operator <<( property_stream& o, cds::intrusive::cuckoo::empty_optimistic_stat const& /*s*/ )
+    {
+        return o;
+    }
+
     static inline property_stream& operator <<( property_stream& o, cds::intrusive::cuckoo::stat const& s )
     {
         return o
@@ -103,7 +118,10 @@ namespace cds_test {
             << CDSSTRESS_STAT_OUT( s, m_nFindSuccess )
             << CDSSTRESS_STAT_OUT( s, m_nFindFailed )
             << CDSSTRESS_STAT_OUT( s, m_nFindWithSuccess )
-            << CDSSTRESS_STAT_OUT( s, m_nFindWithFailed );
+            << CDSSTRESS_STAT_OUT( s, m_nFindWithFailed )
+            << CDSSTRESS_STAT_OUT( s, m_nPathSearchCount )
+            << CDSSTRESS_STAT_OUT( s, m_nPathFailedCount )
+            << CDSSTRESS_STAT_OUT( s, m_nPathMoveCount );
     }
 
     static inline property_stream& operator <<( property_stream& o, cds::intrusive::cuckoo::empty_stat const& /*s*/ )
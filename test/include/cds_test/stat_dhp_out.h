@@ -51,7 +51,17 @@ namespace cds_test {
             << CDS_HPSTAT_OUT( s, hp_block_count )
             << CDS_HPSTAT_OUT( s, retired_block_count )
             << CDS_HPSTAT_OUT( s, hp_extend_count )
-            << CDS_HPSTAT_OUT( s, retired_extend_count );
+            << CDS_HPSTAT_OUT( s, retired_extend_count )
+            << CDS_HPSTAT_OUT( s, hp_block_cache_hit )
+            << CDS_HPSTAT_OUT( s, hp_block_reuse_count )
+            << CDS_HPSTAT_OUT( s, retired_block_cache_hit )
+            << CDS_HPSTAT_OUT( s, retired_block_reuse_count )
+            << CDS_HPSTAT_OUT( s, offload_count )
+            << CDS_HPSTAT_OUT( s, offload_retired_count )
+            << CDS_HPSTAT_OUT( s, offload_reject_count )
+            << CDS_HPSTAT_OUT( s, dispose_thread_free_count )
+            << CDS_HPSTAT_OUT( s, throttle_count )
+            << CDS_HPSTAT_OUT( s, stalled_guard_count );
 #   undef CDS_HPSTAT_OUT
 #else
         return o;
@@ -76,7 +86,17 @@ static inline std::ostream& operator <<( std::ostream& o, cds::gc::DHP::stat con
         << CDS_HPSTAT_OUT( s, hp_block_count )
         << CDS_HPSTAT_OUT( s, retired_block_count )
         << CDS_HPSTAT_OUT( s, hp_extend_count )
-        << CDS_HPSTAT_OUT( s, retired_extend_count );
+        << CDS_HPSTAT_OUT( s, retired_extend_count )
+        << CDS_HPSTAT_OUT( s, hp_block_cache_hit )
+        << CDS_HPSTAT_OUT( s, hp_block_reuse_count )
+        << CDS_HPSTAT_OUT( s, retired_block_cache_hit )
+        << CDS_HPSTAT_OUT( s, retired_block_reuse_count )
+        << CDS_HPSTAT_OUT( s, offload_count )
+        << CDS_HPSTAT_OUT( s, offload_retired_count )
+        << CDS_HPSTAT_OUT( s, offload_reject_count )
+        << CDS_HPSTAT_OUT( s, dispose_thread_free_count )
+        << CDS_HPSTAT_OUT( s, throttle_count )
+        << CDS_HPSTAT_OUT( s, stalled_guard_count );
 #   undef CDS_HPSTAT_OUT
 #else
     return o;
@@ -61,6 +61,7 @@ namespace cds_test {
             << CDSSTRESS_STAT_OUT( s, m_nSlotChanged )
             << CDSSTRESS_STAT_OUT( s, m_nSlotConverting )
             << CDSSTRESS_STAT_OUT( s, m_nArrayNodeCount )
+            << CDSSTRESS_STAT_OUT( s, m_nArrayNodeFreed )
             << CDSSTRESS_STAT_OUT( s, m_nHeight );
     }
 
@@ -47,7 +47,15 @@ namespace cds_test {
             << CDS_HPSTAT_OUT( s, free_count )
             << CDS_HPSTAT_OUT( s, scan_count )
             << CDS_HPSTAT_OUT( s, help_scan_count )
-            << CDS_HPSTAT_OUT( s, thread_rec_count );
+            << CDS_HPSTAT_OUT( s, thread_rec_count )
+            << CDS_HPSTAT_OUT( s, retired_resize_count )
+            << CDS_HPSTAT_OUT( s, offload_count )
+            << CDS_HPSTAT_OUT( s, offload_retired_count )
+            << CDS_HPSTAT_OUT( s, offload_reject_count )
+            << CDS_HPSTAT_OUT( s, dispose_thread_free_count )
+            << CDS_HPSTAT_OUT( s, simd_scan_count )
+            << CDS_HPSTAT_OUT( s, hash_scan_count )
+            << CDS_HPSTAT_OUT( s, snapshot_hp_count );
 #   undef CDS_HPSTAT_OUT
 #else
         return o;
@@ -68,7 +76,15 @@ static inline std::ostream& operator <<( std::ostream& o, cds::gc::HP::stat cons
         << CDS_HPSTAT_OUT( s, free_count )
         << CDS_HPSTAT_OUT( s, scan_count )
         << CDS_HPSTAT_OUT( s, help_scan_count )
-        << CDS_HPSTAT_OUT( s, thread_rec_count );
+        << CDS_HPSTAT_OUT( s, thread_rec_count )
+        << CDS_HPSTAT_OUT( s, retired_resize_count )
+        << CDS_HPSTAT_OUT( s, offload_count )
+        << CDS_HPSTAT_OUT( s, offload_retired_count )
+        << CDS_HPSTAT_OUT( s, offload_reject_count )
+        << CDS_HPSTAT_OUT( s, dispose_thread_free_count )
+        << CDS_HPSTAT_OUT( s, simd_scan_count )
+        << CDS_HPSTAT_OUT( s, hash_scan_count )
+        << CDS_HPSTAT_OUT( s, snapshot_hp_count );
 #   undef CDS_HPSTAT_OUT
 #else
     return o;
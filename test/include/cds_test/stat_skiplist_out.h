@@ -83,7 +83,8 @@ namespace cds_test {
             << CDSSTRESS_STAT_OUT( s, m_nEraseWhileFind )
             << CDSSTRESS_STAT_OUT( s, m_nExtractWhileFind )
             << CDSSTRESS_STAT_OUT( s, m_nMarkFailed )
-            << CDSSTRESS_STAT_OUT( s, m_nEraseContention );
+            << CDSSTRESS_STAT_OUT( s, m_nEraseContention )
+            << CDSSTRESS_STAT_OUT( s, m_nFingerRestart );
     }
 
 } // namespace cds_test
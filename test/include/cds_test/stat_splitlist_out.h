@@ -58,7 +58,10 @@ namespace cds_test {
             << CDSSTRESS_STAT_OUT( s, m_nBucketCount )
             << CDSSTRESS_STAT_OUT( s, m_nInitBucketRecursive )
             << CDSSTRESS_STAT_OUT( s, m_nInitBucketContention )
-            << CDSSTRESS_STAT_OUT( s, m_nBucketsExhausted );
+            << CDSSTRESS_STAT_OUT( s, m_nBucketsExhausted )
+            << CDSSTRESS_STAT_OUT( s, m_nLookupTraversed )
+            << CDSSTRESS_STAT_OUT( s, m_nSkipHit )
+            << CDSSTRESS_STAT_OUT( s, m_nSkipCreated );
     }
 
 } // namespace cds_test
@@ -35,6 +35,7 @@
 #ifdef CDS_ENABLE_HPSTAT
 #   include <cds_test/stat_hp_out.h>
 #   include <cds_test/stat_dhp_out.h>
+#   include <cds_test/stat_he_out.h>
 #endif
 
 namespace cds_test {
@@ -73,6 +74,11 @@ namespace cds_test {
             cds::gc::DHP::statistics( st );
             propout() << st;
         }
+        {
+            cds::gc::HE::stat st;
+            cds::gc::HE::statistics( st );
+            propout() << st;
+        }
 #endif
     }
 
@@ -33,16 +33,20 @@
 #include <cds/init.h>
 #include <cds/gc/hp.h>
 #include <cds/gc/dhp.h>
+#include <cds/gc/he.h>
 #ifdef CDSUNIT_USE_URCU
 #   include <cds/urcu/general_instant.h>
 #   include <cds/urcu/general_buffered.h>
 #   include <cds/urcu/general_threaded.h>
 #   include <cds/urcu/signal_buffered.h>
+#   include <cds/urcu/general_membarrier.h>
+#   include <memory>
 #endif
 
 #ifdef CDS_ENABLE_HPSTAT
 #   include <cds_test/stat_hp_out.h>
 #   include <cds_test/stat_dhp_out.h>
+#   include <cds_test/stat_he_out.h>
 #   include <iostream>
 #endif
 #include <random>
@@ -67,17 +71,36 @@ int main( int argc, char **argv )
         cds_test::config const& general_cfg = cds_test::stress_fixture::get_config( "General" );
 
         // Init SMR
+        std::string const hp_scan_strategy = general_cfg.get( "hp_scan_strategy", "inplace" );
         cds::gc::HP hzpGC(
             general_cfg.get_size_t( "hazard_pointer_count", 16 ),
             general_cfg.get_size_t( "hp_max_thread_count", 0 ),
             general_cfg.get_size_t( "hp_retired_ptr_count", 0 ),
-            general_cfg.get( "hp_scan_strategy", "inplace" ) == "inplace" ? cds::gc::HP::scan_type::inplace : cds::gc::HP::scan_type::classic
+            hp_scan_strategy == "inplace" ? cds::gc::HP::scan_type::inplace
+                : hp_scan_strategy == "vectorized" ? cds::gc::HP::scan_type::vectorized
+                : cds::gc::HP::scan_type::classic,
+            general_cfg.get( "hp_capacity_mode", "fixed" ) == "elastic" ? cds::gc::HP::capacity_mode::elastic : cds::gc::HP::capacity_mode::fixed
         );
 
         cds::gc::DHP dhpGC(
             general_cfg.get_size_t( "dhp_init_guard_count", 16 )
         );
 
+        cds::gc::HE heGC(
+            general_cfg.get_size_t( "hazard_pointer_count", 16 ),
+            general_cfg.get_size_t( "hp_max_thread_count", 0 ),
+            general_cfg.get_size_t( "hp_retired_ptr_count", 0 ),
+            general_cfg.get_size_t( "he_era_frequency", 0 )
+        );
+
+        if ( general_cfg.get_bool( "smr_dispose_thread", false )) {
+            cds::gc::HP::start_dispose_thread( general_cfg.get_size_t( "smr_dispose_backlog", 0 ));
+            cds::gc::DHP::start_dispose_thread( general_cfg.get_size_t( "smr_dispose_backlog", 0 ));
+        }
+
+        if ( general_cfg.get_size_t( "dhp_watermark", 0 ))
+            cds::gc::DHP::set_watermark( general_cfg.get_size_t( "dhp_watermark", 0 ));
+
 #ifdef CDSUNIT_USE_URCU
         size_t rcu_buffer_size = general_cfg.get_size_t( "rcu_buffer_size", 256 );
 
@@ -95,6 +118,13 @@ int main( int argc, char **argv )
         typedef cds::urcu::gc< cds::urcu::signal_buffered<> >    rcu_shb;
         rcu_shb   shbRCU( rcu_buffer_size, SIGUSR1 );
 #   endif
+
+#   ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cds::urcu::gc< cds::urcu::general_membarrier<> > rcu_gpm;
+        std::unique_ptr< rcu_gpm > gpmRCU;
+        if ( rcu_gpm::is_supported())
+            gpmRCU.reset( new rcu_gpm( rcu_buffer_size ));
+#   endif
 #endif // CDSUNIT_USE_URCU
 
         cds::threading::Manager::attachThread();
@@ -117,6 +147,12 @@ int main( int argc, char **argv )
         EXPECT_EQ( st.retired_count, st.free_count );
         std::cout << st;
     }
+    {
+        cds::gc::HE::stat const& st = cds::gc::HE::postmortem_statistics();
+        EXPECT_EQ( st.guard_allocated, st.guard_freed );
+        EXPECT_EQ( st.retired_count, st.free_count );
+        std::cout << st;
+    }
 #endif
 
     cds::Terminate();
@@ -0,0 +1,172 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2017
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef CDSUNIT_MAP_TYPE_BLINK_TREE_H
+#define CDSUNIT_MAP_TYPE_BLINK_TREE_H
+
+#include "map_type.h"
+
+#include <cds/container/blink_tree_map_rcu.h>
+
+#include <cds_test/stat_blink_tree_out.h>
+
+namespace map {
+
+    template <class GC, typename Key, typename T, typename Traits = cc::blink_tree::traits >
+    class BLinkTreeMap : public cc::BLinkTreeMap< GC, Key, T, Traits >
+    {
+        typedef cc::BLinkTreeMap< GC, Key, T, Traits > base_class;
+    public:
+        template <typename Config>
+        BLinkTreeMap( Config const& /*cfg*/ )
+            : base_class()
+        {}
+
+        std::pair<Key, bool> extract_min_key()
+        {
+            auto xp = base_class::extract_min();
+            if ( xp )
+                return std::make_pair( xp->first, true );
+            return std::make_pair( Key(), false );
+        }
+
+        std::pair<Key, bool> extract_max_key()
+        {
+            auto xp = base_class::extract_max();
+            if ( xp )
+                return std::make_pair( xp->first, true );
+            return std::make_pair( Key(), false );
+        }
+
+        // for testing
+        static constexpr bool const c_bExtractSupported = true;
+        static constexpr bool const c_bLoadFactorDepended = false;
+        static constexpr bool const c_bEraseExactKey = false;
+    };
+
+    struct tag_BLinkTreeMap;
+
+    template <typename Key, typename Value>
+    struct map_type< tag_BLinkTreeMap, Key, Value >: public map_type_base< Key, Value >
+    {
+        typedef map_type_base< Key, Value >      base_class;
+        typedef typename base_class::key_compare compare;
+        typedef typename base_class::key_less    less;
+
+        struct BLinkTreeMap_less: public
+            cc::blink_tree::make_traits<
+                co::less< less >
+                ,co::item_counter< cds::atomicity::cache_friendly_item_counter >
+            >::type
+        {};
+        typedef BLinkTreeMap< rcu_gpi, Key, Value, BLinkTreeMap_less > BLinkTreeMap_rcu_gpi_less;
+        typedef BLinkTreeMap< rcu_gpb, Key, Value, BLinkTreeMap_less > BLinkTreeMap_rcu_gpb_less;
+        typedef BLinkTreeMap< rcu_gpt, Key, Value, BLinkTreeMap_less > BLinkTreeMap_rcu_gpt_less;
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        typedef BLinkTreeMap< rcu_shb, Key, Value, BLinkTreeMap_less > BLinkTreeMap_rcu_shb_less;
+#endif
+
+        struct BLinkTreeMap_cmp_stat: public
+            cc::blink_tree::make_traits<
+                co::compare< compare >
+                ,co::item_counter< cds::atomicity::cache_friendly_item_counter >
+                ,co::stat< cc::blink_tree::stat<>>
+            >::type
+        {};
+        typedef BLinkTreeMap< rcu_gpi, Key, Value, BLinkTreeMap_cmp_stat > BLinkTreeMap_rcu_gpi_cmp_stat;
+        typedef BLinkTreeMap< rcu_gpb, Key, Value, BLinkTreeMap_cmp_stat > BLinkTreeMap_rcu_gpb_cmp_stat;
+        typedef BLinkTreeMap< rcu_gpt, Key, Value, BLinkTreeMap_cmp_stat > BLinkTreeMap_rcu_gpt_cmp_stat;
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        typedef BLinkTreeMap< rcu_shb, Key, Value, BLinkTreeMap_cmp_stat > BLinkTreeMap_rcu_shb_cmp_stat;
+#endif
+
+        struct BLinkTreeMap_less_node64_stat: public
+            cc::blink_tree::make_traits<
+                co::less< less >
+                ,cc::blink_tree::node_size< 64 >
+                ,co::item_counter< cds::atomicity::cache_friendly_item_counter >
+                ,co::stat< cc::blink_tree::stat<>>
+            >::type
+        {};
+        typedef BLinkTreeMap< rcu_gpi, Key, Value, BLinkTreeMap_less_node64_stat > BLinkTreeMap_rcu_gpi_less_node64_stat;
+        typedef BLinkTreeMap< rcu_gpb, Key, Value, BLinkTreeMap_less_node64_stat > BLinkTreeMap_rcu_gpb_less_node64_stat;
+    };
+
+    template <typename GC, typename Key, typename T, typename Traits>
+    static inline void print_stat( cds_test::property_stream& o, BLinkTreeMap<GC, Key, T, Traits> const& m )
+    {
+        o << m.statistics();
+    }
+
+    template <typename GC, typename Key, typename T, typename Traits>
+    static inline void check_before_cleanup( BLinkTreeMap<GC, Key, T, Traits>& m )
+    {
+        EXPECT_TRUE( m.check_consistency()) << "Internal tree structure violation";
+    }
+
+
+#define CDSSTRESS_BLinkTreeMap_case( fixture, test_case, blink_map_type, key_type, value_type ) \
+    TEST_F( fixture, blink_map_type ) \
+    { \
+        typedef map::map_type< tag_BLinkTreeMap, key_type, value_type >::blink_map_type map_type; \
+        test_case<map_type>(); \
+    }
+
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+#   define CDSSTRESS_BLinkTreeMap_SHRCU( fixture, test_case, key_type, value_type ) \
+        CDSSTRESS_BLinkTreeMap_case( fixture, test_case, BLinkTreeMap_rcu_shb_less,             key_type, value_type ) \
+        CDSSTRESS_BLinkTreeMap_case( fixture, test_case, BLinkTreeMap_rcu_shb_cmp_stat,         key_type, value_type ) \
+
+#else
+#   define CDSSTRESS_BLinkTreeMap_SHRCU( fixture, test_case, key_type, value_type )
+#endif
+
+#if defined(CDS_STRESS_TEST_LEVEL) && CDS_STRESS_TEST_LEVEL > 0
+#   define CDSSTRESS_BLinkTreeMap_1( fixture, test_case, key_type, value_type ) \
+        CDSSTRESS_BLinkTreeMap_case( fixture, test_case, BLinkTreeMap_rcu_gpi_cmp_stat,         key_type, value_type ) \
+        CDSSTRESS_BLinkTreeMap_case( fixture, test_case, BLinkTreeMap_rcu_gpi_less_node64_stat, key_type, value_type ) \
+        CDSSTRESS_BLinkTreeMap_SHRCU( fixture, test_case, key_type, value_type )
+
+#else
+#   define CDSSTRESS_BLinkTreeMap_1( fixture, test_case, key_type, value_type )
+#endif
+
+#define CDSSTRESS_BLinkTreeMap( fixture, test_case, key_type, value_type ) \
+    CDSSTRESS_BLinkTreeMap_case( fixture, test_case, BLinkTreeMap_rcu_gpi_less,                 key_type, value_type ) \
+    CDSSTRESS_BLinkTreeMap_case( fixture, test_case, BLinkTreeMap_rcu_gpb_less,                 key_type, value_type ) \
+    CDSSTRESS_BLinkTreeMap_case( fixture, test_case, BLinkTreeMap_rcu_gpt_less,                 key_type, value_type ) \
+    CDSSTRESS_BLinkTreeMap_case( fixture, test_case, BLinkTreeMap_rcu_gpb_cmp_stat,             key_type, value_type ) \
+    CDSSTRESS_BLinkTreeMap_case( fixture, test_case, BLinkTreeMap_rcu_gpt_cmp_stat,             key_type, value_type ) \
+    CDSSTRESS_BLinkTreeMap_case( fixture, test_case, BLinkTreeMap_rcu_gpb_less_node64_stat,     key_type, value_type ) \
+    CDSSTRESS_BLinkTreeMap_1( fixture, test_case, key_type, value_type ) \
+
+}   // namespace map
+
+#endif // ifndef CDSUNIT_MAP_TYPE_BLINK_TREE_H
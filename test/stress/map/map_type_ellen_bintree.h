@@ -156,6 +156,16 @@ namespace map {
         typedef EllenBinTreeMap< rcu_shb, Key, Value, traits_EllenBinTreeMap_shb > EllenBinTreeMap_rcu_shb;
 #endif
 
+        struct traits_EllenBinTreeMap_cached: public cc::ellen_bintree::make_set_traits<
+                co::less< less >
+                ,co::node_allocator< cc::ellen_bintree::cached_allocator<> >
+                ,cc::ellen_bintree::update_desc_allocator< cc::ellen_bintree::cached_allocator<> >
+                ,co::item_counter< cds::atomicity::cache_friendly_item_counter >
+            >::type
+        {};
+        typedef EllenBinTreeMap< cds::gc::HP, Key, Value, traits_EllenBinTreeMap_cached > EllenBinTreeMap_hp_cached;
+        typedef EllenBinTreeMap< rcu_gpb, Key, Value, traits_EllenBinTreeMap_cached > EllenBinTreeMap_rcu_gpb_cached;
+
         struct traits_EllenBinTreeMap_yield : public traits_EllenBinTreeMap
         {
             typedef cds::backoff::yield back_off;
@@ -308,6 +318,7 @@ namespace map {
     CDSSTRESS_EllenBinTreeMap_case( fixture, test_case, EllenBinTreeMap_dhp,            key_type, value_type ) \
     CDSSTRESS_EllenBinTreeMap_case( fixture, test_case, EllenBinTreeMap_hp_stat,        key_type, value_type ) \
     CDSSTRESS_EllenBinTreeMap_case( fixture, test_case, EllenBinTreeMap_dhp_stat,       key_type, value_type ) \
+    CDSSTRESS_EllenBinTreeMap_case( fixture, test_case, EllenBinTreeMap_hp_cached,      key_type, value_type ) \
     CDSSTRESS_EllenBinTreeMap_HP_1( fixture, test_case, key_type, value_type ) \
 
 #define CDSSTRESS_EllenBinTreeMap_RCU( fixture, test_case, key_type, value_type ) \
@@ -315,6 +326,7 @@ namespace map {
     CDSSTRESS_EllenBinTreeMap_case( fixture, test_case, EllenBinTreeMap_rcu_gpt,        key_type, value_type ) \
     CDSSTRESS_EllenBinTreeMap_case( fixture, test_case, EllenBinTreeMap_rcu_gpb_stat,   key_type, value_type ) \
     CDSSTRESS_EllenBinTreeMap_case( fixture, test_case, EllenBinTreeMap_rcu_gpt_stat,   key_type, value_type ) \
+    CDSSTRESS_EllenBinTreeMap_case( fixture, test_case, EllenBinTreeMap_rcu_gpb_cached, key_type, value_type ) \
     CDSSTRESS_EllenBinTreeMap_RCU_1( fixture, test_case, key_type, value_type ) \
 
 #define CDSSTRESS_EllenBinTreeMap( fixture, test_case, key_type, value_type ) \
@@ -95,6 +95,7 @@ namespace map {
 
         typedef MichaelHashMap< cds::gc::HP,  typename ml::MichaelList_HP_cmp,  traits_MichaelMap_hash > MichaelMap_HP_cmp;
         typedef MichaelHashMap< cds::gc::DHP, typename ml::MichaelList_DHP_cmp, traits_MichaelMap_hash > MichaelMap_DHP_cmp;
+        typedef MichaelHashMap< cds::gc::HE,  typename ml::MichaelList_HE_cmp,  traits_MichaelMap_hash > MichaelMap_HE_cmp;
         typedef MichaelHashMap< cds::gc::nogc, typename ml::MichaelList_NOGC_cmp, traits_MichaelMap_hash > MichaelMap_NOGC_cmp;
         typedef MichaelHashMap< rcu_gpi, typename ml::MichaelList_RCU_GPI_cmp, traits_MichaelMap_hash > MichaelMap_RCU_GPI_cmp;
         typedef MichaelHashMap< rcu_gpb, typename ml::MichaelList_RCU_GPB_cmp, traits_MichaelMap_hash > MichaelMap_RCU_GPB_cmp;
@@ -102,9 +103,13 @@ namespace map {
 #ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
         typedef MichaelHashMap< rcu_shb, typename ml::MichaelList_RCU_SHB_cmp, traits_MichaelMap_hash > MichaelMap_RCU_SHB_cmp;
 #endif
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef MichaelHashMap< rcu_gpm, typename ml::MichaelList_RCU_GPM_cmp, traits_MichaelMap_hash > MichaelMap_RCU_GPM_cmp;
+#endif
 
         typedef MichaelHashMap< cds::gc::HP, typename ml::MichaelList_HP_cmp_stat, traits_MichaelMap_hash > MichaelMap_HP_cmp_stat;
         typedef MichaelHashMap< cds::gc::DHP, typename ml::MichaelList_DHP_cmp_stat, traits_MichaelMap_hash > MichaelMap_DHP_cmp_stat;
+        typedef MichaelHashMap< cds::gc::HE,  typename ml::MichaelList_HE_cmp_stat,  traits_MichaelMap_hash > MichaelMap_HE_cmp_stat;
         typedef MichaelHashMap< cds::gc::nogc, typename ml::MichaelList_NOGC_cmp_stat, traits_MichaelMap_hash > MichaelMap_NOGC_cmp_stat;
         typedef MichaelHashMap< rcu_gpi, typename ml::MichaelList_RCU_GPI_cmp_stat, traits_MichaelMap_hash > MichaelMap_RCU_GPI_cmp_stat;
         typedef MichaelHashMap< rcu_gpb, typename ml::MichaelList_RCU_GPB_cmp_stat, traits_MichaelMap_hash > MichaelMap_RCU_GPB_cmp_stat;
@@ -112,9 +117,13 @@ namespace map {
 #ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
         typedef MichaelHashMap< rcu_shb, typename ml::MichaelList_RCU_SHB_cmp_stat, traits_MichaelMap_hash > MichaelMap_RCU_SHB_cmp_stat;
 #endif
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef MichaelHashMap< rcu_gpm, typename ml::MichaelList_RCU_GPM_cmp_stat, traits_MichaelMap_hash > MichaelMap_RCU_GPM_cmp_stat;
+#endif
 
         typedef MichaelHashMap< cds::gc::HP, typename ml::MichaelList_HP_less, traits_MichaelMap_hash > MichaelMap_HP_less;
         typedef MichaelHashMap< cds::gc::DHP, typename ml::MichaelList_DHP_less, traits_MichaelMap_hash > MichaelMap_DHP_less;
+        typedef MichaelHashMap< cds::gc::HE,  typename ml::MichaelList_HE_less,  traits_MichaelMap_hash > MichaelMap_HE_less;
         typedef MichaelHashMap< cds::gc::nogc, typename ml::MichaelList_NOGC_less, traits_MichaelMap_hash > MichaelMap_NOGC_less;
         typedef MichaelHashMap< rcu_gpi, typename ml::MichaelList_RCU_GPI_less, traits_MichaelMap_hash > MichaelMap_RCU_GPI_less;
         typedef MichaelHashMap< rcu_gpb, typename ml::MichaelList_RCU_GPB_less, traits_MichaelMap_hash > MichaelMap_RCU_GPB_less;
@@ -122,9 +131,13 @@ namespace map {
 #ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
         typedef MichaelHashMap< rcu_shb, typename ml::MichaelList_RCU_SHB_less, traits_MichaelMap_hash > MichaelMap_RCU_SHB_less;
 #endif
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef MichaelHashMap< rcu_gpm, typename ml::MichaelList_RCU_GPM_less, traits_MichaelMap_hash > MichaelMap_RCU_GPM_less;
+#endif
 
         typedef MichaelHashMap< cds::gc::HP, typename ml::MichaelList_HP_less_stat, traits_MichaelMap_hash > MichaelMap_HP_less_stat;
         typedef MichaelHashMap< cds::gc::DHP, typename ml::MichaelList_DHP_less_stat, traits_MichaelMap_hash > MichaelMap_DHP_less_stat;
+        typedef MichaelHashMap< cds::gc::HE,  typename ml::MichaelList_HE_less_stat,  traits_MichaelMap_hash > MichaelMap_HE_less_stat;
         typedef MichaelHashMap< cds::gc::nogc, typename ml::MichaelList_NOGC_less_stat, traits_MichaelMap_hash > MichaelMap_NOGC_less_stat;
         typedef MichaelHashMap< rcu_gpi, typename ml::MichaelList_RCU_GPI_less_stat, traits_MichaelMap_hash > MichaelMap_RCU_GPI_less_stat;
         typedef MichaelHashMap< rcu_gpb, typename ml::MichaelList_RCU_GPB_less_stat, traits_MichaelMap_hash > MichaelMap_RCU_GPB_less_stat;
@@ -132,6 +145,29 @@ namespace map {
 #ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
         typedef MichaelHashMap< rcu_shb, typename ml::MichaelList_RCU_SHB_less_stat, traits_MichaelMap_hash > MichaelMap_RCU_SHB_less_stat;
 #endif
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef MichaelHashMap< rcu_gpm, typename ml::MichaelList_RCU_GPM_less_stat, traits_MichaelMap_hash > MichaelMap_RCU_GPM_less_stat;
+#endif
+
+        struct traits_MichaelMap_hash_cacheline: public traits_MichaelMap_hash
+        {
+            static const bool cache_line_bucket = true;
+        };
+
+        typedef MichaelHashMap< cds::gc::HP,  typename ml::MichaelList_HP_cmp,  traits_MichaelMap_hash_cacheline > MichaelMap_HP_cmp_cacheline;
+        typedef MichaelHashMap< cds::gc::DHP, typename ml::MichaelList_DHP_cmp, traits_MichaelMap_hash_cacheline > MichaelMap_DHP_cmp_cacheline;
+        typedef MichaelHashMap< cds::gc::HE,  typename ml::MichaelList_HE_cmp,  traits_MichaelMap_hash_cacheline > MichaelMap_HE_cmp_cacheline;
+        typedef MichaelHashMap< cds::gc::HP,  typename ml::MichaelList_HP_less_stat,  traits_MichaelMap_hash_cacheline > MichaelMap_HP_less_stat_cacheline;
+
+        struct traits_MichaelMap_hash_resizable: public traits_MichaelMap_hash
+        {
+            static const bool resizable = true;
+        };
+
+        typedef MichaelHashMap< cds::gc::HP,  typename ml::MichaelList_HP_cmp,  traits_MichaelMap_hash_resizable > MichaelMap_HP_cmp_resizable;
+        typedef MichaelHashMap< cds::gc::DHP, typename ml::MichaelList_DHP_cmp, traits_MichaelMap_hash_resizable > MichaelMap_DHP_cmp_resizable;
+        typedef MichaelHashMap< cds::gc::HE,  typename ml::MichaelList_HE_cmp,  traits_MichaelMap_hash_resizable > MichaelMap_HE_cmp_resizable;
+        typedef MichaelHashMap< cds::gc::HP,  typename ml::MichaelList_HP_less_stat,  traits_MichaelMap_hash_resizable > MichaelMap_HP_less_stat_resizable;
 
         typedef MichaelHashMap< cds::gc::HP, typename ml::MichaelList_HP_cmp_seqcst, traits_MichaelMap_hash > MichaelMap_HP_cmp_seqcst;
         typedef MichaelHashMap< cds::gc::DHP, typename ml::MichaelList_DHP_cmp_seqcst, traits_MichaelMap_hash > MichaelMap_DHP_cmp_seqcst;
@@ -290,6 +326,15 @@ namespace map {
 #   define CDSSTRESS_MichaelMap_SHRCU( fixture, test_case, key_type, value_type )
 #endif
 
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+#   define CDSSTRESS_MichaelMap_MBRCU( fixture, test_case, key_type, value_type ) \
+        CDSSTRESS_MichaelMap_case( fixture, test_case, MichaelMap_RCU_GPM_cmp,              key_type, value_type ) \
+        CDSSTRESS_MichaelMap_case( fixture, test_case, MichaelMap_RCU_GPM_less_stat,        key_type, value_type ) \
+
+#else
+#   define CDSSTRESS_MichaelMap_MBRCU( fixture, test_case, key_type, value_type )
+#endif
+
 #if defined(CDS_STRESS_TEST_LEVEL) && CDS_STRESS_TEST_LEVEL > 1
 #   define  CDSSTRESS_MichaelMap_HP_2( fixture, test_case, key_type, value_type ) \
         CDSSTRESS_MichaelMap_case( fixture, test_case, MichaelMap_HP_cmp_seqcst,               key_type, value_type ) \
@@ -343,6 +388,8 @@ namespace map {
         CDSSTRESS_MichaelMap_case( fixture, test_case, MichaelMap_HP_cmp_stat,                 key_type, value_type ) \
         CDSSTRESS_MichaelMap_case( fixture, test_case, MichaelMap_HP_less,                     key_type, value_type ) \
         CDSSTRESS_MichaelMap_case( fixture, test_case, MichaelMap_DHP_less_stat,               key_type, value_type ) \
+        CDSSTRESS_MichaelMap_case( fixture, test_case, MichaelMap_HE_cmp_stat,                 key_type, value_type ) \
+        CDSSTRESS_MichaelMap_case( fixture, test_case, MichaelMap_HE_less,                     key_type, value_type ) \
         \
         CDSSTRESS_MichaelMap_case( fixture, test_case, MichaelMap_Lazy_DHP_cmp,                key_type, value_type ) \
         CDSSTRESS_MichaelMap_case( fixture, test_case, MichaelMap_Lazy_HP_cmp_stat,            key_type, value_type ) \
@@ -383,6 +430,18 @@ namespace map {
     CDSSTRESS_MichaelMap_case( fixture, test_case, MichaelMap_DHP_cmp_stat,                key_type, value_type ) \
     CDSSTRESS_MichaelMap_case( fixture, test_case, MichaelMap_DHP_less,                    key_type, value_type ) \
     CDSSTRESS_MichaelMap_case( fixture, test_case, MichaelMap_HP_less_stat,                key_type, value_type ) \
+    CDSSTRESS_MichaelMap_case( fixture, test_case, MichaelMap_HE_cmp,                      key_type, value_type ) \
+    CDSSTRESS_MichaelMap_case( fixture, test_case, MichaelMap_HE_less_stat,                key_type, value_type ) \
+    \
+    CDSSTRESS_MichaelMap_case( fixture, test_case, MichaelMap_HP_cmp_cacheline,            key_type, value_type ) \
+    CDSSTRESS_MichaelMap_case( fixture, test_case, MichaelMap_DHP_cmp_cacheline,           key_type, value_type ) \
+    CDSSTRESS_MichaelMap_case( fixture, test_case, MichaelMap_HE_cmp_cacheline,            key_type, value_type ) \
+    CDSSTRESS_MichaelMap_case( fixture, test_case, MichaelMap_HP_less_stat_cacheline,      key_type, value_type ) \
+    \
+    CDSSTRESS_MichaelMap_case( fixture, test_case, MichaelMap_HP_cmp_resizable,            key_type, value_type ) \
+    CDSSTRESS_MichaelMap_case( fixture, test_case, MichaelMap_DHP_cmp_resizable,           key_type, value_type ) \
+    CDSSTRESS_MichaelMap_case( fixture, test_case, MichaelMap_HE_cmp_resizable,            key_type, value_type ) \
+    CDSSTRESS_MichaelMap_case( fixture, test_case, MichaelMap_HP_less_stat_resizable,      key_type, value_type ) \
     \
     CDSSTRESS_MichaelMap_case( fixture, test_case, MichaelMap_Lazy_HP_cmp,                 key_type, value_type ) \
     CDSSTRESS_MichaelMap_case( fixture, test_case, MichaelMap_Lazy_DHP_cmp_stat,           key_type, value_type ) \
@@ -403,6 +462,7 @@ namespace map {
     CDSSTRESS_MichaelMap_case( fixture, test_case, MichaelMap_Lazy_RCU_GPT_cmp,            key_type, value_type ) \
     CDSSTRESS_MichaelMap_case( fixture, test_case, MichaelMap_Lazy_RCU_GPB_less,           key_type, value_type ) \
     \
+    CDSSTRESS_MichaelMap_MBRCU( fixture, test_case, key_type, value_type ) \
     CDSSTRESS_MichaelMap_RCU_1( fixture, test_case, key_type, value_type ) \
     CDSSTRESS_MichaelMap_RCU_2( fixture, test_case, key_type, value_type ) \
 
@@ -35,6 +35,7 @@
 
 #include <cds/container/michael_kvlist_hp.h>
 #include <cds/container/michael_kvlist_dhp.h>
+#include <cds/container/michael_kvlist_he.h>
 #include <cds/container/michael_kvlist_rcu.h>
 #include <cds/container/michael_kvlist_nogc.h>
 
@@ -55,6 +56,7 @@ namespace map {
         {};
         typedef cc::MichaelKVList< cds::gc::HP,  Key, Value, traits_MichaelList_cmp > MichaelList_HP_cmp;
         typedef cc::MichaelKVList< cds::gc::DHP, Key, Value, traits_MichaelList_cmp > MichaelList_DHP_cmp;
+        typedef cc::MichaelKVList< cds::gc::HE,  Key, Value, traits_MichaelList_cmp > MichaelList_HE_cmp;
         typedef cc::MichaelKVList< cds::gc::nogc, Key, Value, traits_MichaelList_cmp > MichaelList_NOGC_cmp;
         typedef cc::MichaelKVList< rcu_gpi, Key, Value, traits_MichaelList_cmp > MichaelList_RCU_GPI_cmp;
         typedef cc::MichaelKVList< rcu_gpb, Key, Value, traits_MichaelList_cmp > MichaelList_RCU_GPB_cmp;
@@ -62,6 +64,9 @@ namespace map {
 #ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
         typedef cc::MichaelKVList< rcu_shb, Key, Value, traits_MichaelList_cmp > MichaelList_RCU_SHB_cmp;
 #endif
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::MichaelKVList< rcu_gpm, Key, Value, traits_MichaelList_cmp > MichaelList_RCU_GPM_cmp;
+#endif
 
         struct traits_MichaelList_cmp_stat : public traits_MichaelList_cmp
         {
@@ -69,6 +74,7 @@ namespace map {
         };
         typedef cc::MichaelKVList< cds::gc::HP,  Key, Value, traits_MichaelList_cmp_stat > MichaelList_HP_cmp_stat;
         typedef cc::MichaelKVList< cds::gc::DHP, Key, Value, traits_MichaelList_cmp_stat > MichaelList_DHP_cmp_stat;
+        typedef cc::MichaelKVList< cds::gc::HE,  Key, Value, traits_MichaelList_cmp_stat > MichaelList_HE_cmp_stat;
         typedef cc::MichaelKVList< cds::gc::nogc, Key, Value, traits_MichaelList_cmp_stat > MichaelList_NOGC_cmp_stat;
         typedef cc::MichaelKVList< rcu_gpi, Key, Value, traits_MichaelList_cmp_stat > MichaelList_RCU_GPI_cmp_stat;
         typedef cc::MichaelKVList< rcu_gpb, Key, Value, traits_MichaelList_cmp_stat > MichaelList_RCU_GPB_cmp_stat;
@@ -76,6 +82,9 @@ namespace map {
 #ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
         typedef cc::MichaelKVList< rcu_shb, Key, Value, traits_MichaelList_cmp_stat > MichaelList_RCU_SHB_cmp_stat;
 #endif
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::MichaelKVList< rcu_gpm, Key, Value, traits_MichaelList_cmp_stat > MichaelList_RCU_GPM_cmp_stat;
+#endif
 
         struct traits_MichaelList_cmp_seqcst :
             public cc::michael_list::make_traits<
@@ -100,6 +109,7 @@ namespace map {
         {};
         typedef cc::MichaelKVList< cds::gc::HP,  Key, Value, traits_MichaelList_less > MichaelList_HP_less;
         typedef cc::MichaelKVList< cds::gc::DHP, Key, Value, traits_MichaelList_less > MichaelList_DHP_less;
+        typedef cc::MichaelKVList< cds::gc::HE,  Key, Value, traits_MichaelList_less > MichaelList_HE_less;
         typedef cc::MichaelKVList< cds::gc::nogc, Key, Value, traits_MichaelList_less > MichaelList_NOGC_less;
         typedef cc::MichaelKVList< rcu_gpi, Key, Value, traits_MichaelList_less > MichaelList_RCU_GPI_less;
         typedef cc::MichaelKVList< rcu_gpb, Key, Value, traits_MichaelList_less > MichaelList_RCU_GPB_less;
@@ -107,6 +117,9 @@ namespace map {
 #ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
         typedef cc::MichaelKVList< rcu_shb, Key, Value, traits_MichaelList_less > MichaelList_RCU_SHB_less;
 #endif
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::MichaelKVList< rcu_gpm, Key, Value, traits_MichaelList_less > MichaelList_RCU_GPM_less;
+#endif
 
         struct traits_MichaelList_less_stat: public traits_MichaelList_less
         {
@@ -114,6 +127,7 @@ namespace map {
         };
         typedef cc::MichaelKVList< cds::gc::HP, Key, Value, traits_MichaelList_less_stat > MichaelList_HP_less_stat;
         typedef cc::MichaelKVList< cds::gc::DHP, Key, Value, traits_MichaelList_less_stat > MichaelList_DHP_less_stat;
+        typedef cc::MichaelKVList< cds::gc::HE,  Key, Value, traits_MichaelList_less_stat > MichaelList_HE_less_stat;
         typedef cc::MichaelKVList< cds::gc::nogc, Key, Value, traits_MichaelList_less_stat > MichaelList_NOGC_less_stat;
         typedef cc::MichaelKVList< rcu_gpi, Key, Value, traits_MichaelList_less_stat > MichaelList_RCU_GPI_less_stat;
         typedef cc::MichaelKVList< rcu_gpb, Key, Value, traits_MichaelList_less_stat > MichaelList_RCU_GPB_less_stat;
@@ -121,6 +135,9 @@ namespace map {
 #ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
         typedef cc::MichaelKVList< rcu_shb, Key, Value, traits_MichaelList_less_stat > MichaelList_RCU_SHB_less_stat;
 #endif
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::MichaelKVList< rcu_gpm, Key, Value, traits_MichaelList_less_stat > MichaelList_RCU_GPM_less_stat;
+#endif
 
         struct traits_MichaelList_less_seqcst :
             public cc::michael_list::make_traits<
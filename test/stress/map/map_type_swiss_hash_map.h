@@ -0,0 +1,107 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2017
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef CDSUNIT_MAP_TYPE_SWISS_HASH_MAP_H
+#define CDSUNIT_MAP_TYPE_SWISS_HASH_MAP_H
+
+#include "map_type.h"
+
+#include <cds/container/swiss_hash_map.h>
+#include <cds/gc/hp.h>
+#include <cds/gc/dhp.h>
+
+#include <cds_test/stat_swiss_hash_map_out.h>
+
+namespace map {
+
+    template <class GC, typename Key, typename T, typename Traits = cc::swiss_hash_map::traits>
+    class SwissHashMap : public cc::SwissHashMap< GC, Key, T, Traits >
+    {
+        typedef cc::SwissHashMap< GC, Key, T, Traits > base_class;
+    public:
+        template <typename Config>
+        SwissHashMap( Config const& cfg )
+            : base_class( cfg.s_nMapSize )
+        {}
+
+        // for testing
+        static constexpr bool const c_bExtractSupported = false;
+        static constexpr bool const c_bLoadFactorDepended = false;
+        static constexpr bool const c_bEraseExactKey = true;
+    };
+
+    struct tag_SwissHashMap;
+
+    template <typename Key, typename Value>
+    struct map_type< tag_SwissHashMap, Key, Value >: public map_type_base< Key, Value >
+    {
+        typedef map_type_base< Key, Value > base_class;
+
+        struct traits_SwissHashMap_stdhash : public cc::swiss_hash_map::traits
+        {
+            typedef std::hash< Key > hash;
+            typedef cds::atomicity::cache_friendly_item_counter item_counter;
+        };
+
+        typedef SwissHashMap< cds::gc::HP,  Key, Value, traits_SwissHashMap_stdhash > SwissHashMap_hp_stdhash;
+        typedef SwissHashMap< cds::gc::DHP, Key, Value, traits_SwissHashMap_stdhash > SwissHashMap_dhp_stdhash;
+
+        struct traits_SwissHashMap_stdhash_stat : public traits_SwissHashMap_stdhash
+        {
+            typedef cc::swiss_hash_map::stat<> stat;
+        };
+
+        typedef SwissHashMap< cds::gc::HP,  Key, Value, traits_SwissHashMap_stdhash_stat > SwissHashMap_hp_stdhash_stat;
+        typedef SwissHashMap< cds::gc::DHP, Key, Value, traits_SwissHashMap_stdhash_stat > SwissHashMap_dhp_stdhash_stat;
+    };
+
+    template <typename GC, typename K, typename T, typename Traits >
+    static inline void print_stat( cds_test::property_stream& o, SwissHashMap< GC, K, T, Traits > const& m )
+    {
+        o << m.statistics()
+          << CDSSTRESS_STAT_OUT_( "stat.capacity", m.capacity());
+    }
+
+#define CDSSTRESS_SwissHashMap_case( fixture, test_case, swiss_map_type, key_type, value_type ) \
+    TEST_F( fixture, swiss_map_type ) \
+    { \
+        typedef map::map_type< tag_SwissHashMap, key_type, value_type >::swiss_map_type map_type; \
+        test_case<map_type>(); \
+    }
+
+#define CDSSTRESS_SwissHashMap( fixture, test_case, key_type, value_type ) \
+    CDSSTRESS_SwissHashMap_case( fixture, test_case, SwissHashMap_hp_stdhash,       key_type, value_type ) \
+    CDSSTRESS_SwissHashMap_case( fixture, test_case, SwissHashMap_dhp_stdhash,      key_type, value_type ) \
+    CDSSTRESS_SwissHashMap_case( fixture, test_case, SwissHashMap_hp_stdhash_stat,  key_type, value_type ) \
+    CDSSTRESS_SwissHashMap_case( fixture, test_case, SwissHashMap_dhp_stdhash_stat, key_type, value_type ) \
+
+}   // namespace map
+
+#endif // #ifndef CDSUNIT_MAP_TYPE_SWISS_HASH_MAP_H
@@ -143,6 +143,34 @@ namespace {
         test( s );
     }
 
+    TEST_F( IntrusiveFeldmanHashSet_DHP, geometry )
+    {
+        struct traits : public ci::feldman_hashset::traits
+        {
+            typedef base_class::hash_accessor hash_accessor;
+            typedef cmp compare;
+            typedef mock_disposer disposer;
+            typedef ci::feldman_hashset::stat<> stat;
+        };
+
+        typedef ci::FeldmanHashSet< gc_type, int_item, traits > set_type;
+
+        ci::feldman_hashset::geometry g = ci::feldman_hashset::geometry::for_size( 100 );
+        EXPECT_EQ( g.head_bits, 7u );
+        EXPECT_EQ( g.array_bits, 2u );
+        g = ci::feldman_hashset::geometry::for_size( 100000000 );
+        EXPECT_EQ( g.head_bits, 24u );
+        EXPECT_EQ( g.array_bits, 5u );
+
+        set_type s( ci::feldman_hashset::geometry::for_size( 1000 ));
+        test( s );
+
+        // small head makes deep trees for compact()
+        set_type s2( 4, 2 );
+        test( s2 );
+        EXPECT_GT( static_cast<size_t>( s2.statistics().m_nArrayNodeFreed ), 0u );
+    }
+
     TEST_F( IntrusiveFeldmanHashSet_DHP, explicit_hash_size )
     {
         struct traits: public ci::feldman_hashset::traits
@@ -32,6 +32,9 @@
 
 #include <cds/intrusive/feldman_hashset_hp.h>
 
+#include <thread>
+#include <vector>
+
 namespace {
     namespace ci = cds::intrusive;
     typedef cds::gc::HP gc_type;
@@ -144,6 +147,82 @@ namespace {
         test( s );
     }
 
+    TEST_F( IntrusiveFeldmanHashSet_HP, geometry )
+    {
+        struct traits : public ci::feldman_hashset::traits
+        {
+            typedef base_class::hash_accessor hash_accessor;
+            typedef cmp compare;
+            typedef mock_disposer disposer;
+            typedef ci::feldman_hashset::stat<> stat;
+        };
+
+        typedef ci::FeldmanHashSet< gc_type, int_item, traits > set_type;
+
+        ci::feldman_hashset::geometry g = ci::feldman_hashset::geometry::for_size( 100 );
+        EXPECT_EQ( g.head_bits, 7u );
+        EXPECT_EQ( g.array_bits, 2u );
+        g = ci::feldman_hashset::geometry::for_size( 100000000 );
+        EXPECT_EQ( g.head_bits, 24u );
+        EXPECT_EQ( g.array_bits, 5u );
+
+        set_type s( ci::feldman_hashset::geometry::for_size( 1000 ));
+        test( s );
+
+        // small head makes deep trees for compact()
+        set_type s2( 4, 2 );
+        test( s2 );
+        EXPECT_GT( static_cast<size_t>( s2.statistics().m_nArrayNodeFreed ), 0u );
+    }
+
+    TEST_F( IntrusiveFeldmanHashSet_HP, compact_quiescent )
+    {
+        // compact() is called at a quiescent point after concurrent mass erasing
+        struct traits : public ci::feldman_hashset::traits
+        {
+            typedef base_class::hash_accessor hash_accessor;
+            typedef cmp compare;
+            typedef mock_disposer disposer;
+            typedef ci::feldman_hashset::stat<> stat;
+        };
+
+        typedef ci::FeldmanHashSet< gc_type, int_item, traits > set_type;
+
+        int const nThreadCount = 4;
+        int const nItemPerThread = 2000;
+        std::vector< int_item > data;
+        for ( int i = 0; i < nThreadCount * nItemPerThread; ++i )
+            data.push_back( int_item( i ));
+
+        set_type s( 4, 2 );
+        std::vector< std::thread > threads;
+        for ( int t = 0; t < nThreadCount; ++t ) {
+            threads.emplace_back( [&s, &data, t, nThreadCount]() {
+                cds::threading::Manager::attachThread();
+                for ( size_t i = t; i < data.size(); i += nThreadCount )
+                    EXPECT_TRUE( s.insert( data[i] ));
+                for ( size_t i = t; i < data.size(); i += nThreadCount ) {
+                    if ( i % 16 != 0 )
+                        EXPECT_TRUE( s.erase( data[i].key()));
+                }
+                cds::threading::Manager::detachThread();
+            });
+        }
+        for ( auto& t : threads )
+            t.join();
+
+        EXPECT_GT( s.compact(), 0u );
+        EXPECT_EQ( s.compact(), 0u );
+        for ( auto const& i : data )
+            EXPECT_EQ( s.contains( i.key()), i.key() % 16 == 0 ) << "key=" << i.key();
+
+        s.clear();
+        EXPECT_TRUE( s.empty());
+        gc_type::force_dispose();
+        for ( auto const& i : data )
+            EXPECT_EQ( i.nDisposeCount, 1u ) << "key=" << i.key();
+    }
+
     TEST_F( IntrusiveFeldmanHashSet_HP, explicit_hash_size )
     {
         struct traits: public ci::feldman_hashset::traits
@@ -297,4 +297,26 @@ namespace {
         EXPECT_GE( s.statistics().m_nInsertSuccess, 0u );
     }
 
+    TEST_F( IntrusiveMichaelSet_DHP, base_cache_line_bucket )
+    {
+        typedef ci::MichaelList< gc_type
+            , base_item_type
+            ,ci::michael_list::make_traits<
+                ci::opt::hook< ci::michael_list::base_hook< ci::opt::gc< gc_type > > >
+                ,ci::opt::compare< cmp<base_item_type> >
+                ,ci::opt::disposer< mock_disposer >
+            >::type
+        > bucket_type;
+
+        typedef ci::MichaelHashSet< gc_type, bucket_type,
+            ci::michael_set::make_traits<
+                ci::opt::hash< hash_int >
+                ,ci::michael_set::cache_line_bucket< true >
+            >::type
+        > set_type;
+
+        set_type s( kSize, 4 );
+        test( s );
+    }
+
 } // namespace
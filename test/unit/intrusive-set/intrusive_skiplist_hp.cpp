@@ -357,4 +357,109 @@ namespace {
         test( s );
     }
 
+    TEST_F( IntrusiveSkipListSet_HP, base_insert_sorted )
+    {
+        struct traits: public ci::skip_list::traits
+        {
+            typedef ci::skip_list::base_hook< ci::opt::gc< gc_type >> hook;
+            typedef mock_disposer disposer;
+            typedef cmp<base_item_type> compare;
+            typedef cds::atomicity::item_counter item_counter;
+            typedef ci::skip_list::stat<> stat;
+        };
+
+        typedef ci::SkipListSet< gc_type, base_item_type, traits > set_type;
+
+        size_t const nSize = kSize;
+
+        std::vector< base_item_type > data( nSize );
+        for ( size_t i = 0; i < data.size(); ++i ) {
+            data[i].nKey = static_cast<int>( i );
+            data[i].nVal = static_cast<int>( i );
+        }
+
+        {
+            set_type s;
+
+            // bulk load of even keys
+            std::vector< std::reference_wrapper< base_item_type >> evens;
+            for ( size_t i = 0; i < data.size(); i += 2 )
+                evens.push_back( std::ref( data[i] ));
+            EXPECT_EQ( s.insert_sorted( evens.begin(), evens.end()), evens.size());
+            EXPECT_EQ( s.size(), evens.size());
+
+            // merge: only odd keys are new
+            size_t nFuncCall = 0;
+            EXPECT_EQ( s.insert_sorted( data.begin(), data.end(), [&nFuncCall]( base_item_type& item ) {
+                EXPECT_EQ( item.nKey % 2, 1 );
+                ++nFuncCall;
+            } ), nSize / 2 );
+            EXPECT_EQ( nFuncCall, nSize / 2 );
+            EXPECT_EQ( s.size(), nSize );
+
+            int nPrev = -1;
+            for ( auto it = s.begin(); it != s.end(); ++it ) {
+                EXPECT_EQ( it->nKey, nPrev + 1 );
+                nPrev = it->nKey;
+            }
+            EXPECT_EQ( nPrev, static_cast<int>( nSize ) - 1 );
+            EXPECT_EQ( static_cast<size_t>( s.statistics().m_nInsertSuccess ), nSize );
+
+            s.clear();
+            EXPECT_TRUE( s.empty());
+            gc_type::force_dispose();
+            for ( auto& item : data )
+                EXPECT_EQ( item.nDisposeCount, 1u );
+        }
+    }
+
+    TEST_F( IntrusiveSkipListSet_HP, base_inline_tower )
+    {
+        typedef ci::skip_list::base_hook< ci::opt::gc< gc_type >> hook;
+        typedef ci::skip_list::inline_tower_allocator< base_item_type, hook > item_allocator;
+
+        typedef ci::SkipListSet< gc_type, base_item_type,
+            typename ci::skip_list::make_traits<
+                ci::opt::hook< hook >
+                ,ci::opt::disposer< item_allocator::disposer >
+                ,ci::opt::compare< cmp<base_item_type>>
+                ,ci::opt::item_counter< cds::atomicity::item_counter >
+                ,ci::skip_list::inline_tower< true >
+            >::type
+        > set_type;
+
+        size_t const nSize = kSize;
+        item_allocator alloc;
+        set_type s;
+
+        size_t nTallCount = 0;
+        for ( int i = 0; i < static_cast<int>( nSize ); ++i ) {
+            base_item_type * p = alloc.New( i );
+            if ( p->height() > 1 ) {
+                // the tower is placed right after the item
+                EXPECT_EQ( reinterpret_cast<char *>( p->get_tower()), reinterpret_cast<char *>( p ) + item_allocator::item_size( 1 ));
+                ++nTallCount;
+            }
+            ASSERT_TRUE( s.insert( *p ));
+        }
+        EXPECT_GT( nTallCount, 0u );
+        EXPECT_EQ( s.size(), nSize );
+
+        base_item_type * pDup = alloc.New( 0 );
+        EXPECT_FALSE( s.insert( *pDup ));
+        item_allocator::Delete( pDup );
+
+        for ( int i = 0; i < static_cast<int>( nSize ); ++i )
+            EXPECT_TRUE( s.contains( i ));
+
+        for ( int i = 0; i < static_cast<int>( nSize ); i += 2 )
+            EXPECT_TRUE( s.erase( i ));
+        for ( int i = 0; i < static_cast<int>( nSize ); ++i )
+            EXPECT_EQ( s.contains( i ), i % 2 != 0 );
+
+        s.clear();
+        EXPECT_TRUE( s.empty());
+        gc_type::force_dispose();
+    }
+
 } // namespace
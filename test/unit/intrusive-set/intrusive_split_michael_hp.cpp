@@ -279,6 +279,60 @@ namespace {
         test( s );
     }
 
+    TEST_F( IntrusiveSplitListSet_HP, base_skip_pointers )
+    {
+        struct list_traits: public ci::michael_list::traits
+        {
+            typedef ci::michael_list::base_hook< ci::opt::gc<gc_type>> hook;
+            typedef cmp<base_item_type> compare;
+            typedef mock_disposer disposer;
+        };
+        typedef ci::MichaelList< gc_type, base_item_type, list_traits > bucket_type;
+
+        struct set_traits: public ci::split_list::traits
+        {
+            typedef hash_int hash;
+            typedef simple_item_counter item_counter;
+            typedef ci::split_list::stat<> stat;
+            enum {
+                skip_pointers = 4
+            };
+        };
+        typedef ci::SplitListSet< gc_type, bucket_type, set_traits > set_type;
+
+        // high load factor makes bucket segments long
+        set_type s( kSize, 32 );
+        test( s );
+        EXPECT_GT( static_cast<size_t>( s.statistics().m_nLookupTraversed ), 0u );
+        EXPECT_GT( static_cast<size_t>( s.statistics().m_nSkipCreated ), 0u );
+        EXPECT_GT( static_cast<size_t>( s.statistics().m_nSkipHit ), 0u );
+    }
+
+    TEST_F( IntrusiveSplitListSet_HP, base_skip_pointers_static_bucket_table )
+    {
+        struct list_traits: public ci::michael_list::traits
+        {
+            typedef ci::michael_list::base_hook< ci::opt::gc<gc_type>> hook;
+            typedef cmp<base_item_type> compare;
+            typedef mock_disposer disposer;
+        };
+        typedef ci::MichaelList< gc_type, base_item_type, list_traits > bucket_type;
+
+        typedef ci::SplitListSet< gc_type, bucket_type,
+            ci::split_list::make_traits<
+                ci::opt::hash< hash_int >
+                , ci::opt::item_counter< simple_item_counter >
+                , ci::opt::stat< ci::split_list::stat<>>
+                , ci::split_list::dynamic_bucket_table< false >
+                , ci::split_list::skip_pointers< 8 >
+            >::type
+        > set_type;
+
+        set_type s( kSize, 32 );
+        test( s );
+        EXPECT_GT( static_cast<size_t>( s.statistics().m_nSkipHit ), 0u );
+    }
+
     TEST_F( IntrusiveSplitListSet_HP, member_cmp )
     {
         typedef ci::MichaelList< gc_type
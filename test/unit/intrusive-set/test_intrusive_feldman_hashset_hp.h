@@ -32,6 +32,7 @@
 #define CDSUNIT_SET_TEST_INTRUSIVE_FELDMAN_HASHSET_HP_H
 
 #include "test_intrusive_feldman_hashset.h"
+#include <memory>   // unique_ptr
 
 namespace cds_test {
 
@@ -116,6 +117,61 @@ namespace cds_test {
                 EXPECT_EQ( i.nDisposeCount, 1u );
             }
 
+            // find_batch/contains_batch: odd keys are in the set
+            for ( auto& i : data ) {
+                i.clear_stat();
+                if ( i.key() & 1 )
+                    ASSERT_TRUE( s.insert( i ));
+            }
+            {
+                std::vector< typename Set::hash_type > keys;
+                std::vector< int > intKeys;
+                for ( auto idx : indices )
+                    intKeys.push_back( data[idx].key());
+                intKeys.push_back( static_cast<int>( nSetSize + 1 ));
+                for ( int k : intKeys )
+                    keys.push_back( k );
+
+                std::unique_ptr<bool[]> found( new bool[keys.size()] );
+                size_t nFound = s.contains_batch( keys.data(), keys.size(), found.get());
+                EXPECT_EQ( nFound, nSetSize / 2 );
+                for ( size_t k = 0; k < keys.size(); ++k )
+                    EXPECT_EQ( found[k], ( intKeys[k] & 1 ) != 0 && static_cast<size_t>( intKeys[k] ) < nSetSize ) << "key=" << intKeys[k];
+
+                nFound = s.find_batch( keys.data(), keys.size(), [&intKeys]( size_t nIndex, value_type& item ) {
+                    EXPECT_EQ( item.key(), intKeys[nIndex] );
+                    ++item.nFindCount;
+                });
+                EXPECT_EQ( nFound, nSetSize / 2 );
+                for ( auto const& i : data )
+                    EXPECT_EQ( i.nFindCount, static_cast<unsigned>( i.key() & 1 ));
+            }
+
+            // compact(): erase most of the items, the remaining ones must be found after compacting
+            for ( auto& i : data ) {
+                if (( i.key() & 1 ) && i.key() % 7 != 1 )
+                    ASSERT_TRUE( s.erase( i.key()));
+            }
+            s.compact();
+            EXPECT_EQ( s.compact(), 0u );
+            for ( auto& i : data ) {
+                bool const bExpected = ( i.key() & 1 ) && i.key() % 7 == 1;
+                EXPECT_EQ( s.contains( i.key()), bExpected ) << "key=" << i.key();
+            }
+            {
+                std::vector< typename Set::level_statistics > level_stat;
+                s.get_level_statistics( level_stat );
+                for ( size_t level = 1; level < level_stat.size(); ++level ) {
+                    // each array node below the head has at least two items or a child array node
+                    EXPECT_GE( level_stat[level].data_cell_count + 2 * level_stat[level].array_cell_count,
+                        2 * level_stat[level].array_node_count ) << "level=" << level;
+                }
+            }
+
+            s.clear();
+            ASSERT_TRUE( s.empty());
+            Set::gc::force_dispose();
+
             // erase_at( iterator )
             for ( auto& i : data ) {
                 i.clear_stat();
@@ -195,5 +195,69 @@ namespace {
         EXPECT_GE( m.statistics().m_nInsertSuccess, 0u );
     }
 
-} // namespace
+    TEST_F( MichaelMap_DHP, cache_line_bucket )
+    {
+        typedef cc::MichaelKVList< gc_type, key_type, value_type,
+            typename cc::michael_list::make_traits<
+                cds::opt::compare< cmp >
+                ,cds::opt::stat< cc::michael_list::stat<> >
+            >::type
+        > list_type;
+
+        typedef cc::MichaelHashMap< gc_type, list_type,
+            typename cc::michael_map::make_traits<
+                cds::opt::hash< hash1 >
+                ,cc::michael_map::cache_line_bucket< true >
+            >::type
+        > map_type;
+
+        map_type m( kSize, 4 );
+        test( m );
+        EXPECT_GE( m.statistics().m_nFindSuccess, 0u );
+    }
+
+    TEST_F( MichaelMap_DHP, resizable )
+    {
+        typedef cc::MichaelKVList< gc_type, key_type, value_type,
+            typename cc::michael_list::make_traits<
+                cds::opt::compare< cmp >
+                ,cds::opt::stat< cc::michael_list::stat<> >
+            >::type
+        > list_type;
+
+        typedef cc::MichaelHashMap< gc_type, list_type,
+            typename cc::michael_map::make_traits<
+                cds::opt::hash< hash1 >
+                ,cc::michael_map::resizable< true >
+            >::type
+        > map_type;
 
+        map_type m( 16, 2 );
+        size_t const nInitBucketCount = m.bucket_count();
+        test( m );
+        EXPECT_GT( m.bucket_count(), nInitBucketCount );
+    }
+
+    TEST_F( MichaelMap_DHP, resizable_cache_line_bucket )
+    {
+        typedef cc::MichaelKVList< gc_type, key_type, value_type,
+            typename cc::michael_list::make_traits<
+                cds::opt::less< less >
+            >::type
+        > list_type;
+
+        typedef cc::MichaelHashMap< gc_type, list_type,
+            typename cc::michael_map::make_traits<
+                cds::opt::hash< hash1 >
+                ,cc::michael_map::resizable< true >
+                ,cc::michael_map::cache_line_bucket< true >
+            >::type
+        > map_type;
+
+        map_type m( 4, 1 );
+        size_t const nInitBucketCount = m.bucket_count();
+        test( m );
+        EXPECT_GT( m.bucket_count(), nInitBucketCount );
+    }
+
+} // namespace
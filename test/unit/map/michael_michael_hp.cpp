@@ -33,6 +33,9 @@
 #include <cds/container/michael_kvlist_hp.h>
 #include <cds/container/michael_map.h>
 
+#include <thread>
+#include <vector>
+
 namespace {
 
     namespace cc = cds::container;
@@ -46,7 +49,14 @@ namespace {
         void SetUp()
         {
             typedef cc::MichaelKVList< gc_type, key_type, value_type > list_type;
-            typedef cc::MichaelHashMap< gc_type, list_type >   map_type;
+
+            // growth mode requires more guards than the default map
+            typedef cc::MichaelHashMap< gc_type, list_type,
+                typename cc::michael_map::make_traits<
+                    cds::opt::hash< hash1 >
+                    , cc::michael_map::resizable< true >
+                >::type
+            > map_type;
 
             // +1 - for guarded_ptr and iterator
             cds::gc::hp::GarbageCollector::Construct( map_type::c_nHazardPtrCount + 1, 1, 16 );
@@ -197,5 +207,145 @@ namespace {
         EXPECT_GE( m.statistics().m_nInsertSuccess, 0u );
     }
 
-} // namespace
+    TEST_F( MichaelMap_HP, cache_line_bucket )
+    {
+        typedef cc::MichaelKVList< gc_type, key_type, value_type,
+            typename cc::michael_list::make_traits<
+                cds::opt::compare< cmp >
+                ,cds::opt::stat< cc::michael_list::stat<> >
+            >::type
+        > list_type;
+
+        typedef cc::MichaelHashMap< gc_type, list_type,
+            typename cc::michael_map::make_traits<
+                cds::opt::hash< hash1 >
+                ,cc::michael_map::cache_line_bucket< true >
+            >::type
+        > map_type;
+
+        map_type m( kSize, 4 );
+        test( m );
+        EXPECT_GE( m.statistics().m_nFindSuccess, 0u );
+    }
+
+    TEST_F( MichaelMap_HP, resizable )
+    {
+        typedef cc::MichaelKVList< gc_type, key_type, value_type,
+            typename cc::michael_list::make_traits<
+                cds::opt::compare< cmp >
+                ,cds::opt::stat< cc::michael_list::stat<> >
+            >::type
+        > list_type;
+
+        typedef cc::MichaelHashMap< gc_type, list_type,
+            typename cc::michael_map::make_traits<
+                cds::opt::hash< hash1 >
+                ,cc::michael_map::resizable< true >
+            >::type
+        > map_type;
 
+        map_type m( 16, 2 );
+        size_t const nInitBucketCount = m.bucket_count();
+        test( m );
+        EXPECT_GT( m.bucket_count(), nInitBucketCount );
+    }
+
+    TEST_F( MichaelMap_HP, resizable_cache_line_bucket )
+    {
+        typedef cc::MichaelKVList< gc_type, key_type, value_type,
+            typename cc::michael_list::make_traits<
+                cds::opt::less< less >
+            >::type
+        > list_type;
+
+        typedef cc::MichaelHashMap< gc_type, list_type,
+            typename cc::michael_map::make_traits<
+                cds::opt::hash< hash1 >
+                ,cc::michael_map::resizable< true >
+                ,cc::michael_map::cache_line_bucket< true >
+            >::type
+        > map_type;
+
+        map_type m( 4, 1 );
+        size_t const nInitBucketCount = m.bucket_count();
+        test( m );
+        EXPECT_GT( m.bucket_count(), nInitBucketCount );
+    }
+
+    TEST_F( MichaelMap_HP, resizable_find_functor )
+    {
+        // find() is a lock-free lookup in growth mode: it finds every item while the buckets are moved
+        struct counter {
+            atomics::atomic<int> n;
+
+            counter()
+                : n( 0 )
+            {}
+            counter( counter const& src )
+                : n( src.n.load( atomics::memory_order_relaxed ))
+            {}
+        };
+
+        typedef cc::MichaelKVList< gc_type, int, counter,
+            typename cc::michael_list::make_traits<
+                cds::opt::less< std::less<int>>
+            >::type
+        > list_type;
+
+        struct int_hash {
+            size_t operator()( int k ) const
+            {
+                return std::hash<int>()( k );
+            }
+        };
+
+        typedef cc::MichaelHashMap< gc_type, list_type,
+            typename cc::michael_map::make_traits<
+                cds::opt::hash< int_hash >
+                ,cc::michael_map::resizable< true >
+            >::type
+        > map_type;
+
+        int const nCounterCount = 64;
+        int const nFindCount = 100000;
+        unsigned const nFinderCount = 4;
+
+        map_type m( 4, 1 );
+        for ( int k = 0; k < nCounterCount; ++k )
+            ASSERT_TRUE( m.emplace( k ));
+
+        atomics::atomic<int> nFound( 0 );
+        std::vector<std::thread> threads;
+        for ( unsigned t = 0; t < nFinderCount; ++t ) {
+            threads.emplace_back( [&m, &nFound, t, nCounterCount, nFindCount]() {
+                cds::threading::Manager::attachThread();
+                int n = 0;
+                for ( int i = 0; i < nFindCount; ++i ) {
+                    if ( m.find( static_cast<int>( i * 7 + t ) % nCounterCount, []( map_type::value_type& item ) { EXPECT_EQ( item.second.n.load( atomics::memory_order_relaxed ), 0 ); } ))
+                        ++n;
+                }
+                nFound.fetch_add( n, atomics::memory_order_relaxed );
+                cds::threading::Manager::detachThread();
+            });
+        }
+        threads.emplace_back( [&m, nCounterCount]() {
+            // grows the map
+            cds::threading::Manager::attachThread();
+            for ( int k = nCounterCount; k < nCounterCount * 400; ++k )
+                m.emplace( k );
+            cds::threading::Manager::detachThread();
+        });
+        for ( auto& t : threads )
+            t.join();
+
+        EXPECT_EQ( nFound.load(), nFindCount * static_cast<int>( nFinderCount ));
+
+        // The iterator traverses the table left by the growth
+        size_t nCount = 0;
+        for ( auto it = m.cbegin(); it != m.cend(); ++it )
+            ++nCount;
+        EXPECT_EQ( nCount, m.size());
+        EXPECT_TRUE( m.begin() != m.end());
+    }
+
+} // namespace
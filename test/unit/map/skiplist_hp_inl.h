@@ -189,3 +189,42 @@ TEST_F( CDSTEST_FIXTURE_NAME, turbo16 )
     map_type m;
     test( m );
 }
+
+TEST_F( CDSTEST_FIXTURE_NAME, insert_sorted )
+{
+    struct map_traits: public cc::skip_list::traits
+    {
+        typedef cmp compare;
+        typedef cds::atomicity::item_counter item_counter;
+        typedef cc::skip_list::stat<> stat;
+    };
+    typedef cc::SkipListMap< gc_type, key_type, value_type, map_traits > map_type;
+
+    size_t const nSize = kSize;
+
+    map_type m;
+
+    // bulk load of even keys
+    std::vector< std::pair< int, int >> data;
+    for ( int i = 0; i < static_cast<int>( nSize ); i += 2 )
+        data.push_back( std::make_pair( i, i * 10 ));
+    EXPECT_EQ( m.insert_sorted( data.begin(), data.end()), data.size());
+    EXPECT_EQ( m.size(), data.size());
+
+    // merge all keys: only odd keys are new, the values of existing keys are not changed
+    data.clear();
+    for ( int i = 0; i < static_cast<int>( nSize ); ++i )
+        data.push_back( std::make_pair( i, i * 100 ));
+    EXPECT_EQ( m.insert_sorted( data.begin(), data.end()), nSize / 2 );
+    EXPECT_EQ( m.size(), nSize );
+
+    for ( int i = 0; i < static_cast<int>( nSize ); ++i ) {
+        EXPECT_TRUE( m.find( i, [i]( typename map_type::value_type& v ) {
+            EXPECT_EQ( v.first.nKey, i );
+            EXPECT_EQ( v.second.nVal, i % 2 ? i * 100 : i * 10 );
+        }));
+    }
+
+    m.clear();
+    EXPECT_TRUE( m.empty());
+}
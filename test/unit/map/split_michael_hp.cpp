@@ -207,6 +207,30 @@ namespace {
         test( m );
     }
 
+    TEST_F( SplitListMichaelMap_HP, skip_pointers )
+    {
+        struct map_traits: public cc::split_list::traits
+        {
+            typedef cc::michael_list_tag ordered_list;
+            typedef hash1 hash;
+            typedef cds::atomicity::item_counter item_counter;
+            typedef cc::split_list::stat<> stat;
+            enum {
+                skip_pointers = 4
+            };
+
+            struct ordered_list_traits: public cc::michael_list::traits
+            {
+                typedef cmp compare;
+            };
+        };
+        typedef cc::SplitListMap< gc_type, key_type, value_type, map_traits > map_type;
+
+        map_type m( kSize, 32 );
+        test( m );
+        EXPECT_GT( static_cast<size_t>( m.statistics().m_nSkipHit ), 0u );
+    }
+
     struct set_static_traits: public cc::split_list::traits
     {
         static bool const dynamic_bucket_table = false;
@@ -0,0 +1,127 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2017
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "test_swiss_hash_map.h"
+
+#include <cds/gc/dhp.h>
+
+namespace {
+    namespace cc = cds::container;
+    typedef cds::gc::DHP gc_type;
+
+    class SwissHashMap_DHP : public cds_test::swiss_hash_map
+    {
+    protected:
+        typedef cds_test::swiss_hash_map base_class;
+
+        void SetUp()
+        {
+            typedef cc::SwissHashMap< gc_type, key_type, value_type > map_type;
+
+            cds::gc::dhp::smr::construct( map_type::c_nHazardPtrCount );
+            cds::threading::Manager::attachThread();
+        }
+
+        void TearDown()
+        {
+            cds::threading::Manager::detachThread();
+            cds::gc::dhp::smr::destruct();
+        }
+    };
+
+    TEST_F( SwissHashMap_DHP, defaulted )
+    {
+        typedef cc::SwissHashMap< gc_type, key_type, value_type > map_type;
+
+        map_type m;
+        test( m );
+    }
+
+    TEST_F( SwissHashMap_DHP, capacity )
+    {
+        typedef cc::SwissHashMap< gc_type, key_type, value_type > map_type;
+
+        map_type m( kSize * 2 );
+        EXPECT_GE( m.capacity(), kSize * 2 );
+        test( m );
+    }
+
+    TEST_F( SwissHashMap_DHP, bad_hash )
+    {
+        struct map_traits: public cc::swiss_hash_map::traits
+        {
+            typedef shifted_hash hash;
+            typedef cds::backoff::yield back_off;
+        };
+        typedef cc::SwissHashMap< gc_type, key_type, value_type, map_traits > map_type;
+
+        map_type m( 10 );
+        test( m );
+    }
+
+    TEST_F( SwissHashMap_DHP, bad_hash_probe )
+    {
+        // The hash mixing should spread the keys differing in high bits only over the groups
+        struct map_traits: public cc::swiss_hash_map::traits
+        {
+            typedef shifted_hash hash;
+            typedef cc::swiss_hash_map::stat<> stat;
+        };
+        typedef cc::SwissHashMap< gc_type, key_type, value_type, map_traits > map_type;
+
+        map_type m( kSize * 2 );
+        test( m );
+
+        auto const& st = m.statistics();
+        size_t const nOpCount = st.m_nInsertSuccess.get() + st.m_nInsertFailed.get()
+            + st.m_nUpdateNew.get() + st.m_nUpdateExisting.get() + st.m_nUpdateFailed.get()
+            + st.m_nEraseSuccess.get() + st.m_nEraseFailed.get()
+            + st.m_nFindSuccess.get() + st.m_nFindFailed.get();
+        EXPECT_GT( nOpCount, 0u );
+        EXPECT_LT( st.m_nGroupProbe.get(), nOpCount / 8 );
+    }
+
+    TEST_F( SwissHashMap_DHP, stat )
+    {
+        typedef cc::SwissHashMap< gc_type, key_type, value_type,
+            typename cc::swiss_hash_map::make_traits<
+                cds::opt::stat< cc::swiss_hash_map::stat<>>
+                ,cds::opt::item_counter< cds::atomicity::cache_friendly_item_counter >
+            >::type
+        > map_type;
+
+        map_type m( 1 );
+        EXPECT_EQ( m.capacity(), static_cast<size_t>( 16 ));
+        test( m );
+        EXPECT_GT( m.statistics().m_nResize.get(), 0u );
+        EXPECT_GT( m.statistics().m_nChunkMigrated.get(), 0u );
+    }
+
+} // namespace
@@ -32,6 +32,7 @@
 #define CDSUNIT_MAP_TEST_FELDMAN_HASHMAP_HP_H
 
 #include "test_feldman_hashmap.h"
+#include <memory>   // unique_ptr
 
 namespace cds_test {
 
@@ -106,6 +107,26 @@ namespace cds_test {
             }
             EXPECT_EQ( nCount, kkSize );
 
+            // find_batch/contains_batch
+            {
+                std::vector<key_type> keys( arrKeys );
+                for ( int i = 0; i < 40; ++i )
+                    keys.push_back( key_type( static_cast<int>( kkSize ) + i ));
+
+                std::unique_ptr<bool[]> found( new bool[keys.size()] );
+                EXPECT_EQ( m.contains_batch( keys.data(), keys.size(), found.get()), kkSize );
+                for ( size_t k = 0; k < keys.size(); ++k )
+                    EXPECT_EQ( found[k], static_cast<size_t>( keys[k].nKey ) < kkSize ) << "key=" << keys[k].nKey;
+
+                nCount = 0;
+                EXPECT_EQ( m.find_batch( keys.data(), keys.size(), [&keys, &nCount]( size_t nIndex, typename Map::value_type& item ) {
+                    EXPECT_EQ( item.first.nKey, keys[nIndex].nKey );
+                    EXPECT_EQ( item.second.nVal, item.first.nKey * 4 );
+                    ++nCount;
+                }), kkSize );
+                EXPECT_EQ( nCount, kkSize );
+            }
+
             // get/extract
             typedef typename Map::guarded_ptr guarded_ptr;
             guarded_ptr gp;
@@ -145,6 +166,16 @@ namespace cds_test {
             ASSERT_TRUE( m.empty());
             ASSERT_CONTAINER_SIZE( m, 0 );
 
+            // compact() of the empty map leaves the head only
+            m.compact();
+            EXPECT_EQ( m.compact(), 0u );
+            {
+                std::vector< typename Map::level_statistics > level_stat;
+                m.get_level_statistics( level_stat );
+                ASSERT_EQ( level_stat.size(), 1u );
+                EXPECT_EQ( level_stat[0].array_cell_count, 0u );
+            }
+
             // erase_at( iterator )
             for ( auto const& i : arrKeys )
                 ASSERT_TRUE( m.insert( i ));
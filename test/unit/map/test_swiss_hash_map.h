@@ -0,0 +1,177 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2017
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef CDSUNIT_MAP_TEST_SWISS_HASH_MAP_H
+#define CDSUNIT_MAP_TEST_SWISS_HASH_MAP_H
+
+#include <cds_test/check_size.h>
+#include <cds_test/fixture.h>
+
+#include <cds/container/swiss_hash_map.h>
+
+namespace cds_test {
+
+    class swiss_hash_map: public fixture
+    {
+    public:
+        static size_t const kSize = 1000;
+
+        typedef int      key_type;
+        typedef unsigned value_type;
+
+        // A bad hash: the keys differ only in high bits of the hash value
+        struct shifted_hash {
+            size_t operator()( key_type k ) const
+            {
+                return static_cast<size_t>( k ) << 40;
+            }
+        };
+
+    protected:
+        template <class Map>
+        void test( Map& m )
+        {
+            // Precondition: map is empty
+            // Postcondition: map is empty
+
+            ASSERT_TRUE( m.empty());
+            ASSERT_CONTAINER_SIZE( m, 0 );
+
+            typedef typename Map::value_type map_pair;
+            size_t const kkSize = kSize;
+
+            std::vector<key_type> arrKeys;
+            for ( int i = 0; i < static_cast<int>( kkSize ); ++i )
+                arrKeys.push_back( i );
+            shuffle( arrKeys.begin(), arrKeys.end());
+
+            // insert/find
+            for ( auto k : arrKeys ) {
+                ASSERT_FALSE( m.contains( k ));
+                ASSERT_FALSE( m.find( k, []( map_pair& ) { ASSERT_TRUE( false ); }));
+
+                switch ( k % 4 ) {
+                case 0:
+                    ASSERT_TRUE( m.insert( k ));
+                    ASSERT_FALSE( m.insert( k ));
+                    ASSERT_TRUE( m.find( k, []( map_pair& item ) { EXPECT_EQ( item.second, 0u ); }));
+                    ASSERT_TRUE( m.upsert( k, static_cast<value_type>( k * 2 )).first );
+                    break;
+                case 1:
+                    ASSERT_TRUE( m.insert( k, static_cast<value_type>( k * 2 )));
+                    ASSERT_FALSE( m.insert( k, static_cast<value_type>( k )));
+                    break;
+                case 2:
+                    ASSERT_TRUE( m.insert_with( k, []( map_pair& item ) { item.second = static_cast<value_type>( item.first * 2 ); }));
+                    ASSERT_FALSE( m.insert_with( k, []( map_pair& ) { ASSERT_TRUE( false ); }));
+                    break;
+                case 3:
+                    {
+                        auto ret = m.update( k, []( bool, map_pair& ) { ASSERT_TRUE( false ); }, false );
+                        EXPECT_FALSE( ret.first );
+                        EXPECT_FALSE( ret.second );
+
+                        ret = m.update( k, []( bool bNew, map_pair& item ) {
+                            EXPECT_TRUE( bNew );
+                            item.second = static_cast<value_type>( item.first );
+                        });
+                        EXPECT_TRUE( ret.first );
+                        EXPECT_TRUE( ret.second );
+
+                        ret = m.update( k, []( bool bNew, map_pair& item ) {
+                            EXPECT_FALSE( bNew );
+                            EXPECT_EQ( item.second, static_cast<value_type>( item.first ));
+                            item.second *= 2;
+                        }, false );
+                        EXPECT_TRUE( ret.first );
+                        EXPECT_FALSE( ret.second );
+                    }
+                    break;
+                }
+
+                ASSERT_TRUE( m.contains( k ));
+                ASSERT_TRUE( m.find( k, []( map_pair& item ) {
+                    EXPECT_EQ( item.second, static_cast<value_type>( item.first * 2 ));
+                }));
+            }
+            ASSERT_FALSE( m.empty());
+            ASSERT_CONTAINER_SIZE( m, kkSize );
+            EXPECT_GE( m.capacity(), kkSize );
+
+            // erase
+            shuffle( arrKeys.begin(), arrKeys.end());
+            for ( auto k : arrKeys ) {
+                ASSERT_TRUE( m.contains( k ));
+                if ( k & 1 )
+                    ASSERT_TRUE( m.erase( k ));
+                else {
+                    ASSERT_TRUE( m.erase( k, []( map_pair& item ) {
+                        EXPECT_EQ( item.second, static_cast<value_type>( item.first * 2 ));
+                    }));
+                }
+                ASSERT_FALSE( m.contains( k ));
+                ASSERT_FALSE( m.erase( k ));
+            }
+            ASSERT_TRUE( m.empty());
+            ASSERT_CONTAINER_SIZE( m, 0 );
+
+            // The slots of the erased keys are reused
+            size_t const nCapacity = m.capacity();
+            for ( auto k : arrKeys )
+                ASSERT_TRUE( m.insert( k, static_cast<value_type>( k )));
+            ASSERT_CONTAINER_SIZE( m, kkSize );
+            EXPECT_EQ( m.capacity(), nCapacity );
+
+            // clear
+            m.clear();
+            ASSERT_TRUE( m.empty());
+            ASSERT_CONTAINER_SIZE( m, 0 );
+            for ( auto k : arrKeys )
+                ASSERT_FALSE( m.contains( k ));
+
+            // Tombstones: the table is rehashed instead of infinite growth
+            for ( int pass = 0; pass < 20; ++pass ) {
+                for ( size_t i = 0; i < kkSize / 10; ++i ) {
+                    int const k = static_cast<int>( kkSize * pass + i );
+                    ASSERT_TRUE( m.insert( k, static_cast<value_type>( k )));
+                }
+                for ( size_t i = 0; i < kkSize / 10; ++i ) {
+                    int const k = static_cast<int>( kkSize * pass + i );
+                    ASSERT_TRUE( m.erase( k ));
+                }
+            }
+            ASSERT_TRUE( m.empty());
+            EXPECT_LE( m.capacity(), nCapacity * 2 );
+        }
+    };
+
+} // namespace cds_test
+
+#endif // #ifndef CDSUNIT_MAP_TEST_SWISS_HASH_MAP_H
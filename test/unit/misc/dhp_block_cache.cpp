@@ -0,0 +1,144 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2017
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cds_test/ext_gtest.h>
+#include <cds/gc/dhp.h>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    struct item
+    {
+        size_t  nDisposeCount = 0;
+    };
+
+    struct disposer
+    {
+        void operator()( item * p ) const
+        {
+            ++p->nDisposeCount;
+        }
+    };
+
+    static size_t const c_nInitialGuardCount = 4;
+    static size_t const c_nGuardCount = 40; // several extended guard blocks
+    static size_t const c_nRetiredCount = cds::gc::dhp::retired_block::c_capacity * 3;
+
+    atomics::atomic<size_t> s_nAllocCount( 0 );
+    atomics::atomic<size_t> s_nFreeCount( 0 );
+
+    // Counting allocator compatible with the default DHP allocator
+    void* counting_alloc( size_t nSize )
+    {
+        s_nAllocCount.fetch_add( 1, atomics::memory_order_relaxed );
+        return new uintptr_t[( nSize + sizeof( uintptr_t ) - 1 ) / sizeof( uintptr_t )];
+    }
+
+    void counting_free( void* p )
+    {
+        s_nFreeCount.fetch_add( 1, atomics::memory_order_relaxed );
+        delete[] reinterpret_cast<uintptr_t*>( p );
+    }
+
+    class dhp_block_cache: public ::testing::Test
+    {
+    protected:
+        void SetUp()
+        {
+            // The allocator may be set only when DHP is not constructed.
+            // It is not reset on tear down: it is compatible with the default one
+            cds::gc::dhp::smr::set_memory_allocator( counting_alloc, counting_free );
+            cds::gc::dhp::smr::construct( c_nInitialGuardCount );
+            cds::threading::Manager::attachThread();
+        }
+
+        void TearDown()
+        {
+            cds::threading::Manager::detachThread();
+            cds::gc::dhp::smr::destruct();
+        }
+
+        // Uses extended guards and retires enough items to fill several retired blocks.
+        // The guarded items are not retired, so all retired items are freed by the end of the workload
+        static void workload( std::vector< item >& items )
+        {
+            item guarded[c_nGuardCount];
+            cds::gc::DHP::GuardArray< c_nGuardCount > guards;
+            for ( size_t i = 0; i < c_nGuardCount; ++i )
+                guards.assign( i, &guarded[i] );
+
+            for ( auto& i : items )
+                cds::gc::DHP::retire<disposer>( &i );
+            cds::gc::DHP::scan();
+        }
+
+        static void thread_workload( std::vector< item >& items )
+        {
+            std::thread th( [&items]() {
+                cds::threading::Manager::attachThread();
+                workload( items );
+                cds::threading::Manager::detachThread();
+            });
+            th.join();
+        }
+    };
+
+    TEST_F( dhp_block_cache, no_alloc_after_warmup )
+    {
+        std::vector< item > items( c_nRetiredCount );
+
+        // Warm-up: the blocks are allocated
+        for ( int i = 0; i < 2; ++i ) {
+            workload( items );
+            thread_workload( items );
+        }
+        cds::gc::DHP::scan();
+        for ( auto const& i : items )
+            ASSERT_EQ( i.nDisposeCount, 4u );
+
+        // Steady state: the blocks are taken from the per-thread caches and from the global free-list
+        size_t const nAllocCount = s_nAllocCount.load( atomics::memory_order_relaxed );
+        size_t const nFreeCount = s_nFreeCount.load( atomics::memory_order_relaxed );
+        EXPECT_GT( nAllocCount, 0u );
+
+        for ( int i = 0; i < 10; ++i ) {
+            workload( items );
+            thread_workload( items );
+        }
+        cds::gc::DHP::scan();
+
+        EXPECT_EQ( s_nAllocCount.load( atomics::memory_order_relaxed ), nAllocCount );
+        EXPECT_EQ( s_nFreeCount.load( atomics::memory_order_relaxed ), nFreeCount );
+        for ( auto const& i : items )
+            EXPECT_EQ( i.nDisposeCount, 24u );
+    }
+
+} // namespace
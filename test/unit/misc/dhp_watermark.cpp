@@ -0,0 +1,139 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2017
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cds_test/ext_gtest.h>
+#include <cds/gc/dhp.h>
+#include <vector>
+
+namespace {
+
+    struct item
+    {
+        int value;
+    };
+
+    struct disposer
+    {
+        void operator()( item * p ) const
+        {
+            delete p;
+        }
+    };
+
+    static size_t const c_nGuardCount = 64;
+    static size_t const c_nWatermark = 32;
+
+    size_t s_nStalledCount;
+    cds::gc::DHP::stalled_guard s_LastStalled;
+
+    void on_stalled_guard( cds::gc::DHP::stalled_guard const& info )
+    {
+        ++s_nStalledCount;
+        s_LastStalled = info;
+    }
+
+    class dhp_watermark: public ::testing::Test
+    {
+    protected:
+        void SetUp()
+        {
+            cds::gc::dhp::GarbageCollector::Construct( 16 );
+            cds::threading::Manager::attachThread();
+            s_nStalledCount = 0;
+        }
+
+        void TearDown()
+        {
+            cds::threading::Manager::detachThread();
+            cds::gc::dhp::GarbageCollector::Destruct();
+        }
+
+        static void retire_items( size_t nCount )
+        {
+            for ( size_t i = 0; i < nCount; ++i )
+                cds::gc::DHP::retire<disposer>( new item );
+        }
+    };
+
+    TEST_F( dhp_watermark, stalled_guard )
+    {
+        cds::gc::DHP::set_watermark( c_nWatermark, on_stalled_guard );
+        EXPECT_EQ( cds::gc::dhp::smr::instance().watermark(), c_nWatermark );
+
+        {
+            // The guarded pointers cannot be freed: the thread is above the watermark after each scan()
+            cds::gc::DHP::GuardArray< c_nGuardCount > guards;
+            std::vector< item* > guarded;
+            for ( size_t i = 0; i < c_nGuardCount; ++i ) {
+                guarded.push_back( new item );
+                guards.assign( i, guarded.back());
+                cds::gc::DHP::retire<disposer>( guarded.back());
+            }
+
+            retire_items( cds::gc::dhp::retired_block::c_capacity * 4 );
+            EXPECT_GT( s_nStalledCount, 0u );
+            EXPECT_EQ( s_LastStalled.owner, cds::OS::get_current_thread_id());
+            EXPECT_EQ( s_LastStalled.guarded, guarded.front());
+            EXPECT_GE( s_LastStalled.backlog, c_nGuardCount );
+            EXPECT_GT( s_LastStalled.stall_count, 1u );
+
+            // The retired array is not extended since scan() frees the unguarded pointers
+            cds::gc::DHP::scan();
+            EXPECT_EQ( cds::gc::dhp::smr::tls()->retired_.size(), c_nGuardCount );
+        }
+
+        // The guards are released
+        size_t const nStalled = s_nStalledCount;
+        cds::gc::DHP::scan();
+        EXPECT_EQ( cds::gc::dhp::smr::tls()->retired_.size(), 0u );
+        retire_items( cds::gc::dhp::retired_block::c_capacity * 4 );
+        EXPECT_EQ( s_nStalledCount, nStalled );
+
+        cds::gc::DHP::set_watermark( 0 );
+        EXPECT_EQ( cds::gc::dhp::smr::instance().watermark(), 0u );
+    }
+
+    TEST_F( dhp_watermark, off )
+    {
+        {
+            cds::gc::DHP::GuardArray< c_nGuardCount > guards;
+            for ( size_t i = 0; i < c_nGuardCount; ++i ) {
+                item* p = new item;
+                guards.assign( i, p );
+                cds::gc::DHP::retire<disposer>( p );
+            }
+            retire_items( cds::gc::dhp::retired_block::c_capacity * 4 );
+        }
+        cds::gc::DHP::scan();
+        EXPECT_EQ( s_nStalledCount, 0u );
+        EXPECT_EQ( cds::gc::dhp::smr::tls()->retired_.size(), 0u );
+    }
+
+} // namespace
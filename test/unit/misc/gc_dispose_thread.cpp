@@ -0,0 +1,209 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2017
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cds_test/ext_gtest.h>
+#include <cds/gc/hp.h>
+#include <cds/gc/dhp.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    static size_t const c_nItemCount = 10000;
+
+    struct item
+    {
+        atomics::atomic<size_t> nDisposeCount;
+        item*                   pChild;
+
+        item()
+            : nDisposeCount( 0 )
+            , pChild( nullptr )
+        {}
+    };
+
+    // Statistics of the disposer calls
+    struct dispose_stat
+    {
+        cds::OS::ThreadId       mainThread;
+        atomics::atomic<size_t> nForeignCount;      // disposed by other thread than main
+        atomics::atomic<size_t> nNotAttachedCount;  // disposed by the thread not attached to threading manager
+    };
+
+    dispose_stat s_Stat;
+
+    // The disposer called by the dispose thread retires the child item,
+    // it requires the dispose thread to be attached to the GC.
+    // Other threads dispose the child immediately since the retired array cannot be changed during scan()
+    template <class GC>
+    struct disposer
+    {
+        void operator()( item * p ) const
+        {
+            bool bRetireChild = false;
+            if ( cds::OS::get_current_thread_id() != s_Stat.mainThread ) {
+                s_Stat.nForeignCount.fetch_add( 1, atomics::memory_order_relaxed );
+                if ( cds::threading::Manager::isThreadAttached())
+                    bRetireChild = true;
+                else
+                    s_Stat.nNotAttachedCount.fetch_add( 1, atomics::memory_order_relaxed );
+            }
+
+            if ( p->pChild ) {
+                if ( bRetireChild )
+                    GC::template retire< disposer >( p->pChild );
+                else
+                    disposer()( p->pChild );
+            }
+
+            p->nDisposeCount.fetch_add( 1, atomics::memory_order_relaxed );
+        }
+    };
+
+    template <class GC>
+    class gc_dispose_thread: public ::testing::Test
+    {
+    protected:
+        void SetUp()
+        {
+            s_Stat.mainThread = cds::OS::get_current_thread_id();
+            s_Stat.nForeignCount.store( 0, atomics::memory_order_relaxed );
+            s_Stat.nNotAttachedCount.store( 0, atomics::memory_order_relaxed );
+
+            construct();
+            cds::threading::Manager::attachThread();
+            GC::start_dispose_thread();
+            bDestroyed_ = false;
+        }
+
+        void TearDown()
+        {
+            destroy();
+        }
+
+        void destroy()
+        {
+            if ( !bDestroyed_ ) {
+                cds::threading::Manager::detachThread();
+                destruct();
+                bDestroyed_ = true;
+            }
+        }
+
+        void test()
+        {
+            ASSERT_TRUE( GC::isUsed());
+
+            std::vector< item > parents( c_nItemCount );
+            std::vector< item > children( c_nItemCount );
+            for ( size_t i = 0; i < c_nItemCount; ++i )
+                parents[i].pChild = &children[i];
+
+            item guarded;
+            {
+                typename GC::Guard g;
+                g.assign( &guarded );
+                GC::template retire< disposer<GC>>( &guarded );
+
+                for ( auto& i : parents )
+                    GC::template retire< disposer<GC>>( &i );
+
+                // The retired arrays of the main thread are passed to the dispose thread
+                auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds( 30 );
+                while ( s_Stat.nForeignCount.load( atomics::memory_order_relaxed ) == 0
+                    && std::chrono::steady_clock::now() < deadline )
+                {
+                    std::this_thread::sleep_for( std::chrono::milliseconds( 1 ));
+                }
+                EXPECT_GT( s_Stat.nForeignCount.load( atomics::memory_order_relaxed ), 0u );
+
+                // The guarded item is kept by the dispose thread
+                std::this_thread::sleep_for( std::chrono::milliseconds( 50 ));
+                EXPECT_EQ( guarded.nDisposeCount.load( atomics::memory_order_relaxed ), 0u );
+            }
+
+            // The dispose thread frees all retired pointers on destruction
+            destroy();
+
+            EXPECT_EQ( s_Stat.nNotAttachedCount.load( atomics::memory_order_relaxed ), 0u );
+            EXPECT_EQ( guarded.nDisposeCount.load( atomics::memory_order_relaxed ), 1u );
+            for ( auto const& i : parents )
+                EXPECT_EQ( i.nDisposeCount.load( atomics::memory_order_relaxed ), 1u );
+            for ( auto const& i : children )
+                EXPECT_EQ( i.nDisposeCount.load( atomics::memory_order_relaxed ), 1u );
+        }
+
+    private:
+        void construct();
+        void destruct();
+
+    private:
+        bool bDestroyed_;
+    };
+
+    template <>
+    void gc_dispose_thread< cds::gc::HP >::construct()
+    {
+        cds::gc::hp::smr::construct( 4, 4, 64 );
+    }
+
+    template <>
+    void gc_dispose_thread< cds::gc::HP >::destruct()
+    {
+        cds::gc::hp::smr::destruct( true );
+    }
+
+    template <>
+    void gc_dispose_thread< cds::gc::DHP >::construct()
+    {
+        cds::gc::dhp::smr::construct( 4 );
+    }
+
+    template <>
+    void gc_dispose_thread< cds::gc::DHP >::destruct()
+    {
+        cds::gc::dhp::smr::destruct( true );
+    }
+
+    typedef gc_dispose_thread< cds::gc::HP >  hp_dispose_thread;
+    typedef gc_dispose_thread< cds::gc::DHP > dhp_dispose_thread;
+
+    TEST_F( hp_dispose_thread, offload )
+    {
+        test();
+    }
+
+    TEST_F( dhp_dispose_thread, offload )
+    {
+        test();
+    }
+
+} // namespace
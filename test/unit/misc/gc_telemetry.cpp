@@ -0,0 +1,227 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2017
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cds_test/ext_gtest.h>
+#include <cds/gc/hp.h>
+#include <cds/gc/dhp.h>
+#include <cds/urcu/general_buffered.h>
+#include <algorithm>
+#include <thread>
+#include <chrono>
+#include <vector>
+
+namespace {
+
+    struct item
+    {
+        char data[48];
+    };
+
+    struct disposer
+    {
+        void operator()( item * p ) const
+        {
+            delete p;
+        }
+    };
+
+    static size_t const c_nItemCount = 4096;
+
+    // All items are alive at the same time, so all addresses are distinct
+    // and some of them are sampled for sure
+    std::vector< item * > make_items()
+    {
+        std::vector< item * > v;
+        v.reserve( c_nItemCount );
+        for ( size_t i = 0; i < c_nItemCount; ++i )
+            v.push_back( new item );
+        return v;
+    }
+
+    template <class GC>
+    void test_hazard_pointer()
+    {
+        typedef typename GC::telemetry_snapshot snapshot;
+
+        std::vector< item * > items = make_items();
+        for ( auto p : items )
+            GC::template retire<disposer>( p );
+        GC::scan();
+
+        snapshot st;
+        GC::telemetry( st );
+        EXPECT_EQ( st.backlog_count, 0u );
+        EXPECT_EQ( st.backlog_bytes, 0u );
+        EXPECT_GT( st.retire_age.count(), 0u );
+        EXPECT_GT( st.reclaim_time.count(), 0u );
+        EXPECT_EQ( st.blocking_thread, cds::OS::c_NullThreadId );
+
+        // The guarded object cannot be reclaimed; the current thread blocks the reclamation
+        item * p = new item;
+        {
+            typename GC::Guard g;
+            g.assign( p );
+            GC::template retire<disposer>( p );
+            GC::scan();
+
+            GC::telemetry( st );
+            EXPECT_EQ( st.backlog_count, 1u );
+            EXPECT_EQ( st.blocking_thread, cds::OS::get_current_thread_id());
+        }
+        GC::scan();
+
+        GC::telemetry( st );
+        EXPECT_EQ( st.backlog_count, 0u );
+        EXPECT_EQ( st.blocking_thread, cds::OS::c_NullThreadId );
+    }
+
+    class gc_telemetry: public ::testing::Test
+    {};
+
+    TEST_F( gc_telemetry, HP )
+    {
+        cds::gc::hp::GarbageCollector::Construct( 4, 1, c_nItemCount * 2 );
+        cds::threading::Manager::attachThread();
+
+        // No scan() is called while retiring: the backlog is exact
+        {
+            cds::gc::HP::telemetry_snapshot st;
+            std::vector< item * > items = make_items();
+            for ( auto p : items )
+                cds::gc::HP::retire<disposer>( p );
+
+            cds::gc::HP::telemetry( st );
+            EXPECT_EQ( st.backlog_count, c_nItemCount );
+            EXPECT_EQ( st.backlog_bytes, c_nItemCount * sizeof( item ));
+            cds::gc::HP::scan();
+        }
+
+        test_hazard_pointer< cds::gc::HP >();
+
+        cds::threading::Manager::detachThread();
+        cds::gc::hp::GarbageCollector::Destruct( true );
+    }
+
+    TEST_F( gc_telemetry, DHP )
+    {
+        cds::gc::dhp::GarbageCollector::Construct( 4 );
+        cds::threading::Manager::attachThread();
+
+        test_hazard_pointer< cds::gc::DHP >();
+
+        cds::threading::Manager::detachThread();
+        cds::gc::dhp::GarbageCollector::Destruct();
+    }
+
+    TEST_F( gc_telemetry, RCU_GPB )
+    {
+        typedef cds::urcu::gc< cds::urcu::general_buffered<>> rcu_type;
+
+        rcu_type rcu( c_nItemCount * 2 );
+        cds::threading::Manager::attachThread();
+
+        rcu_type::telemetry_snapshot st;
+        std::vector< item * > items = make_items();
+        for ( auto p : items )
+            rcu_type::retire_ptr<disposer>( p );
+
+        rcu_type::telemetry( st );
+        EXPECT_EQ( st.backlog_count, c_nItemCount );
+        EXPECT_EQ( st.backlog_bytes, c_nItemCount * sizeof( item ));
+
+        rcu_type::synchronize();
+        rcu_type::telemetry( st );
+        EXPECT_EQ( st.backlog_count, 0u );
+        EXPECT_GT( st.retire_age.count(), 0u );
+        EXPECT_GT( st.reclaim_time.count(), 0u );
+
+        // A reader holds the critical section while the writer waits for the grace period
+        atomics::atomic<bool> bLocked( false );
+        cds::OS::ThreadId idReader = cds::OS::c_NullThreadId;
+        std::thread reader( [&bLocked, &idReader]() {
+            cds::threading::Manager::attachThread();
+            idReader = cds::OS::get_current_thread_id();
+            rcu_type::access_lock();
+            bLocked.store( true, atomics::memory_order_release );
+            std::this_thread::sleep_for( std::chrono::milliseconds( 50 ));
+            rcu_type::access_unlock();
+            cds::threading::Manager::detachThread();
+        });
+        while ( !bLocked.load( atomics::memory_order_acquire ))
+            std::this_thread::yield();
+
+        rcu_type::synchronize();
+        reader.join();
+
+        rcu_type::telemetry( st );
+        EXPECT_EQ( st.blocking_thread, idReader );
+
+        cds::threading::Manager::detachThread();
+    }
+
+    cds::gc::telemetry::details::collector s_Collector;
+    size_t s_nDisposeCount;
+
+    struct collector_locator {
+        static cds::gc::telemetry::details::collector& get()
+        {
+            return s_Collector;
+        }
+    };
+
+    void count_dispose( void* )
+    {
+        ++s_nDisposeCount;
+    }
+
+    TEST_F( gc_telemetry, release )
+    {
+        std::vector< item * > items = make_items();
+        auto it = std::find_if( items.begin(), items.end(), []( item* p ) { return cds::gc::telemetry::details::is_sampled( p ); });
+        ASSERT_TRUE( it != items.end());
+        item* p = *it;
+        s_nDisposeCount = 0;
+
+        // The sampled pointer is released by its disposer
+        cds::gc::details::free_retired_ptr_func func = count_dispose;
+        s_Collector.sample< collector_locator >( p, func );
+        EXPECT_TRUE( func != count_dispose );
+        func( p );
+        EXPECT_EQ( s_nDisposeCount, 1u );
+
+        // The pointer that is not in the sample table is not found
+        EXPECT_TRUE( s_Collector.release( p ) == nullptr );
+        EXPECT_EQ( s_nDisposeCount, 1u );
+
+        for ( auto pItem : items )
+            delete pItem;
+    }
+
+} // namespace
@@ -0,0 +1,244 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2017
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cds_test/ext_gtest.h>
+#include <cds/gc/hp.h>
+#include <cds/gc/dhp.h>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    struct item
+    {
+        size_t  nDisposeCount = 0;
+    };
+
+    struct disposer
+    {
+        void operator()( item * p ) const
+        {
+            ++p->nDisposeCount;
+        }
+    };
+
+    static size_t const c_nHazardPtrCount = 4;
+    static size_t const c_nThreadCount = 8;
+
+    // Starts nCount threads attached to the GC, they are waiting until release() is called
+    class attached_threads
+    {
+    public:
+        explicit attached_threads( size_t nCount )
+            : nAttached_( 0 )
+            , bRelease_( false )
+        {
+            for ( size_t i = 0; i < nCount; ++i ) {
+                threads_.emplace_back( [this]() {
+                    cds::threading::Manager::attachThread();
+                    nAttached_.fetch_add( 1, atomics::memory_order_acq_rel );
+                    while ( !bRelease_.load( atomics::memory_order_acquire ))
+                        std::this_thread::yield();
+                    cds::threading::Manager::detachThread();
+                });
+            }
+            while ( nAttached_.load( atomics::memory_order_acquire ) != nCount )
+                std::this_thread::yield();
+        }
+
+        ~attached_threads()
+        {
+            release();
+        }
+
+        void release()
+        {
+            bRelease_.store( true, atomics::memory_order_release );
+            for ( auto& t : threads_ ) {
+                if ( t.joinable())
+                    t.join();
+            }
+        }
+
+    private:
+        std::vector< std::thread > threads_;
+        atomics::atomic<size_t>    nAttached_;
+        atomics::atomic<bool>      bRelease_;
+    };
+
+    // Runs new thread attached to the GC, the thread retires pRetire if it is not null.
+    // Returns the thread record of the thread
+    template <class GC, class SMR>
+    void* attach_and_detach( item* pRetire )
+    {
+        void* pRec = nullptr;
+        std::thread th( [&pRec, pRetire]() {
+            cds::threading::Manager::attachThread();
+            pRec = SMR::tls();
+            if ( pRetire )
+                GC::template retire<disposer>( pRetire );
+            cds::threading::Manager::detachThread();
+        });
+        th.join();
+        return pRec;
+    }
+
+    void* hp_attach_and_detach( item* pRetire = nullptr )
+    {
+        return attach_and_detach< cds::gc::HP, cds::gc::hp::smr >( pRetire );
+    }
+
+    void* dhp_attach_and_detach( item* pRetire = nullptr )
+    {
+        return attach_and_detach< cds::gc::DHP, cds::gc::dhp::smr >( pRetire );
+    }
+
+    class hp_elastic: public ::testing::Test
+    {
+    protected:
+        void SetUp()
+        {
+            cds::gc::hp::smr::construct( c_nHazardPtrCount, 2, 0, cds::gc::hp::inplace, cds::gc::hp::elastic_capacity );
+            cds::threading::Manager::attachThread();
+        }
+
+        void TearDown()
+        {
+            cds::threading::Manager::detachThread();
+            cds::gc::hp::smr::destruct();
+        }
+
+        static size_t capacity()
+        {
+            return cds::gc::hp::smr::tls()->retired_.capacity();
+        }
+    };
+
+    TEST_F( hp_elastic, resize )
+    {
+        ASSERT_EQ( cds::gc::hp::smr::instance().get_capacity_mode(), cds::gc::hp::elastic_capacity );
+        EXPECT_EQ( cds::gc::HP::thread_count(), 1u );
+        size_t const nInitCapacity = capacity();
+        EXPECT_LT( nInitCapacity, 2 * c_nHazardPtrCount * c_nThreadCount );
+
+        item guarded;
+        std::vector< item > items( nInitCapacity * 4 );
+        {
+            cds::gc::HP::Guard g;
+            g.assign( &guarded );
+            cds::gc::HP::retire<disposer>( &guarded );
+
+            {
+                // The thread count is greater than nMaxThreadCount passed to construct()
+                attached_threads threads( c_nThreadCount - 1 );
+                EXPECT_EQ( cds::gc::HP::thread_count(), c_nThreadCount );
+
+                // The retired array grows on scan() and keeps the guarded pointer
+                for ( auto& i : items )
+                    cds::gc::HP::retire<disposer>( &i );
+                cds::gc::HP::scan();
+                EXPECT_GE( capacity(), 2 * c_nHazardPtrCount * c_nThreadCount );
+                EXPECT_EQ( cds::gc::hp::smr::tls()->retired_.size(), 1u );
+                EXPECT_EQ( guarded.nDisposeCount, 0u );
+                for ( auto const& i : items )
+                    EXPECT_EQ( i.nDisposeCount, 1u );
+            }
+            EXPECT_EQ( cds::gc::HP::thread_count(), 1u );
+
+            // The retired array shrinks when the threads are detached
+            cds::gc::HP::scan();
+            EXPECT_LT( capacity(), 2 * c_nHazardPtrCount * c_nThreadCount );
+            EXPECT_GE( capacity(), nInitCapacity );
+            EXPECT_EQ( cds::gc::hp::smr::tls()->retired_.size(), 1u );
+            EXPECT_EQ( guarded.nDisposeCount, 0u );
+        }
+
+        cds::gc::HP::scan();
+        EXPECT_EQ( guarded.nDisposeCount, 1u );
+        EXPECT_EQ( cds::gc::hp::smr::tls()->retired_.size(), 0u );
+    }
+
+    TEST_F( hp_elastic, record_reuse )
+    {
+        // The record released by a thread is reused by the next one
+        void* pRec = hp_attach_and_detach();
+        ASSERT_TRUE( pRec != nullptr );
+        EXPECT_NE( pRec, static_cast<void*>( cds::gc::hp::smr::tls()));
+        EXPECT_EQ( hp_attach_and_detach(), pRec );
+        EXPECT_EQ( cds::gc::HP::thread_count(), 1u );
+
+        // The pointer guarded by the current thread stays in the retired array of the released record
+        // and is freed by the next owner of the record
+        item guarded;
+        {
+            cds::gc::HP::Guard g;
+            g.assign( &guarded );
+            EXPECT_EQ( hp_attach_and_detach( &guarded ), pRec );
+            EXPECT_EQ( guarded.nDisposeCount, 0u );
+        }
+        EXPECT_EQ( hp_attach_and_detach(), pRec );
+        EXPECT_EQ( guarded.nDisposeCount, 1u );
+    }
+
+    class dhp_record_reuse: public ::testing::Test
+    {
+    protected:
+        void SetUp()
+        {
+            cds::gc::dhp::smr::construct( c_nHazardPtrCount );
+            cds::threading::Manager::attachThread();
+        }
+
+        void TearDown()
+        {
+            cds::threading::Manager::detachThread();
+            cds::gc::dhp::smr::destruct();
+        }
+    };
+
+    TEST_F( dhp_record_reuse, reuse )
+    {
+        void* pRec = dhp_attach_and_detach();
+        ASSERT_TRUE( pRec != nullptr );
+        EXPECT_NE( pRec, static_cast<void*>( cds::gc::dhp::smr::tls()));
+        EXPECT_EQ( dhp_attach_and_detach(), pRec );
+
+        item guarded;
+        {
+            cds::gc::DHP::Guard g;
+            g.assign( &guarded );
+            EXPECT_EQ( dhp_attach_and_detach( &guarded ), pRec );
+            EXPECT_EQ( guarded.nDisposeCount, 0u );
+        }
+        EXPECT_EQ( dhp_attach_and_detach(), pRec );
+        EXPECT_EQ( guarded.nDisposeCount, 1u );
+    }
+
+} // namespace
@@ -0,0 +1,162 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2017
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cds_test/ext_gtest.h>
+#include <cds/gc/hp.h>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    struct item
+    {
+        size_t  nDisposeCount = 0;
+    };
+
+    struct disposer
+    {
+        void operator()( item * p ) const
+        {
+            ++p->nDisposeCount;
+        }
+    };
+
+    class hp_vectorized_scan: public ::testing::Test
+    {
+    protected:
+        void construct( size_t nHazardPtrCount )
+        {
+            cds::gc::hp::smr::construct( nHazardPtrCount, 4, 0, cds::gc::hp::vectorized );
+            ASSERT_EQ( cds::gc::hp::smr::instance().get_scan_type(), cds::gc::hp::vectorized );
+            cds::threading::Manager::attachThread();
+        }
+
+        void TearDown()
+        {
+            cds::threading::Manager::detachThread();
+            cds::gc::hp::smr::destruct();
+        }
+
+        // Guards every nStep-th hazard pointer of the current thread, retires 3 items per hazard pointer
+        // and checks that scan() frees unguarded items only
+        static void test( size_t nHazardPtrCount, size_t nStep )
+        {
+            std::vector< item > items( nHazardPtrCount * 3 );
+            {
+                std::vector< cds::gc::HP::Guard > guards( nHazardPtrCount );
+                for ( size_t i = 0; i < nHazardPtrCount; i += nStep )
+                    guards[i].assign( &items[i * 3 + 1] );
+
+                for ( auto& i : items )
+                    cds::gc::HP::retire<disposer>( &i );
+                cds::gc::HP::scan();
+
+                for ( size_t i = 0; i < items.size(); ++i ) {
+                    bool const bGuarded = i % 3 == 1 && ( i / 3 ) % nStep == 0;
+                    EXPECT_EQ( items[i].nDisposeCount, bGuarded ? 0u : 1u ) << "item " << i;
+                }
+
+                // Guarded items are kept in the retired array
+                cds::gc::HP::scan();
+                for ( size_t i = 0; i < items.size(); ++i ) {
+                    bool const bGuarded = i % 3 == 1 && ( i / 3 ) % nStep == 0;
+                    EXPECT_EQ( items[i].nDisposeCount, bGuarded ? 0u : 1u ) << "item " << i;
+                }
+            }
+
+            // The guards are released
+            cds::gc::HP::scan();
+            for ( size_t i = 0; i < items.size(); ++i )
+                EXPECT_EQ( items[i].nDisposeCount, 1u ) << "item " << i;
+        }
+    };
+
+    TEST_F( hp_vectorized_scan, single_vector )
+    {
+        // The snapshot is less than kernel width
+        construct( 3 );
+        test( 3, 1 );
+    }
+
+    TEST_F( hp_vectorized_scan, linear )
+    {
+        // The snapshot is not a multiple of kernel width
+        construct( 29 );
+        test( 29, 1 );
+        test( 29, 3 );
+    }
+
+    TEST_F( hp_vectorized_scan, hash_set )
+    {
+        // The snapshot is greater than c_nVectorizedScanLinearLimit
+        size_t const nHazardPtrCount = cds::gc::hp::smr::c_nVectorizedScanLinearLimit * 2 + 5;
+        construct( nHazardPtrCount );
+        test( nHazardPtrCount, 1 );
+        test( nHazardPtrCount, 5 );
+    }
+
+    TEST_F( hp_vectorized_scan, other_thread )
+    {
+        construct( 16 );
+
+        item guarded;
+        item unguarded;
+        atomics::atomic<int> nStage( 0 );
+
+        std::thread th( [&]() {
+            cds::threading::Manager::attachThread();
+            {
+                cds::gc::HP::Guard g;
+                g.assign( &guarded );
+                nStage.store( 1, atomics::memory_order_release );
+                while ( nStage.load( atomics::memory_order_acquire ) != 2 )
+                    std::this_thread::yield();
+            }
+            cds::threading::Manager::detachThread();
+        });
+
+        while ( nStage.load( atomics::memory_order_acquire ) != 1 )
+            std::this_thread::yield();
+
+        cds::gc::HP::retire<disposer>( &guarded );
+        cds::gc::HP::retire<disposer>( &unguarded );
+        cds::gc::HP::scan();
+        EXPECT_EQ( guarded.nDisposeCount, 0u );
+        EXPECT_EQ( unguarded.nDisposeCount, 1u );
+
+        nStage.store( 2, atomics::memory_order_release );
+        th.join();
+
+        cds::gc::HP::scan();
+        EXPECT_EQ( guarded.nDisposeCount, 1u );
+        EXPECT_EQ( unguarded.nDisposeCount, 1u );
+    }
+
+} // namespace
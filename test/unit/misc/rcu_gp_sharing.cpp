@@ -0,0 +1,206 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2017
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cds_test/ext_gtest.h>
+#include <cds/urcu/general_instant.h>
+#include <cds/urcu/general_buffered.h>
+#include <chrono>
+#include <thread>
+
+namespace {
+
+    static std::chrono::milliseconds const c_nStallTime( 100 );
+
+    // Thread that is inside read-side critical section until release() is called
+    template <class RCU>
+    class reader_thread
+    {
+    public:
+        reader_thread()
+            : bLocked_( false )
+            , bRelease_( false )
+        {
+            thread_ = std::thread( [this]() {
+                cds::threading::Manager::attachThread();
+                {
+                    typename cds::urcu::gc<RCU>::scoped_lock sl;
+                    bLocked_.store( true, atomics::memory_order_release );
+                    while ( !bRelease_.load( atomics::memory_order_acquire ))
+                        std::this_thread::yield();
+                }
+                cds::threading::Manager::detachThread();
+            });
+
+            while ( !bLocked_.load( atomics::memory_order_acquire ))
+                std::this_thread::yield();
+        }
+
+        ~reader_thread()
+        {
+            release();
+        }
+
+        void release()
+        {
+            bRelease_.store( true, atomics::memory_order_release );
+            if ( thread_.joinable())
+                thread_.join();
+        }
+
+    private:
+        std::thread             thread_;
+        atomics::atomic<bool>   bLocked_;
+        atomics::atomic<bool>   bRelease_;
+    };
+
+    // Thread that calls synchronize()
+    template <class RCU>
+    class writer_thread
+    {
+    public:
+        writer_thread()
+            : bDone_( false )
+        {
+            thread_ = std::thread( [this]() {
+                cds::threading::Manager::attachThread();
+                cds::urcu::gc<RCU>::synchronize();
+                bDone_.store( true, atomics::memory_order_release );
+                cds::threading::Manager::detachThread();
+            });
+        }
+
+        ~writer_thread()
+        {
+            join();
+        }
+
+        bool done() const
+        {
+            return bDone_.load( atomics::memory_order_acquire );
+        }
+
+        void join()
+        {
+            if ( thread_.joinable())
+                thread_.join();
+        }
+
+    private:
+        std::thread             thread_;
+        atomics::atomic<bool>   bDone_;
+    };
+
+    template <class RCU>
+    class rcu_gp_sharing: public ::testing::Test
+    {
+    protected:
+        typedef RCU rcu_implementation;
+        typedef cds::urcu::gc<RCU> rcu_type;
+
+        void SetUp()
+        {
+            RCU::Construct();
+            cds::threading::Manager::attachThread();
+        }
+
+        void TearDown()
+        {
+            cds::threading::Manager::detachThread();
+            RCU::Destruct();
+        }
+
+        static uint64_t gp_snap()
+        {
+            return RCU::instance()->gp_snap();
+        }
+
+        static bool gp_done( uint64_t nSnap )
+        {
+            return RCU::instance()->gp_done( nSnap );
+        }
+    };
+
+    typedef ::testing::Types<
+        cds::urcu::general_instant<>,
+        cds::urcu::general_buffered<>
+    > rcu_types;
+    TYPED_TEST_CASE( rcu_gp_sharing, rcu_types );
+
+    TYPED_TEST( rcu_gp_sharing, synchronize )
+    {
+        typedef typename TestFixture::rcu_type rcu_type;
+
+        uint64_t const nSnap = this->gp_snap();
+        EXPECT_FALSE( this->gp_done( nSnap ));
+        rcu_type::synchronize();
+        EXPECT_TRUE( this->gp_done( nSnap ));
+
+        // The grace period passed before the snapshot does not count
+        uint64_t const nSnap2 = this->gp_snap();
+        EXPECT_GT( nSnap2, nSnap );
+        EXPECT_FALSE( this->gp_done( nSnap2 ));
+        rcu_type::synchronize();
+        EXPECT_TRUE( this->gp_done( nSnap2 ));
+    }
+
+    TYPED_TEST( rcu_gp_sharing, reader )
+    {
+        typedef typename TestFixture::rcu_implementation rcu_implementation;
+        typedef typename TestFixture::rcu_type rcu_type;
+
+        uint64_t nSnap;
+        uint64_t nSnapInProgress;
+        {
+            reader_thread< rcu_implementation > reader;
+            nSnap = this->gp_snap();
+
+            // The grace period cannot end while the reader is inside the critical section
+            writer_thread< rcu_implementation > writer;
+            std::this_thread::sleep_for( c_nStallTime );
+            EXPECT_FALSE( writer.done());
+            EXPECT_FALSE( this->gp_done( nSnap ));
+
+            // The snapshot taken during the grace period requires the next one
+            nSnapInProgress = this->gp_snap();
+            std::this_thread::sleep_for( c_nStallTime );
+            EXPECT_FALSE( this->gp_done( nSnap ));
+
+            reader.release();
+            writer.join();
+            EXPECT_TRUE( writer.done());
+        }
+        EXPECT_TRUE( this->gp_done( nSnap ));
+        EXPECT_FALSE( this->gp_done( nSnapInProgress ));
+
+        rcu_type::synchronize();
+        EXPECT_TRUE( this->gp_done( nSnapInProgress ));
+    }
+
+} // namespace
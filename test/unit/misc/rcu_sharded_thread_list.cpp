@@ -0,0 +1,203 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2017
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cds_test/ext_gtest.h>
+#include <cds/urcu/general_instant.h>
+#include <algorithm>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    typedef cds::urcu::details::sharded_thread_list< cds::urcu::general_instant_tag > thread_list;
+    typedef thread_list::thread_record thread_record;
+
+    static size_t const c_nShardCount = 4;
+    static size_t const c_nThreadCount = 8;
+    static size_t const c_nPassCount = 2000;
+
+    // The processor the thread is running on; the test sets it explicitly to choose the shard
+    thread_local unsigned int s_nProcessor = 0;
+
+    unsigned int current_processor()
+    {
+        return s_nProcessor;
+    }
+
+    class rcu_sharded_thread_list: public ::testing::Test
+    {
+    protected:
+        static size_t record_count( thread_list const& list, size_t nShard )
+        {
+            size_t nCount = 0;
+            for ( thread_record* p = list.head( nShard, atomics::memory_order_acquire ); p; p = p->m_list.m_pNext.load( atomics::memory_order_relaxed ))
+                ++nCount;
+            return nCount;
+        }
+
+        static bool is_free( thread_record const* p )
+        {
+            return p->m_list.m_idOwner.load( atomics::memory_order_acquire ) == cds::OS::c_NullThreadId;
+        }
+
+        static void check_all_free( thread_list const& list )
+        {
+            for ( size_t i = 0; i < list.shard_count(); ++i ) {
+                EXPECT_EQ( list.active_count( i ), 0u ) << "shard=" << i;
+                for ( thread_record* p = list.head( i, atomics::memory_order_acquire ); p; p = p->m_list.m_pNext.load( atomics::memory_order_relaxed )) {
+                    EXPECT_TRUE( is_free( p ));
+                    EXPECT_EQ( p->m_list.m_nShard, i );
+                }
+            }
+        }
+    };
+
+    TEST_F( rcu_sharded_thread_list, shard_count )
+    {
+        EXPECT_EQ( thread_list( 0, current_processor ).shard_count(), 1u );
+        EXPECT_EQ( thread_list( c_nShardCount, current_processor ).shard_count(), c_nShardCount );
+        size_t const nMaxShardCount = thread_list::c_nMaxShardCount;
+        EXPECT_EQ( thread_list( nMaxShardCount * 2, current_processor ).shard_count(), nMaxShardCount );
+    }
+
+    TEST_F( rcu_sharded_thread_list, attach_detach )
+    {
+        thread_list list( c_nShardCount, current_processor );
+
+        // The threads attach and detach concurrently, several threads share each shard.
+        // Another thread compacts the shards like the RCU writer does
+        atomics::atomic<size_t> nErrors( 0 );
+        atomics::atomic<size_t> nRunning( c_nThreadCount );
+        std::vector< std::thread > threads;
+        for ( size_t i = 0; i < c_nThreadCount; ++i ) {
+            threads.emplace_back( [&list, &nErrors, &nRunning, i]() {
+                s_nProcessor = static_cast<unsigned int>( i );
+                cds::OS::ThreadId const self = cds::OS::get_current_thread_id();
+                size_t const nShard = i % c_nShardCount;
+
+                for ( size_t pass = 0; pass < c_nPassCount; ++pass ) {
+                    thread_record* pRec = list.alloc();
+                    if ( pRec->m_list.m_nShard != nShard || list.active_count( nShard ) == 0 )
+                        nErrors.fetch_add( 1, atomics::memory_order_relaxed );
+                    if ( pRec->m_list.m_idOwner.load( atomics::memory_order_acquire ) != self )
+                        nErrors.fetch_add( 1, atomics::memory_order_relaxed );
+
+                    std::this_thread::yield();
+
+                    // No other thread may take the record while it is owned
+                    if ( pRec->m_list.m_idOwner.load( atomics::memory_order_acquire ) != self )
+                        nErrors.fetch_add( 1, atomics::memory_order_relaxed );
+                    list.retire( pRec );
+                }
+                nRunning.fetch_sub( 1, atomics::memory_order_release );
+            });
+        }
+        threads.emplace_back( [&list, &nRunning]() {
+            while ( nRunning.load( atomics::memory_order_acquire ) != 0 ) {
+                list.compact();
+                std::this_thread::yield();
+            }
+        });
+
+        for ( auto& t : threads )
+            t.join();
+
+        EXPECT_EQ( nErrors.load( atomics::memory_order_relaxed ), 0u );
+        check_all_free( list );
+
+        // The shard list walked by the grace period detection stays short
+        list.compact();
+        size_t const nCompactThreshold = thread_list::c_nCompactThreshold;
+        for ( size_t i = 0; i < c_nShardCount; ++i )
+            EXPECT_LT( record_count( list, i ), nCompactThreshold ) << "shard=" << i;
+    }
+
+    TEST_F( rcu_sharded_thread_list, compact )
+    {
+        thread_list list( c_nShardCount, current_processor );
+        s_nProcessor = 1;
+
+        // The records owned by the thread are not reused
+        std::vector< thread_record* > records;
+        for ( size_t i = 0; i < thread_list::c_nCompactThreshold * 2; ++i )
+            records.push_back( list.alloc());
+        EXPECT_EQ( std::set< thread_record* >( records.begin(), records.end()).size(), records.size());
+        EXPECT_EQ( list.active_count( 1 ), records.size());
+        EXPECT_EQ( record_count( list, 1 ), records.size());
+
+        // The shard having too many free records is compacted
+        for ( auto p : records )
+            list.retire( p );
+        list.compact();
+        EXPECT_EQ( record_count( list, 1 ), 0u );
+        EXPECT_EQ( list.active_count( 1 ), 0u );
+
+        // The spare records are reused
+        thread_record* pRec = list.alloc();
+        EXPECT_TRUE( std::find( records.begin(), records.end(), pRec ) != records.end());
+        EXPECT_EQ( list.head( 1, atomics::memory_order_acquire ), pRec );
+        EXPECT_EQ( list.active_count( 1 ), 1u );
+        list.retire( pRec );
+        s_nProcessor = 0;
+    }
+
+    TEST_F( rcu_sharded_thread_list, detach_all )
+    {
+        thread_list list( c_nShardCount, current_processor );
+
+        // The threads of all shards stay attached
+        std::vector< thread_record* > records;
+        for ( size_t i = 0; i < c_nThreadCount; ++i ) {
+            std::thread th( [&list, &records, i]() {
+                s_nProcessor = static_cast<unsigned int>( i );
+                records.push_back( list.alloc());
+            });
+            th.join();
+        }
+        for ( size_t i = 0; i < c_nShardCount; ++i )
+            EXPECT_EQ( list.active_count( i ), c_nThreadCount / c_nShardCount ) << "shard=" << i;
+
+        list.detach_all();
+        check_all_free( list );
+
+        // The detached records are reused
+        for ( size_t i = 0; i < c_nThreadCount; ++i ) {
+            s_nProcessor = static_cast<unsigned int>( i );
+            thread_record* pRec = list.alloc();
+            EXPECT_TRUE( std::find( records.begin(), records.end(), pRec ) != records.end());
+            EXPECT_EQ( pRec->m_list.m_nShard, i % c_nShardCount );
+        }
+        s_nProcessor = 0;
+        list.detach_all();
+        check_all_free( list );
+    }
+
+} // namespace
@@ -205,3 +205,53 @@ TEST_F( CDSTEST_FIXTURE_NAME, turbo16 )
     set_type s;
     test( s );
 }
+
+TEST_F( CDSTEST_FIXTURE_NAME, insert_sorted )
+{
+    struct set_traits: public cc::skip_list::traits
+    {
+        typedef cmp compare;
+        typedef cds::atomicity::item_counter item_counter;
+        typedef cc::skip_list::stat<> stat;
+    };
+    typedef cc::SkipListSet< gc_type, int_item, set_traits >set_type;
+
+    size_t const nSize = kSize;
+
+    set_type s;
+
+    // bulk load of even keys
+    std::vector< int_item > data;
+    for ( int i = 0; i < static_cast<int>( nSize ); i += 2 )
+        data.push_back( int_item( i ));
+    EXPECT_EQ( s.insert_sorted( data.begin(), data.end()), data.size());
+    EXPECT_EQ( s.insert_sorted( data.begin(), data.end()), 0u );
+    EXPECT_EQ( s.size(), data.size());
+
+    // merge all keys: only odd keys are new
+    data.clear();
+    for ( int i = 0; i < static_cast<int>( nSize ); ++i )
+        data.push_back( int_item( i ));
+    EXPECT_EQ( s.insert_sorted( data.begin(), data.end()), nSize / 2 );
+    EXPECT_EQ( s.size(), nSize );
+
+    int nPrev = -1;
+    for ( auto it = s.begin(); it != s.end(); ++it ) {
+        EXPECT_EQ( it->nKey, nPrev + 1 );
+        nPrev = it->nKey;
+    }
+    EXPECT_EQ( nPrev, static_cast<int>( nSize ) - 1 );
+
+    // unsorted range
+    s.clear();
+    std::vector< int > keys;
+    for ( int i = 0; i < static_cast<int>( nSize ); ++i )
+        keys.push_back( i );
+    shuffle( keys.begin(), keys.end());
+    EXPECT_EQ( s.insert_sorted( keys.begin(), keys.end()), nSize );
+    for ( auto k : keys )
+        EXPECT_TRUE( s.contains( k ));
+
+    s.clear();
+    EXPECT_TRUE( s.empty());
+}
@@ -32,6 +32,7 @@
 #define CDSUNIT_SET_TEST_FELDMAN_HASHSET_HP_H
 
 #include "test_feldman_hashset.h"
+#include <memory>   // unique_ptr
 
 namespace cds_test {
 
@@ -107,6 +108,30 @@ namespace cds_test {
                 gp.release();
             }
 
+            // find_batch/contains_batch: keys >= nSetSize are absent
+            {
+                std::vector< typename Set::hash_type > keys;
+                std::vector< int > intKeys;
+                for ( auto idx : indices )
+                    intKeys.push_back( data[idx].key());
+                for ( size_t k = 0; k < 40; ++k )
+                    intKeys.push_back( static_cast<int>( nSetSize + k ));
+                for ( int k : intKeys )
+                    keys.push_back( k );
+
+                std::unique_ptr<bool[]> found( new bool[keys.size()] );
+                EXPECT_EQ( s.contains_batch( keys.data(), keys.size(), found.get()), nSetSize );
+                for ( size_t k = 0; k < keys.size(); ++k )
+                    EXPECT_EQ( found[k], static_cast<size_t>( intKeys[k] ) < nSetSize ) << "key=" << intKeys[k];
+
+                size_t nCalls = 0;
+                EXPECT_EQ( s.find_batch( keys.data(), keys.size(), [&intKeys, &nCalls]( size_t nIndex, value_type& item ) {
+                    EXPECT_EQ( item.key(), intKeys[nIndex] );
+                    ++nCalls;
+                }), nSetSize );
+                EXPECT_EQ( nCalls, nSetSize );
+            }
+
             // extract()
             for ( auto idx : indices ) {
                 auto& i = data[idx];
@@ -124,6 +149,16 @@ namespace cds_test {
             ASSERT_TRUE( s.empty());
             ASSERT_CONTAINER_SIZE( s, 0 );
 
+            // compact() of the empty set leaves the head only
+            s.compact();
+            EXPECT_EQ( s.compact(), 0u );
+            {
+                std::vector< typename Set::level_statistics > level_stat;
+                s.get_level_statistics( level_stat );
+                ASSERT_EQ( level_stat.size(), 1u );
+                EXPECT_EQ( level_stat[0].array_cell_count, 0u );
+            }
+
             // erase_at()
             for ( auto& i : data ) {
                 ASSERT_TRUE( s.insert( i ));
@@ -513,5 +513,40 @@ namespace {
         test( m );
     }
 
+    TEST_F( CuckooMap, optimistic_vector_unordered_storehash )
+    {
+        struct map_traits: public store_hash_traits
+        {
+            typedef cds::opt::hash_tuple< hash1, hash2 > hash;
+            typedef cc::cuckoo::optimistic<> mutex_policy;
+            typedef base_class::equal_to    equal_to;
+            typedef cc::cuckoo::stat        stat;
+            typedef cc::cuckoo::vector<4>   probeset_type;
+        };
+        typedef cc::CuckooMap< key_type, value_type, map_traits > map_type;
+
+        map_type m( 32, 4 );
+        test( m );
+    }
+
+    TEST_F( CuckooMap, optimistic_list_ordered_stat )
+    {
+        typedef cc::CuckooMap< key_type, value_type
+            , cc::cuckoo::make_traits<
+                cds::opt::hash< std::tuple< hash1, hash2 > >
+                ,cds::opt::mutex_policy< cc::cuckoo::optimistic<>>
+                ,cds::opt::less< less >
+                ,cds::opt::compare< cmp >
+                ,cds::opt::stat< cc::cuckoo::stat >
+                ,cc::cuckoo::probeset_type< cc::cuckoo::list >
+            >::type
+        > map_type;
+
+        map_type m;
+        test( m );
+        EXPECT_GT( static_cast<size_t>( m.mutex_policy_statistics().m_nReadCount ), 0u );
+        EXPECT_GT( static_cast<size_t>( m.mutex_policy_statistics().m_nSynchronizeCount ), 0u );
+    }
+
 
 } // namespace
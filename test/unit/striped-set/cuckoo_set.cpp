@@ -513,5 +513,57 @@ namespace {
         test( s );
     }
 
+    TEST_F( CuckooSet, optimistic_list_unordered_storehash )
+    {
+        struct set_traits: public store_hash_traits
+        {
+            typedef cc::cuckoo::optimistic<> mutex_policy;
+            typedef cds::opt::hash_tuple< hash1, hash2 > hash;
+            typedef base_class::equal_to equal_to;
+            typedef cc::cuckoo::list     probeset_type;
+            typedef cc::cuckoo::stat     stat;
+        };
+        typedef cc::CuckooSet< int_item, set_traits > set_type;
+
+        set_type s;
+        test( s );
+    }
+
+    TEST_F( CuckooSet, optimistic_vector_ordered_stat )
+    {
+        typedef cc::CuckooSet< int_item
+            ,cc::cuckoo::make_traits<
+                cds::opt::hash< std::tuple< hash1, hash2 > >
+                ,cds::opt::mutex_policy< cc::cuckoo::optimistic<>>
+                ,cds::opt::less< less >
+                ,cds::opt::compare< cmp >
+                ,cds::opt::stat< cc::cuckoo::stat >
+                ,cc::cuckoo::probeset_type< cc::cuckoo::vector<6>>
+            >::type
+        > set_type;
+
+        set_type s( 32, 6 );
+        test( s );
+        EXPECT_GT( static_cast<size_t>( s.mutex_policy_statistics().m_nReadCount ), 0u );
+        EXPECT_GT( static_cast<size_t>( s.mutex_policy_statistics().m_nSynchronizeCount ), 0u );
+    }
+
+
+    TEST_F( CuckooSet, bfs_vector_ordered_stat )
+    {
+        typedef cc::CuckooSet< int_item
+            ,cc::cuckoo::make_traits<
+                cds::opt::hash< std::tuple< hash1, hash2 > >
+                ,cds::opt::less< less >
+                ,cds::opt::compare< cmp >
+                ,cds::opt::stat< cc::cuckoo::stat >
+                ,cc::cuckoo::probeset_type< cc::cuckoo::vector<4>>
+                ,cc::cuckoo::bfs_depth< 4 >
+            >::type
+        > set_type;
+
+        set_type s( 32, 4 );
+        test( s );
+    }
 
 } // namespace
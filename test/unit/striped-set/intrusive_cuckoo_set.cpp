@@ -42,6 +42,22 @@ namespace {
 
         typedef base_class::hash_int hash1;
 
+        // Well-mixed hash pair for the occupancy test
+        template <size_t Seed>
+        struct mix_hash {
+            size_t operator()( int i ) const
+            {
+                uint64_t h = static_cast<uint64_t>( i ) + Seed;
+                h = ( h ^ ( h >> 30 )) * 0xbf58476d1ce4e5b9ULL;
+                h = ( h ^ ( h >> 27 )) * 0x94d049bb133111ebULL;
+                return static_cast<size_t>( h ^ ( h >> 31 ));
+            }
+            template <typename Item>
+            size_t operator()( const Item& i ) const
+            {
+                return (*this)( i.key());
+            }
+        };
 
         template <typename Set>
         void test( Set& s, std::vector< typename Set::value_type >& data )
@@ -1403,4 +1419,274 @@ namespace {
         }
     }
 
+//************************************************************
+// optimistic
+
+    TEST_F( IntrusiveCuckooSet, optimistic_list_basehook_unordered )
+    {
+        typedef base_class::base_int_item< ci::cuckoo::node< ci::cuckoo::list, 0 > >  item_type;
+        struct set_traits: public ci::cuckoo::traits
+        {
+            typedef cds::opt::hash_tuple< hash1, hash2 > hash;
+            typedef base_class::equal_to<item_type> equal_to;
+            typedef mock_disposer disposer;
+            typedef ci::cuckoo::optimistic<> mutex_policy;
+        };
+        typedef ci::CuckooSet< item_type, set_traits > set_type;
+
+        std::vector< typename set_type::value_type > data;
+        {
+            set_type s;
+            test( s, data );
+        }
+    }
+
+    TEST_F( IntrusiveCuckooSet, optimistic_vector_basehook_unordered )
+    {
+        typedef base_class::base_int_item< ci::cuckoo::node< ci::cuckoo::vector<4>, 0 >> item_type;
+        struct set_traits: public ci::cuckoo::traits
+        {
+            typedef ci::cuckoo::base_hook< ci::cuckoo::probeset_type< item_type::probeset_type >> hook;
+            typedef cds::opt::hash_tuple< hash1, hash2 > hash;
+            typedef base_class::equal_to<item_type> equal_to;
+            typedef mock_disposer disposer;
+            typedef ci::cuckoo::optimistic<> mutex_policy;
+        };
+        typedef ci::CuckooSet< item_type, set_traits > set_type;
+
+        std::vector< typename set_type::value_type > data;
+        {
+            set_type s( 32, 4 );
+            test( s, data );
+        }
+    }
+
+    TEST_F( IntrusiveCuckooSet, optimistic_list_basehook_ordered_stat )
+    {
+        typedef base_class::base_int_item< ci::cuckoo::node< ci::cuckoo::list, 0 >> item_type;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::base_hook<
+                    ci::cuckoo::probeset_type< item_type::probeset_type >
+                > >
+                ,ci::opt::mutex_policy<ci::cuckoo::optimistic<>>
+                ,ci::opt::hash< std::tuple< hash1, hash2 > >
+                ,ci::opt::less< less<item_type> >
+                ,ci::opt::compare< cmp<item_type> >
+                ,ci::opt::stat< ci::cuckoo::stat >
+                ,ci::opt::disposer< mock_disposer >
+            >::type
+        > set_type;
+
+        std::vector< typename set_type::value_type > data;
+        {
+            set_type s;
+            test( s, data );
+
+            // no concurrent writers - each lookup succeeds at first attempt
+            EXPECT_GT( static_cast<size_t>( s.mutex_policy_statistics().m_nReadCount ), 0u );
+            EXPECT_EQ( static_cast<size_t>( s.mutex_policy_statistics().m_nReadRetryCount ), 0u );
+            EXPECT_EQ( static_cast<size_t>( s.mutex_policy_statistics().m_nReadFallbackCount ), 0u );
+        }
+    }
+
+    TEST_F( IntrusiveCuckooSet, optimistic_vector_basehook_ordered_stat )
+    {
+        typedef base_class::base_int_item< ci::cuckoo::node< ci::cuckoo::vector<6>, 0 >> item_type;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::base_hook<
+                    ci::cuckoo::probeset_type< item_type::probeset_type >
+                > >
+                ,ci::opt::mutex_policy<ci::cuckoo::optimistic<>>
+                ,ci::opt::hash< std::tuple< hash1, hash2 > >
+                ,ci::opt::less< less<item_type> >
+                ,ci::opt::compare< cmp<item_type> >
+                ,ci::opt::stat< ci::cuckoo::stat >
+                ,ci::opt::disposer< mock_disposer >
+            >::type
+        > set_type;
+
+        std::vector< typename set_type::value_type > data;
+        {
+            set_type s;
+            test( s, data );
+
+            EXPECT_GT( static_cast<size_t>( s.mutex_policy_statistics().m_nReadCount ), 0u );
+            EXPECT_EQ( static_cast<size_t>( s.mutex_policy_statistics().m_nReadFallbackCount ), 0u );
+        }
+    }
+
+    TEST_F( IntrusiveCuckooSet, optimistic_vector_basehook_unordered_storehash )
+    {
+        typedef base_class::base_int_item< ci::cuckoo::node< ci::cuckoo::vector<4>, 2 >> item_type;
+        struct set_traits: public ci::cuckoo::traits
+        {
+            typedef ci::cuckoo::base_hook<
+                ci::cuckoo::probeset_type< item_type::probeset_type >
+                ,ci::cuckoo::store_hash< item_type::hash_array_size >
+            > hook;
+            typedef cds::opt::hash_tuple< hash1, hash2 > hash;
+            typedef base_class::equal_to<item_type> equal_to;
+            typedef mock_disposer disposer;
+            typedef ci::cuckoo::optimistic<> mutex_policy;
+        };
+        typedef ci::CuckooSet< item_type, set_traits > set_type;
+
+        std::vector< typename set_type::value_type > data;
+        {
+            typename set_type::hash_tuple_type ht;
+            set_type s( 32, 4, 0, ht );
+            test( s, data );
+        }
+    }
+
+    TEST_F( IntrusiveCuckooSet, optimistic_list_memberhook_ordered_storehash )
+    {
+        typedef base_class::member_int_item< ci::cuckoo::node< ci::cuckoo::list, 2 >> item_type;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::member_hook< offsetof( item_type, hMember ),
+                    ci::cuckoo::probeset_type< item_type::member_type::probeset_type >
+                    ,ci::cuckoo::store_hash< item_type::member_type::hash_array_size >
+                > >
+                ,ci::opt::mutex_policy<ci::cuckoo::optimistic<>>
+                ,cds::opt::hash< std::tuple< hash1, hash2 > >
+                ,cds::opt::less< less<item_type> >
+                ,cds::opt::compare< cmp<item_type> >
+                ,ci::opt::disposer< mock_disposer >
+            >::type
+        > set_type;
+
+        std::vector< typename set_type::value_type > data;
+        {
+            typename set_type::hash_tuple_type ht;
+            set_type s( std::move( ht ));
+            test( s, data );
+        }
+    }
+
+//************************************************************
+// BFS cuckoo path search
+
+    TEST_F( IntrusiveCuckooSet, bfs_vector_basehook_unordered )
+    {
+        typedef base_class::base_int_item< ci::cuckoo::node< ci::cuckoo::vector<4>, 0 >> item_type;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::base_hook<
+                    ci::cuckoo::probeset_type< item_type::probeset_type >
+                > >
+                ,ci::cuckoo::bfs_depth< 4 >
+                ,ci::opt::hash< std::tuple< hash1, hash2 > >
+                ,ci::opt::equal_to< base_class::equal_to<item_type> >
+                ,ci::opt::disposer< mock_disposer >
+            >::type
+        > set_type;
+
+        std::vector< typename set_type::value_type > data;
+        {
+            set_type s( 32, 4 );
+            test( s, data );
+        }
+    }
+
+    TEST_F( IntrusiveCuckooSet, bfs_list_basehook_ordered_stat )
+    {
+        typedef base_class::base_int_item< ci::cuckoo::node< ci::cuckoo::list, 0 >> item_type;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::base_hook<
+                    ci::cuckoo::probeset_type< item_type::probeset_type >
+                > >
+                ,ci::cuckoo::bfs_depth< 3 >
+                ,ci::opt::hash< std::tuple< hash1, hash2 > >
+                ,ci::opt::less< less<item_type> >
+                ,ci::opt::compare< cmp<item_type> >
+                ,ci::opt::stat< ci::cuckoo::stat >
+                ,ci::opt::disposer< mock_disposer >
+            >::type
+        > set_type;
+
+        std::vector< typename set_type::value_type > data;
+        {
+            set_type s( 32, 4 );
+            test( s, data );
+        }
+    }
+
+    TEST_F( IntrusiveCuckooSet, bfs_vector_memberhook_ordered_storehash )
+    {
+        typedef base_class::member_int_item< ci::cuckoo::node< ci::cuckoo::vector<4>, 2 >> item_type;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::member_hook< offsetof( item_type, hMember ),
+                    ci::cuckoo::probeset_type< item_type::member_type::probeset_type >
+                    ,ci::cuckoo::store_hash< item_type::member_type::hash_array_size >
+                > >
+                ,ci::cuckoo::bfs_depth< 2 >
+                ,ci::opt::mutex_policy< ci::cuckoo::refinable<> >
+                ,cds::opt::hash< std::tuple< hash1, hash2 > >
+                ,cds::opt::less< less<item_type> >
+                ,cds::opt::compare< cmp<item_type> >
+                ,ci::opt::disposer< mock_disposer >
+            >::type
+        > set_type;
+
+        std::vector< typename set_type::value_type > data;
+        {
+            set_type s( 32, 4 );
+            test( s, data );
+        }
+    }
+
+    TEST_F( IntrusiveCuckooSet, bfs_vector_basehook_occupancy )
+    {
+        typedef base_class::base_int_item< ci::cuckoo::node< ci::cuckoo::vector<4>, 0 >> item_type;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::base_hook<
+                    ci::cuckoo::probeset_type< item_type::probeset_type >
+                > >
+                ,ci::cuckoo::bfs_depth< 4 >
+                ,ci::opt::hash< std::tuple< mix_hash<1>, mix_hash<0x9e3779b9> > >
+                ,ci::opt::equal_to< base_class::equal_to<item_type> >
+                ,ci::opt::stat< ci::cuckoo::stat >
+                ,ci::opt::disposer< mock_disposer >
+            >::type
+        > set_type;
+
+        // Fill 90% of slots: BFS path search should place all items without resizing
+        size_t const nBucketCount = 256;
+        size_t const nItemCount = nBucketCount * 2 * 4 * 9 / 10;
+
+        std::vector< item_type > data;
+        data.reserve( nItemCount );
+        for ( size_t i = 0; i < nItemCount; ++i )
+            data.push_back( item_type( static_cast<int>( i )));
+
+        {
+            set_type s( nBucketCount, 4 );
+            for ( auto& i : data )
+                ASSERT_TRUE( s.insert( i ));
+
+            EXPECT_EQ( s.bucket_count(), nBucketCount );
+            EXPECT_EQ( s.size(), nItemCount );
+            for ( auto& i : data )
+                EXPECT_TRUE( s.contains( i.key()));
+
+            EXPECT_GT( static_cast<size_t>( s.statistics().m_nPathMoveCount ), 0u );
+            EXPECT_EQ( static_cast<size_t>( s.statistics().m_nResizeCallCount ), 0u );
+
+            s.clear();
+        }
+    }
+
 } // namespace
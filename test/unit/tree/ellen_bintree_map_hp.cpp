@@ -122,6 +122,20 @@ namespace {
         test( m );
     }
 
+    TEST_F( EllenBinTreeMap_HP, cached_allocator )
+    {
+        struct map_traits: public cc::ellen_bintree::traits
+        {
+            typedef cmp compare;
+            typedef cc::ellen_bintree::cached_allocator<> node_allocator;
+            typedef cc::ellen_bintree::cached_allocator<> update_desc_allocator;
+        };
+        typedef cc::EllenBinTreeMap< gc_type, key_type, value_type, map_traits > map_type;
+
+        map_type m;
+        test( m );
+    }
+
     TEST_F( EllenBinTreeMap_HP, item_counting )
     {
         struct map_traits: public cc::ellen_bintree::traits
@@ -131,6 +131,20 @@ namespace {
         test( s );
     }
 
+    TEST_F( EllenBinTreeSet_HP, cached_allocator )
+    {
+        struct set_traits: public generic_traits
+        {
+            typedef cmp compare;
+            typedef cc::ellen_bintree::cached_allocator<> node_allocator;
+            typedef cc::ellen_bintree::cached_allocator<> update_desc_allocator;
+        };
+        typedef cc::EllenBinTreeSet< gc_type, key_type, int_item, set_traits > set_type;
+
+        set_type s;
+        test( s );
+    }
+
     TEST_F( EllenBinTreeSet_HP, item_counting )
     {
         struct set_traits: public generic_traits
@@ -181,6 +181,23 @@ namespace {
         test( t );
     }
 
+    TEST_F( IntrusiveEllenBinTree_HP, base_cached_allocator )
+    {
+        struct tree_traits: public generic_traits
+        {
+            typedef ci::ellen_bintree::base_hook< ci::opt::gc< gc_type >> hook;
+            typedef base_class::less<base_item_type> less;
+            typedef cds::atomicity::item_counter item_counter;
+            typedef ci::ellen_bintree::cached_allocator<> node_allocator;
+            typedef ci::ellen_bintree::cached_allocator<> update_desc_allocator;
+        };
+
+        typedef ci::EllenBinTree< gc_type, key_type, base_item_type, tree_traits > tree_type;
+
+        tree_type t;
+        test( t );
+    }
+
     // member hook
     TEST_F( IntrusiveEllenBinTree_HP, member_cmp )
     {
@@ -0,0 +1,251 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2017
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef CDSUNIT_TREE_TEST_BLINK_TREE_MAP_RCU_H
+#define CDSUNIT_TREE_TEST_BLINK_TREE_MAP_RCU_H
+
+#include "test_tree_map_rcu.h"
+#include <cds/container/blink_tree_map_rcu.h>
+#include <mutex>
+
+namespace {
+    namespace cc = cds::container;
+
+    template <class RCU>
+    class BLinkTreeMap: public cds_test::container_tree_map_rcu
+    {
+        typedef cds_test::container_tree_map_rcu base_class;
+    public:
+        typedef cds::urcu::gc<RCU> rcu_type;
+
+    protected:
+
+        void SetUp()
+        {
+            RCU::Construct();
+            cds::threading::Manager::attachThread();
+        }
+
+        void TearDown()
+        {
+            cds::threading::Manager::detachThread();
+            RCU::Destruct();
+        }
+    };
+
+    TYPED_TEST_CASE_P( BLinkTreeMap );
+
+    TYPED_TEST_P( BLinkTreeMap, compare )
+    {
+        typedef typename TestFixture::rcu_type   rcu_type;
+        typedef typename TestFixture::key_type   key_type;
+        typedef typename TestFixture::value_type value_type;
+
+        typedef cc::BLinkTreeMap< rcu_type, key_type, value_type,
+            typename cc::blink_tree::make_traits<
+                cds::opt::compare< typename TestFixture::cmp >
+            >::type
+        > map_type;
+
+        map_type m;
+        this->test( m );
+    }
+
+    TYPED_TEST_P( BLinkTreeMap, less )
+    {
+        typedef typename TestFixture::rcu_type   rcu_type;
+        typedef typename TestFixture::key_type   key_type;
+        typedef typename TestFixture::value_type value_type;
+
+        typedef cc::BLinkTreeMap< rcu_type, key_type, value_type,
+            typename cc::blink_tree::make_traits<
+                cds::opt::less< typename TestFixture::less >
+            >::type
+        > map_type;
+
+        map_type m;
+        this->test( m );
+    }
+
+    TYPED_TEST_P( BLinkTreeMap, cmpmix )
+    {
+        typedef typename TestFixture::rcu_type   rcu_type;
+        typedef typename TestFixture::key_type   key_type;
+        typedef typename TestFixture::value_type value_type;
+
+        typedef cc::BLinkTreeMap< rcu_type, key_type, value_type,
+            typename cc::blink_tree::make_traits<
+                cds::opt::less< typename TestFixture::less >
+                ,cds::opt::compare< typename TestFixture::cmp >
+            >::type
+        > map_type;
+
+        map_type m;
+        this->test( m );
+    }
+
+    TYPED_TEST_P( BLinkTreeMap, item_counting )
+    {
+        typedef typename TestFixture::rcu_type   rcu_type;
+        typedef typename TestFixture::key_type   key_type;
+        typedef typename TestFixture::value_type value_type;
+
+        struct map_traits: public cc::blink_tree::traits
+        {
+            typedef typename TestFixture::cmp compare;
+            typedef cds::atomicity::item_counter item_counter;
+        };
+        typedef cc::BLinkTreeMap< rcu_type, key_type, value_type, map_traits > map_type;
+
+        map_type m;
+        this->test( m );
+    }
+
+    TYPED_TEST_P( BLinkTreeMap, stat )
+    {
+        typedef typename TestFixture::rcu_type   rcu_type;
+        typedef typename TestFixture::key_type   key_type;
+        typedef typename TestFixture::value_type value_type;
+
+        struct map_traits: public cc::blink_tree::traits
+        {
+            typedef typename TestFixture::less less;
+            typedef cds::atomicity::item_counter item_counter;
+            typedef cc::blink_tree::stat<> stat;
+        };
+        typedef cc::BLinkTreeMap< rcu_type, key_type, value_type, map_traits > map_type;
+
+        map_type m;
+        this->test( m );
+        EXPECT_GT( m.statistics().m_nLeafSplit.get(), 0u );
+        EXPECT_GT( m.statistics().m_nRootGrow.get(), 0u );
+    }
+
+    TYPED_TEST_P( BLinkTreeMap, small_node )
+    {
+        typedef typename TestFixture::rcu_type   rcu_type;
+        typedef typename TestFixture::key_type   key_type;
+        typedef typename TestFixture::value_type value_type;
+
+        typedef cc::BLinkTreeMap< rcu_type, key_type, value_type,
+            typename cc::blink_tree::make_traits<
+                cds::opt::less< typename TestFixture::less >
+                ,cc::blink_tree::node_size< 64 >
+                ,cds::opt::item_counter< cds::atomicity::item_counter >
+                ,cds::opt::stat< cc::blink_tree::stat<>>
+            >::type
+        > map_type;
+
+        map_type m;
+        this->test( m );
+        EXPECT_GT( m.statistics().m_nInnerSplit.get(), 0u );
+    }
+
+    TYPED_TEST_P( BLinkTreeMap, mutex )
+    {
+        typedef typename TestFixture::rcu_type   rcu_type;
+        typedef typename TestFixture::key_type   key_type;
+        typedef typename TestFixture::value_type value_type;
+
+        typedef cc::BLinkTreeMap< rcu_type, key_type, value_type,
+            typename cc::blink_tree::make_traits<
+                cds::opt::compare< typename TestFixture::cmp >
+                ,cds::opt::lock_type< std::mutex >
+                ,cds::opt::memory_model< cds::opt::v::sequential_consistent >
+            >::type
+        > map_type;
+
+        map_type m;
+        this->test( m );
+    }
+
+    TYPED_TEST_P( BLinkTreeMap, leaf_unlink )
+    {
+        typedef typename TestFixture::rcu_type   rcu_type;
+        typedef typename TestFixture::key_type   key_type;
+        typedef typename TestFixture::value_type value_type;
+
+        typedef cc::BLinkTreeMap< rcu_type, key_type, value_type,
+            typename cc::blink_tree::make_traits<
+                cds::opt::less< typename TestFixture::less >
+                ,cc::blink_tree::node_size< 64 >
+                ,cds::opt::stat< cc::blink_tree::stat<>>
+            >::type
+        > map_type;
+
+        map_type m;
+        int const nSize = 1000;
+        for ( int i = 0; i < nSize; ++i )
+            ASSERT_TRUE( m.insert( key_type( i ), value_type( i )));
+
+        // Empty the leaves in the middle of the key range
+        for ( int i = nSize / 4; i < nSize / 2; ++i )
+            ASSERT_TRUE( m.erase( key_type( i )));
+        EXPECT_GT( m.statistics().m_nLeafUnlink.get(), 0u );
+        EXPECT_TRUE( m.check_consistency());
+        for ( int i = 0; i < nSize; ++i )
+            EXPECT_EQ( i < nSize / 4 || i >= nSize / 2, m.contains( key_type( i ))) << "key=" << i;
+
+        // The key range of the leaves unlinked is taken over by their left siblings
+        for ( int i = nSize / 4; i < nSize / 2; ++i )
+            ASSERT_TRUE( m.insert( key_type( i ), value_type( i )));
+        EXPECT_TRUE( m.check_consistency());
+
+        // extract_min()/extract_max() unlink the leaves emptied
+        for ( int i = 0; i < nSize / 4; ++i ) {
+            auto xp = m.extract_min();
+            ASSERT_FALSE( !xp );
+            EXPECT_EQ( i, xp->first.nKey );
+            xp = m.extract_max();
+            ASSERT_FALSE( !xp );
+            EXPECT_EQ( nSize - 1 - i, xp->first.nKey );
+        }
+        EXPECT_TRUE( m.check_consistency());
+        EXPECT_FALSE( m.empty());
+
+        m.clear();
+        EXPECT_TRUE( m.empty());
+        EXPECT_TRUE( m.check_consistency());
+        EXPECT_TRUE( !m.extract_min());
+        EXPECT_TRUE( !m.extract_max());
+
+        for ( int i = 0; i < nSize; ++i )
+            ASSERT_TRUE( m.insert( key_type( i ), value_type( i )));
+        EXPECT_FALSE( m.empty());
+        EXPECT_TRUE( m.check_consistency());
+    }
+
+    REGISTER_TYPED_TEST_CASE_P( BLinkTreeMap,
+        compare, less, cmpmix, item_counting, stat, small_node, mutex, leaf_unlink
+    );
+
+} // namespace
+
+#endif // CDSUNIT_TREE_TEST_BLINK_TREE_MAP_RCU_H
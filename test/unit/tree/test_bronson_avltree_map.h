@@ -511,6 +511,53 @@ namespace {
             ASSERT_TRUE( m.empty());
             ASSERT_CONTAINER_SIZE( m, 0 );
 
+            // erase_range
+            shuffle( arrKeys.begin(), arrKeys.end());
+            for ( auto const& i : arrKeys )
+                ASSERT_TRUE( m.insert( i, arrVals[ i.nKey ] ));
+
+            int const nLo = static_cast<int>( kkSize / 4 );
+            int const nHi = static_cast<int>( kkSize / 2 );
+            EXPECT_EQ( static_cast<size_t>( nHi - nLo ), m.erase_range( key_type( nLo ), key_type( nHi )));
+            EXPECT_EQ( 0u, m.erase_range_with( other_item( nLo ), other_item( nHi ), other_less()));
+            EXPECT_TRUE( m.check_consistency());
+            ASSERT_CONTAINER_SIZE( m, kkSize - ( nHi - nLo ));
+            for ( auto const& i : arrKeys )
+                EXPECT_EQ( i.nKey < nLo || i.nKey >= nHi, m.contains( i )) << "key=" << i.nKey;
+
+            // split/join
+            {
+                Map m2;
+                EXPECT_EQ( kkSize - nHi, m.split( key_type( nHi ), m2 ));
+                EXPECT_TRUE( m.check_consistency());
+                EXPECT_TRUE( m2.check_consistency());
+                for ( auto const& i : arrKeys ) {
+                    EXPECT_EQ( i.nKey < nLo, m.contains( i )) << "key=" << i.nKey;
+                    EXPECT_EQ( i.nKey >= nHi, m2.contains( i )) << "key=" << i.nKey;
+                }
+
+                // no item is placed in neither map without concurrent insertions
+                size_t nReported = 0;
+                EXPECT_EQ( kkSize - nHi, m.join( m2, [&nReported]( key_type const&, value_type& ) { ++nReported; } ));
+                EXPECT_EQ( nReported, 0u );
+                ASSERT_TRUE( m2.empty());
+                EXPECT_TRUE( m.check_consistency());
+                for ( auto const& i : arrKeys ) {
+                    EXPECT_EQ( i.nKey < nLo || i.nKey >= nHi, m.find( i, []( key_type const& key, value_type& v ) {
+                        EXPECT_EQ( key.nKey, v.nVal );
+                    })) << "key=" << i.nKey;
+                }
+
+                // the key already present in the destination stays in the source
+                ASSERT_TRUE( m2.insert( key_type( 0 ), arrVals[ 0 ] ));
+                EXPECT_EQ( 0u, m.join( m2 ));
+                EXPECT_TRUE( m2.contains( key_type( 0 )));
+                m2.clear();
+            }
+
+            EXPECT_EQ( kkSize - ( nHi - nLo ), m.erase_range_with( other_item( 0 ), other_item( static_cast<int>( kkSize )), other_less()));
+            ASSERT_TRUE( m.empty());
+            ASSERT_CONTAINER_SIZE( m, 0 );
         }
     };
 
@@ -743,8 +790,30 @@ namespace {
         this->test( m );
     }
 
+    TYPED_TEST_P( BronsonAVLTreeMap, optimistic_read )
+    {
+        typedef typename TestFixture::rcu_type rcu_type;
+        typedef typename TestFixture::key_type key_type;
+        typedef typename TestFixture::value_type value_type;
+
+        typedef cc::BronsonAVLTreeMap< rcu_type, key_type, value_type,
+            typename cc::bronson_avltree::make_traits<
+                cds::opt::compare< typename TestFixture::cmp >
+                ,cds::opt::item_counter< cds::atomicity::item_counter >
+                ,cds::opt::sync_monitor< cds::sync::pool_monitor< cds::memory::vyukov_queue_pool< std::mutex >>>
+                ,cds::opt::stat< cc::bronson_avltree::stat<>>
+                ,cc::bronson_avltree::optimistic_read< 8, cds::backoff::yield >
+            >::type
+        > map_type;
+        static_assert( map_type::c_bOptimisticRead, "optimistic_read is not enabled" );
+        static_assert( std::is_same< typename map_type::optimistic_back_off, cds::backoff::yield >::value, "wrong optimistic_back_off" );
+
+        map_type m;
+        this->test( m );
+    }
+
     REGISTER_TYPED_TEST_CASE_P( BronsonAVLTreeMap,
-        compare, less, cmpmix, stat, item_counting, relaxed_insert, seq_cst, sync_monitor, lazy_sync_monitor, rcu_check_deadlock, rcu_no_check_deadlock
+        compare, less, cmpmix, stat, item_counting, relaxed_insert, seq_cst, sync_monitor, lazy_sync_monitor, rcu_check_deadlock, rcu_no_check_deadlock, optimistic_read
     );
 
 } // namespace
@@ -476,6 +476,54 @@ namespace {
                 EXPECT_EQ( key.nKey, -100 );
             }
 
+            // erase_range
+            shuffle( arrKeys.begin(), arrKeys.end());
+            for ( auto const& i : arrKeys ) {
+                value_type& val( arrVals.at( i.nKey ));
+                ASSERT_TRUE( m.insert( i, &val ));
+            }
+
+            int const nLo = static_cast<int>( kkSize / 4 );
+            int const nHi = static_cast<int>( kkSize / 2 );
+            EXPECT_EQ( static_cast<size_t>( nHi - nLo ), m.erase_range( key_type( nLo ), key_type( nHi )));
+            EXPECT_EQ( 0u, m.erase_range_with( other_item( nLo ), other_item( nHi ), other_less()));
+            ASSERT_TRUE( m.check_consistency());
+            ASSERT_CONTAINER_SIZE( m, kkSize - ( nHi - nLo ));
+
+            Map::gc::force_dispose();
+            for ( auto const& item : arrVals ) {
+                EXPECT_EQ( item.nDisposeCount, item.nVal >= nLo && item.nVal < nHi ? 6u : 5u );
+            }
+
+            // split/join move the values without disposing
+            {
+                Map m2;
+                size_t nReported = 0;
+                EXPECT_EQ( kkSize - nHi, m.split( key_type( nHi ), m2, [&nReported]( key_type const&, mapped_type * ) { ++nReported; } ));
+                EXPECT_EQ( nReported, 0u );
+                ASSERT_TRUE( m.check_consistency());
+                ASSERT_TRUE( m2.check_consistency());
+                for ( auto const& i : arrKeys ) {
+                    EXPECT_EQ( i.nKey < nLo, m.contains( i )) << "key=" << i.nKey;
+                    EXPECT_EQ( i.nKey >= nHi, m2.contains( i )) << "key=" << i.nKey;
+                }
+
+                EXPECT_EQ( kkSize - nHi, m.join( m2 ));
+                ASSERT_TRUE( m2.empty());
+                ASSERT_TRUE( m.check_consistency());
+                for ( auto const& i : arrKeys )
+                    EXPECT_EQ( i.nKey < nLo || i.nKey >= nHi, m.contains( i )) << "key=" << i.nKey;
+            }
+
+            EXPECT_EQ( kkSize - ( nHi - nLo ), m.erase_range( key_type( 0 ), key_type( static_cast<int>( kkSize ))));
+            ASSERT_TRUE( m.empty());
+            ASSERT_CONTAINER_SIZE( m, 0 );
+
+            Map::gc::force_dispose();
+            for ( auto const& item : arrVals ) {
+                EXPECT_EQ( item.nDisposeCount, 6u );
+            }
+
             // checking empty map
             ASSERT_TRUE( m.check_consistency());
         }
@@ -717,8 +765,35 @@ namespace {
         this->test( m );
     }
 
+    struct bronson_optimistic_read_traits: public bronson_traits
+    {
+        static unsigned int const optimistic_read = 8;
+    };
+
+    TYPED_TEST_P( BronsonAVLTreeMapPtr, optimistic_read )
+    {
+        typedef typename TestFixture::rcu_type rcu_type;
+        typedef typename TestFixture::key_type key_type;
+        typedef typename TestFixture::value_type value_type;
+
+        struct map_traits: public bronson_optimistic_read_traits
+        {
+            typedef typename TestFixture::cmp    compare;
+            typedef cds::atomicity::item_counter item_counter;
+            typedef cds::sync::pool_monitor< cds::memory::vyukov_queue_pool< std::mutex >> sync_monitor;
+            typedef cc::bronson_avltree::stat<> stat;
+        };
+
+        typedef cc::BronsonAVLTreeMap< rcu_type, key_type, value_type*, map_traits > map_type;
+        static_assert( map_type::c_bOptimisticRead, "optimistic_read is not enabled" );
+        static_assert( std::is_same< typename map_type::optimistic_back_off, cds::backoff::Default >::value, "wrong optimistic_back_off" );
+
+        map_type m;
+        this->test( m );
+    }
+
     REGISTER_TYPED_TEST_CASE_P( BronsonAVLTreeMapPtr,
-        compare, less, cmpmix, stat, item_counting, relaxed_insert, seq_cst, sync_monitor, lazy_sync_monitor, rcu_check_deadlock, rcu_no_check_deadlock
+        compare, less, cmpmix, stat, item_counting, relaxed_insert, seq_cst, sync_monitor, lazy_sync_monitor, rcu_check_deadlock, rcu_no_check_deadlock, optimistic_read
     );
 
 
@@ -224,6 +224,28 @@ namespace {
         this->test( t );
     }
 
+    TYPED_TEST_P( IntrusiveEllenBinTree, base_cached_allocator )
+    {
+        typedef typename TestFixture::rcu_type   rcu_type;
+        typedef typename TestFixture::key_type   key_type;
+        typedef typename TestFixture::base_item_type base_item_type;
+        typedef typename TestFixture::generic_traits generic_traits;
+
+        struct tree_traits: public generic_traits
+        {
+            typedef ci::ellen_bintree::base_hook< ci::opt::gc< rcu_type >> hook;
+            typedef typename TestFixture::template less<base_item_type> less;
+            typedef cds::atomicity::item_counter item_counter;
+            typedef ci::ellen_bintree::cached_allocator<> node_allocator;
+            typedef ci::ellen_bintree::cached_allocator<> update_desc_allocator;
+        };
+
+        typedef ci::EllenBinTree< rcu_type, key_type, base_item_type, tree_traits > tree_type;
+
+        tree_type t;
+        this->test( t );
+    }
+
     // member hook
     TYPED_TEST_P( IntrusiveEllenBinTree, member_cmp )
     {
@@ -371,7 +393,7 @@ namespace {
     }
 
     REGISTER_TYPED_TEST_CASE_P( IntrusiveEllenBinTree,
-        base_cmp, base_less, base_item_counter, base_backoff, base_seq_cst, base_update_desc_pool, base_update_desc_lazy_pool, member_cmp, member_less, member_item_counter, member_backoff, member_seq_cst, member_update_desc_pool, member_update_desc_lazy_pool
+        base_cmp, base_less, base_item_counter, base_backoff, base_seq_cst, base_update_desc_pool, base_update_desc_lazy_pool, base_cached_allocator, member_cmp, member_less, member_item_counter, member_backoff, member_seq_cst, member_update_desc_pool, member_update_desc_lazy_pool
         );
 
 } // namespace
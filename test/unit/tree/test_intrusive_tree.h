@@ -461,6 +461,43 @@ namespace cds_test {
             ASSERT_FALSE( t.empty());
             ASSERT_CONTAINER_SIZE( t, nTreeSize );
 
+            // for_each_in_range
+            {
+                int nPrev = -1;
+                size_t nCount = t.for_each_in_range( 0, static_cast<int>( nTreeSize ), [&nPrev]( value_type& v ) {
+                    EXPECT_EQ( v.key(), nPrev + 1 );
+                    nPrev = v.key();
+                    ++v.nFindCount;
+                });
+                EXPECT_EQ( nCount, nTreeSize );
+                EXPECT_EQ( nPrev, static_cast<int>( nTreeSize ) - 1 );
+                for ( auto const& i : data )
+                    EXPECT_EQ( i.nFindCount, 1u );
+
+                nPrev = 9;
+                nCount = t.for_each_in_range_with( other_item( 10 ), other_item( 20 ), other_less(), [&nPrev]( value_type& v ) {
+                    EXPECT_EQ( v.key(), nPrev + 1 );
+                    nPrev = v.key();
+                });
+                EXPECT_EQ( nCount, 10u );
+                EXPECT_EQ( nPrev, 19 );
+
+                EXPECT_EQ( t.for_each_in_range( 20, 20, []( value_type& ) { ASSERT_TRUE( false ); } ), 0u );
+                EXPECT_EQ( t.for_each_in_range( 30, 20, []( value_type& ) { ASSERT_TRUE( false ); } ), 0u );
+                EXPECT_EQ( t.for_each_in_range( static_cast<int>( nTreeSize ), static_cast<int>( nTreeSize ) + 10, []( value_type& ) { ASSERT_TRUE( false ); } ), 0u );
+
+                // remove even keys from [20, 40): the range contains odd keys only
+                for ( int key = 20; key < 40; key += 2 )
+                    ASSERT_TRUE( t.unlink( data[key] ));
+                nPrev = 19;
+                nCount = t.for_each_in_range( 20, 40, [&nPrev]( value_type& v ) {
+                    EXPECT_EQ( v.key(), nPrev + 2 );
+                    nPrev = v.key();
+                });
+                EXPECT_EQ( nCount, 10u );
+                EXPECT_EQ( nPrev, 39 );
+            }
+
             // clear test
             t.clear();
 
@@ -273,6 +273,27 @@ namespace cds_test {
 
             ASSERT_TRUE( m.check_consistency());
 
+            // for_each_in_range
+            {
+                int nPrev = -1;
+                size_t nCount = m.for_each_in_range( 0, static_cast<int>( kkSize ), [&nPrev]( map_pair& v ) {
+                    EXPECT_EQ( v.first.nKey, nPrev + 1 );
+                    nPrev = v.first.nKey;
+                });
+                EXPECT_EQ( nCount, kkSize );
+                EXPECT_EQ( nPrev, static_cast<int>( kkSize ) - 1 );
+
+                nPrev = 99;
+                nCount = m.for_each_in_range_with( other_item( 100 ), other_item( 200 ), other_less(), [&nPrev]( map_pair& v ) {
+                    EXPECT_EQ( v.first.nKey, nPrev + 1 );
+                    nPrev = v.first.nKey;
+                });
+                EXPECT_EQ( nCount, 100u );
+                EXPECT_EQ( nPrev, 199 );
+
+                EXPECT_EQ( m.for_each_in_range( 200, 100, []( map_pair& ) { ASSERT_TRUE( false ); } ), 0u );
+            }
+
             shuffle( arrKeys.begin(), arrKeys.end());
 
             // erase/find
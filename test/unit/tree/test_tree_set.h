@@ -409,6 +409,27 @@ namespace cds_test {
 
             ASSERT_TRUE( s.check_consistency());
 
+            // for_each_in_range
+            {
+                int nPrev = -1;
+                size_t nCount = s.for_each_in_range( 0, static_cast<int>( nSetSize ), [&nPrev]( value_type& v ) {
+                    EXPECT_EQ( v.key(), nPrev + 1 );
+                    nPrev = v.key();
+                });
+                EXPECT_EQ( nCount, nSetSize );
+                EXPECT_EQ( nPrev, static_cast<int>( nSetSize ) - 1 );
+
+                nPrev = 99;
+                nCount = s.for_each_in_range_with( other_item( 100 ), other_item( 200 ), other_less(), [&nPrev]( value_type& v ) {
+                    EXPECT_EQ( v.key(), nPrev + 1 );
+                    nPrev = v.key();
+                });
+                EXPECT_EQ( nCount, 100u );
+                EXPECT_EQ( nPrev, 199 );
+
+                EXPECT_EQ( s.for_each_in_range( 200, 100, []( value_type& ) { ASSERT_TRUE( false ); } ), 0u );
+            }
+
             // erase
             shuffle( indices.begin(), indices.end());
             for ( auto idx : indices ) {